@@ -0,0 +1,221 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "Vector.h"
+#include "SmallVector.h"
+#include "TypeManager.h"
+#include "Entity.h"
+#include "ActionList.h"
+#include "ActionIncrement.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+#include "MemoryResource.h"
+#include <json/json.h>
+#include <sstream>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Writes one string attribute in the JSON table format.
+	/// </summary>
+	static void WriteString(ostringstream& json, const string& name, const string& value)
+	{
+		json << "\"" << name << "\": { \"type\": \"string\", \"value\": \"" << value << "\" }";
+	}
+
+	/// <summary>
+	/// Builds content shaped like TestWorld.json: a world Entity whose sector Entities each hold a few child Entities
+	/// and an ActionList of ActionIncrements, which is the mix of small Scopes a level file is made of.
+	/// </summary>
+	static string MakeWorldJson(size_t sectorCount, size_t childrenPerSector)
+	{
+		ostringstream json;
+		json << "{ ";
+		WriteString(json, "Name", "World");
+		json << ", \"Children\": { \"type\": \"table\", \"value\": [";
+		for (size_t sector = 0; sector < sectorCount; ++sector)
+		{
+			json << (sector > 0 ? ", " : "") << "{ \"type\": \"table\", \"class\": \"Entity\", \"value\": { ";
+			WriteString(json, "Name", "Sector " + to_string(sector));
+
+			json << ", \"Children\": { \"type\": \"table\", \"value\": [";
+			for (size_t child = 0; child < childrenPerSector; ++child)
+			{
+				json << (child > 0 ? ", " : "") << "{ \"type\": \"table\", \"class\": \"Entity\", \"value\": { ";
+				WriteString(json, "Name", "Entity " + to_string(child));
+				json << ", \"X\": { \"type\": \"integer\", \"value\": 0 } } }";
+			}
+			json << "] }";
+
+			json << ", \"Actions\": { \"type\": \"table\", \"value\": [ { \"type\": \"table\", \"class\": \"ActionList\", \"value\": { ";
+			WriteString(json, "Name", "Update");
+			json << ", \"Actions\": { \"type\": \"table\", \"value\": [";
+			for (size_t child = 0; child < childrenPerSector; ++child)
+			{
+				json << (child > 0 ? ", " : "") << "{ \"type\": \"table\", \"class\": \"ActionIncrement\", \"value\": { ";
+				WriteString(json, "Name", "Increment " + to_string(child));
+				json << ", ";
+				WriteString(json, "Target", "X");
+				json << ", \"Step\": { \"type\": \"integer\", \"value\": 1 } } }";
+			}
+			json << "] } } } ] } } }";
+		}
+		json << "] } }";
+
+		return json.str();
+	}
+
+	/// <summary>
+	/// Builds a Scope with childCount nested Scopes of a few attributes each, all allocating from resource.
+	/// </summary>
+	static void BuildScopeTree(MemoryResource* resource, size_t childCount)
+	{
+		Scope root(11_z, resource);
+		for (size_t i = 0; i < childCount; ++i)
+		{
+			Scope& child = root.AppendScope("Child");
+			child.Append("Name") = "Entity";
+			child.Append("X") = static_cast<int>(i);
+			child.Append("Y") = static_cast<int>(i);
+		}
+		DoNotOptimize(root.Size());
+	}
+
+	/// <summary>
+	/// Counts the allocations made building containerCount containers of elementCount pointers each.
+	/// </summary>
+	template<typename TContainer>
+	static optional<size_t> CountContainerAllocations(size_t containerCount, size_t elementCount)
+	{
+		return CountAllocations([containerCount, elementCount]
+		{
+			for (size_t i = 0; i < containerCount; ++i)
+			{
+				TContainer container;
+				for (size_t j = 0; j < elementCount; ++j)
+				{
+					container.PushBack(nullptr);
+				}
+				DoNotOptimize(container.Size());
+			}
+		});
+	}
+
+	/// <summary>
+	/// Prints an allocation count as allocations per item.
+	/// </summary>
+	static void ReportAllocations(const string& name, size_t count, optional<size_t> allocations, size_t items = 1)
+	{
+		Report("Allocations", name, count, static_cast<double>(*allocations) / static_cast<double>(items), "allocs");
+	}
+
+	void RunAllocationBenchmarks()
+	{
+		BeginSuite("Allocations");
+
+		if (!AllocationCount().has_value())
+		{
+			cout << "Skipped: this build cannot count allocations. Run the Debug configuration." << endl;
+			return;
+		}
+
+		const size_t containerCount = 1000;
+		for (const size_t elementCount : { 3_z, 4_z, 8_z })
+		{
+			ReportAllocations("PushBack/Vector", elementCount, CountContainerAllocations<Vector<Scope::PairType*>>(containerCount, elementCount), containerCount);
+			ReportAllocations("PushBack/SmallVector<4>", elementCount, CountContainerAllocations<SmallVector<Scope::PairType*, 4>>(containerCount, elementCount), containerCount);
+		}
+
+		TypeManager::AddType(Entity::TypeIdClass(), Entity::Signatures());
+		TypeManager::AddType(Action::TypeIdClass(), Action::Signatures());
+		TypeManager::AddType(ActionList::TypeIdClass(), ActionList::Signatures());
+		TypeManager::AddType(ActionIncrement::TypeIdClass(), ActionIncrement::Signatures());
+
+		for (const size_t childCount : { 8_z, 64_z })
+		{
+			ReportAllocations("BuildScopeTree/Default", childCount, CountAllocations([childCount] { BuildScopeTree(nullptr, childCount); }));
+			ReportAllocations("BuildScopeTree/Monotonic", childCount, CountAllocations([childCount]
+			{
+				MonotonicResource resource(64_z * 1024_z);
+				BuildScopeTree(&resource, childCount);
+			}));
+			ReportAllocations("BuildScopeTree/Pool", childCount, CountAllocations([childCount]
+			{
+				PoolResource resource;
+				BuildScopeTree(&resource, childCount);
+			}));
+		}
+
+		{
+			// Long enough to defeat the small string optimization, so copying a name costs an allocation.
+			vector<string> names;
+			for (size_t i = 0; i < 64_z; ++i)
+			{
+				names.push_back("AttributeWithALongName" + to_string(i));
+			}
+
+			Scope scope(128_z);
+			ReportAllocations("Append/New", names.size(), CountAllocations([&scope, &names]
+			{
+				for (const string& name : names)
+				{
+					scope.Append(name);
+				}
+			}), names.size());
+			ReportAllocations("Append/Existing", names.size(), CountAllocations([&scope, &names]
+			{
+				for (const string& name : names)
+				{
+					scope.Append(name);
+				}
+			}), names.size());
+
+			scope.Clear();
+			ReportAllocations("Append/NewMoved", names.size(), CountAllocations([&scope, &names]
+			{
+				for (string& name : names)
+				{
+					scope.Append(std::move(name));
+				}
+			}), names.size());
+		}
+
+		{
+			ReportAllocations("Construct/Scope", 1, CountAllocations([] { Scope scope; }));
+			ReportAllocations("Construct/ActionIncrement", 1, CountAllocations([] { ActionIncrement action; }));
+			ReportAllocations("Construct/Entity", 1, CountAllocations([] { Entity entity; }));
+		}
+
+		{
+			EntityFactory entityFactory;
+			ActionListFactory actionListFactory;
+			ActionIncrementFactory actionIncrementFactory;
+
+			for (const size_t sectorCount : { 3_z, 32_z })
+			{
+				const string json = MakeWorldJson(sectorCount, 4_z);
+
+				ReportAllocations("LoadWorld/JsonOnly", sectorCount, CountAllocations([&json]
+				{
+					istringstream stream(json);
+					Json::Value root;
+					stream >> root;
+				}));
+
+				ReportAllocations("LoadWorld", sectorCount, CountAllocations([&json]
+				{
+					Entity world;
+					JsonTableParseHelper::SharedData sharedData(world);
+					JsonParseCoordinator parseCoordinator(sharedData);
+					JsonTableParseHelper parseHelper;
+					parseCoordinator.AddHelper(parseHelper);
+					parseCoordinator.Parse(json);
+				}));
+			}
+		}
+
+		TypeManager::Clear();
+	}
+}
@@ -0,0 +1,175 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include <atomic>
+#include <iomanip>
+
+#if defined(_MSC_VER)
+#include <crtdbg.h>
+#endif
+
+namespace Benchmarks
+{
+	static volatile std::size_t sSink;
+	static std::atomic<std::size_t> sAllocationCount{ 0 };
+	static ReportFormat sReportFormat{ ReportFormat::Text };
+
+	/// <summary>
+	/// Writes text as a JSON string literal, escaping the characters JSON requires.
+	/// </summary>
+	static void WriteJsonString(std::ostream& stream, const std::string& text)
+	{
+		stream << '"';
+		for (const char c : text)
+		{
+			if (c == '"' || c == '\\')
+			{
+				stream << '\\' << c;
+			}
+			else if (static_cast<unsigned char>(c) < 0x20)
+			{
+				stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec << std::setfill(' ');
+			}
+			else
+			{
+				stream << c;
+			}
+		}
+		stream << '"';
+	}
+
+	/// <summary>
+	/// Writes text as one CSV field, quoted only when it contains a comma, a quote or a line break.
+	/// </summary>
+	static void WriteCsvField(std::ostream& stream, const std::string& text)
+	{
+		if (text.find_first_of(",\"\r\n") == std::string::npos)
+		{
+			stream << text;
+			return;
+		}
+
+		stream << '"';
+		for (const char c : text)
+		{
+			if (c == '"')
+			{
+				stream << '"';
+			}
+			stream << c;
+		}
+		stream << '"';
+	}
+
+	void SetReportFormat(ReportFormat format)
+	{
+		sReportFormat = format;
+		if (format == ReportFormat::Csv)
+		{
+			std::cout << "suite,name,count,value,unit" << std::endl;
+		}
+	}
+
+	void Report(const std::string& suite, const std::string& name, std::size_t count, double value, const std::string& unit)
+	{
+		switch (sReportFormat)
+		{
+		case ReportFormat::Csv:
+			WriteCsvField(std::cout, suite);
+			std::cout << ',';
+			WriteCsvField(std::cout, name);
+			std::cout << ',' << count << ',' << std::fixed << std::setprecision(3) << value << ',';
+			WriteCsvField(std::cout, unit);
+			std::cout << std::endl;
+			break;
+
+		case ReportFormat::Json:
+			std::cout << "{\"suite\":";
+			WriteJsonString(std::cout, suite);
+			std::cout << ",\"name\":";
+			WriteJsonString(std::cout, name);
+			std::cout << ",\"count\":" << count << ",\"value\":" << std::fixed << std::setprecision(3) << value << ",\"unit\":";
+			WriteJsonString(std::cout, unit);
+			std::cout << "}" << std::endl;
+			break;
+
+		default:
+			std::cout << std::left << std::setw(12) << suite << std::setw(48) << name
+				<< std::right << std::setw(10) << count
+				<< std::setw(14) << std::fixed << std::setprecision(2) << value << " " << unit << std::endl;
+			break;
+		}
+	}
+
+	void BeginSuite(const std::string& suite)
+	{
+		if (sReportFormat == ReportFormat::Text)
+		{
+			std::cout << std::endl << "== " << suite << " ==" << std::endl;
+		}
+	}
+
+	void DoNotOptimize(std::size_t value)
+	{
+		sSink = sSink + value;
+	}
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+	/// <summary>
+	/// Debug CRT hook, called for every heap operation. Counts allocations and reallocations.
+	/// </summary>
+	static int CountAllocationHook(int allocationType, void*, std::size_t, int, long, const unsigned char*, int)
+	{
+		if (allocationType == _HOOK_ALLOC || allocationType == _HOOK_REALLOC)
+		{
+			sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		return 1;
+	}
+
+	std::optional<std::size_t> AllocationCount()
+	{
+		static const _CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocationHook);
+		UNREFERENCED_LOCAL(previousHook);
+		return sAllocationCount.load(std::memory_order_relaxed);
+	}
+#elif defined(__GLIBC__)
+	std::optional<std::size_t> AllocationCount()
+	{
+		return sAllocationCount.load(std::memory_order_relaxed);
+	}
+#else
+	std::optional<std::size_t> AllocationCount()
+	{
+		return std::nullopt;
+	}
+#endif
+}
+
+#if !defined(_MSC_VER) && defined(__GLIBC__)
+// glibc lets a program replace the allocation functions; these count the call and forward to the real allocator.
+// operator new is implemented on top of malloc, so it is counted too.
+extern "C"
+{
+	void* __libc_malloc(std::size_t size);
+	void* __libc_calloc(std::size_t count, std::size_t size);
+	void* __libc_realloc(void* pointer, std::size_t size);
+
+	void* malloc(std::size_t size) noexcept
+	{
+		Benchmarks::sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		return __libc_malloc(size);
+	}
+
+	void* calloc(std::size_t count, std::size_t size) noexcept
+	{
+		Benchmarks::sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		return __libc_calloc(count, size);
+	}
+
+	void* realloc(void* pointer, std::size_t size) noexcept
+	{
+		Benchmarks::sAllocationCount.fetch_add(1, std::memory_order_relaxed);
+		return __libc_realloc(pointer, size);
+	}
+}
+#endif
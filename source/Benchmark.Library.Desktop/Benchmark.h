@@ -0,0 +1,139 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Times a single pass of func and returns the average number of nanoseconds spent per operation.
+	/// The pass is repeated until at least MinimumDuration has elapsed so small sizes are not lost in timer noise.
+	/// </summary>
+	/// <typeparam name="TFunc">Callable taking no arguments that performs operations units of work.</typeparam>
+	/// <param name="operations">Number of operations performed by one call to func.</param>
+	/// <param name="func">The work to be timed.</param>
+	/// <returns>Average nanoseconds per operation.</returns>
+	template<typename TFunc>
+	double Measure(std::size_t operations, TFunc&& func);
+
+	/// <summary>
+	/// Times setup-dependent work. setup runs before every pass and is excluded from the measurement.
+	/// </summary>
+	/// <typeparam name="TSetup">Callable taking no arguments that prepares state for the next pass.</typeparam>
+	/// <typeparam name="TFunc">Callable taking no arguments that performs operations units of work.</typeparam>
+	/// <param name="operations">Number of operations performed by one call to func.</param>
+	/// <param name="setup">Untimed preparation for each pass.</param>
+	/// <param name="func">The work to be timed.</param>
+	/// <returns>Average nanoseconds per operation.</returns>
+	template<typename TSetup, typename TFunc>
+	double Measure(std::size_t operations, TSetup&& setup, TFunc&& func);
+
+	/// <summary>
+	/// How Report writes its results.
+	/// </summary>
+	enum class ReportFormat
+	{
+		/// <summary>
+		/// Aligned columns under a header per suite, for reading.
+		/// </summary>
+		Text,
+		/// <summary>
+		/// A header line, then one comma-separated row per result: suite,name,count,value,unit.
+		/// </summary>
+		Csv,
+		/// <summary>
+		/// One JSON object per line, with the same fields as the CSV rows.
+		/// </summary>
+		Json
+	};
+
+	/// <summary>
+	/// Chooses how every following Report is written. Text unless changed.
+	/// </summary>
+	/// <param name="format">The format to write results in.</param>
+	void SetReportFormat(ReportFormat format);
+
+	/// <summary>
+	/// Prints one result row.
+	/// </summary>
+	/// <param name="suite">Name of the group of benchmarks, e.g. "HashMap".</param>
+	/// <param name="name">Name of the individual benchmark, e.g. "Insert/Flat".</param>
+	/// <param name="count">Element count the benchmark was run with.</param>
+	/// <param name="value">Result of Measure, or any other measured quantity.</param>
+	/// <param name="unit">Unit printed after the value.</param>
+	void Report(const std::string& suite, const std::string& name, std::size_t count, double value, const std::string& unit = "ns/op");
+
+	/// <summary>
+	/// Prints the header for a suite of results. Only the Text format has suite headers; the other formats name the suite in every row.
+	/// </summary>
+	/// <param name="suite">Name of the group of benchmarks.</param>
+	void BeginSuite(const std::string& suite);
+
+	/// <summary>
+	/// Keeps value alive so the optimizer cannot discard the work that produced it.
+	/// </summary>
+	/// <param name="value">Any result of the timed work.</param>
+	void DoNotOptimize(std::size_t value);
+
+	/// <summary>
+	/// Number of heap allocations the process has made so far: every malloc, calloc, realloc and operator new.
+	/// The runtime has to let the benchmark observe allocations, which the MSVC debug CRT and glibc do.
+	/// </summary>
+	/// <returns>The running allocation count, or nothing if this build cannot count allocations.</returns>
+	std::optional<std::size_t> AllocationCount();
+
+	/// <summary>
+	/// Counts the heap allocations made while running func.
+	/// </summary>
+	/// <typeparam name="TFunc">Callable taking no arguments.</typeparam>
+	/// <param name="func">The work to be counted.</param>
+	/// <returns>The number of allocations made by func, or nothing if this build cannot count allocations.</returns>
+	template<typename TFunc>
+	std::optional<std::size_t> CountAllocations(TFunc&& func);
+
+	/// <summary>
+	/// Minimum wall-clock time spent measuring one benchmark.
+	/// </summary>
+	inline constexpr std::chrono::milliseconds MinimumDuration{ 200 };
+
+	template<typename TFunc>
+	inline double Measure(std::size_t operations, TFunc&& func)
+	{
+		return Measure(operations, [] {}, func);
+	}
+
+	template<typename TFunc>
+	inline std::optional<std::size_t> CountAllocations(TFunc&& func)
+	{
+		const std::optional<std::size_t> before = AllocationCount();
+		func();
+		const std::optional<std::size_t> after = AllocationCount();
+
+		if (!before.has_value() || !after.has_value())
+		{
+			return std::nullopt;
+		}
+		return *after - *before;
+	}
+
+	template<typename TSetup, typename TFunc>
+	inline double Measure(std::size_t operations, TSetup&& setup, TFunc&& func)
+	{
+		using Clock = std::chrono::steady_clock;
+
+		std::chrono::nanoseconds elapsed{ 0 };
+		std::size_t passes = 0;
+		do
+		{
+			setup();
+			const auto start = Clock::now();
+			func();
+			elapsed += std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+			++passes;
+		} while (elapsed < MinimumDuration);
+
+		return static_cast<double>(elapsed.count()) / static_cast<double>(passes * operations);
+	}
+}
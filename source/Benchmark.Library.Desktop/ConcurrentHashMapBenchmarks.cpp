@@ -0,0 +1,111 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "ConcurrentHashMap.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	using RegistryMap = ConcurrentHashMap<size_t, size_t>;
+
+	/// <summary>
+	/// Number of keys registered before the readers start, roughly the number of types and factories a game registers.
+	/// </summary>
+	constexpr size_t RegisteredCount = 256;
+
+	/// <summary>
+	/// Number of lookups each reader thread performs.
+	/// </summary>
+	constexpr size_t ReadsPerThread = 200000;
+
+	/// <summary>
+	/// Runs readerCount threads looking up registered keys while writerCount threads keep registering and removing other keys,
+	/// the way worker threads would construct Attributed objects while a loader registers types.
+	/// </summary>
+	/// <returns>Wall-clock nanoseconds per lookup, across all readers.</returns>
+	static double MeasureReads(RegistryMap& map, size_t readerCount, size_t writerCount)
+	{
+		using Clock = chrono::steady_clock;
+
+		atomic<size_t> ready{ 0 };
+		atomic<bool> start{ false };
+		atomic<size_t> readersLeft{ readerCount };
+		vector<thread> threads;
+
+		for (size_t writer = 0; writer < writerCount; ++writer)
+		{
+			threads.emplace_back([&map, &ready, &start, &readersLeft, writer]
+			{
+				++ready;
+				while (!start.load(memory_order_acquire)) {}
+
+				// Writer keys sit above the registered ones, so readers always find what they look for.
+				const size_t base = RegisteredCount + (writer + 1) * 1000000;
+				size_t i = 0;
+				while (readersLeft.load(memory_order_relaxed) > 0)
+				{
+					map.TryEmplace(base + i % 64, i);
+					map.Remove(base + (i + 32) % 64);
+					++i;
+				}
+			});
+		}
+
+		for (size_t reader = 0; reader < readerCount; ++reader)
+		{
+			threads.emplace_back([&map, &ready, &start, &readersLeft, reader]
+			{
+				++ready;
+				while (!start.load(memory_order_acquire)) {}
+
+				size_t sum = 0;
+				for (size_t i = 0; i < ReadsPerThread; ++i)
+				{
+					const size_t* value = map.Find((i * 7 + reader) % RegisteredCount);
+					sum += (value != nullptr) ? *value : 0;
+				}
+				DoNotOptimize(sum);
+				--readersLeft;
+			});
+		}
+
+		while (ready.load() < threads.size()) {}
+		const auto begin = Clock::now();
+		start.store(true, memory_order_release);
+		while (readersLeft.load() > 0) {}
+		const auto elapsed = chrono::duration_cast<chrono::nanoseconds>(Clock::now() - begin);
+
+		for (thread& worker : threads)
+		{
+			worker.join();
+		}
+
+		return static_cast<double>(elapsed.count()) / static_cast<double>(readerCount * ReadsPerThread);
+	}
+
+	void RunConcurrentHashMapBenchmarks()
+	{
+		BeginSuite("Concurrent");
+
+		const size_t hardwareThreads = max(thread::hardware_concurrency(), 2u);
+		for (const size_t shardCount : { 1_z, RegistryMap::DefaultShardCount })
+		{
+			RegistryMap map(shardCount);
+			for (size_t i = 0; i < RegisteredCount; ++i)
+			{
+				map.TryEmplace(i, i);
+			}
+
+			const string label = (shardCount == 1_z) ? "SingleLock" : "Sharded";
+			for (size_t readerCount = 1; readerCount <= hardwareThreads; readerCount *= 2)
+			{
+				Report("Concurrent", "Read/" + label, readerCount, MeasureReads(map, readerCount, 0_z));
+				Report("Concurrent", "ReadWhileWriting/" + label, readerCount, MeasureReads(map, readerCount, 2_z));
+			}
+		}
+	}
+}
@@ -0,0 +1,365 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "HashMap.h"
+#include "SList.h"
+#include "Vector.h"
+#include <list>
+#include <type_traits>
+#include <unordered_map>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Number of Find and Remove calls per pass. Both are linear in the sequence containers, so they are sampled rather than run count times.
+	/// </summary>
+	constexpr size_t MaxProbes = 256;
+
+#pragma region Sequence adapters
+	// Give the engine containers and their std equivalents one spelling, so each workload below is written once and runs on both.
+
+	template<typename T>
+	static void Append(Vector<T>& container, const T& value)
+	{
+		container.PushBack(value);
+	}
+
+	template<typename T>
+	static void Append(vector<T>& container, const T& value)
+	{
+		container.push_back(value);
+	}
+
+	template<typename T>
+	static void Append(SList<T>& container, const T& value)
+	{
+		container.PushBack(value);
+	}
+
+	template<typename T>
+	static void Append(list<T>& container, const T& value)
+	{
+		container.push_back(value);
+	}
+
+	template<typename T>
+	static void Reserve(Vector<T>& container, size_t capacity)
+	{
+		container.Reserve(capacity);
+	}
+
+	template<typename T>
+	static void Reserve(vector<T>& container, size_t capacity)
+	{
+		container.reserve(capacity);
+	}
+
+	template<typename T>
+	static bool Contains(const Vector<T>& container, const T& value)
+	{
+		return container.Find(value) != container.end();
+	}
+
+	template<typename T>
+	static bool Contains(const SList<T>& container, const T& value)
+	{
+		return container.Find(value) != container.end();
+	}
+
+	template<typename TStdContainer, typename T>
+	static bool Contains(const TStdContainer& container, const T& value)
+	{
+		return find(container.begin(), container.end(), value) != container.end();
+	}
+
+	template<typename T>
+	static bool RemoveFirst(Vector<T>& container, const T& value)
+	{
+		return container.Remove(value);
+	}
+
+	template<typename T>
+	static bool RemoveFirst(SList<T>& container, const T& value)
+	{
+		return container.Remove(value);
+	}
+
+	template<typename TStdContainer, typename T>
+	static bool RemoveFirst(TStdContainer& container, const T& value)
+	{
+		const auto position = find(container.begin(), container.end(), value);
+		if (position == container.end())
+		{
+			return false;
+		}
+
+		container.erase(position);
+		return true;
+	}
+#pragma endregion
+
+#pragma region Map adapters
+	template<typename TKey, typename TValue>
+	static void Insert(HashMap<TKey, TValue>& map, const TKey& key, const TValue& value)
+	{
+		map.Insert(make_pair(key, value));
+	}
+
+	template<typename TKey, typename TValue>
+	static void Insert(unordered_map<TKey, TValue>& map, const TKey& key, const TValue& value)
+	{
+		map.insert(make_pair(key, value));
+	}
+
+	template<typename TKey, typename TValue>
+	static TValue& At(HashMap<TKey, TValue>& map, const TKey& key)
+	{
+		return map.Find(key)->second;
+	}
+
+	template<typename TKey, typename TValue>
+	static TValue& At(unordered_map<TKey, TValue>& map, const TKey& key)
+	{
+		return map.find(key)->second;
+	}
+
+	template<typename TKey, typename TValue>
+	static bool Contains(const HashMap<TKey, TValue>& map, const TKey& key)
+	{
+		return map.ContainsKey(key);
+	}
+
+	template<typename TKey, typename TValue>
+	static bool Contains(const unordered_map<TKey, TValue>& map, const TKey& key)
+	{
+		return map.find(key) != map.end();
+	}
+
+	template<typename TKey, typename TValue>
+	static void Erase(HashMap<TKey, TValue>& map, const TKey& key)
+	{
+		map.Remove(key);
+	}
+
+	template<typename TKey, typename TValue>
+	static void Erase(unordered_map<TKey, TValue>& map, const TKey& key)
+	{
+		map.erase(key);
+	}
+
+	template<typename TKey, typename TValue>
+	static void Presize(HashMap<TKey, TValue>& map, size_t count)
+	{
+		map = HashMap<TKey, TValue>(count);
+	}
+
+	template<typename TKey, typename TValue>
+	static void Presize(unordered_map<TKey, TValue>& map, size_t count)
+	{
+		map = unordered_map<TKey, TValue>();
+		map.reserve(count);
+	}
+#pragma endregion
+
+	/// <summary>
+	/// Runs the sequence workload on one container type: appending with and without a reservation, Find and Remove of values spread
+	/// through the sequence, and a full iteration.
+	/// </summary>
+	/// <param name="label">Name of the container in the results, e.g. "Vector" or "std::vector".</param>
+	/// <param name="values">The elements, in the order they are appended.</param>
+	template<typename TContainer>
+	static void RunSequenceBenchmarks(const string& label, const vector<int>& values)
+	{
+		const size_t count = values.size();
+
+		Report("Containers", "PushBack/" + label, count, Measure(count, [&values]
+		{
+			TContainer container;
+			for (const int value : values)
+			{
+				Append(container, value);
+			}
+			DoNotOptimize(container.begin() != container.end());
+		}));
+
+		if constexpr (is_same_v<TContainer, Vector<int>> || is_same_v<TContainer, vector<int>>)
+		{
+			Report("Containers", "PushBackReserved/" + label, count, Measure(count, [&values]
+			{
+				TContainer container;
+				Reserve(container, values.size());
+				for (const int value : values)
+				{
+					Append(container, value);
+				}
+				DoNotOptimize(container.begin() != container.end());
+			}));
+		}
+
+		TContainer source;
+		for (const int value : values)
+		{
+			Append(source, value);
+		}
+
+		const size_t probeCount = min(count, MaxProbes);
+		vector<int> probes;
+		for (size_t i = 0; i < probeCount; ++i)
+		{
+			probes.push_back(values[i * count / probeCount]);
+		}
+
+		Report("Containers", "Find/" + label, count, Measure(probeCount, [&source, &probes]
+		{
+			size_t found = 0;
+			for (const int probe : probes)
+			{
+				found += Contains(source, probe);
+			}
+			DoNotOptimize(found);
+		}));
+
+		TContainer container;
+		Report("Containers", "Remove/" + label, count, Measure(probeCount, [&container, &source] { container = source; }, [&container, &probes]
+		{
+			size_t removed = 0;
+			for (const int probe : probes)
+			{
+				removed += RemoveFirst(container, probe);
+			}
+			DoNotOptimize(removed);
+		}));
+
+		Report("Containers", "Iterate/" + label, count, Measure(count, [&source]
+		{
+			size_t total = 0;
+			for (const int value : source)
+			{
+				total += static_cast<size_t>(value);
+			}
+			DoNotOptimize(total);
+		}));
+	}
+
+	/// <summary>
+	/// Runs the map workload on one map type: inserting into a default-sized and a presized map, finding present and absent keys,
+	/// and erasing every key.
+	/// </summary>
+	/// <param name="label">Name of the map in the results, e.g. "HashMap/string" or "std::unordered_map/string".</param>
+	/// <param name="keys">The keys, in the order they are inserted.</param>
+	/// <param name="missingKeys">Keys that are never inserted.</param>
+	template<typename TMap, typename TKey>
+	static void RunMapBenchmarks(const string& label, const vector<TKey>& keys, const vector<TKey>& missingKeys)
+	{
+		const size_t count = keys.size();
+
+		TMap map;
+		Report("Containers", "Insert/" + label, count, Measure(count, [&map] { map = TMap(); }, [&map, &keys]
+		{
+			size_t value = 0;
+			for (const TKey& key : keys)
+			{
+				Insert(map, key, value++);
+			}
+		}));
+
+		Report("Containers", "InsertPresized/" + label, count, Measure(count, [&map, count] { Presize(map, count); }, [&map, &keys]
+		{
+			size_t value = 0;
+			for (const TKey& key : keys)
+			{
+				Insert(map, key, value++);
+			}
+		}));
+
+		Report("Containers", "FindHit/" + label, count, Measure(count, [&map, &keys]
+		{
+			size_t total = 0;
+			for (const TKey& key : keys)
+			{
+				total += At(map, key);
+			}
+			DoNotOptimize(total);
+		}));
+
+		Report("Containers", "FindMiss/" + label, count, Measure(count, [&map, &missingKeys]
+		{
+			size_t found = 0;
+			for (const TKey& key : missingKeys)
+			{
+				found += Contains(map, key);
+			}
+			DoNotOptimize(found);
+		}));
+
+		const TMap source = map;
+		Report("Containers", "Erase/" + label, count, Measure(count, [&map, &source] { map = source; }, [&map, &keys]
+		{
+			for (const TKey& key : keys)
+			{
+				Erase(map, key);
+			}
+		}));
+	}
+
+	/// <summary>
+	/// Makes count distinct keys numbered from first, in a fixed shuffled order so every run inserts and probes in the same order.
+	/// Integer keys are scattered, so a hash that passes integers through unchanged does not get an easy run of consecutive keys.
+	/// </summary>
+	template<typename TKey>
+	static vector<TKey> MakeShuffledKeys(size_t count, size_t first)
+	{
+		vector<TKey> keys;
+		keys.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			if constexpr (is_same_v<TKey, string>)
+			{
+				keys.push_back("Key" + to_string(first + i));
+			}
+			else
+			{
+				keys.push_back(static_cast<TKey>((first + i) * 2654435761u));
+			}
+		}
+
+		shuffle(keys.begin(), keys.end(), mt19937_64(count));
+		return keys;
+	}
+
+	void RunContainerBenchmarks()
+	{
+		BeginSuite("Containers");
+
+		for (const size_t count : { 16_z, 1024_z, 65536_z })
+		{
+			vector<int> values(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] = static_cast<int>(i);
+			}
+			shuffle(values.begin(), values.end(), mt19937_64(count));
+
+			RunSequenceBenchmarks<Vector<int>>("Vector", values);
+			RunSequenceBenchmarks<vector<int>>("std::vector", values);
+			// std::forward_list has no push_back, so SList is measured against std::list.
+			RunSequenceBenchmarks<SList<int>>("SList", values);
+			RunSequenceBenchmarks<list<int>>("std::list", values);
+		}
+
+		for (const size_t count : { 10_z, 1000_z, 100000_z })
+		{
+			const vector<size_t> keys = MakeShuffledKeys<size_t>(count, 0_z);
+			const vector<size_t> missingKeys = MakeShuffledKeys<size_t>(count, count);
+			RunMapBenchmarks<HashMap<size_t, size_t>>("HashMap/size_t", keys, missingKeys);
+			RunMapBenchmarks<unordered_map<size_t, size_t>>("std::unordered_map/size_t", keys, missingKeys);
+
+			const vector<string> stringKeys = MakeShuffledKeys<string>(count, 0_z);
+			const vector<string> missingStringKeys = MakeShuffledKeys<string>(count, count);
+			RunMapBenchmarks<HashMap<string, size_t>>("HashMap/string", stringKeys, missingStringKeys);
+			RunMapBenchmarks<unordered_map<string, size_t>>("std::unordered_map/string", stringKeys, missingStringKeys);
+		}
+	}
+}
@@ -0,0 +1,342 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "Datum.h"
+#include "DatumMath.h"
+#include "SimdMath.h"
+#include "TextConversion.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+#include <json/json.h>
+#include <sstream>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Builds a Float Datum holding count values and a Vector Datum holding count vectors.
+	/// </summary>
+	static pair<Datum, Datum> MakeDatums(size_t count)
+	{
+		Datum floats;
+		floats.SetType(Datum::DatumTypes::Float);
+		floats.Resize(count);
+		Datum vectors;
+		vectors.SetType(Datum::DatumTypes::Vector);
+		vectors.Resize(count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			floats.GetFloat(i) = static_cast<float>(i);
+			vectors.GetVector(i) = glm::vec4(static_cast<float>(i));
+		}
+
+		return make_pair(std::move(floats), std::move(vectors));
+	}
+
+	/// <summary>
+	/// Times each SimdMath kernel the processor supports on the same Datums, against the loop a system would write with Get.
+	/// Results are per element: per float for Scale and Sum, per vector for MultiplyAdd and Transform, per int for Convert.
+	/// </summary>
+	static void RunMathBenchmarks(size_t count)
+	{
+		auto [floats, positions] = MakeDatums(count);
+		Datum velocities = MakeDatums(count).second;
+		Datum ints;
+		ints.SetType(Datum::DatumTypes::Integer);
+		ints.Resize(count);
+		Datum converted;
+		converted.SetType(Datum::DatumTypes::Float);
+		converted.Resize(count);
+		const glm::mat4 rotation(0.0f, 1.0f, 0.0f, 0.0f, -1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f);
+
+		Report("Datum", "MultiplyAdd/Get", count, Measure(count, [&positions, &velocities]
+		{
+			for (size_t i = 0; i < positions.Size(); ++i)
+			{
+				positions.GetVector(i) += velocities.GetVector(i) * 0.016f;
+			}
+			DoNotOptimize(static_cast<size_t>(positions.GetVector(0).x));
+		}));
+
+		Report("Datum", "Transform/Get", count, Measure(count, [&positions, &rotation]
+		{
+			for (size_t i = 0; i < positions.Size(); ++i)
+			{
+				positions.GetVector(i) = rotation * positions.GetVector(i);
+			}
+			DoNotOptimize(static_cast<size_t>(positions.GetVector(0).x));
+		}));
+
+		const pair<SimdLevel, const char*> levels[] = { { SimdLevel::Scalar, "/Scalar" }, { SimdLevel::SSE2, "/SSE2" }, { SimdLevel::AVX2, "/AVX2" } };
+		for (const auto& [level, levelName] : levels)
+		{
+			if (level > SupportedSimdLevel())
+			{
+				continue;
+			}
+
+			Report("Datum", string("Scale") + levelName, count, Measure(count, [&floats, level = level]
+			{
+				const span<float> values = floats.AsSpan<float>();
+				SimdScale(values.data(), values.size(), 1.0001f, level);
+				DoNotOptimize(static_cast<size_t>(values[0]));
+			}));
+
+			Report("Datum", string("MultiplyAdd") + levelName, count, Measure(count, [&positions, &velocities, level = level]
+			{
+				SimdMultiplyAdd(&positions.AsSpan<glm::vec4>()[0].x, &velocities.AsSpan<glm::vec4>()[0].x, 0.016f, positions.Size() * 4, level);
+				DoNotOptimize(static_cast<size_t>(positions.GetVector(0).x));
+			}));
+
+			Report("Datum", string("Transform") + levelName, count, Measure(count, [&positions, &rotation, level = level]
+			{
+				SimdTransform(positions.AsSpan<glm::vec4>().data(), positions.Size(), rotation, level);
+				DoNotOptimize(static_cast<size_t>(positions.GetVector(0).x));
+			}));
+
+			Report("Datum", string("Sum") + levelName, count, Measure(count, [&floats, level = level]
+			{
+				DoNotOptimize(static_cast<size_t>(SimdSum(floats.AsSpan<float>().data(), floats.Size(), level)));
+			}));
+
+			Report("Datum", string("Convert") + levelName, count, Measure(count, [&ints, &converted, level = level]
+			{
+				SimdConvert(ints.AsSpan<int>().data(), converted.AsSpan<float>().data(), ints.Size(), level);
+				DoNotOptimize(static_cast<size_t>(converted.GetFloat(0)));
+			}));
+		}
+
+		// What callers get: the Datum interface, dispatched to the best kernel.
+		Report("Datum", "MultiplyAdd/DatumMath", count, Measure(count, [&positions, &velocities]
+		{
+			DatumMath::MultiplyAdd(positions, velocities, 0.016f);
+			DoNotOptimize(static_cast<size_t>(positions.GetVector(0).x));
+		}));
+	}
+
+	/// <summary>
+	/// Times filling a Datum from an array one PushBack at a time against one Append of the whole array.
+	/// Results are per element.
+	/// </summary>
+	static void RunBulkBenchmarks(size_t count)
+	{
+		const vector<glm::mat4> matrices(count, glm::mat4(1.0f));
+		vector<string> names;
+		names.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			names.push_back("Entity with a name too long for small strings " + to_string(i));
+		}
+
+		Report("Datum", "FillMatrices/PushBack", count, Measure(count, [&matrices]
+		{
+			Datum datum(Datum::DatumTypes::Matrix);
+			for (const glm::mat4& matrix : matrices)
+			{
+				datum.PushBack(matrix);
+			}
+			DoNotOptimize(datum.Size());
+		}));
+
+		Report("Datum", "FillMatrices/Append", count, Measure(count, [&matrices]
+		{
+			Datum datum(Datum::DatumTypes::Matrix);
+			datum.Append(span<const glm::mat4>(matrices));
+			DoNotOptimize(datum.Size());
+		}));
+
+		Report("Datum", "FillStrings/PushBack", count, Measure(count, [&names]
+		{
+			Datum datum(Datum::DatumTypes::String);
+			for (const string& name : names)
+			{
+				datum.PushBack(name);
+			}
+			DoNotOptimize(datum.Size());
+		}));
+
+		Report("Datum", "FillStrings/Append", count, Measure(count, [&names]
+		{
+			Datum datum(Datum::DatumTypes::String);
+			datum.Append(span<const string>(names));
+			DoNotOptimize(datum.Size());
+		}));
+	}
+
+	/// <summary>
+	/// Times converting matrices to and from text with TextConversion, against the sscanf and glm::to_string calls Datum used before.
+	/// Results are per matrix.
+	/// </summary>
+	static void RunTextBenchmarks(size_t count)
+	{
+		vector<string> texts;
+		texts.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			texts.push_back("mat4x4((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (" + to_string(static_cast<float>(i) * 0.25f) + ", 2.5, -3.75, 1))");
+		}
+
+		Report("Datum", "ParseMatrix/sscanf", count, Measure(count, [&texts]
+		{
+			float total = 0.f;
+			for (const string& text : texts)
+			{
+				glm::mat4 data;
+#ifdef _WINDOWS
+				sscanf_s(text.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
+#else
+				sscanf(text.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
+#endif
+					&data[0][0], &data[0][1], &data[0][2], &data[0][3],
+					&data[1][0], &data[1][1], &data[1][2], &data[1][3],
+					&data[2][0], &data[2][1], &data[2][2], &data[2][3],
+					&data[3][0], &data[3][1], &data[3][2], &data[3][3]);
+				total += data[3][0];
+			}
+			DoNotOptimize(static_cast<size_t>(total));
+		}));
+
+		Report("Datum", "ParseMatrix/TextConversion", count, Measure(count, [&texts]
+		{
+			float total = 0.f;
+			for (const string& text : texts)
+			{
+				total += TextConversion::ParseMatrix(text)[3][0];
+			}
+			DoNotOptimize(static_cast<size_t>(total));
+		}));
+
+		Datum matrices;
+		matrices.SetType(Datum::DatumTypes::Matrix);
+		for (const string& text : texts)
+		{
+			matrices.PushBackFromString(text);
+		}
+
+		Report("Datum", "FormatMatrix/to_string", count, Measure(count, [&matrices]
+		{
+			size_t length = 0;
+			for (const glm::mat4& matrix : matrices.AsSpan<glm::mat4>())
+			{
+				length += glm::to_string(matrix).size();
+			}
+			DoNotOptimize(length);
+		}));
+
+		Report("Datum", "FormatMatrix/TextConversion", count, Measure(count, [&matrices]
+		{
+			char buffer[TextConversion::MaxMatrixLength];
+			size_t length = 0;
+			for (const glm::mat4& matrix : matrices.AsSpan<glm::mat4>())
+			{
+				length += TextConversion::Format(matrix, buffer);
+			}
+			DoNotOptimize(length);
+		}));
+	}
+
+	/// <summary>
+	/// Builds a JSON table holding one Vector array and one Matrix array of count elements each, in the format content files use.
+	/// </summary>
+	static string MakeTransformJson(size_t count)
+	{
+		ostringstream json;
+		json << "{ \"Positions\": { \"type\": \"vector\", \"value\": [";
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float value = static_cast<float>(i) * 0.25f;
+			json << (i > 0 ? ", " : "") << "\"vec4(" << value << ", " << -value << ", 0.5, 1)\"";
+		}
+		json << "] }, \"Transforms\": { \"type\": \"matrix\", \"value\": [";
+		for (size_t i = 0; i < count; ++i)
+		{
+			json << (i > 0 ? ", " : "") << "\"mat4x4((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (" << static_cast<float>(i) << ", 2.5, -3.75, 1))\"";
+		}
+		json << "] } }";
+
+		return json.str();
+	}
+
+	/// <summary>
+	/// Times loading Vector and Matrix arrays from JSON, against parsing the same document into Json::Value alone.
+	/// The difference between the two is the engine's share: building the Scope and converting each string to a value.
+	/// </summary>
+	static void RunLoadBenchmarks(size_t count)
+	{
+		const string json = MakeTransformJson(count);
+
+		Report("Datum", "LoadTransforms/JsonOnly", count, Measure(count, [&json]
+		{
+			istringstream stream(json);
+			Json::Value root;
+			stream >> root;
+			DoNotOptimize(root.size());
+		}));
+
+		Report("Datum", "LoadTransforms", count, Measure(count, [&json]
+		{
+			Scope root;
+			JsonTableParseHelper::SharedData sharedData(root);
+			JsonParseCoordinator parseCoordinator(sharedData);
+			JsonTableParseHelper parseHelper;
+			parseCoordinator.AddHelper(parseHelper);
+			parseCoordinator.Parse(json);
+			DoNotOptimize(root.Size());
+		}));
+	}
+
+	void RunDatumBenchmarks()
+	{
+		BeginSuite("Datum");
+
+		for (const size_t count : { 16_z, 1024_z, 100000_z })
+		{
+			auto [floats, vectors] = MakeDatums(count);
+
+			Report("Datum", "SumFloats/Get", count, Measure(count, [&floats]
+			{
+				float total = 0.f;
+				for (size_t i = 0; i < floats.Size(); ++i)
+				{
+					total += floats.GetFloat(i);
+				}
+				DoNotOptimize(static_cast<size_t>(total));
+			}));
+
+			Report("Datum", "SumFloats/AsSpan", count, Measure(count, [&floats]
+			{
+				float total = 0.f;
+				for (const float value : floats.AsSpan<float>())
+				{
+					total += value;
+				}
+				DoNotOptimize(static_cast<size_t>(total));
+			}));
+
+			Report("Datum", "ScaleVectors/Get", count, Measure(count, [&vectors]
+			{
+				for (size_t i = 0; i < vectors.Size(); ++i)
+				{
+					vectors.GetVector(i) *= 1.0001f;
+				}
+				DoNotOptimize(static_cast<size_t>(vectors.GetVector(0).x));
+			}));
+
+			Report("Datum", "ScaleVectors/AsSpan", count, Measure(count, [&vectors]
+			{
+				for (glm::vec4& value : vectors.AsSpan<glm::vec4>())
+				{
+					value *= 1.0001f;
+				}
+				DoNotOptimize(static_cast<size_t>(vectors.GetVector(0).x));
+			}));
+
+			RunMathBenchmarks(count);
+			RunBulkBenchmarks(count);
+			RunTextBenchmarks(count);
+			RunLoadBenchmarks(count);
+		}
+	}
+}
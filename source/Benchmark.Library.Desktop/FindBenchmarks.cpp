@@ -0,0 +1,89 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "SimdFind.h"
+#include "Vector.h"
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Elements scanned per measured pass. Short vectors are searched many times per pass so timer overhead stays out of the result.
+	/// </summary>
+	constexpr size_t FindElementsPerPass = 1 << 20;
+
+	/// <summary>
+	/// Searches a Vector of count elements for a value it does not hold, so every search scans the whole vector.
+	/// Compares each SimdFind kernel the processor supports with the scalar loop Vector::Find used before, and with std::find.
+	/// </summary>
+	template<typename T, typename TMakeValue>
+	static void RunFindBenchmarks(const string& label, size_t count, TMakeValue makeValue, const T& missing)
+	{
+		Vector<T> values;
+		values.Reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			values.PushBack(makeValue(i));
+		}
+
+		const size_t searches = max(FindElementsPerPass / count, 1_z);
+		Report("Find", label + "/Scalar loop", count, Measure(searches, [&values, &missing, searches]
+		{
+			for (size_t i = 0; i < searches; ++i)
+			{
+				DoNotOptimize(values.template Find<equal_to<T>>(missing) == values.end() ? 1_z : 0_z);
+			}
+		}));
+
+		Report("Find", label + "/std::find", count, Measure(searches, [&values, &missing, searches]
+		{
+			for (size_t i = 0; i < searches; ++i)
+			{
+				DoNotOptimize(static_cast<size_t>(find(values.Data(), values.Data() + values.Size(), missing) - values.Data()));
+			}
+		}));
+
+		const pair<SimdLevel, const char*> levels[] = { { SimdLevel::SSE2, "/SSE2" }, { SimdLevel::AVX2, "/AVX2" } };
+		for (const auto& [level, levelName] : levels)
+		{
+			if (level > SupportedSimdLevel())
+			{
+				continue;
+			}
+
+			Report("Find", label + levelName, count, Measure(searches, [&values, &missing, searches, level = level]
+			{
+				for (size_t i = 0; i < searches; ++i)
+				{
+					DoNotOptimize(SimdFind(values.Data(), values.Size(), missing, level));
+				}
+			}));
+		}
+
+		// What callers get: the default equality, dispatched to the best kernel.
+		Report("Find", label + "/Vector::Find", count, Measure(searches, [&values, &missing, searches]
+		{
+			for (size_t i = 0; i < searches; ++i)
+			{
+				DoNotOptimize(values.Find(missing) == values.end() ? 1_z : 0_z);
+			}
+		}));
+	}
+
+	void RunFindBenchmarks()
+	{
+		BeginSuite("Find");
+
+		for (const size_t count : { 16_z, 1024_z, 1048576_z })
+		{
+			RunFindBenchmarks<int>("int", count, [](size_t i) { return static_cast<int>(i); }, -1);
+			RunFindBenchmarks<float>("float", count, [](size_t i) { return static_cast<float>(i); }, -1.0f);
+			RunFindBenchmarks<glm::vec4>("vec4", count, [](size_t i) { return glm::vec4(static_cast<float>(i)); }, glm::vec4(-1.0f));
+
+			Vector<int> targets;
+			targets.Resize(count);
+			RunFindBenchmarks<int*>("pointer", count, [&targets](size_t i) { return targets.Data() + i; }, nullptr);
+		}
+	}
+}
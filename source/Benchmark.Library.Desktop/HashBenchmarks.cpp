@@ -0,0 +1,193 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "DefaultHash.h"
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <set>
+#include <sstream>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// The byte-sum hash DefaultHash used before it was replaced, kept here as the baseline.
+	/// </summary>
+	static size_t LegacyAdditiveHash(const string& key)
+	{
+		size_t hash = 0;
+		for (const char c : key)
+		{
+			hash += 31 * static_cast<uint8_t>(c);
+		}
+		return hash;
+	}
+
+	static size_t Fnv1aHash(const string& key)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		for (const char c : key)
+		{
+			hash ^= static_cast<uint8_t>(c);
+			hash *= 1099511628211ull;
+		}
+		return static_cast<size_t>(hash);
+	}
+
+	/// <summary>
+	/// Collects every object key (anything of the form "key":) from the JSON files in directory.
+	/// </summary>
+	static vector<string> LoadAttributeNames(const filesystem::path& directory)
+	{
+		set<string> names;
+		const regex keyPattern("\"([^\"\\\\]+)\"\\s*:");
+
+		error_code error;
+		for (const auto& entry : filesystem::directory_iterator(directory, error))
+		{
+			if (entry.path().extension() != ".json")
+			{
+				continue;
+			}
+
+			ifstream file(entry.path());
+			stringstream contents;
+			contents << file.rdbuf();
+			const string text = contents.str();
+
+			for (sregex_iterator it(text.begin(), text.end(), keyPattern), end; it != end; ++it)
+			{
+				names.insert((*it)[1].str());
+			}
+		}
+
+		return vector<string>(names.begin(), names.end());
+	}
+
+	/// <summary>
+	/// Every distinct rearrangement of each name's letters. Under a byte-sum hash all of them share one bucket.
+	/// </summary>
+	static vector<string> MakeAnagrams(const vector<string>& names, size_t maxLength)
+	{
+		set<string> anagrams;
+		for (string name : names)
+		{
+			if (name.size() > maxLength)
+			{
+				continue;
+			}
+
+			sort(name.begin(), name.end());
+			do
+			{
+				anagrams.insert(name);
+			} while (next_permutation(name.begin(), name.end()));
+		}
+
+		return vector<string>(anagrams.begin(), anagrams.end());
+	}
+
+	/// <summary>
+	/// The same names with numeric suffixes, the way generated entities and array elements tend to be named.
+	/// </summary>
+	static vector<string> MakeSuffixed(const vector<string>& names, size_t suffixCount)
+	{
+		vector<string> suffixed;
+		suffixed.reserve(names.size() * suffixCount);
+		for (const string& name : names)
+		{
+			for (size_t i = 0; i < suffixCount; ++i)
+			{
+				suffixed.push_back(name + to_string(i));
+			}
+		}
+
+		return suffixed;
+	}
+
+	/// <summary>
+	/// Buckets keys at a load factor of 1 and reports the longest chain and the expected probe cost relative to
+	/// an ideal random hash (1.00 is ideal; larger means more collisions than chance).
+	/// </summary>
+	template<typename THash>
+	static void ReportDistribution(const string& corpus, const string& hashName, const vector<string>& keys, THash hash)
+	{
+		const size_t bucketCount = keys.size() | 1;
+		vector<size_t> buckets(bucketCount);
+		for (const string& key : keys)
+		{
+			++buckets[hash(key) % bucketCount];
+		}
+
+		size_t longestChain = 0;
+		double probeCost = 0.0;
+		for (const size_t chain : buckets)
+		{
+			longestChain = max(longestChain, chain);
+			probeCost += static_cast<double>(chain) * static_cast<double>(chain + 1) / 2.0;
+		}
+
+		const double n = static_cast<double>(keys.size());
+		const double m = static_cast<double>(bucketCount);
+		const double idealProbeCost = (n / (2.0 * m)) * (n + 2.0 * m - 1.0);
+
+		Report("Hash", corpus + "/" + hashName + "/LongestChain", keys.size(), static_cast<double>(longestChain), "keys");
+		Report("Hash", corpus + "/" + hashName + "/ProbeCost", keys.size(), probeCost / idealProbeCost, "x ideal");
+	}
+
+	static void RunDistributionBenchmarks(const string& corpus, const vector<string>& keys)
+	{
+		if (keys.empty())
+		{
+			return;
+		}
+
+		ReportDistribution(corpus, "Additive", keys, LegacyAdditiveHash);
+		ReportDistribution(corpus, "Fnv1a", keys, Fnv1aHash);
+		ReportDistribution(corpus, "Default", keys, DefaultHash<string>{});
+	}
+
+	void RunHashBenchmarks(const filesystem::path& contentDirectory)
+	{
+		BeginSuite("Hash");
+
+		const vector<string> names = LoadAttributeNames(contentDirectory);
+		if (names.empty())
+		{
+			cout << "No JSON files found in " << contentDirectory << "; skipping attribute name corpora." << endl;
+		}
+		RunDistributionBenchmarks("JsonNames", names);
+		RunDistributionBenchmarks("JsonNames+Suffix", MakeSuffixed(names, 1000));
+		RunDistributionBenchmarks("JsonNames+Anagrams", MakeAnagrams(names, 8));
+
+		for (const size_t length : { 4_z, 16_z, 64_z, 256_z, 1024_z, 65536_z })
+		{
+			const string key(length, 'x');
+			const size_t iterations = max(1_z, 1000000_z / length);
+
+			Report("Hash", "Throughput/Additive", length, Measure(iterations, [&key, iterations]
+			{
+				for (size_t i = 0; i < iterations; ++i)
+				{
+					DoNotOptimize(LegacyAdditiveHash(key));
+				}
+			}));
+			Report("Hash", "Throughput/Fnv1a", length, Measure(iterations, [&key, iterations]
+			{
+				for (size_t i = 0; i < iterations; ++i)
+				{
+					DoNotOptimize(Fnv1aHash(key));
+				}
+			}));
+			Report("Hash", "Throughput/Default", length, Measure(iterations, [&key, iterations]
+			{
+				for (size_t i = 0; i < iterations; ++i)
+				{
+					DoNotOptimize(DefaultHash<string>{}(key));
+				}
+			}));
+		}
+	}
+}
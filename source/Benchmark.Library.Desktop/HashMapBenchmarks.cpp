@@ -0,0 +1,131 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "HashMap.h"
+#include "FlatHashMap.h"
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	static vector<string> MakeKeys(size_t count, const string& prefix)
+	{
+		vector<string> keys;
+		keys.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			keys.push_back(prefix + to_string(i));
+		}
+
+		shuffle(keys.begin(), keys.end(), mt19937_64(count));
+		return keys;
+	}
+
+	/// <summary>
+	/// Runs the same workload against either map type. Maps are built by makeMap, so a benchmark can start from
+	/// a presized map or from the default size and let the map grow as it fills.
+	/// </summary>
+	template<typename TMap>
+	static void RunMapBenchmarks(const string& label, size_t count, const vector<string>& keys, const vector<string>& missingKeys, TMap&& makeMap)
+	{
+		{
+			auto map = makeMap();
+			const double result = Measure(count, [&map, &makeMap] { map = makeMap(); }, [&map, &keys]
+			{
+				for (const string& key : keys)
+				{
+					map.Insert(make_pair(key, key.size()));
+				}
+			});
+			Report("HashMap", "Insert/" + label, count, result);
+		}
+
+		auto map = makeMap();
+		for (const string& key : keys)
+		{
+			map.Insert(make_pair(key, key.size()));
+		}
+
+		Report("HashMap", "FindHit/" + label, count, Measure(count, [&map, &keys]
+		{
+			size_t found = 0;
+			for (const string& key : keys)
+			{
+				found += map.Find(key)->second;
+			}
+			DoNotOptimize(found);
+		}));
+
+		Report("HashMap", "FindMiss/" + label, count, Measure(count, [&map, &missingKeys]
+		{
+			size_t found = 0;
+			for (const string& key : missingKeys)
+			{
+				found += map.ContainsKey(key);
+			}
+			DoNotOptimize(found);
+		}));
+
+		Report("HashMap", "Iterate/" + label, count, Measure(count, [&map]
+		{
+			size_t total = 0;
+			for (const auto& pair : map)
+			{
+				total += pair.second;
+			}
+			DoNotOptimize(total);
+		}));
+
+		{
+			auto removeMap = makeMap();
+			const double result = Measure(count, [&removeMap, &map] { removeMap = map; }, [&removeMap, &keys]
+			{
+				for (const string& key : keys)
+				{
+					removeMap.Remove(key);
+				}
+			});
+			Report("HashMap", "Remove/" + label, count, result);
+		}
+	}
+
+	/// <summary>
+	/// Reports the slowest single Insert while growing from the default size. Incremental growth should keep this
+	/// close to the cost of moving a handful of buckets instead of the whole map.
+	/// </summary>
+	template<typename TMap>
+	static void RunWorstInsertBenchmark(const string& label, size_t count, const vector<string>& keys, TMap map)
+	{
+		using Clock = chrono::steady_clock;
+
+		chrono::nanoseconds worst{ 0 };
+		for (const string& key : keys)
+		{
+			const auto start = Clock::now();
+			map.Insert(make_pair(key, key.size()));
+			worst = max(worst, chrono::duration_cast<chrono::nanoseconds>(Clock::now() - start));
+		}
+
+		Report("HashMap", "WorstInsert/" + label, count, static_cast<double>(worst.count()), "ns");
+	}
+
+	void RunHashMapBenchmarks()
+	{
+		BeginSuite("HashMap");
+
+		for (const size_t count : { 10_z, 1000_z, 1000000_z })
+		{
+			const vector<string> keys = MakeKeys(count, "Key");
+			const vector<string> missingKeys = MakeKeys(count, "Missing");
+
+			RunMapBenchmarks("Chained", count, keys, missingKeys, [count] { return HashMap<string, size_t>(count); });
+			RunMapBenchmarks("ChainedDynamic", count, keys, missingKeys, [count] { return DynamicHashMap<string, size_t>(count); });
+			RunMapBenchmarks("ChainedGrowing", count, keys, missingKeys, [] { return HashMap<string, size_t>(); });
+			RunMapBenchmarks("Flat", count, keys, missingKeys, [] { return FlatHashMap<string, size_t>(); });
+			RunMapBenchmarks("FlatDynamic", count, keys, missingKeys, [] { return DynamicFlatHashMap<string, size_t>(); });
+
+			RunWorstInsertBenchmark("ChainedGrowing", count, keys, HashMap<string, size_t>());
+			RunWorstInsertBenchmark("Flat", count, keys, FlatHashMap<string, size_t>());
+		}
+	}
+}
@@ -0,0 +1,92 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "HashMap.h"
+#include "NodePool.h"
+#include "Stack.h"
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Inserts count keys and removes them again, so every operation creates or destroys a chain node.
+	/// makeMap builds the map, which decides where its nodes come from.
+	/// </summary>
+	template<typename TMakeMap>
+	static void RunMapChurn(const string& label, size_t count, TMakeMap makeMap)
+	{
+		auto map = makeMap();
+		Report("NodePool", "HashMapChurn/" + label, count, Measure(2_z * count, [&map, count]
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				map.Insert(make_pair(static_cast<int>(i), i));
+			}
+			for (size_t i = 0; i < count; ++i)
+			{
+				map.Remove(static_cast<int>(i));
+			}
+			DoNotOptimize(map.Size());
+		}));
+	}
+
+	/// <summary>
+	/// Pushes count values onto a stack and pops them all off again.
+	/// </summary>
+	template<typename TStack>
+	static void RunStackChurn(const string& label, size_t count, TStack& stack)
+	{
+		Report("NodePool", "StackChurn/" + label, count, Measure(2_z * count, [&stack, count]
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				stack.Push(i);
+			}
+			size_t sum = 0;
+			while (!stack.IsEmpty())
+			{
+				sum += stack.Top();
+				stack.Pop();
+			}
+			DoNotOptimize(sum);
+		}));
+	}
+
+	void RunNodePoolBenchmarks()
+	{
+		BeginSuite("NodePool");
+
+		using DefaultMap = HashMap<int, size_t>;
+		using PooledMap = HashMap<int, size_t, DefaultHash<int>, DefaultEquality<int>, NodePoolAllocator>;
+		using PooledStack = Stack<size_t, NodePoolAllocator>;
+
+		for (const size_t count : { 64_z, 4096_z, 65536_z })
+		{
+			// Sized up front so the churn measures node allocation rather than bucket growth.
+			const size_t buckets = count + 1_z;
+			RunMapChurn("Default", count, [buckets] { return DefaultMap(buckets); });
+			{
+				NodePool pool(PooledMap::NodeSize, PooledMap::NodeAlignment, 256_z);
+				RunMapChurn("Pool", count, [buckets, &pool] { return PooledMap(buckets, {}, {}, NodePoolAllocator(pool)); });
+			}
+			RunMapChurn("SharedPool", count, [buckets] { return PooledMap(buckets); });
+
+			{
+				Stack<size_t> stack;
+				RunStackChurn("Default", count, stack);
+			}
+			{
+				NodePool pool(PooledStack::NodeSize, PooledStack::NodeAlignment, 256_z);
+				PooledStack stack{ NodePoolAllocator(pool) };
+				RunStackChurn("Pool", count, stack);
+			}
+			{
+				PooledStack stack;
+				RunStackChurn("SharedPool", count, stack);
+			}
+		}
+
+		NodePool::ReleaseShared();
+	}
+}
@@ -0,0 +1,86 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "ParallelAlgorithms.h"
+#include <cmath>
+#include <numeric>
+#include <thread>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Number of elements every parallel algorithm is run over.
+	/// </summary>
+	constexpr size_t ParallelElementCount = 10000000;
+
+	/// <summary>
+	/// Runs each algorithm over ParallelElementCount elements on a pool of threadCount threads, including the calling thread.
+	/// The count column of each row is the thread count, so rows of one algorithm read as a scaling curve.
+	/// </summary>
+	static void RunParallelAlgorithms(size_t threadCount, const Vector<float>& values)
+	{
+		ThreadPool pool(threadCount - 1_z);
+		const size_t count = values.Size();
+
+		Vector<float> scratch;
+		Report("Parallel", "ForEach", threadCount, Measure(count, [&scratch, &values] { scratch = values; }, [&scratch, &pool]
+		{
+			ParallelForEach(scratch, [](float& value) { value = sqrt(value) * 1.5f + 0.25f; }, pool);
+		}));
+
+		Vector<float> output;
+		Report("Parallel", "Transform", threadCount, Measure(count, [&values, &output, &pool]
+		{
+			ParallelTransform(values, output, [](float value) { return value * value + 1.0f; }, pool);
+		}));
+
+		Report("Parallel", "Reduce", threadCount, Measure(count, [&values, &pool]
+		{
+			DoNotOptimize(static_cast<size_t>(ParallelReduce(values, 0.0, plus<>{}, pool)));
+		}));
+
+		Report("Parallel", "Sort", threadCount, Measure(count, [&scratch, &values] { scratch = values; }, [&scratch, &pool]
+		{
+			ParallelSort(scratch, less<>{}, pool);
+		}));
+
+		Report("Parallel", "Partition", threadCount, Measure(count, [&scratch, &values] { scratch = values; }, [&scratch, &pool]
+		{
+			DoNotOptimize(ParallelPartition(scratch.Data(), scratch.Data() + scratch.Size(), [](float value) { return value < 500.0f; }, pool) - scratch.Data());
+		}));
+	}
+
+	void RunParallelBenchmarks()
+	{
+		BeginSuite("Parallel");
+
+		mt19937 random(42);
+		uniform_real_distribution<float> distribution(0.0f, 1000.0f);
+		Vector<float> values;
+		values.Reserve(ParallelElementCount);
+		for (size_t i = 0; i < ParallelElementCount; ++i)
+		{
+			values.PushBack(distribution(random));
+		}
+
+		// The serial baselines the one-thread rows should match.
+		Vector<float> scratch;
+		Report("Parallel", "Sort/std::sort", 1_z, Measure(ParallelElementCount, [&scratch, &values] { scratch = values; }, [&scratch]
+		{
+			sort(scratch.Data(), scratch.Data() + scratch.Size());
+		}));
+		Report("Parallel", "Reduce/std::accumulate", 1_z, Measure(ParallelElementCount, [&values]
+		{
+			DoNotOptimize(static_cast<size_t>(accumulate(values.Data(), values.Data() + values.Size(), 0.0)));
+		}));
+
+		const size_t hardwareThreads = max(static_cast<size_t>(thread::hardware_concurrency()), 1_z);
+		for (size_t threadCount = 1; threadCount < hardwareThreads; threadCount *= 2)
+		{
+			RunParallelAlgorithms(threadCount, values);
+		}
+		RunParallelAlgorithms(hardwareThreads, values);
+	}
+}
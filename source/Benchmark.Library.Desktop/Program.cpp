@@ -0,0 +1,124 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include <functional>
+#include <utility>
+
+namespace Benchmarks
+{
+	void RunHashBenchmarks(const std::filesystem::path& contentDirectory);
+	void RunHashMapBenchmarks();
+	void RunVectorBenchmarks();
+	void RunScopeBenchmarks();
+	void RunAllocationBenchmarks();
+	void RunNodePoolBenchmarks();
+	void RunStackBenchmarks();
+	void RunConcurrentHashMapBenchmarks();
+	void RunParallelBenchmarks();
+	void RunFindBenchmarks();
+	void RunQueueBenchmarks();
+	void RunContainerBenchmarks();
+	void RunDatumBenchmarks();
+}
+
+/// <summary>
+/// Prints the command line options.
+/// </summary>
+static void PrintUsage(const char* program)
+{
+	std::cerr << "Usage: " << program << " [--format text|csv|json] [--suite <name>]... [content directory]" << std::endl
+		<< "  --format   How results are written. csv has a header row; json writes one object per line. Default: text." << std::endl
+		<< "  --suite    Runs only the named suite, e.g. Containers. Repeat to run several. Default: every suite." << std::endl
+		<< "  The content directory holds the JSON used by the Hash suite. Default: ../UnitTest.Library.Desktop." << std::endl;
+}
+
+/// <summary>
+/// Runs the benchmark suites. By default every suite runs and results are printed as aligned text.
+/// An optional positional argument overrides where the JSON content used by the hash distribution benchmarks is read from;
+/// by default it is the unit test project, relative to this project's directory.
+/// </summary>
+int main(int argc, char* argv[])
+{
+	std::filesystem::path contentDirectory = "../UnitTest.Library.Desktop";
+	Benchmarks::ReportFormat format = Benchmarks::ReportFormat::Text;
+	std::vector<std::string> selectedSuites;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		const std::string argument = argv[i];
+		if (argument == "--format" && i + 1 < argc)
+		{
+			const std::string value = argv[++i];
+			if (value == "text")
+			{
+				format = Benchmarks::ReportFormat::Text;
+			}
+			else if (value == "csv")
+			{
+				format = Benchmarks::ReportFormat::Csv;
+			}
+			else if (value == "json")
+			{
+				format = Benchmarks::ReportFormat::Json;
+			}
+			else
+			{
+				PrintUsage(argv[0]);
+				return EXIT_FAILURE;
+			}
+		}
+		else if (argument == "--suite" && i + 1 < argc)
+		{
+			selectedSuites.push_back(argv[++i]);
+		}
+		else if (argument.starts_with("--"))
+		{
+			PrintUsage(argv[0]);
+			return EXIT_FAILURE;
+		}
+		else
+		{
+			contentDirectory = argument;
+		}
+	}
+
+#if defined(DEBUG) | defined(_DEBUG)
+	std::cerr << "Warning: benchmarks were built without optimizations." << std::endl;
+#endif
+
+	const std::pair<std::string, std::function<void()>> suites[] =
+	{
+		{ "Hash", [&contentDirectory] { Benchmarks::RunHashBenchmarks(contentDirectory); } },
+		{ "HashMap", Benchmarks::RunHashMapBenchmarks },
+		{ "Vector", Benchmarks::RunVectorBenchmarks },
+		{ "Scope", Benchmarks::RunScopeBenchmarks },
+		{ "Allocations", Benchmarks::RunAllocationBenchmarks },
+		{ "NodePool", Benchmarks::RunNodePoolBenchmarks },
+		{ "Stack", Benchmarks::RunStackBenchmarks },
+		{ "Concurrent", Benchmarks::RunConcurrentHashMapBenchmarks },
+		{ "Parallel", Benchmarks::RunParallelBenchmarks },
+		{ "Find", Benchmarks::RunFindBenchmarks },
+		{ "Queue", Benchmarks::RunQueueBenchmarks },
+		{ "Containers", Benchmarks::RunContainerBenchmarks },
+		{ "Datum", Benchmarks::RunDatumBenchmarks }
+	};
+
+	for (const std::string& selected : selectedSuites)
+	{
+		if (std::none_of(std::begin(suites), std::end(suites), [&selected](const auto& suite) { return suite.first == selected; }))
+		{
+			std::cerr << "Unknown suite: " << selected << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	Benchmarks::SetReportFormat(format);
+	for (const auto& [name, run] : suites)
+	{
+		if (selectedSuites.empty() || std::find(selectedSuites.begin(), selectedSuites.end(), name) != selectedSuites.end())
+		{
+			run();
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
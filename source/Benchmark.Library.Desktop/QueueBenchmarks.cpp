@@ -0,0 +1,315 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "Deque.h"
+#include "MpscQueue.h"
+#include "SpscQueue.h"
+#include "Vector.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// The baseline the lock-free queues replace: a Vector and a read index behind a mutex, bounded like the lock-free queues.
+	/// Popped elements stay in the Vector until the read index has passed a full capacity of them, then the rest slide to the front.
+	/// </summary>
+	template<typename T>
+	class MutexVectorQueue final
+	{
+	public:
+		explicit MutexVectorQueue(size_t capacity) :
+			_items(capacity * 2), _capacity(capacity)
+		{
+		}
+
+		bool TryPush(const T& value)
+		{
+			lock_guard<mutex> lock(_mutex);
+			if (_items.Size() - _head >= _capacity)
+			{
+				return false;
+			}
+
+			if (_head >= _capacity)
+			{
+				const size_t remaining = _items.Size() - _head;
+				for (size_t i = 0; i < remaining; ++i)
+				{
+					_items[i] = std::move(_items[_head + i]);
+				}
+				while (_items.Size() > remaining)
+				{
+					_items.PopBack();
+				}
+				_head = 0;
+			}
+
+			_items.PushBack(value);
+			return true;
+		}
+
+		bool TryPop(T& value)
+		{
+			lock_guard<mutex> lock(_mutex);
+			if (_head == _items.Size())
+			{
+				return false;
+			}
+
+			value = std::move(_items[_head++]);
+			if (_head == _items.Size())
+			{
+				_items.Clear();
+				_head = 0;
+			}
+			return true;
+		}
+
+	private:
+		mutex _mutex;
+		Vector<T> _items;
+		size_t _head{ 0 };
+		size_t _capacity;
+	};
+
+	/// <summary>
+	/// Capacity of every bounded queue in the threaded benchmarks.
+	/// </summary>
+	constexpr size_t QueueCapacity = 1024;
+
+	/// <summary>
+	/// Elements sent through a queue per threaded measurement, split evenly between the producers.
+	/// </summary>
+	constexpr size_t ElementsPerRun = 1 << 20;
+
+	/// <summary>
+	/// Round trips per latency measurement.
+	/// </summary>
+	constexpr size_t RoundTripsPerRun = 1 << 15;
+
+	/// <summary>
+	/// Pushes value, yielding while the queue is full. Yielding rather than spinning keeps the numbers meaningful when the
+	/// producer and consumer share a core.
+	/// </summary>
+	template<typename TQueue>
+	static void Push(TQueue& queue, size_t value)
+	{
+		while (!queue.TryPush(value))
+		{
+			this_thread::yield();
+		}
+	}
+
+	/// <summary>
+	/// Pops one element, yielding while the queue is empty.
+	/// </summary>
+	template<typename TQueue>
+	static size_t Pop(TQueue& queue)
+	{
+		size_t value;
+		while (!queue.TryPop(value))
+		{
+			this_thread::yield();
+		}
+		return value;
+	}
+
+	/// <summary>
+	/// Keeps count elements queued and pushes one and pops one per operation on a single thread, the way EventQueue cycles its entries.
+	/// Measures the container itself, without any contention.
+	/// </summary>
+	template<typename TQueue>
+	static double MeasureFifo(TQueue& queue, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			queue.TryPush(i);
+		}
+
+		constexpr size_t operations = 1 << 16;
+		return Measure(operations, [&queue]
+		{
+			size_t sum = 0;
+			for (size_t i = 0; i < operations; ++i)
+			{
+				queue.TryPush(i);
+				size_t value = 0;
+				queue.TryPop(value);
+				sum += value;
+			}
+			DoNotOptimize(sum);
+		});
+	}
+
+	/// <summary>
+	/// Adapts Deque and Vector to the TryPush/TryPop interface for MeasureFifo. Neither is bounded.
+	/// </summary>
+	template<typename TContainer>
+	struct UnboundedFifo final
+	{
+		bool TryPush(size_t value)
+		{
+			_items.PushBack(value);
+			return true;
+		}
+
+		bool TryPop(size_t& value)
+		{
+			if (_items.IsEmpty())
+			{
+				return false;
+			}
+
+			value = *_items.begin();
+			if constexpr (is_same_v<TContainer, Deque<size_t>>)
+			{
+				_items.PopFront();
+			}
+			else
+			{
+				_items.Remove(_items.begin());
+			}
+			return true;
+		}
+
+		TContainer _items;
+	};
+
+	/// <summary>
+	/// Runs producerCount threads pushing ElementsPerRun elements between them while this thread pops them all.
+	/// </summary>
+	/// <returns>Wall-clock nanoseconds per element.</returns>
+	template<typename TQueue>
+	static double MeasureThroughput(size_t producerCount)
+	{
+		using Clock = chrono::steady_clock;
+
+		TQueue queue(QueueCapacity);
+		atomic<size_t> ready{ 0 };
+		atomic<bool> start{ false };
+		vector<thread> producers;
+		const size_t perProducer = ElementsPerRun / producerCount;
+
+		for (size_t producer = 0; producer < producerCount; ++producer)
+		{
+			producers.emplace_back([&queue, &ready, &start, perProducer]
+			{
+				++ready;
+				while (!start.load(memory_order_acquire))
+				{
+					this_thread::yield();
+				}
+
+				for (size_t i = 0; i < perProducer; ++i)
+				{
+					Push(queue, i);
+				}
+			});
+		}
+
+		while (ready.load() < producerCount)
+		{
+			this_thread::yield();
+		}
+		const auto begin = Clock::now();
+		start.store(true, memory_order_release);
+
+		size_t sum = 0;
+		for (size_t i = 0; i < perProducer * producerCount; ++i)
+		{
+			sum += Pop(queue);
+		}
+		const auto elapsed = chrono::duration_cast<chrono::nanoseconds>(Clock::now() - begin);
+		DoNotOptimize(sum);
+
+		for (thread& producer : producers)
+		{
+			producer.join();
+		}
+
+		return static_cast<double>(elapsed.count()) / static_cast<double>(perProducer * producerCount);
+	}
+
+	/// <summary>
+	/// Bounces a value between this thread and an echo thread through a request queue and a reply queue.
+	/// </summary>
+	/// <returns>Wall-clock nanoseconds per round trip.</returns>
+	template<typename TQueue>
+	static double MeasureRoundTrip()
+	{
+		using Clock = chrono::steady_clock;
+
+		TQueue requests(QueueCapacity);
+		TQueue replies(QueueCapacity);
+		thread echo([&requests, &replies]
+		{
+			for (size_t i = 0; i < RoundTripsPerRun; ++i)
+			{
+				Push(replies, Pop(requests) + 1);
+			}
+		});
+
+		const auto begin = Clock::now();
+		size_t value = 0;
+		for (size_t i = 0; i < RoundTripsPerRun; ++i)
+		{
+			Push(requests, value);
+			value = Pop(replies);
+		}
+		const auto elapsed = chrono::duration_cast<chrono::nanoseconds>(Clock::now() - begin);
+		DoNotOptimize(value);
+		echo.join();
+
+		return static_cast<double>(elapsed.count()) / static_cast<double>(RoundTripsPerRun);
+	}
+
+	void RunQueueBenchmarks()
+	{
+		BeginSuite("Queue");
+
+		for (const size_t count : { 16_z, 1024_z })
+		{
+			{
+				UnboundedFifo<Deque<size_t>> queue;
+				Report("Queue", "FIFO/Deque", count, MeasureFifo(queue, count));
+			}
+			{
+				UnboundedFifo<Vector<size_t>> queue;
+				Report("Queue", "FIFO/Vector", count, MeasureFifo(queue, count));
+			}
+			{
+				MutexVectorQueue<size_t> queue(count + 1);
+				Report("Queue", "FIFO/MutexVector", count, MeasureFifo(queue, count));
+			}
+			{
+				SpscQueue<size_t> queue(count + 1);
+				Report("Queue", "FIFO/SpscQueue", count, MeasureFifo(queue, count));
+			}
+			{
+				MpscQueue<size_t> queue(count + 1);
+				Report("Queue", "FIFO/MpscQueue", count, MeasureFifo(queue, count));
+			}
+		}
+
+		Report("Queue", "Throughput/MutexVector", 1_z, MeasureThroughput<MutexVectorQueue<size_t>>(1_z));
+		Report("Queue", "Throughput/SpscQueue", 1_z, MeasureThroughput<SpscQueue<size_t>>(1_z));
+		const size_t hardwareThreads = max(thread::hardware_concurrency(), 2u);
+		for (size_t producerCount = 1; producerCount <= max(hardwareThreads - 1, 4_z); producerCount *= 2)
+		{
+			if (producerCount > 1)
+			{
+				Report("Queue", "Throughput/MutexVector", producerCount, MeasureThroughput<MutexVectorQueue<size_t>>(producerCount));
+			}
+			Report("Queue", "Throughput/MpscQueue", producerCount, MeasureThroughput<MpscQueue<size_t>>(producerCount));
+		}
+
+		Report("Queue", "RoundTrip/MutexVector", 1_z, MeasureRoundTrip<MutexVectorQueue<size_t>>());
+		Report("Queue", "RoundTrip/SpscQueue", 1_z, MeasureRoundTrip<SpscQueue<size_t>>());
+		Report("Queue", "RoundTrip/MpscQueue", 1_z, MeasureRoundTrip<MpscQueue<size_t>>());
+	}
+}
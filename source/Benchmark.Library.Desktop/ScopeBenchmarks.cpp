@@ -0,0 +1,170 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "Scope.h"
+#include "MemoryStatistics.h"
+#include <optional>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Builds a Scope with count integer attributes named like the ones the JSON content declares.
+	/// </summary>
+	static vector<string> PopulateScope(Scope& scope, size_t count)
+	{
+		vector<string> names;
+		names.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			names.push_back("Attribute" + to_string(i));
+			scope.Append(names.back()) = static_cast<int>(i);
+		}
+
+		shuffle(names.begin(), names.end(), mt19937_64(count));
+		return names;
+	}
+
+	/// <summary>
+	/// Builds a world of count entity Scopes the way a prototype loaded from content looks: a few long strings and a skeleton's worth of matrices
+	/// each, which copies of the world almost never change.
+	/// </summary>
+	static void PopulateWorld(Scope& world, size_t count)
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			Scope& entity = world.AppendScope("Entity");
+			entity.Append("Name") = "Prototype entity number " + to_string(i);
+			Datum& tags = entity.Append("Tags");
+			tags.SetType(Datum::DatumTypes::String);
+			for (const char* tag : { "Category/Creature/Hostile", "Faction/Northern Raiders", "Loot/Common Drop Table" })
+			{
+				tags.PushBack(string(tag));
+			}
+			entity.Append("Transform") = glm::mat4(1.0f);
+			Datum& bones = entity.Append("Bones");
+			bones.SetType(Datum::DatumTypes::Matrix);
+			bones.Resize(16_z, glm::mat4(1.0f));
+			entity.Append("Health") = 100;
+			entity.Append("Position") = glm::vec4(static_cast<float>(i));
+		}
+	}
+
+	/// <summary>
+	/// Times copying a world of count entities, and reports the bytes the copy adds, when MemoryStatistics is enabled, and what changing one string in each copied entity costs.
+	/// </summary>
+	static void RunCloneBenchmarks(size_t count)
+	{
+		Scope world;
+		PopulateWorld(world, count);
+
+		optional<Scope> clone;
+		Report("Scope", "CloneWorld", count, Measure(count, [&clone] { clone.reset(); }, [&clone, &world]
+		{
+			clone.emplace(world);
+			DoNotOptimize(clone->Size());
+		}));
+
+		if constexpr (MemoryStatistics::Enabled)
+		{
+			clone.reset();
+			const size_t bytesBefore = MemoryStatistics::Report().TotalBytes();
+			clone.emplace(world);
+			const size_t bytesAfter = MemoryStatistics::Report().TotalBytes();
+			Report("Scope", "CloneWorld/Bytes", count, static_cast<double>(bytesAfter - bytesBefore) / static_cast<double>(count), "bytes/entity");
+		}
+
+		Report("Scope", "CloneWorld+Rename", count, Measure(count, [&clone, &world] { clone.emplace(world); }, [&clone]
+		{
+			Datum& entities = clone->At("Entity");
+			for (size_t i = 0; i < entities.Size(); ++i)
+			{
+				entities.GetScope(i).At("Name").GetString() += " (copy)";
+			}
+			DoNotOptimize(entities.Size());
+		}));
+	}
+
+	/// <summary>
+	/// Reports the bytes per entity a world of count transforms costs when every value is widened to int, vec4 and mat4, against the same
+	/// entities stored as the types they actually are.
+	/// </summary>
+	static void RunCompactTypeBenchmarks(size_t count)
+	{
+		const auto measureBytes = [count](auto populate)
+		{
+			const size_t bytesBefore = MemoryStatistics::Report().TotalBytes();
+			optional<Scope> world(in_place);
+			for (size_t i = 0; i < count; ++i)
+			{
+				populate(world->AppendScope("Entity"), i);
+			}
+			const size_t bytesAfter = MemoryStatistics::Report().TotalBytes();
+			return static_cast<double>(bytesAfter - bytesBefore) / static_cast<double>(count);
+		};
+
+		Report("Scope", "WideEntity/Bytes", count, measureBytes([](Scope& entity, size_t i)
+		{
+			entity.Append("Visible") = 1;
+			entity.Append("Id") = static_cast<int>(i);
+			entity.Append("Age") = static_cast<float>(i);
+			entity.Append("Offset") = glm::vec4(static_cast<float>(i));
+			entity.Append("Position") = glm::vec4(static_cast<float>(i));
+			entity.Append("Rotation") = glm::mat4(1.0f);
+			entity.Append("Scale") = glm::mat4(1.0f);
+		}), "bytes/entity");
+
+		Report("Scope", "CompactEntity/Bytes", count, measureBytes([](Scope& entity, size_t i)
+		{
+			entity.Append("Visible") = true;
+			entity.Append("Id") = static_cast<std::int64_t>(i);
+			entity.Append("Age") = static_cast<double>(i);
+			entity.Append("Offset") = glm::vec2(static_cast<float>(i));
+			entity.Append("Position") = glm::vec3(static_cast<float>(i));
+			entity.Append("Rotation") = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+			entity.Append("Scale") = glm::mat3(1.0f);
+		}), "bytes/entity");
+	}
+
+	void RunScopeBenchmarks()
+	{
+		BeginSuite("Scope");
+
+		Report("Scope", "sizeof(Scope)", 1, static_cast<double>(sizeof(Scope)), "bytes");
+		Report("Scope", "sizeof(HashMap<string, Datum>)", 1, static_cast<double>(sizeof(HashMap<const string, Datum>)), "bytes");
+
+		for (const size_t count : { 4_z, 16_z, 256_z })
+		{
+			Scope scope;
+			const vector<string> names = PopulateScope(scope, count);
+
+			Report("Scope", "Find", count, Measure(count, [&scope, &names]
+			{
+				size_t found = 0;
+				for (const string& name : names)
+				{
+					found += scope.Find(name)->Size();
+				}
+				DoNotOptimize(found);
+			}));
+
+			Scope& child = scope.AppendScope("Child").AppendScope("Grandchild");
+			Report("Scope", "SearchFromGrandchild", count, Measure(count, [&child, &names]
+			{
+				size_t found = 0;
+				for (const string& name : names)
+				{
+					found += child.Search(name)->Size();
+				}
+				DoNotOptimize(found);
+			}));
+		}
+
+		RunCloneBenchmarks(10000);
+		if constexpr (MemoryStatistics::Enabled)
+		{
+			RunCompactTypeBenchmarks(10000);
+		}
+	}
+}
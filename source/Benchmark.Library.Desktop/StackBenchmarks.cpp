@@ -0,0 +1,164 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "ActionExpression.h"
+#include "TypeManager.h"
+#include "JsonParseCoordinator.h"
+#include "JsonTableParseHelper.h"
+#include "Stack.h"
+#include "ContiguousStack.h"
+#include <sstream>
+#include <stack>
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Builds an infix expression of termCount parenthesized terms, so the operator stack rises and falls throughout.
+	/// Every divisor is non-zero.
+	/// </summary>
+	static string MakeExpression(size_t termCount)
+	{
+		string expression;
+		for (size_t i = 0; i < termCount; ++i)
+		{
+			const char digit = static_cast<char>('1' + i % 9);
+			expression += (i > 0 ? "+" : "");
+			expression += "((";
+			expression += digit;
+			expression += "+2)*(3-";
+			expression += digit;
+			expression += ")/(4+1))";
+		}
+		return expression;
+	}
+
+	/// <summary>
+	/// Builds a chain of depth nested Scope tables, each with one integer attribute, so the parse helper's context stack grows to depth.
+	/// </summary>
+	static string MakeDeepJson(size_t depth)
+	{
+		ostringstream json;
+		for (size_t i = 0; i < depth; ++i)
+		{
+			json << "{ \"X\": { \"type\": \"integer\", \"value\": " << i << " }, \"Child\": { \"type\": \"table\", \"value\": ";
+		}
+		json << "{ \"X\": { \"type\": \"integer\", \"value\": 0 } }";
+		for (size_t i = 0; i < depth; ++i)
+		{
+			json << " } }";
+		}
+		return json.str();
+	}
+
+	void RunStackBenchmarks()
+	{
+		BeginSuite("Stack");
+
+		for (const size_t count : { 16_z, 256_z, 4096_z })
+		{
+			Report("Stack", "PushPop/Stack", count, Measure(2_z * count, [count]
+			{
+				Stack<size_t> stack;
+				for (size_t i = 0; i < count; ++i)
+				{
+					stack.Push(i);
+				}
+				size_t sum = 0;
+				while (!stack.IsEmpty())
+				{
+					sum += stack.Top();
+					stack.Pop();
+				}
+				DoNotOptimize(sum);
+			}));
+
+			Report("Stack", "PushPop/ContiguousStack", count, Measure(2_z * count, [count]
+			{
+				ContiguousStack<size_t> stack;
+				for (size_t i = 0; i < count; ++i)
+				{
+					stack.Push(i);
+				}
+				size_t sum = 0;
+				while (!stack.IsEmpty())
+				{
+					sum += stack.Top();
+					stack.Pop();
+				}
+				DoNotOptimize(sum);
+			}));
+
+			Report("Stack", "PushPop/std::stack", count, Measure(2_z * count, [count]
+			{
+				stack<size_t> stack;
+				for (size_t i = 0; i < count; ++i)
+				{
+					stack.push(i);
+				}
+				size_t sum = 0;
+				while (!stack.empty())
+				{
+					sum += stack.top();
+					stack.pop();
+				}
+				DoNotOptimize(sum);
+			}));
+
+			Report("Stack", "PushPop/std::stack<vector>", count, Measure(2_z * count, [count]
+			{
+				stack<size_t, vector<size_t>> stack;
+				for (size_t i = 0; i < count; ++i)
+				{
+					stack.push(i);
+				}
+				size_t sum = 0;
+				while (!stack.empty())
+				{
+					sum += stack.top();
+					stack.pop();
+				}
+				DoNotOptimize(sum);
+			}));
+		}
+
+		TypeManager::AddType(Action::TypeIdClass(), Action::Signatures());
+		TypeManager::AddType(ActionExpression::TypeIdClass(), ActionExpression::Signatures());
+
+		ActionExpression action;
+		for (const size_t termCount : { 1_z, 16_z, 256_z })
+		{
+			const string infix = MakeExpression(termCount);
+			const string postfix = action.ConvertInfixToPostfix(infix);
+
+			Report("Stack", "ConvertInfixToPostfix", infix.size(), Measure(infix.size(), [&action, &infix]
+			{
+				DoNotOptimize(action.ConvertInfixToPostfix(infix).size());
+			}));
+
+			Report("Stack", "Evaluate", postfix.size(), Measure(postfix.size(), [&action, &postfix]
+			{
+				DoNotOptimize(static_cast<size_t>(action.Evaluate(postfix)));
+			}));
+		}
+
+		ScopeFactory scopeFactory;
+		for (const size_t depth : { 8_z, 64_z, 256_z })
+		{
+			const string json = MakeDeepJson(depth);
+			Report("Stack", "ParseDeepJson", depth, Measure(depth, [&json]
+			{
+				Scope root;
+				JsonTableParseHelper::SharedData sharedData(root);
+				JsonParseCoordinator parseCoordinator(sharedData);
+				JsonTableParseHelper parseHelper;
+				parseCoordinator.AddHelper(parseHelper);
+				parseCoordinator.Parse(json);
+				DoNotOptimize(root.Size());
+			}));
+		}
+
+		TypeManager::Clear();
+	}
+}
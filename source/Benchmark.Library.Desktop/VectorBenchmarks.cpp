@@ -0,0 +1,72 @@
+#include "pch.h"
+#include "Benchmark.h"
+#include "Vector.h"
+
+using namespace FIEAGameEngine;
+using namespace std;
+
+namespace Benchmarks
+{
+	/// <summary>
+	/// Grows and erases from a Vector of T, with std::vector as the reference.
+	/// makeValue turns an index into an element, so the same workload runs for trivially and non-trivially relocatable types.
+	/// </summary>
+	template<typename T, typename TMakeValue>
+	static void RunVectorBenchmarks(const string& label, size_t count, TMakeValue makeValue)
+	{
+		vector<T> values;
+		values.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			values.push_back(makeValue(i));
+		}
+
+		Report("Vector", "PushBack/" + label, count, Measure(count, [&values]
+		{
+			Vector<T> container;
+			for (const T& value : values)
+			{
+				container.PushBack(value);
+			}
+			DoNotOptimize(container.Size());
+		}));
+
+		Report("Vector", "PushBack/std::vector/" + label, count, Measure(count, [&values]
+		{
+			vector<T> container;
+			for (const T& value : values)
+			{
+				container.push_back(value);
+			}
+			DoNotOptimize(container.size());
+		}));
+
+		Vector<T> source;
+		for (const T& value : values)
+		{
+			source.PushBack(value);
+		}
+
+		// Erasing from the front shifts every remaining element, so this is dominated by relocation.
+		const size_t removals = std::min(count, 256_z);
+		Vector<T> container;
+		Report("Vector", "RemoveFront/" + label, count, Measure(removals, [&container, &source] { container = source; }, [&container, removals]
+		{
+			for (size_t i = 0; i < removals; ++i)
+			{
+				container.Remove(container.begin());
+			}
+		}));
+	}
+
+	void RunVectorBenchmarks()
+	{
+		BeginSuite("Vector");
+
+		for (const size_t count : { 64_z, 4096_z, 65536_z })
+		{
+			RunVectorBenchmarks<int>("int", count, [](size_t i) { return static_cast<int>(i); });
+			RunVectorBenchmarks<string>("string", count, [](size_t i) { return "Attribute" + to_string(i); });
+		}
+	}
+}
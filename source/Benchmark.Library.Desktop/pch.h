@@ -0,0 +1,25 @@
+#pragma once
+
+#ifndef UNREFERENCED_LOCAL
+#define UNREFERENCED_LOCAL(P) static_cast<void>(P)
+#endif
+
+// C++ Guideline Support Library
+#include <gsl/gsl>
+
+// OpenGL Mathematics, needed by Datum
+#include <glm/gtx/string_cast.hpp>
+
+// Standard
+#include <cstdlib>
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "SizeLiteral.h"
@@ -33,9 +33,9 @@ namespace FIEAGameEngine
 		_target = target;
 	}
 
-	const Vector<Signature> Action::Signatures()
+	const SignatureList Action::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(Action, _name) },
 			{TargetStringLiteral, Datum::DatumTypes::String, 1, offsetof(Action, _target) },
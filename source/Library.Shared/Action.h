@@ -74,7 +74,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an Action with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an Action.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 		///// <summary>
 		///// An override on the clone function which provides a heap allocated object of an Action.
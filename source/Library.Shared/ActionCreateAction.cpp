@@ -22,9 +22,9 @@ namespace FIEAGameEngine
 		worldState.AddCreateAction(WorldState::CreateAction(_actionToCreateName, _className, _target, *_parent));
 	}
 
-	const Vector<Signature> ActionCreateAction::Signatures()
+	const SignatureList ActionCreateAction::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{ NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionCreateAction, _name) },
 			{ TargetStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionCreateAction, _target) },
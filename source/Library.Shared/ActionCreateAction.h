@@ -62,7 +62,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an ActionCreateAction with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an ActionCreateAction.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	private:
 		/// <summary>
@@ -22,9 +22,9 @@ namespace FIEAGameEngine
 		worldState.AddDestroyAction(WorldState::DestroyAction(_actionToDeleteName, *_parent));
 	}
 
-	const Vector<Signature> ActionDestroyAction::Signatures()
+	const SignatureList ActionDestroyAction::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{ NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionDestroyAction, _name) },
 			{ ActionToDeleteStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionDestroyAction, _actionToDeleteName) }
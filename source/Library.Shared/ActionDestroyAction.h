@@ -64,7 +64,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an ActionDestroyAction with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an ActionDestroyAction.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	private:
 		/// <summary>
@@ -48,9 +48,9 @@ namespace FIEAGameEngine
 		worldState._eventQueue->Enqueue(actionEvent, worldState.GetGameTime(), (std::chrono::milliseconds) _delay);
 	}
 
-	const Vector<Signature> ActionEvent::Signatures()
+	const SignatureList ActionEvent::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ SubtypeStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionEvent, _subtype) },
 			{ DelayStringLiteral, Datum::DatumTypes::Integer, 1, offsetof(ActionEvent, _delay) }
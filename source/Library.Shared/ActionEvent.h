@@ -91,7 +91,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an ActionEvent with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an ActionEvent.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	protected:
 		/// <summary>
@@ -57,7 +57,7 @@ namespace FIEAGameEngine
 
 	string ActionExpression::ConvertInfixToPostfix(const string& infixExpression)
 	{
-		Stack<char> stack;
+		ContiguousStack<char, 32> stack;
 		Vector<char> queue;
 		std::string postfixExpression;
 
@@ -122,7 +122,7 @@ namespace FIEAGameEngine
 
 	int ActionExpression::Evaluate(const string& postfixExpression)
 	{
-		Stack<int> stack;
+		ContiguousStack<int, 32> stack;
 
 		for (size_t i = 0; i < postfixExpression.size(); ++i)
 		{
@@ -172,9 +172,9 @@ namespace FIEAGameEngine
 		return (character == '+' || character == '-' || character == '*' || character == '/' || character == '^' || character == '(' || character == '%');
 	}
 
-	const Vector<Signature> ActionExpression::Signatures()
+	const SignatureList ActionExpression::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{ NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionExpression, _name) },
 			{ TargetStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionExpression, _target) },
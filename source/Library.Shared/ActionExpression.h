@@ -3,7 +3,7 @@
 #include "Action.h"
 #include "TypeManager.h"
 #include "WorldState.h"
-#include "Stack.h"
+#include "ContiguousStack.h"
 #include "Vector.h"
 
 namespace FIEAGameEngine
@@ -111,7 +111,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an ActionExpression with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an ActionExpression.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	private:
 		/// <summary>
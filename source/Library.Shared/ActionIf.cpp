@@ -11,7 +11,7 @@ namespace FIEAGameEngine
 
 	}
 
-	const bool ActionIf::Condition() const
+	bool ActionIf::Condition() const
 	{
 		return _condition;
 	}
@@ -48,9 +48,9 @@ namespace FIEAGameEngine
 		ActionList& actionList = static_cast<ActionList&>(*scope);
 		actionList.Update(worldState);
 	}
-	const Vector<Signature> ActionIf::Signatures()
+	const SignatureList ActionIf::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionIf, _name) },
 			{ConditionStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionIf, _target) },
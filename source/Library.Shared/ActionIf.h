@@ -53,7 +53,7 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Returns the bool condition this action is set to.
 		/// </summary>
-		const bool Condition() const;
+		bool Condition() const;
 		/// <summary>
 		/// Sets the bool condition of this action.
 		/// </summary>
@@ -74,7 +74,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an ActionIf with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an ActionIf.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	private:
 		/// <summary>
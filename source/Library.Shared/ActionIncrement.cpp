@@ -56,9 +56,9 @@ namespace FIEAGameEngine
 
 		foundTarget->Set(foundTarget->GetInteger() + _step);
 	}
-	const Vector<Signature> ActionIncrement::Signatures()
+	const SignatureList ActionIncrement::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionIncrement, _name) },
 			{TargetStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionIncrement, _target) },
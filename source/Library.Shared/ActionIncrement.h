@@ -88,7 +88,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an ActionIncrement with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an ActionIncrement.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	private:
 		/// <summary>
@@ -64,9 +64,9 @@ namespace FIEAGameEngine
 		}
 	}
 
-	const Vector<Signature> ActionList::Signatures()
+	const SignatureList ActionList::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(ActionList, _name) },
 			{ ActionStringLiteral, Datum::DatumTypes::Table, 0, 0 }
@@ -89,7 +89,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an ActionList with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an ActionList.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	protected:
 		/// <summary>
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include "MemoryResource.h"
+
+/// <summary>
+/// Lets a member of an empty type, such as a stateless hash, equality or allocator policy, take up no space in its owner.
+/// MSVC only honors its own spelling of the attribute.
+/// </summary>
+#if defined(_MSC_VER)
+#define FIEA_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#else
+#define FIEA_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Allocator policy the containers use when none is given: malloc, realloc and free.
+	/// An allocator policy hands out untyped memory, so one policy type serves a container and everything it allocates internally,
+	/// such as a HashMap's bucket Vector and its SList nodes. A policy provides Allocate, Reallocate and Deallocate with these
+	/// signatures and operator==, which must be true when memory from one instance can be given back to the other.
+	/// Containers copy their policy on copy and move, so both sides keep allocating from the same place.
+	/// </summary>
+	struct DefaultAllocator final
+	{
+		/// <summary>
+		/// Provides size bytes aligned to alignment.
+		/// </summary>
+		/// <param name="size">The number of bytes needed.</param>
+		/// <param name="alignment">At most alignof(std::max_align_t).</param>
+		/// <returns>The memory.</returns>
+		void* Allocate(size_t size, size_t alignment) const;
+		/// <summary>
+		/// Resizes memory from this allocator, keeping the first min(oldSize, newSize) bytes.
+		/// </summary>
+		/// <param name="memory">The memory, or null to allocate.</param>
+		/// <param name="oldSize">The size it was allocated with.</param>
+		/// <param name="newSize">The size needed.</param>
+		/// <param name="alignment">The alignment it was allocated with.</param>
+		/// <returns>The resized memory, which may be at a new address.</returns>
+		void* Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment) const;
+		/// <summary>
+		/// Returns memory from this allocator.
+		/// </summary>
+		/// <param name="memory">The memory, or null to do nothing.</param>
+		/// <param name="size">The size it was allocated with.</param>
+		/// <param name="alignment">The alignment it was allocated with.</param>
+		void Deallocate(void* memory, size_t size, size_t alignment) const;
+
+		bool operator==(const DefaultAllocator&) const { return true; }
+		bool operator!=(const DefaultAllocator&) const { return false; }
+	};
+
+	/// <summary>
+	/// Allocator policy that forwards to a MemoryResource chosen at runtime, such as a MonotonicResource for a level's Scope tree.
+	/// Costs one pointer in each container that uses it.
+	/// </summary>
+	class ResourceAllocator final
+	{
+	public:
+		/// <summary>
+		/// Creates an allocator for a resource.
+		/// </summary>
+		/// <param name="resource">The resource to allocate from. Null means DefaultResource.</param>
+		ResourceAllocator(MemoryResource* resource = nullptr);
+
+		void* Allocate(size_t size, size_t alignment) const;
+		void* Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment) const;
+		void Deallocate(void* memory, size_t size, size_t alignment) const;
+
+		/// <summary>
+		/// Provides the resource this allocator forwards to.
+		/// </summary>
+		/// <returns>The resource. Never null.</returns>
+		MemoryResource* Resource() const;
+
+		bool operator==(const ResourceAllocator& other) const;
+		bool operator!=(const ResourceAllocator& other) const;
+
+	private:
+		/// <summary>
+		/// The resource this allocator forwards to. Never null.
+		/// </summary>
+		MemoryResource* _resource;
+	};
+
+	inline void* DefaultAllocator::Allocate(size_t size, [[maybe_unused]] size_t alignment) const
+	{
+		assert(alignment <= alignof(std::max_align_t));
+		return malloc(size);
+	}
+
+	inline void* DefaultAllocator::Reallocate(void* memory, size_t, size_t newSize, [[maybe_unused]] size_t alignment) const
+	{
+		assert(alignment <= alignof(std::max_align_t));
+		return realloc(memory, newSize);
+	}
+
+	inline void DefaultAllocator::Deallocate(void* memory, size_t, size_t) const
+	{
+		free(memory);
+	}
+
+	inline ResourceAllocator::ResourceAllocator(MemoryResource* resource) :
+		_resource(resource != nullptr ? resource : &DefaultResource())
+	{
+	}
+
+	inline void* ResourceAllocator::Allocate(size_t size, size_t alignment) const
+	{
+		return _resource->Allocate(size, alignment);
+	}
+
+	inline void* ResourceAllocator::Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment) const
+	{
+		return memory == nullptr ? _resource->Allocate(newSize, alignment) : _resource->Reallocate(memory, oldSize, newSize, alignment);
+	}
+
+	inline void ResourceAllocator::Deallocate(void* memory, size_t size, size_t alignment) const
+	{
+		if (memory != nullptr)
+		{
+			_resource->Deallocate(memory, size, alignment);
+		}
+	}
+
+	inline MemoryResource* ResourceAllocator::Resource() const
+	{
+		return _resource;
+	}
+
+	inline bool ResourceAllocator::operator==(const ResourceAllocator& other) const
+	{
+		return _resource == other._resource;
+	}
+
+	inline bool ResourceAllocator::operator!=(const ResourceAllocator& other) const
+	{
+		return !operator==(other);
+	}
+}
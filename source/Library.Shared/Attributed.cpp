@@ -52,7 +52,7 @@ namespace FIEAGameEngine
 		if (name.compare("this") == 0) { return true; } 
 		if (IsAttribute(name)) 
 		{ 
-			Vector<Signature> signatures = TypeManager::GetSignaturesForType(TypeIdInstance()); 
+			const SignatureList& signatures = TypeManager::GetSignaturesForType(TypeIdInstance()); 
 			auto it = std::find_if(signatures.begin(), signatures.end(), [&name](const Signature& signature) { return signature.Name == name; }); 
 			return it != signatures.end(); 
 		} 
@@ -74,13 +74,13 @@ namespace FIEAGameEngine
 	}
 
 
-	const Vector<Scope::PairType*>& Attributed::Attributes() const
+	const Scope::OrderType& Attributed::Attributes() const
 	{
 		return _order;
 	}
 
 	Vector<Scope::PairType*> Attributed::PrescribedAttributes() const {
-		const auto signatures = TypeManager::GetSignaturesForType(TypeIdInstance()); 
+		const auto& signatures = TypeManager::GetSignaturesForType(TypeIdInstance()); 
 		Vector<PairType*> prescribedAttributes; 
 		size_t prescribedAttributeCount = signatures.Size() + 1; // +1 for the "this" attribute 
 		prescribedAttributes.Reserve(prescribedAttributeCount); 
@@ -93,7 +93,7 @@ namespace FIEAGameEngine
 
 	Vector<Scope::PairType*> Attributed::AuxiliaryAttributes() const 
 	{
-		const auto signatures = TypeManager::GetSignaturesForType(TypeIdInstance()); 
+		const auto& signatures = TypeManager::GetSignaturesForType(TypeIdInstance()); 
 		Vector<PairType*> auxiliaryAttributes; 
 		size_t auxiliaryAttributeBeginIndex = signatures.Size() + 1; // +1 for the "this" attribute 
 		auxiliaryAttributes.Reserve(_order.Size() - auxiliaryAttributeBeginIndex); 
@@ -106,7 +106,7 @@ namespace FIEAGameEngine
 
 	void Attributed::Populate(RTTI::IdType typeId)
 	{
-		Vector<Signature> signatures = TypeManager::GetSignaturesForType(typeId);
+		const SignatureList& signatures = TypeManager::GetSignaturesForType(typeId);
 		for (const Signature& signature : signatures)
 		{
 			assert(signature.Type != Datum::DatumTypes::Unknown);
@@ -132,7 +132,7 @@ namespace FIEAGameEngine
 
 	void Attributed::UpdateExternalStorage(RTTI::IdType typeId) 
 	{
-		const auto signatures = TypeManager::GetSignaturesForType(typeId); 
+		const auto& signatures = TypeManager::GetSignaturesForType(typeId); 
 		assert(_order.Size() >= signatures.Size() + 1); // +1 for "this" 
 		for (size_t i = 1; i < signatures.Size() + 1; ++i) 
 		{ 
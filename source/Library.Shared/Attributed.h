@@ -81,8 +81,8 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Accessor method which provides all attributes in the object.
 		/// </summary>
-		/// <returns>A const reference to the Vector of pointers to the string, datum pairs within this object.</returns>
-		const Vector<Scope::PairType*>& Attributes() const;
+		/// <returns>A const reference to the list of pointers to the string, datum pairs within this object, in insertion order.</returns>
+		const Scope::OrderType& Attributes() const;
 		/// <summary>
 		/// Accessor method which provides all prescribed attributes in the object. These are all attributes that existed at construction.
 		/// </summary>
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include "HashMap.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// A HashMap that may be used from several threads at once, meant for process-wide registries such as the factories and the TypeManager.
+	/// Entries are spread over a fixed number of shards, each a HashMap guarded by its own reader-writer lock, so lookups only
+	/// contend with writers that land in the same shard and never with each other.
+	/// No iterators are handed out, since they could not hold the shard's lock. Find instead returns a pointer to the stored value.
+	/// Shards are chained HashMaps, whose nodes never move, so that pointer stays valid until its key is removed or the map is cleared.
+	/// </summary>
+	/// <typeparam name="TKey">The type of the key.</typeparam>
+	/// <typeparam name="TValue">The type of the value.</typeparam>
+	/// <typeparam name="THash">Hash policy. The high bits of the hash choose the shard, and lookups hand the same hash on to the shard's HashMap.</typeparam>
+	/// <typeparam name="TEquality">Equality policy. Lookups by another type are allowed when both policies are transparent.</typeparam>
+	template<typename TKey, typename TValue, typename THash = DefaultHash<TKey>, typename TEquality = DefaultEquality<TKey>>
+	class ConcurrentHashMap final
+	{
+	public:
+		using MapType = HashMap<TKey, TValue, THash, TEquality>;
+		using PairType = typename MapType::PairType;
+		using HashFunctor = THash;
+		using EqualityFunctor = TEquality;
+
+		/// <summary>
+		/// Number of shards used when none is given. Enough that a handful of threads rarely meet in one shard.
+		/// </summary>
+		static constexpr size_t DefaultShardCount = 16;
+
+		/// <summary>
+		/// Creates an empty ConcurrentHashMap.
+		/// </summary>
+		/// <param name="shardCount">The number of independently locked shards. Rounded up to a power of two.</param>
+		/// <param name="bucketsPerShard">The initial bucket count of each shard's HashMap.</param>
+		/// <param name="hFunctor">The hash policy.</param>
+		/// <param name="eqFunctor">The equality policy.</param>
+		/// <exception cref="std::runtime_error">Thrown when shardCount or bucketsPerShard is 0.</exception>
+		explicit ConcurrentHashMap(size_t shardCount = DefaultShardCount, size_t bucketsPerShard = 11_z, HashFunctor hFunctor = HashFunctor{}, EqualityFunctor eqFunctor = EqualityFunctor{});
+		ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+		ConcurrentHashMap(ConcurrentHashMap&&) = delete;
+		ConcurrentHashMap& operator=(const ConcurrentHashMap&) = delete;
+		ConcurrentHashMap& operator=(ConcurrentHashMap&&) = delete;
+		~ConcurrentHashMap() = default;
+
+		/// <summary>
+		/// Copies an entry into the map unless its key is already present.
+		/// </summary>
+		/// <param name="entry">The pair to insert.</param>
+		/// <returns>Whether the entry was inserted.</returns>
+		bool Insert(const PairType& entry);
+		/// <summary>
+		/// Moves an entry into the map unless its key is already present, in which case entry is left untouched.
+		/// </summary>
+		/// <param name="entry">The pair to insert.</param>
+		/// <returns>Whether the entry was inserted.</returns>
+		bool Insert(PairType&& entry);
+		/// <summary>
+		/// Inserts key with a TValue constructed in place from args, unless the key is already present.
+		/// The check and the insert happen under one lock, so of several threads racing to add a key exactly one succeeds.
+		/// </summary>
+		/// <param name="key">The key to insert.</param>
+		/// <param name="args">Arguments forwarded to the constructor of TValue.</param>
+		/// <returns>Whether the entry was inserted.</returns>
+		template <typename... TArgs>
+		bool TryEmplace(const TKey& key, TArgs&&... args);
+		/// <summary>
+		/// Moves key into the map with a TValue constructed in place from args, unless the key is already present.
+		/// </summary>
+		/// <param name="key">The key to insert.</param>
+		/// <param name="args">Arguments forwarded to the constructor of TValue.</param>
+		/// <returns>Whether the entry was inserted.</returns>
+		template <typename... TArgs>
+		bool TryEmplace(std::remove_const_t<TKey>&& key, TArgs&&... args);
+
+		/// <summary>
+		/// Removes the entry with the given key, if there is one.
+		/// Any pointer Find returned for that key dangles afterwards, so removal is for keys no other thread is still using.
+		/// </summary>
+		/// <param name="key">The key to remove.</param>
+		/// <returns>Whether an entry was removed.</returns>
+		bool Remove(const TKey& key);
+		/// <summary>
+		/// Removes every entry. Same caveat as Remove, for every key.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Finds the value stored for a key.
+		/// </summary>
+		/// <param name="key">A TKey, or another type when both policies are transparent.</param>
+		/// <returns>The stored value, valid until its key is removed, or nullptr if the key is not present.</returns>
+		template <typename TLookup>
+		const TValue* Find(const TLookup& key) const;
+		/// <summary>
+		/// Checks whether a key is present.
+		/// </summary>
+		/// <param name="key">A TKey, or another type when both policies are transparent.</param>
+		/// <returns>True if the key is present.</returns>
+		template <typename TLookup>
+		bool ContainsKey(const TLookup& key) const;
+
+		/// <summary>
+		/// Calls func with every entry, one shard at a time while holding that shard's read lock.
+		/// Entries inserted or removed by other threads during the walk may or may not be seen. func must not write to this map.
+		/// </summary>
+		/// <param name="func">Callable taking a const PairType&.</param>
+		template <typename TFunc>
+		void ForEach(TFunc func) const;
+
+		/// <summary>
+		/// Provides the number of entries. Only a snapshot while other threads are writing.
+		/// </summary>
+		/// <returns>The number of entries.</returns>
+		size_t Size() const;
+		/// <summary>
+		/// Checks whether the map has no entries. Only a snapshot while other threads are writing.
+		/// </summary>
+		/// <returns>True if the map is empty.</returns>
+		bool IsEmpty() const;
+		/// <summary>
+		/// Provides the number of shards, after rounding up.
+		/// </summary>
+		/// <returns>The number of shards.</returns>
+		size_t ShardCount() const;
+
+	private:
+		/// <summary>
+		/// A lock and the part of the map it guards. Each shard gets its own cache line so that threads locking neighbouring shards do not contend.
+		/// </summary>
+		struct alignas(64) Shard final
+		{
+			mutable std::shared_mutex _mutex;
+			MapType _map;
+		};
+
+		/// <summary>
+		/// Chooses the shard for a hash from its high bits, which the shard's own bucket index does not depend on.
+		/// </summary>
+		/// <param name="hash">The full hash of a key.</param>
+		/// <returns>The shard that owns the key.</returns>
+		Shard& ShardFor(size_t hash) const;
+
+		/// <summary>
+		/// Odd multiplier derived from the golden ratio, which spreads the hash into the high bits ShardFor uses.
+		/// </summary>
+		static constexpr size_t ShardMixer = static_cast<size_t>(0x9E3779B97F4A7C15ull);
+
+		/// <summary>
+		/// The shards. Never reallocated, so a shard's address is stable.
+		/// </summary>
+		std::unique_ptr<Shard[]> _shards;
+		/// <summary>
+		/// ShardCount() - 1.
+		/// </summary>
+		size_t _shardMask;
+		/// <summary>
+		/// Running count of entries across every shard.
+		/// </summary>
+		std::atomic<size_t> _size{ 0_z };
+		/// <summary>
+		/// The hash policy, applied once per call before a shard is locked.
+		/// </summary>
+		HashFunctor _hashFunctor;
+	};
+}
+
+#include "ConcurrentHashMap.inl"
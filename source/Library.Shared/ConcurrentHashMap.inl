@@ -0,0 +1,171 @@
+#include "ConcurrentHashMap.h"
+
+namespace FIEAGameEngine
+{
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline ConcurrentHashMap<TKey, TValue, THash, TEquality>::ConcurrentHashMap(size_t shardCount, size_t bucketsPerShard, HashFunctor hFunctor, EqualityFunctor eqFunctor) :
+		_hashFunctor(hFunctor)
+	{
+		if (shardCount == 0_z)
+		{
+			throw std::runtime_error("ConcurrentHashMap cannot have 0 shards.");
+		}
+		if (bucketsPerShard == 0_z)
+		{
+			throw std::runtime_error("HashMap cannot have a size of 0.");
+		}
+
+		size_t roundedCount = 1_z;
+		while (roundedCount < shardCount)
+		{
+			roundedCount <<= 1;
+		}
+
+		_shards = std::make_unique<Shard[]>(roundedCount);
+		_shardMask = roundedCount - 1_z;
+		for (size_t i = 0_z; i < roundedCount; ++i)
+		{
+			_shards[i]._map = MapType(bucketsPerShard, hFunctor, eqFunctor);
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline bool ConcurrentHashMap<TKey, TValue, THash, TEquality>::Insert(const PairType& entry)
+	{
+		Shard& shard = ShardFor(_hashFunctor(entry.first));
+		std::unique_lock lock(shard._mutex);
+		const bool wasInserted = shard._map.Insert(entry).second;
+		if (wasInserted)
+		{
+			_size.fetch_add(1_z, std::memory_order_relaxed);
+		}
+		return wasInserted;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline bool ConcurrentHashMap<TKey, TValue, THash, TEquality>::Insert(PairType&& entry)
+	{
+		Shard& shard = ShardFor(_hashFunctor(entry.first));
+		std::unique_lock lock(shard._mutex);
+		const bool wasInserted = shard._map.Insert(std::move(entry)).second;
+		if (wasInserted)
+		{
+			_size.fetch_add(1_z, std::memory_order_relaxed);
+		}
+		return wasInserted;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	template<typename... TArgs>
+	inline bool ConcurrentHashMap<TKey, TValue, THash, TEquality>::TryEmplace(const TKey& key, TArgs&&... args)
+	{
+		Shard& shard = ShardFor(_hashFunctor(key));
+		std::unique_lock lock(shard._mutex);
+		const bool wasInserted = shard._map.TryEmplace(key, std::forward<TArgs>(args)...).second;
+		if (wasInserted)
+		{
+			_size.fetch_add(1_z, std::memory_order_relaxed);
+		}
+		return wasInserted;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	template<typename... TArgs>
+	inline bool ConcurrentHashMap<TKey, TValue, THash, TEquality>::TryEmplace(std::remove_const_t<TKey>&& key, TArgs&&... args)
+	{
+		Shard& shard = ShardFor(_hashFunctor(key));
+		std::unique_lock lock(shard._mutex);
+		const bool wasInserted = shard._map.TryEmplace(std::move(key), std::forward<TArgs>(args)...).second;
+		if (wasInserted)
+		{
+			_size.fetch_add(1_z, std::memory_order_relaxed);
+		}
+		return wasInserted;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline bool ConcurrentHashMap<TKey, TValue, THash, TEquality>::Remove(const TKey& key)
+	{
+		Shard& shard = ShardFor(_hashFunctor(key));
+		std::unique_lock lock(shard._mutex);
+		const size_t previousSize = shard._map.Size();
+		shard._map.Remove(key);
+		const bool wasRemoved = shard._map.Size() != previousSize;
+		if (wasRemoved)
+		{
+			_size.fetch_sub(1_z, std::memory_order_relaxed);
+		}
+		return wasRemoved;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline void ConcurrentHashMap<TKey, TValue, THash, TEquality>::Clear()
+	{
+		for (size_t i = 0_z; i <= _shardMask; ++i)
+		{
+			Shard& shard = _shards[i];
+			std::unique_lock lock(shard._mutex);
+			_size.fetch_sub(shard._map.Size(), std::memory_order_relaxed);
+			shard._map.Clear();
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	template<typename TLookup>
+	inline const TValue* ConcurrentHashMap<TKey, TValue, THash, TEquality>::Find(const TLookup& key) const
+	{
+		const size_t hash = _hashFunctor(key);
+		const Shard& shard = ShardFor(hash);
+		std::shared_lock lock(shard._mutex);
+		// Only the const Find is safe under a shared lock: the non-const one migrates buckets during a resize.
+		const MapType& map = shard._map;
+		auto it = map.Find(key, hash);
+		return it != map.end() ? &it->second : nullptr;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	template<typename TLookup>
+	inline bool ConcurrentHashMap<TKey, TValue, THash, TEquality>::ContainsKey(const TLookup& key) const
+	{
+		return Find(key) != nullptr;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	template<typename TFunc>
+	inline void ConcurrentHashMap<TKey, TValue, THash, TEquality>::ForEach(TFunc func) const
+	{
+		for (size_t i = 0_z; i <= _shardMask; ++i)
+		{
+			const Shard& shard = _shards[i];
+			std::shared_lock lock(shard._mutex);
+			for (const PairType& entry : shard._map)
+			{
+				func(entry);
+			}
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline size_t ConcurrentHashMap<TKey, TValue, THash, TEquality>::Size() const
+	{
+		return _size.load(std::memory_order_relaxed);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline bool ConcurrentHashMap<TKey, TValue, THash, TEquality>::IsEmpty() const
+	{
+		return Size() == 0_z;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline size_t ConcurrentHashMap<TKey, TValue, THash, TEquality>::ShardCount() const
+	{
+		return _shardMask + 1_z;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality>
+	inline typename ConcurrentHashMap<TKey, TValue, THash, TEquality>::Shard& ConcurrentHashMap<TKey, TValue, THash, TEquality>::ShardFor(size_t hash) const
+	{
+		return _shards[((hash * ShardMixer) >> (std::numeric_limits<size_t>::digits / 2)) & _shardMask];
+	}
+}
@@ -0,0 +1,42 @@
+#include "pch.h"
+#include "ContainerStats.h"
+#include <algorithm>
+
+namespace FIEAGameEngine
+{
+	ContainerStats& ContainerStats::operator+=(const ContainerStats& other)
+	{
+		_elementCount += other._elementCount;
+		_bytesAllocated += other._bytesAllocated;
+		_bytesInUse += other._bytesInUse;
+		return *this;
+	}
+
+	std::size_t ContainerStats::BytesOverhead() const
+	{
+		return _bytesAllocated > _bytesInUse ? _bytesAllocated - _bytesInUse : 0_z;
+	}
+
+	HashMapStats& HashMapStats::operator+=(const HashMapStats& other)
+	{
+		_memory += other._memory;
+		_bucketCount += other._bucketCount;
+		_emptyBucketCount += other._emptyBucketCount;
+		_longestChain = std::max(_longestChain, other._longestChain);
+		for (std::size_t i = 0; i < HistogramSize; ++i)
+		{
+			_chainLengths[i] += other._chainLengths[i];
+		}
+		return *this;
+	}
+
+	float HashMapStats::LoadFactor() const
+	{
+		return (_bucketCount == 0) ? 0.0f : static_cast<float>(_memory._elementCount) / static_cast<float>(_bucketCount);
+	}
+
+	float HashMapStats::EmptyBucketRatio() const
+	{
+		return (_bucketCount == 0) ? 0.0f : static_cast<float>(_emptyBucketCount) / static_cast<float>(_bucketCount);
+	}
+}
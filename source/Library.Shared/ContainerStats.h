@@ -0,0 +1,90 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Memory footprint of one container, as reported by its Stats(). Adding several together with += gives the footprint of all of them.
+	/// </summary>
+	struct ContainerStats final
+	{
+		/// <summary>
+		/// Adds the counts of other to these.
+		/// </summary>
+		/// <param name="other">The stats being added.</param>
+		/// <returns>Reference to these stats.</returns>
+		ContainerStats& operator+=(const ContainerStats& other);
+
+		/// <summary>
+		/// Provides the bytes allocated but not holding an element: unused capacity, plus per-node links and bookkeeping.
+		/// </summary>
+		/// <returns>_bytesAllocated minus _bytesInUse, or 0 when the elements are held inline or externally and nothing is allocated for them.</returns>
+		std::size_t BytesOverhead() const;
+
+		/// <summary>
+		/// Number of elements in the container.
+		/// </summary>
+		std::size_t _elementCount{ 0 };
+		/// <summary>
+		/// Bytes the container currently holds from its allocator. Storage inside the container object itself, such as a SmallVector's inline buffer, is not counted,
+		/// and neither is memory the elements own, such as the characters of a std::string.
+		/// </summary>
+		std::size_t _bytesAllocated{ 0 };
+		/// <summary>
+		/// Bytes taken up by the elements themselves.
+		/// </summary>
+		std::size_t _bytesInUse{ 0 };
+	};
+
+	/// <summary>
+	/// What HashMap::Stats reports: its memory and how evenly its keys are spread over the buckets.
+	/// </summary>
+	struct HashMapStats final
+	{
+		/// <summary>
+		/// Number of entries in the chain length histogram.
+		/// </summary>
+		static constexpr std::size_t HistogramSize = 8;
+
+		/// <summary>
+		/// Adds the counts of other to these. The longest chain becomes the longer of the two.
+		/// </summary>
+		/// <param name="other">The stats being added.</param>
+		/// <returns>Reference to these stats.</returns>
+		HashMapStats& operator+=(const HashMapStats& other);
+
+		/// <summary>
+		/// Provides the average number of entries per bucket.
+		/// </summary>
+		/// <returns>The element count divided by the bucket count, or 0 if there are no buckets.</returns>
+		float LoadFactor() const;
+		/// <summary>
+		/// Provides the fraction of buckets that hold no entries.
+		/// </summary>
+		/// <returns>A value between 0 and 1, or 0 if there are no buckets.</returns>
+		float EmptyBucketRatio() const;
+
+		/// <summary>
+		/// Entry count and memory, counting the bucket vectors and every chain node.
+		/// </summary>
+		ContainerStats _memory;
+		/// <summary>
+		/// Number of buckets, including the old ones still being drained by an incremental resize.
+		/// </summary>
+		std::size_t _bucketCount{ 0 };
+		/// <summary>
+		/// Number of buckets with no entries.
+		/// </summary>
+		std::size_t _emptyBucketCount{ 0 };
+		/// <summary>
+		/// Number of entries in the longest chain.
+		/// </summary>
+		std::size_t _longestChain{ 0 };
+		/// <summary>
+		/// Entry i is the number of buckets holding exactly i entries, except the last, which counts the buckets holding HistogramSize - 1 or more.
+		/// </summary>
+		std::array<std::size_t, HistogramSize> _chainLengths{};
+	};
+}
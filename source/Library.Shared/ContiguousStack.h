@@ -0,0 +1,96 @@
+#pragma once
+
+#include "SmallVector.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// A LIFO stack that keeps its elements in one contiguous SmallVector instead of a linked list.
+	/// The first N elements live inside the stack itself, so a short-lived stack that stays shallow never touches the heap,
+	/// and deeper stacks grow by doubling rather than allocating a node per Push.
+	/// Pushing can move the elements, so references returned by Top are invalidated by Push and Reserve.
+	/// </summary>
+	/// <typeparam name="T">The type of element stored in the stack.</typeparam>
+	/// <typeparam name="N">The number of elements stored inline before the first heap allocation.</typeparam>
+	/// <typeparam name="TAllocator">Allocator policy for the heap buffer. See DefaultAllocator.</typeparam>
+	template <typename T, std::size_t N = 8, typename TAllocator = DefaultAllocator>
+	class ContiguousStack final
+	{
+	public:
+		/// <summary>
+		/// Creates an empty stack.
+		/// </summary>
+		/// <param name="capacity">The number of elements to reserve room for up front.</param>
+		/// <param name="allocator">The allocator the heap buffer comes from.</param>
+		explicit ContiguousStack(std::size_t capacity = 0_z, TAllocator allocator = TAllocator{});
+
+		/// <summary>
+		/// Places a copy of value on top of the stack.
+		/// </summary>
+		/// <param name="value">The value to be pushed.</param>
+		void Push(const T& value);
+		/// <summary>
+		/// Moves value on top of the stack.
+		/// </summary>
+		/// <param name="value">The value to be pushed.</param>
+		void Push(T&& value);
+		/// <summary>
+		/// Constructs an element in place on top of the stack.
+		/// Arguments must not refer to elements of this stack, since growing moves them before the new element is constructed.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the constructor of T.</param>
+		/// <returns>A reference to the new top element.</returns>
+		template <typename... TArgs>
+		T& Emplace(TArgs&&... args);
+		/// <summary>
+		/// Removes the top element. Does nothing if the stack is empty.
+		/// </summary>
+		void Pop();
+		/// <summary>
+		/// Provides the top element.
+		/// </summary>
+		/// <returns>A reference to the most recently pushed element.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the stack is empty.</exception>
+		T& Top();
+		/// <summary>
+		/// Provides the top element.
+		/// </summary>
+		/// <returns>A const reference to the most recently pushed element.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the stack is empty.</exception>
+		const T& Top() const;
+
+		/// <summary>
+		/// Provides the number of elements on the stack.
+		/// </summary>
+		/// <returns>The number of elements.</returns>
+		std::size_t Size() const;
+		/// <summary>
+		/// Provides the number of elements the stack can hold before it has to grow.
+		/// </summary>
+		/// <returns>The capacity, never less than N.</returns>
+		std::size_t Capacity() const;
+		/// <summary>
+		/// Determines whether the stack holds no elements.
+		/// </summary>
+		/// <returns>True if the stack is empty.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Makes room for capacity elements, so that many pushes do not allocate. Never shrinks the stack.
+		/// </summary>
+		/// <param name="capacity">The number of elements to make room for.</param>
+		void Reserve(std::size_t capacity);
+		/// <summary>
+		/// Removes every element. Keeps the capacity, so a stack reused across calls does not allocate again.
+		/// </summary>
+		void Clear();
+
+	private:
+		/// <summary>
+		/// The elements, bottom of the stack first.
+		/// </summary>
+		SmallVector<T, N, TAllocator> _elements;
+	};
+}
+
+#include "ContiguousStack.inl"
@@ -0,0 +1,77 @@
+#include "ContiguousStack.h"
+
+namespace FIEAGameEngine
+{
+	template <typename T, std::size_t N, typename TAllocator>
+	inline ContiguousStack<T, N, TAllocator>::ContiguousStack(std::size_t capacity, TAllocator allocator) :
+		_elements(capacity, allocator)
+	{
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline void ContiguousStack<T, N, TAllocator>::Push(const T& value)
+	{
+		_elements.PushBack(value);
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline void ContiguousStack<T, N, TAllocator>::Push(T&& value)
+	{
+		_elements.PushBack(std::move(value));
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	template <typename... TArgs>
+	inline T& ContiguousStack<T, N, TAllocator>::Emplace(TArgs&&... args)
+	{
+		return *_elements.EmplaceBack(std::forward<TArgs>(args)...);
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline void ContiguousStack<T, N, TAllocator>::Pop()
+	{
+		_elements.PopBack();
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline T& ContiguousStack<T, N, TAllocator>::Top()
+	{
+		return _elements.Back();
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline const T& ContiguousStack<T, N, TAllocator>::Top() const
+	{
+		return _elements.Back();
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline std::size_t ContiguousStack<T, N, TAllocator>::Size() const
+	{
+		return _elements.Size();
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline std::size_t ContiguousStack<T, N, TAllocator>::Capacity() const
+	{
+		return _elements.Capacity();
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline bool ContiguousStack<T, N, TAllocator>::IsEmpty() const
+	{
+		return _elements.IsEmpty();
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline void ContiguousStack<T, N, TAllocator>::Reserve(std::size_t capacity)
+	{
+		_elements.Reserve(capacity);
+	}
+
+	template <typename T, std::size_t N, typename TAllocator>
+	inline void ContiguousStack<T, N, TAllocator>::Clear()
+	{
+		_elements.Clear();
+	}
+}
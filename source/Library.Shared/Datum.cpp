@@ -1,13 +1,34 @@
 #include "pch.h"
 #include "Datum.h"
+#include "MemoryStatistics.h"
+#include <algorithm>
 #include <stdexcept>
 #include <cassert>
+#include <cstring>
+#include <memory>
 
 using namespace glm;
 using namespace std;
 
 namespace FIEAGameEngine
 {
+	namespace
+	{
+		/// <summary>
+		/// Copies a string into a caller's buffer, the way TextConversion::Format writes numbers.
+		/// </summary>
+		std::size_t CopyToBuffer(std::string_view text, std::span<char> buffer)
+		{
+			if (text.size() > buffer.size())
+			{
+				throw std::runtime_error("The buffer is too small for the string.");
+			}
+
+			std::copy(text.begin(), text.end(), buffer.begin());
+			return text.size();
+		}
+	}
+
 	Datum::Datum(DatumTypes type) :
 		_type(type)
 	{
@@ -15,7 +36,7 @@ namespace FIEAGameEngine
 	}
 
 	Datum::Datum(const Datum& other) :
-		_type(other._type), _size(other._size)
+		_size(other._size), _type(other._type)
 	{
 		if (other._size > 0_z)
 		{
@@ -25,6 +46,12 @@ namespace FIEAGameEngine
 				_capacity = other._capacity;
 				_isExternal = other._isExternal;
 			}
+			else if (other.CanShareBuffer())
+			{
+				other.Header().References.fetch_add(1_z, std::memory_order_relaxed);
+				_data = other._data;
+				_capacity = other._capacity;
+			}
 			else
 			{
 				Reserve(other._size);
@@ -39,21 +66,26 @@ namespace FIEAGameEngine
 
 
 	Datum::Datum(Datum&& other) noexcept :
-		_capacity(other._capacity), _size(other._size), _data(other._data), _type(other._type), _isExternal(other._isExternal)
+		_size(other._size), _capacity(other._capacity), _isExternal(other._isExternal), _isInline(other._isInline), _type(other._type), _data(other._data)
 	{
 		other._capacity = 0_z;
 		other._size = 0_z;
 		other._data.vp = nullptr;
 		other._type = DatumTypes::Unknown;
+		other._isInline = false;
 	}
 
 	Datum& Datum::operator=(const Datum& other)
 	{
 		if (this != &other)
 		{
-			_type = other._type;
 			Clear();
-			
+			const bool share = other.CanShareBuffer();
+			if (other._isExternal || _type != other._type || share)
+			{
+				ReleaseBuffer();
+			}
+			_type = other._type;
 
 			if (other._isExternal)
 			{
@@ -61,6 +93,12 @@ namespace FIEAGameEngine
 				_capacity = other._capacity;
 				_isExternal = other._isExternal;
 			}
+			else if (share)
+			{
+				other.Header().References.fetch_add(1_z, std::memory_order_relaxed);
+				_data = other._data;
+				_capacity = other._capacity;
+			}
 			else
 			{
 				Reserve(other._capacity);
@@ -79,24 +117,21 @@ namespace FIEAGameEngine
 	{
 		if (this != &other)
 		{
-			_type = other._type;
-
 			Clear();
-			if (_capacity > 0_z)
-			{
-				free(_data.vp);
-			}
+			ReleaseBuffer();
+			_type = other._type;
 
 			_capacity = other._capacity;
 			_size = other._size;
 			_data = other._data;
 			_isExternal = other._isExternal;
-
+			_isInline = other._isInline;
 
 			other._capacity = 0_z;
 			other._size = 0_z;
 			other._data.vp = nullptr;
 			other._type = DatumTypes::Unknown;
+			other._isInline = false;
 		}
 
 		return *this;
@@ -107,7 +142,7 @@ namespace FIEAGameEngine
 		if (!_isExternal)
 		{
 			Clear();
-			free(_data.vp);
+			ReleaseBuffer();
 		}
 	}
 
@@ -128,6 +163,12 @@ namespace FIEAGameEngine
 			return true;
 		}
 
+		if (Values().vp == other.Values().vp)
+		{
+			// Copies sharing their elements, or Datums over the same external storage.
+			return false;
+		}
+
 		bool isEqual = false;
 		CompareFunction func = _compareFunctions[static_cast<size_t>(_type)];
 		assert(func != nullptr);
@@ -146,42 +187,84 @@ namespace FIEAGameEngine
 		_type(Datum::DatumTypes::Integer)
 	{
 		Resize(1_z);
-		*_data.i = value;
+		*Values().i = value;
 	}
 
 	Datum::Datum(const float& value) :
 		_type(Datum::DatumTypes::Float)
 	{
 		Resize(1_z);
-		*_data.f = value;
+		*Values().f = value;
 	}
 
 	Datum::Datum(const std::string& value) :
 		_type(Datum::DatumTypes::String)
 	{
 		Resize(1_z);
-		*_data.s = value;
+		*Values().s = value;
 	}
 
 	Datum::Datum(const glm::vec4& value) :
 		_type(Datum::DatumTypes::Vector)
 	{
 		Resize(1_z);
-		*_data.v = value;
+		*Values().v = value;
 	}
 
 	Datum::Datum(const glm::mat4& value) :
 		_type(Datum::DatumTypes::Matrix)
 	{
 		Resize(1_z);
-		*_data.m = value;
+		*Values().m = value;
 	}
 
 	Datum::Datum(RTTI*& value) :
 		_type(Datum::DatumTypes::Pointer)
 	{
 		Resize(1_z);
-		*_data.p = value;
+		*Values().p = value;
+	}
+
+	Datum::Datum(const std::int64_t& value) :
+		_type(Datum::DatumTypes::Integer64)
+	{
+		Resize(1_z);
+		Element<std::int64_t>(0_z) = value;
+	}
+
+	Datum::Datum(const double& value) :
+		_type(Datum::DatumTypes::Double)
+	{
+		Resize(1_z);
+		Element<double>(0_z) = value;
+	}
+
+	Datum::Datum(const glm::vec2& value) :
+		_type(Datum::DatumTypes::Vector2)
+	{
+		Resize(1_z);
+		Element<glm::vec2>(0_z) = value;
+	}
+
+	Datum::Datum(const glm::vec3& value) :
+		_type(Datum::DatumTypes::Vector3)
+	{
+		Resize(1_z);
+		Element<glm::vec3>(0_z) = value;
+	}
+
+	Datum::Datum(const glm::quat& value) :
+		_type(Datum::DatumTypes::Quaternion)
+	{
+		Resize(1_z);
+		Element<glm::quat>(0_z) = value;
+	}
+
+	Datum::Datum(const glm::mat3& value) :
+		_type(Datum::DatumTypes::Matrix3)
+	{
+		Resize(1_z);
+		Element<glm::mat3>(0_z) = value;
 	}
 #pragma endregion
 
@@ -193,7 +276,7 @@ namespace FIEAGameEngine
 		Reserve(list.size());
 		for (const auto& value : list)
 		{
-			new(_data.i + _size++)int(value);
+			new(Values().i + _size++)int(value);
 		}
 	}
 
@@ -203,7 +286,7 @@ namespace FIEAGameEngine
 		Reserve(list.size());
 		for (const auto& value : list)
 		{
-			new(_data.f + _size++)float(value);
+			new(Values().f + _size++)float(value);
 		}
 	}
 
@@ -213,7 +296,7 @@ namespace FIEAGameEngine
 		Reserve(list.size());
 		for (const auto& value : list)
 		{
-			new(_data.s + _size++)string(value);
+			new(Values().s + _size++)string(value);
 		}
 	}
 
@@ -223,7 +306,7 @@ namespace FIEAGameEngine
 		Reserve(list.size());
 		for (const auto& value : list)
 		{
-			new(_data.v + _size++)glm::vec4(value);
+			new(Values().v + _size++)glm::vec4(value);
 		}
 	}
 
@@ -233,7 +316,7 @@ namespace FIEAGameEngine
 		Reserve(list.size());
 		for (const auto& value : list)
 		{
-			new(_data.m + _size++)glm::mat4(value);
+			new(Values().m + _size++)glm::mat4(value);
 		}
 	}
 
@@ -243,10 +326,58 @@ namespace FIEAGameEngine
 		Reserve(list.size());
 		for (const auto& value : list)
 		{
-			new(_data.p + _size++)RTTI* (value);
+			new(Values().p + _size++)RTTI* (value);
 		}
 	}
 
+	Datum::Datum(std::initializer_list<std::int64_t> list) :
+		Datum(Datum::DatumTypes::Integer64)
+	{
+		Reserve(list.size());
+		std::uninitialized_copy(list.begin(), list.end(), reinterpret_cast<std::int64_t*>(Values().vp));
+		_size = list.size();
+	}
+
+	Datum::Datum(std::initializer_list<double> list) :
+		Datum(Datum::DatumTypes::Double)
+	{
+		Reserve(list.size());
+		std::uninitialized_copy(list.begin(), list.end(), reinterpret_cast<double*>(Values().vp));
+		_size = list.size();
+	}
+
+	Datum::Datum(std::initializer_list<glm::vec2> list) :
+		Datum(Datum::DatumTypes::Vector2)
+	{
+		Reserve(list.size());
+		std::uninitialized_copy(list.begin(), list.end(), reinterpret_cast<glm::vec2*>(Values().vp));
+		_size = list.size();
+	}
+
+	Datum::Datum(std::initializer_list<glm::vec3> list) :
+		Datum(Datum::DatumTypes::Vector3)
+	{
+		Reserve(list.size());
+		std::uninitialized_copy(list.begin(), list.end(), reinterpret_cast<glm::vec3*>(Values().vp));
+		_size = list.size();
+	}
+
+	Datum::Datum(std::initializer_list<glm::quat> list) :
+		Datum(Datum::DatumTypes::Quaternion)
+	{
+		Reserve(list.size());
+		std::uninitialized_copy(list.begin(), list.end(), reinterpret_cast<glm::quat*>(Values().vp));
+		_size = list.size();
+	}
+
+	Datum::Datum(std::initializer_list<glm::mat3> list) :
+		Datum(Datum::DatumTypes::Matrix3)
+	{
+		Reserve(list.size());
+		std::uninitialized_copy(list.begin(), list.end(), reinterpret_cast<glm::mat3*>(Values().vp));
+		_size = list.size();
+	}
+
 #pragma endregion
 
 #pragma region CopyAssignmentOverloads
@@ -257,7 +388,7 @@ namespace FIEAGameEngine
 		{
 			Resize(1_z);
 		}
-		*_data.i = value;
+		*Values().i = value;
 		return *this;
 	}
 
@@ -268,7 +399,7 @@ namespace FIEAGameEngine
 		{
 			Resize(1_z);
 		}
-		*_data.f = value;
+		*Values().f = value;
 		return *this;
 	}
 
@@ -279,7 +410,8 @@ namespace FIEAGameEngine
 		{
 			Resize(1_z);
 		}
-		*_data.s = value;
+		Unshare();
+		*Values().s = value;
 		return *this;
 	}
 
@@ -290,7 +422,7 @@ namespace FIEAGameEngine
 		{
 			Resize(1_z);
 		}
-		*_data.v = value;
+		*Values().v = value;
 		return *this;
 	}
 
@@ -301,7 +433,8 @@ namespace FIEAGameEngine
 		{
 			Resize(1_z);
 		}
-		*_data.m = value;
+		Unshare();
+		*Values().m = value;
 		return *this;
 	}
 
@@ -312,7 +445,7 @@ namespace FIEAGameEngine
 		{
 			Resize(1_z);
 		}
-		*_data.t = &(value);
+		*Values().t = &(value);
 		return *this;
 	}
 
@@ -323,7 +456,43 @@ namespace FIEAGameEngine
 		{
 			Resize(1_z);
 		}
-		*_data.p = value;
+		*Values().p = value;
+		return *this;
+	}
+
+	Datum& Datum::operator=(const std::int64_t& value)
+	{
+		AssignElement(value);
+		return *this;
+	}
+
+	Datum& Datum::operator=(const double& value)
+	{
+		AssignElement(value);
+		return *this;
+	}
+
+	Datum& Datum::operator=(const glm::vec2& value)
+	{
+		AssignElement(value);
+		return *this;
+	}
+
+	Datum& Datum::operator=(const glm::vec3& value)
+	{
+		AssignElement(value);
+		return *this;
+	}
+
+	Datum& Datum::operator=(const glm::quat& value)
+	{
+		AssignElement(value);
+		return *this;
+	}
+
+	Datum& Datum::operator=(const glm::mat3& value)
+	{
+		AssignElement(value);
 		return *this;
 	}
 
@@ -343,7 +512,7 @@ namespace FIEAGameEngine
 			return false;
 		}
 
-		return !(_type == Datum::DatumTypes::Integer && _size == 1_z && _data.i[0_z] == other);
+		return !(_type == Datum::DatumTypes::Integer && _size == 1_z && Values().i[0_z] == other);
 	}
 
 	bool Datum::operator==(const float& other) const
@@ -358,7 +527,7 @@ namespace FIEAGameEngine
 			return false;
 		}
 
-		return !(_type == Datum::DatumTypes::Float && _size == 1_z && _data.f[0_z] == other);
+		return !(_type == Datum::DatumTypes::Float && _size == 1_z && Values().f[0_z] == other);
 	}
 
 	bool Datum::operator==(const std::string& other) const
@@ -373,7 +542,7 @@ namespace FIEAGameEngine
 			return false;
 		}
 
-		return !(_type == Datum::DatumTypes::String && _size == 1_z && !_data.s[0_z].compare(other));
+		return !(_type == Datum::DatumTypes::String && _size == 1_z && !Values().s[0_z].compare(other));
 	}
 
 	bool Datum::operator==(const glm::vec4& other) const
@@ -388,7 +557,7 @@ namespace FIEAGameEngine
 			return false;
 		}
 
-		return !(_type == Datum::DatumTypes::Vector && _size == 1_z && _data.v[0_z] == other);
+		return !(_type == Datum::DatumTypes::Vector && _size == 1_z && Values().v[0_z] == other);
 	}
 
 	bool Datum::operator==(const glm::mat4& other) const
@@ -403,7 +572,7 @@ namespace FIEAGameEngine
 			return false;
 		}
 
-		return !(_type == Datum::DatumTypes::Matrix && _size == 1_z && _data.m[0_z] == other);
+		return !(_type == Datum::DatumTypes::Matrix && _size == 1_z && Values().m[0_z] == other);
 	}
 
 	bool Datum::operator==(RTTI* const & other) const
@@ -417,7 +586,7 @@ namespace FIEAGameEngine
 		{
 			return false;
 		}
-		return !(_type == Datum::DatumTypes::Pointer && _size == 1_z && _data.p[0_z]->Equals(other));
+		return !(_type == Datum::DatumTypes::Pointer && _size == 1_z && Values().p[0_z]->Equals(other));
 	}
 
 #pragma endregion
@@ -461,12 +630,148 @@ namespace FIEAGameEngine
 
 		if (capacity > _capacity)
 		{
-			size_t size = _sizeMap[static_cast<size_t>(_type)];
+			ReallocateBuffer(capacity);
+		}
+	}
+
+	ContainerStats Datum::Stats() const
+	{
+		if (_type == DatumTypes::Unknown)
+		{
+			return ContainerStats{};
+		}
+
+		const size_t elementSize = _sizeMap[static_cast<size_t>(_type)];
+		if (IsShared())
+		{
+			// Each Datum sharing the buffer is charged its part, so adding up a Scope's Datums counts the buffer once.
+			return ContainerStats{ _size, _capacity * elementSize / Header().References.load(std::memory_order_relaxed), _size * elementSize };
+		}
+
+		return ContainerStats{ _size, _isExternal || _isInline ? 0_z : _capacity * elementSize, _size * elementSize };
+	}
+
+	void Datum::ReallocateBuffer(size_t capacity)
+	{
+		const size_t elementSize = _sizeMap[static_cast<size_t>(_type)];
+		if (capacity * elementSize <= sizeof(DatumValues) && (_isInline || _capacity == 0_z))
+		{
+			// Only Integer, Float, Table, Pointer, Boolean, Integer64, Double and Vector2 elements are small enough, and they can all be moved with memcpy.
+			_isInline = true;
+			_capacity = sizeof(DatumValues) / elementSize;
+			return;
+		}
+
+		if (IsShareable(_type))
+		{
+			const size_t bytes = sizeof(SharedBuffer) + capacity * elementSize;
+			if (IsShared())
+			{
+				// The other Datums keep reading the old buffer, so the elements are copied rather than moved.
+				std::byte* block = static_cast<std::byte*>(malloc(bytes));
+				assert(block != nullptr);
+				new(block)SharedBuffer{ 1_z };
+				DatumValues data;
+				data.vp = block + sizeof(SharedBuffer);
+				if (_type == DatumTypes::String)
+				{
+					std::uninitialized_copy(Values().s, Values().s + _size, data.s);
+				}
+				else
+				{
+					std::uninitialized_copy(Values().m, Values().m + _size, data.m);
+				}
+
+				ReleaseBuffer();
+				MemoryStatistics::RecordDatumBuffer(0_z, bytes);
+				_data = data;
+				_capacity = capacity;
+				return;
+			}
+
+			const bool isNew = _data.vp == nullptr;
+			const size_t oldBytes = isNew ? 0_z : sizeof(SharedBuffer) + _capacity * elementSize;
+			if (_type == DatumTypes::String)
+			{
+				// Strings may point into themselves, so they are moved into a new block rather than realloc'd.
+				std::byte* block = static_cast<std::byte*>(malloc(bytes));
+				assert(block != nullptr);
+				new(block)SharedBuffer{ 1_z };
+				std::string* strings = reinterpret_cast<std::string*>(block + sizeof(SharedBuffer));
+				if (!isNew)
+				{
+					RelocateElements(strings, Values().s, _size);
+					SharedBuffer& header = Header();
+					header.~SharedBuffer();
+					free(&header);
+				}
+				MemoryStatistics::RecordDatumBuffer(oldBytes, bytes);
+				_data.s = strings;
+				_capacity = capacity;
+				return;
+			}
 
-			void* data = realloc(_data.vp, capacity * size);
-			assert(data != nullptr);
-			_data.vp = data;
+			std::byte* block = static_cast<std::byte*>(realloc(isNew ? nullptr : &Header(), bytes));
+			assert(block != nullptr);
+			if (isNew)
+			{
+				new(block)SharedBuffer{ 1_z };
+			}
+			else
+			{
+				// Growing invalidates every reference that was handed out, so copies may share the buffer again.
+				reinterpret_cast<SharedBuffer*>(block)->Exposed = false;
+			}
+			MemoryStatistics::RecordDatumBuffer(oldBytes, bytes);
+			_data.vp = block + sizeof(SharedBuffer);
 			_capacity = capacity;
+			return;
+		}
+
+		const size_t oldBytes = _isInline ? 0_z : _capacity * elementSize;
+		void* data = realloc(_isInline ? nullptr : _data.vp, capacity * elementSize);
+		assert(data != nullptr);
+		if (_isInline)
+		{
+			memcpy(data, _data.buffer, _size * elementSize);
+			_isInline = false;
+		}
+		MemoryStatistics::RecordDatumBuffer(oldBytes, capacity * elementSize);
+		_data.vp = data;
+		_capacity = capacity;
+	}
+
+	void Datum::ReleaseBuffer()
+	{
+		if (_isInline)
+		{
+			_isInline = false;
+			_data.vp = nullptr;
+			_capacity = 0_z;
+		}
+		else if (!_isExternal && _data.vp != nullptr && IsShareable(_type))
+		{
+			SharedBuffer& header = Header();
+			if (header.References.fetch_sub(1_z, std::memory_order_acq_rel) == 1_z)
+			{
+				if (_type == DatumTypes::String)
+				{
+					std::destroy_n(Values().s, _size);
+				}
+
+				header.~SharedBuffer();
+				MemoryStatistics::RecordDatumBuffer(sizeof(SharedBuffer) + _capacity * _sizeMap[static_cast<size_t>(_type)], 0_z);
+				free(&header);
+			}
+			_data.vp = nullptr;
+			_capacity = 0_z;
+		}
+		else if (!_isExternal && _data.vp != nullptr)
+		{
+			MemoryStatistics::RecordDatumBuffer(_capacity * _sizeMap[static_cast<size_t>(_type)], 0_z);
+			free(_data.vp);
+			_data.vp = nullptr;
+			_capacity = 0_z;
 		}
 	}
 
@@ -483,7 +788,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Datum type must be an integer is order to set with an integer.");
 		}
 
-		_data.i[index] = value;
+		Values().i[index] = value;
 	}
 
 	void Datum::Set(const float& value, size_t index)
@@ -498,7 +803,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Datum type must be an float is order to set with an float.");
 		}
 
-		_data.f[index] = value;
+		Values().f[index] = value;
 	}
 
 	void Datum::Set(const std::string& value, size_t index)
@@ -513,7 +818,8 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Datum type must be an String is order to set with an String.");
 		}
 
-		_data.s[index] = value;
+		Unshare();
+		Values().s[index] = value;
 	}
 
 	void Datum::Set(const glm::vec4& value, size_t index)
@@ -528,7 +834,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Datum type must be an Vector is order to set with an Vector.");
 		}
 
-		_data.v[index] = value;
+		Values().v[index] = value;
 	}
 
 	void Datum::Set(const glm::mat4& value, size_t index)
@@ -543,7 +849,8 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Datum type must be an Matrix is order to set with an Matrix.");
 		}
 
-		_data.m[index] = value;
+		Unshare();
+		Values().m[index] = value;
 	}
 
 	void Datum::Set(Scope& value, size_t index)
@@ -558,7 +865,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Datum type must be an Pointer is order to set with an Pointer.");
 		}
 
-		_data.t[index] = &value;
+		Values().t[index] = &value;
 	}
 
 	void Datum::Set(RTTI*& value, size_t index)
@@ -573,7 +880,37 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Datum type must be an Pointer is order to set with an Pointer.");
 		}
 
-		_data.p[index] = value;
+		Values().p[index] = value;
+	}
+
+	void Datum::Set(const std::int64_t& value, size_t index)
+	{
+		Element<std::int64_t>(index) = value;
+	}
+
+	void Datum::Set(const double& value, size_t index)
+	{
+		Element<double>(index) = value;
+	}
+
+	void Datum::Set(const glm::vec2& value, size_t index)
+	{
+		Element<glm::vec2>(index) = value;
+	}
+
+	void Datum::Set(const glm::vec3& value, size_t index)
+	{
+		Element<glm::vec3>(index) = value;
+	}
+
+	void Datum::Set(const glm::quat& value, size_t index)
+	{
+		Element<glm::quat>(index) = value;
+	}
+
+	void Datum::Set(const glm::mat3& value, size_t index)
+	{
+		Element<glm::mat3>(index) = value;
 	}
 #pragma endregion
 
@@ -590,7 +927,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetInteger when the Datum's type is Integer.");
 		}
 
-		return _data.i[index];
+		return Values().i[index];
 	}
 	float& Datum::GetFloat(size_t index)
 	{
@@ -604,7 +941,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetFloat when the Datum's type is Float.");
 		}
 
-		return _data.f[index];
+		return Values().f[index];
 	}
 	std::string& Datum::GetString(size_t index)
 	{
@@ -618,7 +955,8 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetString when the Datum's type is String.");
 		}
 
-		return _data.s[index];
+		Expose();
+		return Values().s[index];
 	}
 	glm::vec4& Datum::GetVector(size_t index)
 	{
@@ -632,7 +970,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetVector when the Datum's type is Vector.");
 		}
 
-		return _data.v[index];
+		return Values().v[index];
 	}
 	glm::mat4& Datum::GetMatrix(size_t index)
 	{
@@ -646,7 +984,8 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetMatrix when the Datum's type is Matrix.");
 		}
 
-		return _data.m[index];
+		Expose();
+		return Values().m[index];
 	}
 
 	Scope& Datum::GetScope(size_t index)
@@ -661,7 +1000,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetPointer when the Datum's type is Pointer.");
 		}
 
-		return *_data.t[index];
+		return *Values().t[index];
 	}
 
 	RTTI*& Datum::GetPointer(size_t index)
@@ -676,7 +1015,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetPointer when the Datum's type is Pointer.");
 		}
 
-		return _data.p[index];
+		return Values().p[index];
 	}
 
 	int& Datum::GetInteger(size_t index) const
@@ -691,7 +1030,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetInteger when the Datum's type is Integer.");
 		}
 
-		return _data.i[index];
+		return Values().i[index];
 	}
 	float& Datum::GetFloat(size_t index) const
 	{
@@ -705,9 +1044,9 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetFloat when the Datum's type is Float.");
 		}
 
-		return _data.f[index];
+		return Values().f[index];
 	}
-	std::string& Datum::GetString(size_t index) const
+	const std::string& Datum::GetString(size_t index) const
 	{
 		if (index >= _size)
 		{
@@ -719,7 +1058,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetString when the Datum's type is String.");
 		}
 
-		return _data.s[index];
+		return Values().s[index];
 	}
 	glm::vec4& Datum::GetVector(size_t index) const
 	{
@@ -733,9 +1072,9 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetVector when the Datum's type is Vector.");
 		}
 
-		return _data.v[index];
+		return Values().v[index];
 	}
-	glm::mat4& Datum::GetMatrix(size_t index) const
+	const glm::mat4& Datum::GetMatrix(size_t index) const
 	{
 		if (index >= _size)
 		{
@@ -747,7 +1086,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetMatrix when the Datum's type is Matrix.");
 		}
 
-		return _data.m[index];
+		return Values().m[index];
 	}
 
 	Scope& Datum::GetScope(size_t index) const
@@ -762,7 +1101,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetPointer when the Datum's type is Pointer.");
 		}
 
-		return *_data.t[index];
+		return *Values().t[index];
 	}
 
 	RTTI*& Datum::GetPointer(size_t index) const
@@ -777,7 +1116,77 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only use GetPointer when the Datum's type is Pointer.");
 		}
 
-		return _data.p[index];
+		return Values().p[index];
+	}
+
+	bool& Datum::GetBoolean(size_t index)
+	{
+		return Element<bool>(index);
+	}
+
+	std::int64_t& Datum::GetInteger64(size_t index)
+	{
+		return Element<std::int64_t>(index);
+	}
+
+	double& Datum::GetDouble(size_t index)
+	{
+		return Element<double>(index);
+	}
+
+	glm::vec2& Datum::GetVector2(size_t index)
+	{
+		return Element<glm::vec2>(index);
+	}
+
+	glm::vec3& Datum::GetVector3(size_t index)
+	{
+		return Element<glm::vec3>(index);
+	}
+
+	glm::quat& Datum::GetQuaternion(size_t index)
+	{
+		return Element<glm::quat>(index);
+	}
+
+	glm::mat3& Datum::GetMatrix3(size_t index)
+	{
+		return Element<glm::mat3>(index);
+	}
+
+	const bool& Datum::GetBoolean(size_t index) const
+	{
+		return Element<bool>(index);
+	}
+
+	const std::int64_t& Datum::GetInteger64(size_t index) const
+	{
+		return Element<std::int64_t>(index);
+	}
+
+	const double& Datum::GetDouble(size_t index) const
+	{
+		return Element<double>(index);
+	}
+
+	const glm::vec2& Datum::GetVector2(size_t index) const
+	{
+		return Element<glm::vec2>(index);
+	}
+
+	const glm::vec3& Datum::GetVector3(size_t index) const
+	{
+		return Element<glm::vec3>(index);
+	}
+
+	const glm::quat& Datum::GetQuaternion(size_t index) const
+	{
+		return Element<glm::quat>(index);
+	}
+
+	const glm::mat3& Datum::GetMatrix3(size_t index) const
+	{
+		return Element<glm::mat3>(index);
 	}
 #pragma endregion
 
@@ -803,16 +1212,16 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot resize with an unknown type.");
 		}
 
+		Unshare();
 		if (size < _size)
 		{
 			if (_type == Datum::DatumTypes::String)
 			{
 				for (std::size_t i = size; i < _size; ++i)
 				{
-					_data.s[i].~string();
+					Values().s[i].~string();
 				}
 			}
-			_capacity = _size;
 		}
 		else
 		{
@@ -832,11 +1241,16 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot clear with external memory.");
 		}
 
-		if (_type == Datum::DatumTypes::String)
+		if (IsShared())
+		{
+			// The elements still belong to the copies, so there is nothing to destroy and no capacity worth keeping.
+			ReleaseBuffer();
+		}
+		else if (_type == Datum::DatumTypes::String)
 		{
 			for (std::size_t i = 0_z; i < _size; ++i)
 			{
-				_data.s[i].~string();
+				Values().s[i].~string();
 			}
 		}
 
@@ -860,6 +1274,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot set storage to external if internal storage already exists.");
 		}
 		SetType(Datum::DatumTypes::Integer);
+		ReleaseBuffer();
 		_data.i = array;
 		_size = size;
 		_capacity = size;
@@ -884,6 +1299,7 @@ namespace FIEAGameEngine
 		}
 
 		SetType(Datum::DatumTypes::Float);
+		ReleaseBuffer();
 		_data.f = array;
 		_size = size;
 		_capacity = size;
@@ -907,6 +1323,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot set storage to external if internal storage already exists.");
 		}
 		SetType(Datum::DatumTypes::String);
+		ReleaseBuffer();
 		_data.s = array;
 		_size = size;
 		_capacity = size;
@@ -930,6 +1347,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot set storage to external if internal storage already exists.");
 		}
 		SetType(Datum::DatumTypes::Vector);
+		ReleaseBuffer();
 		_data.v = array;
 		_size = size;
 		_capacity = size;
@@ -953,6 +1371,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot set storage to external if internal storage already exists.");
 		}
 		SetType(Datum::DatumTypes::Matrix);
+		ReleaseBuffer();
 		_data.m = array;
 		_size = size;
 		_capacity = size;
@@ -976,12 +1395,48 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot set storage to external if internal storage already exists.");
 		}
 		SetType(Datum::DatumTypes::Pointer);
+		ReleaseBuffer();
 		_data.p = array;
 		_size = size;
 		_capacity = size;
 		_isExternal = true;
 	}
 
+	void Datum::SetStorage(bool* array, size_t size)
+	{
+		SetStorageElements(array, size);
+	}
+
+	void Datum::SetStorage(std::int64_t* array, size_t size)
+	{
+		SetStorageElements(array, size);
+	}
+
+	void Datum::SetStorage(double* array, size_t size)
+	{
+		SetStorageElements(array, size);
+	}
+
+	void Datum::SetStorage(glm::vec2* array, size_t size)
+	{
+		SetStorageElements(array, size);
+	}
+
+	void Datum::SetStorage(glm::vec3* array, size_t size)
+	{
+		SetStorageElements(array, size);
+	}
+
+	void Datum::SetStorage(glm::quat* array, size_t size)
+	{
+		SetStorageElements(array, size);
+	}
+
+	void Datum::SetStorage(glm::mat3* array, size_t size)
+	{
+		SetStorageElements(array, size);
+	}
+
 	void Datum::SetStorage(DatumTypes type, void* array, size_t size)
 	{
 		if (size == 0_z)
@@ -1018,7 +1473,40 @@ namespace FIEAGameEngine
 	}
 
 
-	void Datum::SetFromString(const std::string& str, size_t index)
+	std::size_t Datum::ToString(std::span<char> buffer, size_t index) const
+	{
+		switch (_type)
+		{
+		case DatumTypes::Integer:
+			return TextConversion::Format(GetInteger(index), buffer);
+		case DatumTypes::Float:
+			return TextConversion::Format(GetFloat(index), buffer);
+		case DatumTypes::Vector:
+			return TextConversion::Format(GetVector(index), buffer);
+		case DatumTypes::Matrix:
+			return TextConversion::Format(GetMatrix(index), buffer);
+		case DatumTypes::Boolean:
+			return TextConversion::Format(GetBoolean(index), buffer);
+		case DatumTypes::Integer64:
+			return TextConversion::Format(GetInteger64(index), buffer);
+		case DatumTypes::Double:
+			return TextConversion::Format(GetDouble(index), buffer);
+		case DatumTypes::Vector2:
+			return TextConversion::Format(GetVector2(index), buffer);
+		case DatumTypes::Vector3:
+			return TextConversion::Format(GetVector3(index), buffer);
+		case DatumTypes::Quaternion:
+			return TextConversion::Format(GetQuaternion(index), buffer);
+		case DatumTypes::Matrix3:
+			return TextConversion::Format(GetMatrix3(index), buffer);
+		case DatumTypes::String:
+			return CopyToBuffer(GetString(index), buffer);
+		default:
+			return CopyToBuffer(ToString(index), buffer);
+		}
+	}
+
+	void Datum::SetFromString(std::string_view str, size_t index)
 	{
 		if (_type == Datum::DatumTypes::Unknown)
 		{
@@ -1035,7 +1523,7 @@ namespace FIEAGameEngine
 		(this->*func)(str, index);
 	}
 
-	void Datum::PushBackFromString(const string& value)
+	void Datum::PushBackFromString(std::string_view value)
 	{
 		PushBackFromStringFunction func = _pushBackFromStringFunctions[static_cast<size_t>(_type)];
 		assert(func != nullptr);
@@ -1055,7 +1543,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an integer is the Datum is not an integer type.");
 		}
 
-		return _data.i[0_z];
+		return Values().i[0_z];
 	}
 
 	const int& Datum::FrontInteger() const
@@ -1070,7 +1558,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an integer is the Datum is not an integer type.");
 		}
 
-		return _data.i[0_z];
+		return Values().i[0_z];
 	}
 
 	float& Datum::FrontFloat()
@@ -1085,7 +1573,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an Float is the Datum is not an Float type.");
 		}
 
-		return _data.f[0_z];
+		return Values().f[0_z];
 	}
 
 	const float& Datum::FrontFloat() const
@@ -1100,7 +1588,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an Float is the Datum is not an Float type.");
 		}
 
-		return _data.f[0_z];
+		return Values().f[0_z];
 	}
 
 	std::string& Datum::FrontString()
@@ -1115,7 +1603,8 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an String is the Datum is not an String type.");
 		}
 
-		return _data.s[0_z];
+		Expose();
+		return Values().s[0_z];
 	}
 
 	const std::string& Datum::FrontString() const
@@ -1130,7 +1619,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an String is the Datum is not an String type.");
 		}
 
-		return _data.s[0_z];
+		return Values().s[0_z];
 	}
 
 	glm::vec4& Datum::FrontVector()
@@ -1145,7 +1634,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an Vector is the Datum is not an Vector type.");
 		}
 
-		return _data.v[0_z];
+		return Values().v[0_z];
 	}
 
 	const glm::vec4& Datum::FrontVector() const
@@ -1160,7 +1649,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an Vector is the Datum is not an Vector type.");
 		}
 
-		return _data.v[0_z];
+		return Values().v[0_z];
 	}
 
 	glm::mat4& Datum::FrontMatrix()
@@ -1175,7 +1664,8 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an Matrix is the Datum is not an Matrix type.");
 		}
 
-		return _data.m[0_z];
+		Expose();
+		return Values().m[0_z];
 	}
 
 	const glm::mat4& Datum::FrontMatrix() const
@@ -1190,7 +1680,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an Matrix is the Datum is not an Matrix type.");
 		}
 
-		return _data.m[0_z];
+		return Values().m[0_z];
 	}
 
 	RTTI*& Datum::FrontPointer()
@@ -1205,7 +1695,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an Pointer is the Datum is not an Pointer type.");
 		}
 
-		return _data.p[0_z];
+		return Values().p[0_z];
 	}
 
 	RTTI* const & Datum::FrontPointer() const
@@ -1220,7 +1710,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the front as an Pointer is the Datum is not an Pointer type.");
 		}
 
-		return _data.p[0_z];
+		return Values().p[0_z];
 	}
 #pragma endregion
 
@@ -1237,7 +1727,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an integer is the Datum is not an integer type.");
 		}
 
-		return _data.i[_size - 1_z];
+		return Values().i[_size - 1_z];
 	}
 
 	const int& Datum::BackInteger() const
@@ -1252,7 +1742,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an integer is the Datum is not an integer type.");
 		}
 
-		return _data.i[_size - 1_z];
+		return Values().i[_size - 1_z];
 	}
 
 	float& Datum::BackFloat()
@@ -1267,7 +1757,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an Float is the Datum is not an Float type.");
 		}
 
-		return _data.f[_size - 1_z];
+		return Values().f[_size - 1_z];
 	}
 
 	const float& Datum::BackFloat() const
@@ -1282,7 +1772,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an Float is the Datum is not an Float type.");
 		}
 
-		return _data.f[_size - 1_z];
+		return Values().f[_size - 1_z];
 	}
 
 	std::string& Datum::BackString()
@@ -1297,7 +1787,8 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an String is the Datum is not an String type.");
 		}
 
-		return _data.s[_size - 1_z];
+		Expose();
+		return Values().s[_size - 1_z];
 	}
 
 	const std::string& Datum::BackString() const
@@ -1312,7 +1803,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an String is the Datum is not an String type.");
 		}
 
-		return _data.s[_size - 1_z];
+		return Values().s[_size - 1_z];
 	}
 
 	glm::vec4& Datum::BackVector()
@@ -1327,7 +1818,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an Vector is the Datum is not an Vector type.");
 		}
 
-		return _data.v[_size - 1_z];
+		return Values().v[_size - 1_z];
 	}
 
 	const glm::vec4& Datum::BackVector() const
@@ -1342,7 +1833,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an Vector is the Datum is not an Vector type.");
 		}
 
-		return _data.v[_size - 1_z];
+		return Values().v[_size - 1_z];
 	}
 
 	glm::mat4& Datum::BackMatrix()
@@ -1357,7 +1848,8 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an Matrix is the Datum is not an Matrix type.");
 		}
 
-		return _data.m[_size - 1_z];
+		Expose();
+		return Values().m[_size - 1_z];
 	}
 
 	const glm::mat4& Datum::BackMatrix() const
@@ -1372,7 +1864,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an Matrix is the Datum is not an Matrix type.");
 		}
 
-		return _data.m[_size - 1_z];
+		return Values().m[_size - 1_z];
 	}
 
 	RTTI*& Datum::BackPointer()
@@ -1387,7 +1879,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an Pointer is the Datum is not an Pointer type.");
 		}
 
-		return _data.p[_size - 1_z];
+		return Values().p[_size - 1_z];
 	}
 
 	RTTI* const & Datum::BackPointer() const
@@ -1402,7 +1894,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot get the back as an Pointer is the Datum is not an Pointer type.");
 		}
 
-		return _data.p[_size - 1_z];
+		return Values().p[_size - 1_z];
 	}
 #pragma endregion
 
@@ -1420,10 +1912,11 @@ namespace FIEAGameEngine
 
 		if (!isEmpty())
 		{
+			Unshare();
 			--_size;
 			if (_type == Datum::DatumTypes::String)
 			{
-				_data.s[_size].~string();
+				Values().s[_size].~string();
 			}
 		}
 	}
@@ -1443,9 +1936,10 @@ namespace FIEAGameEngine
 		bool found = false;
 		if (index < _size)
 		{
+			Unshare();
 			if (_type == Datum::DatumTypes::String)
 			{
-				_data.s[index].~string();
+				Values().s[index].~string();
 			}
 
 			RemoveFunction func = _removeFunctions[static_cast<size_t>(_type)];
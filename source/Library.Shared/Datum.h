@@ -1,11 +1,24 @@
 #pragma once
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <string>
+#include <string_view>
 #include <functional>
+#include <iterator>
+#include <memory>
 #include "DefaultIncrement.h"
 #include "DefaultEquality.h"
 #include "RTTI.h"
 #include "HashMap.h"
+#include "SimdFind.h"
+#include "ContainerStats.h"
+#include "Relocation.h"
+#include "TextConversion.h"
 
 using namespace std;
 
@@ -33,6 +46,13 @@ namespace FIEAGameEngine
 			Matrix, // 4x4 matrix
 			Table, // Scope class
 			Pointer, // pointer to any RTTI instance.
+			Boolean, // bool, one byte rather than an Integer's four
+			Integer64, // 64-bit signed integer
+			Double, // double-precision float
+			Vector2, // 2-vector
+			Vector3, // 3-vector
+			Quaternion, // rotation, in a quarter of a Matrix's space
+			Matrix3, // 3x3 matrix
 			Unknown // has no values yet
 		};
 
@@ -44,6 +64,7 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Invokes the copy constructor. 
 		/// Creates a new Datum and deep copies each member variable from the other Datum into this Datum. 
+		/// String and Matrix elements are not copied yet: both Datums share them until either one is changed, which then copies them for itself.
 		/// </summary>
 		/// <param name="other">The instance of Datum that is being copied from.</param>
 		Datum(const Datum& other);
@@ -57,6 +78,7 @@ namespace FIEAGameEngine
 		/// Invokes the copy assignment. Destructs all elements in this Datum and deep copies each element from other Datum into this Datum.
 		/// If the Datum that is being copied from is bigger, that amount of memory will be reserved ahead of time.
 		/// If the Datum that is being copied from is smaller, the amount of memory reserved will stay the same.
+		/// String and Matrix elements are shared instead, as with the copy constructor, so this Datum takes on the other's capacity.
 		/// </summary>
 		/// <param name="other">The instance of Datum that is being copied from.</param>
 		/// <returns>A Datum reference to this object.</returns>
@@ -131,6 +153,50 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="other">The initializer list that is being copied from.</param>
 		Datum(std::initializer_list<RTTI*> list);
+		/// <summary>
+		/// Invokes the copy constructor on an initializer list of bools. 
+		/// Creates a new Datum and deep copies each member variable from the initialzer list into this Datum. 
+		/// Only a list of actual bools is taken, so a list of string literals still makes a String Datum.
+		/// </summary>
+		/// <param name="other">The initializer list that is being copied from.</param>
+		template <std::same_as<bool> TBool>
+		Datum(std::initializer_list<TBool> list);
+		/// <summary>
+		/// Invokes the copy constructor on an initializer list of 64-bit integers. 
+		/// Creates a new Datum and deep copies each member variable from the initialzer list into this Datum. 
+		/// </summary>
+		/// <param name="other">The initializer list that is being copied from.</param>
+		Datum(std::initializer_list<std::int64_t> list);
+		/// <summary>
+		/// Invokes the copy constructor on an initializer list of doubles. 
+		/// Creates a new Datum and deep copies each member variable from the initialzer list into this Datum. 
+		/// </summary>
+		/// <param name="other">The initializer list that is being copied from.</param>
+		Datum(std::initializer_list<double> list);
+		/// <summary>
+		/// Invokes the copy constructor on an initializer list of 2-vectors. 
+		/// Creates a new Datum and deep copies each member variable from the initialzer list into this Datum. 
+		/// </summary>
+		/// <param name="other">The initializer list that is being copied from.</param>
+		Datum(std::initializer_list<glm::vec2> list);
+		/// <summary>
+		/// Invokes the copy constructor on an initializer list of 3-vectors. 
+		/// Creates a new Datum and deep copies each member variable from the initialzer list into this Datum. 
+		/// </summary>
+		/// <param name="other">The initializer list that is being copied from.</param>
+		Datum(std::initializer_list<glm::vec3> list);
+		/// <summary>
+		/// Invokes the copy constructor on an initializer list of quaternions. 
+		/// Creates a new Datum and deep copies each member variable from the initialzer list into this Datum. 
+		/// </summary>
+		/// <param name="other">The initializer list that is being copied from.</param>
+		Datum(std::initializer_list<glm::quat> list);
+		/// <summary>
+		/// Invokes the copy constructor on an initializer list of 3x3 matrices. 
+		/// Creates a new Datum and deep copies each member variable from the initialzer list into this Datum. 
+		/// </summary>
+		/// <param name="other">The initializer list that is being copied from.</param>
+		Datum(std::initializer_list<glm::mat3> list);
 #pragma endregion
 
 #pragma region Copy Constructor Overloads
@@ -170,6 +236,50 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="other">The scalar RTTI pointer that is being copied into the Datum.</param>
 		Datum(RTTI*& other);
+		/// <summary>
+		/// Invokes the copy constructor from a scalar bool. 
+		/// Creates a new Datum and sets the size to 1. Sets the one element to the value of the scalar.
+		/// Only an actual bool is taken, so string literals and pointers still make String and Pointer Datums.
+		/// </summary>
+		/// <param name="other">The scalar bool that is being copied into the Datum.</param>
+		template <std::same_as<bool> TBool>
+		Datum(const TBool& other);
+		/// <summary>
+		/// Invokes the copy constructor from a scalar 64-bit integer. 
+		/// Creates a new Datum and sets the size to 1. Sets the one element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar 64-bit integer that is being copied into the Datum.</param>
+		Datum(const std::int64_t& other);
+		/// <summary>
+		/// Invokes the copy constructor from a scalar double. 
+		/// Creates a new Datum and sets the size to 1. Sets the one element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar double that is being copied into the Datum.</param>
+		Datum(const double& other);
+		/// <summary>
+		/// Invokes the copy constructor from a scalar 2-vector. 
+		/// Creates a new Datum and sets the size to 1. Sets the one element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar 2-vector that is being copied into the Datum.</param>
+		Datum(const glm::vec2& other);
+		/// <summary>
+		/// Invokes the copy constructor from a scalar 3-vector. 
+		/// Creates a new Datum and sets the size to 1. Sets the one element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar 3-vector that is being copied into the Datum.</param>
+		Datum(const glm::vec3& other);
+		/// <summary>
+		/// Invokes the copy constructor from a scalar quaternion. 
+		/// Creates a new Datum and sets the size to 1. Sets the one element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar quaternion that is being copied into the Datum.</param>
+		Datum(const glm::quat& other);
+		/// <summary>
+		/// Invokes the copy constructor from a scalar 3x3 matrix. 
+		/// Creates a new Datum and sets the size to 1. Sets the one element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar 3x3 matrix that is being copied into the Datum.</param>
+		Datum(const glm::mat3& other);
 #pragma endregion
 
 #pragma region Copy Assignment Operator Overloads
@@ -222,6 +332,57 @@ namespace FIEAGameEngine
 		/// <param name="other">The scalar RTTI pointer that is being copied into the Datum.</param>
 		/// <returns>A Datum reference to this object.</returns>
 		Datum& operator=(RTTI* other);
+		/// <summary>
+		/// Invokes the copy assignment from a scalar bool. 
+		/// Resizes the Datum to be exactly 1_z size and assigns the only element to the value of the scalar.
+		/// Only an actual bool is taken, so string literals and pointers still assign a string and a pointer.
+		/// </summary>
+		/// <param name="other">The scalar bool that is being copied into the Datum.</param>
+		/// <returns>A Datum reference to this object.</returns>
+		template <std::same_as<bool> TBool>
+		Datum& operator=(const TBool& other);
+		/// <summary>
+		/// Invokes the copy assignment from a scalar 64-bit integer. 
+		/// Resizes the Datum to be exactly 1_z size and assigns the only element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar 64-bit integer that is being copied into the Datum.</param>
+		/// <returns>A Datum reference to this object.</returns>
+		Datum& operator=(const std::int64_t& other);
+		/// <summary>
+		/// Invokes the copy assignment from a scalar double. 
+		/// Resizes the Datum to be exactly 1_z size and assigns the only element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar double that is being copied into the Datum.</param>
+		/// <returns>A Datum reference to this object.</returns>
+		Datum& operator=(const double& other);
+		/// <summary>
+		/// Invokes the copy assignment from a scalar 2-vector. 
+		/// Resizes the Datum to be exactly 1_z size and assigns the only element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar 2-vector that is being copied into the Datum.</param>
+		/// <returns>A Datum reference to this object.</returns>
+		Datum& operator=(const glm::vec2& other);
+		/// <summary>
+		/// Invokes the copy assignment from a scalar 3-vector. 
+		/// Resizes the Datum to be exactly 1_z size and assigns the only element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar 3-vector that is being copied into the Datum.</param>
+		/// <returns>A Datum reference to this object.</returns>
+		Datum& operator=(const glm::vec3& other);
+		/// <summary>
+		/// Invokes the copy assignment from a scalar quaternion. 
+		/// Resizes the Datum to be exactly 1_z size and assigns the only element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar quaternion that is being copied into the Datum.</param>
+		/// <returns>A Datum reference to this object.</returns>
+		Datum& operator=(const glm::quat& other);
+		/// <summary>
+		/// Invokes the copy assignment from a scalar 3x3 matrix. 
+		/// Resizes the Datum to be exactly 1_z size and assigns the only element to the value of the scalar.
+		/// </summary>
+		/// <param name="other">The scalar 3x3 matrix that is being copied into the Datum.</param>
+		/// <returns>A Datum reference to this object.</returns>
+		Datum& operator=(const glm::mat3& other);
 #pragma endregion
 
 #pragma region Comparison Operator Overloads
@@ -323,10 +484,18 @@ namespace FIEAGameEngine
 		size_t Size() const;
 		/// <summary>
 		/// Provides the current capacity of the Datum.
+		/// Integer, Float, Table, Pointer, Boolean, Integer64, Double and Vector2 Datums keep up to a pointer's worth of elements inside the Datum,
+		/// so their capacity is at least that once reserved.
 		/// </summary>
 		/// <returns>The amount of elements that can fit in the allocated space for the Datum.</returns>
 		size_t Capacity() const;
 		/// <summary>
+		/// Reports the elements held and the bytes of the Datum's buffer. External storage is not owned by the Datum and inline elements are not allocated,
+		/// so both count as no bytes allocated.
+		/// </summary>
+		/// <returns>The element count, Capacity in bytes, and Size in bytes.</returns>
+		ContainerStats Stats() const;
+		/// <summary>
 		/// Determines if the Datum is empty or not.
 		/// </summary>
 		/// <returns>Whether the Datum is empty.</returns>
@@ -336,6 +505,13 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <returns>Whether the Datum is using external memory or not.</returns>
 		bool IsExternal() const;
+		/// <summary>
+		/// Determines if the Datum's elements are shared with copies of it. Only internally stored String and Matrix elements are ever shared.
+		/// Anything that can change the elements, including the non-const Get, Front, Back and AsSpan, first gives the Datum its own copy of them.
+		/// The reference or span those hand out can outlive the call, so they also stop copies from sharing the buffer until it is next reallocated.
+		/// </summary>
+		/// <returns>Whether the elements are shared.</returns>
+		bool IsShared() const;
 
 		/// <summary>
 		/// Changes the size of the Datum. 
@@ -347,7 +523,8 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if external storage is being used.</exception>
 		void Resize(size_t size);
 		/// <summary>
-		/// Removes all elements from the Datum. Sets the size to 0. Does not change the capacity as the memory is still reserved.
+		/// Removes all elements from the Datum. Sets the size to 0. Does not change the capacity as the memory is still reserved,
+		/// unless the elements are shared with copies of the Datum; then it just lets go of them and the capacity drops to 0.
 		/// </summary>
 		/// <exception cref="std::runtime_error">Thrown if external storage is being used.</exception>
 		void Clear();
@@ -414,9 +591,81 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if the type is not the same as currently set type.</exception>
 		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
 		void SetStorage(RTTI** array, size_t size);
+		/// <summary>
+		/// Sets the data array to an externally managed array of type bool.
+		/// Sets a boolean that says the Datum is managed externally.
+		/// </summary>
+		/// <param name="array">The externally managed data array.</param>
+		/// <param name="size">The size of the externally managed data array.</param>
+		/// <exception cref="std::runtime_error">Thrown if the size passed in is 0.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Unknown or Boolean.</exception>
+		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
+		void SetStorage(bool* array, size_t size);
+		/// <summary>
+		/// Sets the data array to an externally managed array of type 64-bit integer.
+		/// Sets a boolean that says the Datum is managed externally.
+		/// </summary>
+		/// <param name="array">The externally managed data array.</param>
+		/// <param name="size">The size of the externally managed data array.</param>
+		/// <exception cref="std::runtime_error">Thrown if the size passed in is 0.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Unknown or Integer64.</exception>
+		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
+		void SetStorage(std::int64_t* array, size_t size);
+		/// <summary>
+		/// Sets the data array to an externally managed array of type double.
+		/// Sets a boolean that says the Datum is managed externally.
+		/// </summary>
+		/// <param name="array">The externally managed data array.</param>
+		/// <param name="size">The size of the externally managed data array.</param>
+		/// <exception cref="std::runtime_error">Thrown if the size passed in is 0.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Unknown or Double.</exception>
+		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
+		void SetStorage(double* array, size_t size);
+		/// <summary>
+		/// Sets the data array to an externally managed array of type 2-vector.
+		/// Sets a boolean that says the Datum is managed externally.
+		/// </summary>
+		/// <param name="array">The externally managed data array.</param>
+		/// <param name="size">The size of the externally managed data array.</param>
+		/// <exception cref="std::runtime_error">Thrown if the size passed in is 0.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Unknown or Vector2.</exception>
+		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
+		void SetStorage(glm::vec2* array, size_t size);
+		/// <summary>
+		/// Sets the data array to an externally managed array of type 3-vector.
+		/// Sets a boolean that says the Datum is managed externally.
+		/// </summary>
+		/// <param name="array">The externally managed data array.</param>
+		/// <param name="size">The size of the externally managed data array.</param>
+		/// <exception cref="std::runtime_error">Thrown if the size passed in is 0.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Unknown or Vector3.</exception>
+		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
+		void SetStorage(glm::vec3* array, size_t size);
+		/// <summary>
+		/// Sets the data array to an externally managed array of type quaternion.
+		/// Sets a boolean that says the Datum is managed externally.
+		/// </summary>
+		/// <param name="array">The externally managed data array.</param>
+		/// <param name="size">The size of the externally managed data array.</param>
+		/// <exception cref="std::runtime_error">Thrown if the size passed in is 0.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Unknown or Quaternion.</exception>
+		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
+		void SetStorage(glm::quat* array, size_t size);
+		/// <summary>
+		/// Sets the data array to an externally managed array of type 3x3 matrix.
+		/// Sets a boolean that says the Datum is managed externally.
+		/// </summary>
+		/// <param name="array">The externally managed data array.</param>
+		/// <param name="size">The size of the externally managed data array.</param>
+		/// <exception cref="std::runtime_error">Thrown if the size passed in is 0.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Unknown or Matrix3.</exception>
+		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
+		void SetStorage(glm::mat3* array, size_t size);
 #pragma endregion
 		/// <summary>
 		/// Reserves memory for the Datum using the specified capacity.
+		/// Integer, Float, Table, Pointer, Boolean, Integer64, Double and Vector2 elements that fit in the space of a pointer are stored inside the Datum
+		/// without allocating, so a single int, float, pointer, bool, int64_t, double or vec2 never allocates. Pointers and references to inline elements do not survive moving the Datum.
 		/// </summary>
 		/// <param name="capacity">The number of elements that can be stored in the Vector.</param>
 		/// <exception cref="std::runtime_error">Thrown if external storage is being used.</exception>
@@ -472,6 +721,63 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if this function is called with an Unknown type.</exception>
 		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
 		void Set(RTTI*& value, size_t index = 0_z);
+		/// <summary>
+		/// Sets the data at the provided index to the passed in bool. Only an actual bool is taken.
+		/// </summary>
+		/// <param name="value">The bool to set the data to.</param>
+		/// <param name="index">The index in the data that will be set.</param>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Boolean.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		template <std::same_as<bool> TBool>
+		void Set(const TBool& value, size_t index = 0_z);
+		/// <summary>
+		/// Sets the data at the provided index to the passed in 64-bit integer.
+		/// </summary>
+		/// <param name="value">The 64-bit integer to set the data to.</param>
+		/// <param name="index">The index in the data that will be set.</param>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Integer64.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		void Set(const std::int64_t& value, size_t index = 0_z);
+		/// <summary>
+		/// Sets the data at the provided index to the passed in double.
+		/// </summary>
+		/// <param name="value">The double to set the data to.</param>
+		/// <param name="index">The index in the data that will be set.</param>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Double.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		void Set(const double& value, size_t index = 0_z);
+		/// <summary>
+		/// Sets the data at the provided index to the passed in 2-vector.
+		/// </summary>
+		/// <param name="value">The 2-vector to set the data to.</param>
+		/// <param name="index">The index in the data that will be set.</param>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Vector2.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		void Set(const glm::vec2& value, size_t index = 0_z);
+		/// <summary>
+		/// Sets the data at the provided index to the passed in 3-vector.
+		/// </summary>
+		/// <param name="value">The 3-vector to set the data to.</param>
+		/// <param name="index">The index in the data that will be set.</param>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Vector3.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		void Set(const glm::vec3& value, size_t index = 0_z);
+		/// <summary>
+		/// Sets the data at the provided index to the passed in quaternion.
+		/// </summary>
+		/// <param name="value">The quaternion to set the data to.</param>
+		/// <param name="index">The index in the data that will be set.</param>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Quaternion.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		void Set(const glm::quat& value, size_t index = 0_z);
+		/// <summary>
+		/// Sets the data at the provided index to the passed in 3x3 matrix.
+		/// </summary>
+		/// <param name="value">The 3x3 matrix to set the data to.</param>
+		/// <param name="index">The index in the data that will be set.</param>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Matrix3.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		void Set(const glm::mat3& value, size_t index = 0_z);
 
 #pragma endregion
 
@@ -551,13 +857,13 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
 		float& GetFloat(size_t index = 0_z) const;
 		/// <summary>
-		/// Get string from data at the specified index. For use on a const Datum.
+		/// Get string from data at the specified index. For use on a const Datum. Read-only, as the string may be shared with copies of the Datum.
 		/// </summary>
 		/// <param name="index">The index used to access an element of data.</param>
 		/// <returns>The element located in data at the index provided.</returns>		
 		/// <exception cref="std::runtime_error">Thrown if the type is not set to string.</exception>
 		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
-		std::string& GetString(size_t index = 0_z) const;
+		const std::string& GetString(size_t index = 0_z) const;
 		/// <summary>
 		/// Get vector from data at the specified index. For use on a const Datum.
 		/// </summary>
@@ -567,13 +873,13 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
 		glm::vec4& GetVector(size_t index = 0_z) const;
 		/// <summary>
-		/// Get matrix from data at the specified index. For use on a const Datum.
+		/// Get matrix from data at the specified index. For use on a const Datum. Read-only, as the matrix may be shared with copies of the Datum.
 		/// </summary>
 		/// <param name="index">The index used to access an element of data.</param>
 		/// <returns>The element located in data at the index provided.</returns>
 		/// <exception cref="std::runtime_error">Thrown if the type is not set to Matrix.</exception>
 		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
-		glm::mat4& GetMatrix(size_t index = 0_z) const;
+		const glm::mat4& GetMatrix(size_t index = 0_z) const;
 		/// <summary>
 		/// Get Scope from data at the specified index. For use on a const Datum.
 		/// </summary>
@@ -590,25 +896,175 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if the type is not set to Pointer.</exception>
 		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
 		RTTI*& GetPointer(size_t index = 0_z) const;
+		/// <summary>
+		/// Get bool from data at the specified index.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Boolean.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		bool& GetBoolean(size_t index = 0_z);
+		/// <summary>
+		/// Get 64-bit integer from data at the specified index.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Integer64.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		std::int64_t& GetInteger64(size_t index = 0_z);
+		/// <summary>
+		/// Get double from data at the specified index.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Double.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		double& GetDouble(size_t index = 0_z);
+		/// <summary>
+		/// Get 2-vector from data at the specified index.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Vector2.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		glm::vec2& GetVector2(size_t index = 0_z);
+		/// <summary>
+		/// Get 3-vector from data at the specified index.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Vector3.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		glm::vec3& GetVector3(size_t index = 0_z);
+		/// <summary>
+		/// Get quaternion from data at the specified index.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Quaternion.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		glm::quat& GetQuaternion(size_t index = 0_z);
+		/// <summary>
+		/// Get 3x3 matrix from data at the specified index.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Matrix3.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		glm::mat3& GetMatrix3(size_t index = 0_z);
+		/// <summary>
+		/// Get bool from data at the specified index. For use on a const Datum.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Boolean.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		const bool& GetBoolean(size_t index = 0_z) const;
+		/// <summary>
+		/// Get 64-bit integer from data at the specified index. For use on a const Datum.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Integer64.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		const std::int64_t& GetInteger64(size_t index = 0_z) const;
+		/// <summary>
+		/// Get double from data at the specified index. For use on a const Datum.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Double.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		const double& GetDouble(size_t index = 0_z) const;
+		/// <summary>
+		/// Get 2-vector from data at the specified index. For use on a const Datum.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Vector2.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		const glm::vec2& GetVector2(size_t index = 0_z) const;
+		/// <summary>
+		/// Get 3-vector from data at the specified index. For use on a const Datum.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Vector3.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		const glm::vec3& GetVector3(size_t index = 0_z) const;
+		/// <summary>
+		/// Get quaternion from data at the specified index. For use on a const Datum.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Quaternion.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		const glm::quat& GetQuaternion(size_t index = 0_z) const;
+		/// <summary>
+		/// Get 3x3 matrix from data at the specified index. For use on a const Datum.
+		/// </summary>
+		/// <param name="index">The index used to access an element of data.</param>
+		/// <returns>The element located in data at the index provided.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the type is not set to Matrix3.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		const glm::mat3& GetMatrix3(size_t index = 0_z) const;
+#pragma endregion
+
+#pragma region AsSpan
+		/// <summary>
+		/// Provides every element as one contiguous span, for loops that would otherwise call a Get function per element.
+		/// The type is checked once here instead of on each access. Works on internal and external storage alike.
+		/// The span is invalidated by anything that can reallocate the Datum, such as PushBack, Reserve, Resize or a move, and by copying the Datum.
+		/// </summary>
+		/// <typeparam name="T">int, float, std::string, glm::vec4, glm::mat4, Scope* for a Table, RTTI* for a Pointer,
+		/// or bool, std::int64_t, double, glm::vec2, glm::vec3, glm::quat or glm::mat3.</typeparam>
+		/// <returns>A span over the Size elements.</returns>
+		/// <exception cref="std::runtime_error">Thrown if T is not the element type of the Datum.</exception>
+		template <typename T>
+		std::span<T> AsSpan();
+		/// <summary>
+		/// Provides every element as one contiguous read-only span. For use on a const Datum.
+		/// </summary>
+		/// <typeparam name="T">One of the element types the non-const AsSpan accepts.</typeparam>
+		/// <returns>A span over the Size elements.</returns>
+		/// <exception cref="std::runtime_error">Thrown if T is not the element type of the Datum.</exception>
+		template <typename T>
+		std::span<const T> AsSpan() const;
 #pragma endregion
 
 		/// <summary>
 		/// Sets an index in data from a given string of the current type of Datum.
-		/// The Datum must have already been set to use this function.
+		/// The Datum must have already been set to use this function. Numbers, vectors and matrices are read as TextConversion reads them.
 		/// </summary>
 		/// <param name="str">The string to convert to a value.</param>
 		/// <param name="index">The index of where to set in the data.</param>
 		/// <exception cref="std::runtime_error">Thrown if the type is set to Unknown. No concept of an Unknown string. </exception>
 		/// <exception cref="std::runtime_error">Thrown if the type is set to Pointer. No concept of an Pointer string. </exception>
-		void SetFromString(const std::string& str, size_t index = 0_z);
+		/// <exception cref="std::runtime_error">Thrown if the string is not a value of the Datum's type.</exception>
+		void SetFromString(std::string_view str, size_t index = 0_z);
 		/// <summary>
 		/// Provides a string representation of the element at this index in the data array.
+		/// Numbers, vectors and matrices are written as TextConversion writes them, so SetFromString reads back exactly the same value.
 		/// </summary>
 		/// <param name="index">The index of the element.</param>
 		/// <returns>A string representation of the element.</returns>
 		std::string ToString(size_t index = 0_z) const;
+		/// <summary>
+		/// Writes the string representation of the element at this index into a caller's buffer, without allocating for any type but Pointer.
+		/// No terminating null is written.
+		/// </summary>
+		/// <param name="buffer">Where the string is written. TextConversion's maximum lengths give the size each numeric type needs.</param>
+		/// <param name="index">The index of the element.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the string does not fit in buffer.</exception>
+		std::size_t ToString(std::span<char> buffer, size_t index = 0_z) const;
 		//void SetFromString(const std::string& value, std::size_t index = 0);
-		void PushBackFromString(const std::string& value);
+		/// <summary>
+		/// Adds an element read from a given string of the current type of Datum onto the back of the Datum.
+		/// </summary>
+		/// <param name="value">The string to convert to a value.</param>
+		/// <exception cref="std::runtime_error">Thrown if the string is not a value of the Datum's type.</exception>
+		void PushBackFromString(std::string_view value);
 
 #pragma region PushBack
 		/// <summary>
@@ -669,6 +1125,14 @@ namespace FIEAGameEngine
 		template <typename IncrementFunctor = DefaultIncrement>
 		void PushBack(const glm::vec4& value);
 		/// <summary>
+		/// Adds a vector element onto the back of the Datum using an rvalue. Does not require a copy. Updates the capacity and size.
+		/// </summary>
+		/// <param name="value">The vector element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not an Vector.</exception>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(glm::vec4&& value);
+		/// <summary>
 		/// Adds a matrix element onto the back of the Datum using an lvalue. Requires a copy. Updates the capacity and size.
 		/// </summary>
 		/// <param name="value">The matrix element that is being added.</param>
@@ -677,6 +1141,14 @@ namespace FIEAGameEngine
 		template <typename IncrementFunctor = DefaultIncrement>
 		void PushBack(const glm::mat4& value);
 		/// <summary>
+		/// Adds a matrix element onto the back of the Datum using an rvalue. Does not require a copy. Updates the capacity and size.
+		/// </summary>
+		/// <param name="value">The matrix element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not an matrix.</exception>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(glm::mat4&& value);
+		/// <summary>
 		/// Adds a pointer element onto the back of the Datum using an lvalue. Requires a copy. Updates the capacity and size.
 		/// </summary>
 		/// <param name="value">The pointer element that is being added.</param>
@@ -684,6 +1156,110 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if the type is not an pointer.</exception>
 		template <typename IncrementFunctor = DefaultIncrement>
 		void PushBack(RTTI*& value);
+		/// <summary>
+		/// Adds a bool element onto the back of the Datum. Updates the capacity and size. Only an actual bool is taken.
+		/// </summary>
+		/// <param name="value">The bool element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Boolean.</exception>
+		template <typename IncrementFunctor = DefaultIncrement, std::same_as<bool> TBool>
+		void PushBack(const TBool& value);
+		/// <summary>
+		/// Adds a 64-bit integer element onto the back of the Datum. Updates the capacity and size.
+		/// </summary>
+		/// <param name="value">The 64-bit integer element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Integer64.</exception>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(const std::int64_t& value);
+		/// <summary>
+		/// Adds a double element onto the back of the Datum. Updates the capacity and size.
+		/// </summary>
+		/// <param name="value">The double element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Double.</exception>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(const double& value);
+		/// <summary>
+		/// Adds a 2-vector element onto the back of the Datum. Updates the capacity and size.
+		/// </summary>
+		/// <param name="value">The 2-vector element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Vector2.</exception>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(const glm::vec2& value);
+		/// <summary>
+		/// Adds a 3-vector element onto the back of the Datum. Updates the capacity and size.
+		/// </summary>
+		/// <param name="value">The 3-vector element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Vector3.</exception>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(const glm::vec3& value);
+		/// <summary>
+		/// Adds a quaternion element onto the back of the Datum. Updates the capacity and size.
+		/// </summary>
+		/// <param name="value">The quaternion element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Quaternion.</exception>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(const glm::quat& value);
+		/// <summary>
+		/// Adds a 3x3 matrix element onto the back of the Datum. Updates the capacity and size.
+		/// </summary>
+		/// <param name="value">The 3x3 matrix element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Matrix3.</exception>
+		template <typename IncrementFunctor = DefaultIncrement>
+		void PushBack(const glm::mat3& value);
+#pragma endregion
+
+#pragma region Bulk
+		/// <summary>
+		/// Adds every element of a range onto the back of the Datum. The type is checked once, and for forward iterators
+		/// the buffer grows at most once; a std::move_iterator moves the elements instead of copying them.
+		/// The range must not refer to this Datum's own elements.
+		/// </summary>
+		/// <typeparam name="InputIt">An input iterator whose value type is one of the element types AsSpan accepts, other than Scope*.</typeparam>
+		/// <param name="first">The first element to add.</param>
+		/// <param name="last">One past the last element to add.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the elements are not of the Datum's type.</exception>
+		template <typename InputIt>
+		void Append(InputIt first, InputIt last);
+		/// <summary>
+		/// Copies every element of a span onto the back of the Datum, growing the buffer at most once.
+		/// The span must not refer to this Datum's own elements.
+		/// </summary>
+		/// <typeparam name="T">One of the element types AsSpan accepts, other than Scope*, optionally const.</typeparam>
+		/// <param name="values">The elements to add.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the elements are not of the Datum's type.</exception>
+		template <typename T>
+		void Append(std::span<T> values);
+		/// <summary>
+		/// Replaces the elements of the Datum with copies of the elements of a span.
+		/// Internal storage is reallocated at most once, and only if the current capacity is too small.
+		/// External storage keeps its size, so the span must hold exactly Size elements, which are copied over the current ones.
+		/// The span must not refer to this Datum's own elements.
+		/// </summary>
+		/// <typeparam name="T">One of the element types AsSpan accepts, other than Scope*, optionally const.</typeparam>
+		/// <param name="values">The new elements.</param>
+		/// <exception cref="std::runtime_error">Thrown if the elements are not of the Datum's type.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external and the span's size differs from Size.</exception>
+		template <typename T>
+		void Assign(std::span<T> values);
+		/// <summary>
+		/// Changes the size of the Datum, as Resize does, except that new elements are copies of fillValue rather than default values.
+		/// fillValue must not be one of this Datum's own elements.
+		/// </summary>
+		/// <typeparam name="T">One of the element types AsSpan accepts, other than Scope*.</typeparam>
+		/// <param name="size">The new size that the Datum will be set to.</param>
+		/// <param name="fillValue">The value every new element is a copy of.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if fillValue is not of the Datum's type.</exception>
+		template <typename T>
+		void Resize(size_t size, const T& fillValue);
 #pragma endregion
 
 #pragma region Front
@@ -1055,6 +1631,7 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Union type for storing and accessing Datum's elements. 
 		/// Each pointer can be thought of as a lens to store and access elements of that type.
+		/// While the elements fit in the space of the pointer, they are stored in buffer instead and no memory is allocated for them.
 		/// </summary>
 		union DatumValues
 		{
@@ -1066,6 +1643,20 @@ namespace FIEAGameEngine
 			Scope** t;
 			RTTI** p;
 			void* vp;
+			alignas(void*) std::byte buffer[sizeof(void*)];
+		};
+
+		/// <summary>
+		/// Sits in front of the elements of every internal String and Matrix buffer, counting the Datums that share the buffer.
+		/// Its size keeps the elements after it as aligned as the allocation itself.
+		/// </summary>
+		struct alignas(16) SharedBuffer
+		{
+			std::atomic<std::size_t> References;
+			/// <summary>
+			/// Set once a mutable reference or span into the buffer has been handed out. Copies then copy the elements rather than share them.
+			/// </summary>
+			bool Exposed{ false };
 		};
 
 		/// <summary>
@@ -1081,6 +1672,10 @@ namespace FIEAGameEngine
 		/// </summary>
 		bool _isExternal{ false };
 		/// <summary>
+		/// Determines if the elements are stored in _data.buffer rather than in an allocated buffer.
+		/// </summary>
+		bool _isInline{ false };
+		/// <summary>
 		/// The type of data that the Datum holds.
 		/// </summary>
 		DatumTypes _type{ DatumTypes::Unknown };
@@ -1110,6 +1705,117 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
 		friend Attributed;
 		void SetStorage(DatumTypes type, void* data, size_t size);
+		/// <summary>
+		/// Provides the lens for the elements, wherever they are stored. Element access goes through this rather than _data,
+		/// which holds the elements themselves while they are inline.
+		/// </summary>
+		/// <returns>A DatumValues pointing at the first element.</returns>
+		DatumValues Values() const;
+		/// <summary>
+		/// Determines if buffers of a type are shared between copies. Only String and Matrix elements are worth it: the rest copy about as fast as they count.
+		/// </summary>
+		/// <param name="type">The type of the elements.</param>
+		/// <returns>Whether internal buffers of the type start with a SharedBuffer.</returns>
+		static constexpr bool IsShareable(DatumTypes type);
+		/// <summary>
+		/// Provides the SharedBuffer in front of the elements. Only valid for an internal String or Matrix Datum that has a buffer.
+		/// </summary>
+		/// <returns>The SharedBuffer of this Datum's buffer.</returns>
+		SharedBuffer& Header() const;
+		/// <summary>
+		/// Gives the Datum its own copy of its elements if they are shared, before anything changes them.
+		/// </summary>
+		void Unshare();
+		/// <summary>
+		/// Unshares the elements before a mutable reference or span to them is handed out, and keeps later copies from sharing them,
+		/// since the caller can keep writing through it after the call returns.
+		/// </summary>
+		void Expose();
+		/// <summary>
+		/// Determines if a copy of this Datum can share its buffer rather than copy the elements.
+		/// </summary>
+		/// <returns>True for an internal String or Matrix buffer that has not been exposed.</returns>
+		bool CanShareBuffer() const;
+		/// <summary>
+		/// Maps an element type to the DatumTypes that stores it.
+		/// </summary>
+		/// <typeparam name="T">One of the element types AsSpan accepts.</typeparam>
+		/// <returns>The DatumTypes whose elements are T.</returns>
+		template <typename T>
+		static constexpr DatumTypes TypeOf();
+		/// <summary>
+		/// Checks that elements of type T can be added to this Datum in bulk.
+		/// </summary>
+		/// <typeparam name="T">One of the element types Append accepts. Table elements are only added through Scope, which adopts them.</typeparam>
+		/// <exception cref="std::runtime_error">Thrown if T is not the element type of the Datum.</exception>
+		template <typename T>
+		void CheckBulkType() const;
+		/// <summary>
+		/// Determines whether a pointer refers to one of this Datum's elements, which a bulk operation must read before it reallocates them.
+		/// </summary>
+		/// <typeparam name="T">The element type of the Datum.</typeparam>
+		/// <param name="element">The pointer to check.</param>
+		/// <returns>True if element points into this Datum's first Size() elements.</returns>
+		template <typename T>
+		bool Holds(const T* element) const;
+		/// <summary>
+		/// Provides the element at an index, for the compact types that share one implementation rather than having their own.
+		/// </summary>
+		/// <typeparam name="T">The element type, which must be the Datum's.</typeparam>
+		/// <param name="index">The index of the element.</param>
+		/// <returns>The element at the index.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+		/// <exception cref="std::runtime_error">Thrown if T is not the element type of the Datum.</exception>
+		template <typename T>
+		T& Element(size_t index) const;
+		/// <summary>
+		/// Sets the type to that of T and makes value the one element, as the scalar assignment operators do.
+		/// </summary>
+		/// <typeparam name="T">The element type.</typeparam>
+		/// <param name="value">The only element the Datum will hold.</param>
+		/// <exception cref="std::runtime_error">Thrown if the Datum already has a different type.</exception>
+		template <typename T>
+		void AssignElement(const T& value);
+		/// <summary>
+		/// Adds an element onto the back of the Datum, as the PushBack overloads do.
+		/// </summary>
+		/// <typeparam name="IncrementFunctor">Decides how much the capacity grows by when the Datum is full.</typeparam>
+		/// <typeparam name="T">The element type, which must be the Datum's.</typeparam>
+		/// <param name="value">The element that is being added.</param>
+		/// <exception cref="std::runtime_error">Thrown if the memory is set to external.</exception>
+		/// <exception cref="std::runtime_error">Thrown if T is not the element type of the Datum.</exception>
+		template <typename IncrementFunctor, typename T>
+		void PushBackElement(const T& value);
+		/// <summary>
+		/// Sets the data array to an externally managed array of T, as the SetStorage overloads do.
+		/// </summary>
+		/// <typeparam name="T">The element type.</typeparam>
+		/// <param name="array">The externally managed data array.</param>
+		/// <param name="size">The size of the externally managed data array.</param>
+		/// <exception cref="std::runtime_error">Thrown if the size passed in is 0.</exception>
+		/// <exception cref="std::runtime_error">Thrown if the type is not Unknown or that of T.</exception>
+		/// <exception cref="std::runtime_error">Thrown if internal storage is already set.</exception>
+		template <typename T>
+		void SetStorageElements(T* array, size_t size);
+		/// <summary>
+		/// Removes the element at the index by moving the ones after it down. Used for the compact types, which are all trivially copyable.
+		/// </summary>
+		/// <typeparam name="T">The element type.</typeparam>
+		/// <param name="index">The index of the element to remove.</param>
+		template <typename T>
+		void RemoveElements(size_t index = 0_z);
+		/// <summary>
+		/// Grows or allocates the internal buffer to hold capacity elements of the current type, and tells MemoryStatistics.
+		/// A capacity that fits in _data.buffer, while nothing has been allocated yet, uses the buffer instead; growing past it moves the elements to the heap.
+		/// A shared buffer is left to the other Datums: the elements are copied into a new buffer of this Datum's own.
+		/// </summary>
+		/// <param name="capacity">The new capacity. Must not be less than Size.</param>
+		void ReallocateBuffer(size_t capacity);
+		/// <summary>
+		/// Frees the internal buffer, if there is one, and tells MemoryStatistics. The elements must already be destroyed.
+		/// A shared buffer is only let go of, and freed by the last Datum to do so, which destroys the elements still in it.
+		/// </summary>
+		void ReleaseBuffer();
 
 		/// <summary>
 		/// Array that contains each size of each type that the Datum can be.
@@ -1158,6 +1864,14 @@ namespace FIEAGameEngine
 		/// <param name="startIndex">Starting index to create RTTI pointers at.</param>
 		/// <param name="size">Ending index to create RTTI pointers, which will be the size at the end of the loop.</param>
 		void CreatePointers(size_t startIndex, size_t size) const;
+		/// <summary>
+		/// Use a loop to create default value elements of one of the compact types.
+		/// </summary>
+		/// <typeparam name="T">The element type.</typeparam>
+		/// <param name="startIndex">Starting index to create elements at.</param>
+		/// <param name="size">Ending index to create elements, which will be the size at the end of the loop.</param>
+		template <typename T>
+		void CreateElements(size_t startIndex, size_t size) const;
 #pragma endregion
 
 #pragma region CopyFunction
@@ -1208,6 +1922,13 @@ namespace FIEAGameEngine
 		/// <param name="size">Ending index to copy RTTI pointers from and to, which will be the size at the end of the loop.</param>
 		/// <param name="data">The data from the other Datum that is being copied from.</param>
 		void CopyPointers(const Datum& other) const;
+		/// <summary>
+		/// Use a loop to copy elements of one of the compact types from an existing Datum's data.
+		/// </summary>
+		/// <typeparam name="T">The element type.</typeparam>
+		/// <param name="other">The Datum that is being copied from.</param>
+		template <typename T>
+		void CopyElements(const Datum& other) const;
 #pragma endregion
 
 #pragma region CompareFunction
@@ -1273,17 +1994,26 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="index">The index of the element that we want to generate the string for.</param>
 		std::string ToStringPointers(size_t index = 0_z) const;
+		/// <summary>
+		/// Creates a string from a Datum of one of the compact types at the index provided.
+		/// </summary>
+		/// <typeparam name="T">The element type.</typeparam>
+		/// <param name="index">The index of the element that we want to generate the string for.</param>
+		template <typename T>
+		std::string ToStringElements(size_t index = 0_z) const;
 #pragma endregion
 
 #pragma region FromStringFunctions
-		int32_t FromStringInteger(const std::string& value) const;
-		float FromStringFloat(const std::string& value) const;
-		glm::vec4 FromStringVector(const std::string& value) const;
-		glm::mat4 FromStringMatrix(const std::string& value) const;
+		int32_t FromStringInteger(std::string_view value) const;
+		float FromStringFloat(std::string_view value) const;
+		glm::vec4 FromStringVector(std::string_view value) const;
+		glm::mat4 FromStringMatrix(std::string_view value) const;
+		template <typename T>
+		static T FromString(std::string_view value);
 #pragma endregion
 
 #pragma region SetFromString
-		using SetFromStringFunction = void(Datum::*)(const std::string& str, size_t index);
+		using SetFromStringFunction = void(Datum::*)(std::string_view str, size_t index);
 		/// <summary>
 		/// Array of functions used to set data from a string for each type that Datum can be.
 		/// </summary>
@@ -1291,28 +2021,33 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Set integers from a string.
 		/// </summary>
-		void SetFromStringIntegers(const std::string& str, size_t index);
+		void SetFromStringIntegers(std::string_view str, size_t index);
 		/// <summary>
 		/// Set floats from a string.
 		/// </summary>
-		void SetFromStringFloats(const std::string& str, size_t index);
+		void SetFromStringFloats(std::string_view str, size_t index);
 		/// <summary>
 		/// Set strings from a string.
 		/// </summary>
-		void SetFromStringStrings(const std::string& str, size_t index);
+		void SetFromStringStrings(std::string_view str, size_t index);
 		/// <summary>
 		/// Set vectors from a string.
 		/// </summary>
-		void SetFromStringVectors(const std::string& str, size_t index);
+		void SetFromStringVectors(std::string_view str, size_t index);
 		/// <summary>
 		/// Set matrices from a string.
 		/// </summary>
-		void SetFromStringMatrices(const std::string& str, size_t index);
+		void SetFromStringMatrices(std::string_view str, size_t index);
+		/// <summary>
+		/// Set elements of one of the compact types from a string.
+		/// </summary>
+		template <typename T>
+		void SetFromStringElements(std::string_view str, size_t index);
 #pragma endregion
 
 
 #pragma region PushBackFromString
-		using PushBackFromStringFunction = void(Datum::*)(const std::string& str);
+		using PushBackFromStringFunction = void(Datum::*)(std::string_view str);
 		/// <summary>
 		/// Array of functions used to PushBack data from a string for each type that Datum can be.
 		/// </summary>
@@ -1320,23 +2055,28 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// PushBack integers from a string.
 		/// </summary>
-		void PushBackFromStringIntegers(const std::string& str);
+		void PushBackFromStringIntegers(std::string_view str);
 		/// <summary>
 		/// PushBack floats from a string.
 		/// </summary>
-		void PushBackFromStringFloats(const std::string& str);
+		void PushBackFromStringFloats(std::string_view str);
 		/// <summary>
 		/// PushBack strings from a string.
 		/// </summary>
-		void PushBackFromStringStrings(const std::string& str);
+		void PushBackFromStringStrings(std::string_view str);
 		/// <summary>
 		/// PushBack vectors from a string.
 		/// </summary>
-		void PushBackFromStringVectors(const std::string& str);
+		void PushBackFromStringVectors(std::string_view str);
 		/// <summary>
 		/// PushBack matrices from a string.
 		/// </summary>
-		void PushBackFromStringMatrices(const std::string& str);
+		void PushBackFromStringMatrices(std::string_view str);
+		/// <summary>
+		/// PushBack elements of one of the compact types from a string.
+		/// </summary>
+		template <typename T>
+		void PushBackFromStringElements(std::string_view str);
 #pragma endregion
 	};
 }
@@ -12,7 +12,14 @@ namespace FIEAGameEngine
 		sizeof(glm::vec4), // DatumTypes::Vector
 		sizeof(glm::mat4), // DatumTypes::Matrix
 		sizeof(Scope*), // DatumTypes::Pointer
-		sizeof(RTTI*) // DatumTypes::Pointer
+		sizeof(RTTI*), // DatumTypes::Pointer
+		sizeof(bool), // DatumTypes::Boolean
+		sizeof(std::int64_t), // DatumTypes::Integer64
+		sizeof(double), // DatumTypes::Double
+		sizeof(glm::vec2), // DatumTypes::Vector2
+		sizeof(glm::vec3), // DatumTypes::Vector3
+		sizeof(glm::quat), // DatumTypes::Quaternion
+		sizeof(glm::mat3) // DatumTypes::Matrix3
 	};
 
 	inline const HashMap<const std::string, Datum::DatumTypes> Datum::_typeMap
@@ -22,10 +29,273 @@ namespace FIEAGameEngine
 			std::pair("string"s, Datum::DatumTypes::String),
 			std::pair("vector"s, Datum::DatumTypes::Vector),
 			std::pair("matrix"s, Datum::DatumTypes::Matrix),
-			std::pair("table"s, Datum::DatumTypes::Table)
+			std::pair("table"s, Datum::DatumTypes::Table),
+			std::pair("boolean"s, Datum::DatumTypes::Boolean),
+			std::pair("integer64"s, Datum::DatumTypes::Integer64),
+			std::pair("double"s, Datum::DatumTypes::Double),
+			std::pair("vector2"s, Datum::DatumTypes::Vector2),
+			std::pair("vector3"s, Datum::DatumTypes::Vector3),
+			std::pair("quaternion"s, Datum::DatumTypes::Quaternion),
+			std::pair("matrix3"s, Datum::DatumTypes::Matrix3)
 	};
 #pragma endregion
 
+	inline Datum::DatumValues Datum::Values() const
+	{
+		DatumValues values;
+		values.vp = _isInline ? const_cast<std::byte*>(_data.buffer) : _data.vp;
+		return values;
+	}
+
+	inline constexpr bool Datum::IsShareable(DatumTypes type)
+	{
+		return type == DatumTypes::String || type == DatumTypes::Matrix;
+	}
+
+	inline Datum::SharedBuffer& Datum::Header() const
+	{
+		return *reinterpret_cast<SharedBuffer*>(static_cast<std::byte*>(_data.vp) - sizeof(SharedBuffer));
+	}
+
+	inline bool Datum::IsShared() const
+	{
+		return IsShareable(_type) && !_isExternal && _data.vp != nullptr && Header().References.load(std::memory_order_acquire) > 1_z;
+	}
+
+	inline void Datum::Unshare()
+	{
+		if (IsShared())
+		{
+			ReallocateBuffer(_capacity);
+		}
+	}
+
+	inline void Datum::Expose()
+	{
+		Unshare();
+		if (IsShareable(_type) && !_isExternal && _data.vp != nullptr)
+		{
+			Header().Exposed = true;
+		}
+	}
+
+	inline bool Datum::CanShareBuffer() const
+	{
+		return IsShareable(_type) && !_isExternal && _data.vp != nullptr && !Header().Exposed;
+	}
+
+	template <typename T>
+	inline constexpr Datum::DatumTypes Datum::TypeOf()
+	{
+		if constexpr (std::is_same_v<T, int>)
+		{
+			return DatumTypes::Integer;
+		}
+		else if constexpr (std::is_same_v<T, float>)
+		{
+			return DatumTypes::Float;
+		}
+		else if constexpr (std::is_same_v<T, std::string>)
+		{
+			return DatumTypes::String;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec4>)
+		{
+			return DatumTypes::Vector;
+		}
+		else if constexpr (std::is_same_v<T, glm::mat4>)
+		{
+			return DatumTypes::Matrix;
+		}
+		else if constexpr (std::is_same_v<T, Scope*>)
+		{
+			return DatumTypes::Table;
+		}
+		else if constexpr (std::is_same_v<T, bool>)
+		{
+			return DatumTypes::Boolean;
+		}
+		else if constexpr (std::is_same_v<T, std::int64_t>)
+		{
+			return DatumTypes::Integer64;
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			return DatumTypes::Double;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec2>)
+		{
+			return DatumTypes::Vector2;
+		}
+		else if constexpr (std::is_same_v<T, glm::vec3>)
+		{
+			return DatumTypes::Vector3;
+		}
+		else if constexpr (std::is_same_v<T, glm::quat>)
+		{
+			return DatumTypes::Quaternion;
+		}
+		else if constexpr (std::is_same_v<T, glm::mat3>)
+		{
+			return DatumTypes::Matrix3;
+		}
+		else
+		{
+			static_assert(std::is_same_v<T, RTTI*>, "Datum cannot store elements of this type.");
+			return DatumTypes::Pointer;
+		}
+	}
+
+	template <typename T>
+	inline void Datum::CheckBulkType() const
+	{
+		static_assert(!std::is_same_v<T, Scope*>, "Table elements are added through Scope, which adopts them.");
+		if (_type != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot add elements of a different type to the Datum.");
+		}
+	}
+
+	template <typename T>
+	inline bool Datum::Holds(const T* element) const
+	{
+		const T* elements = reinterpret_cast<const T*>(Values().vp);
+		return _size > 0_z && std::less_equal<>()(elements, element) && std::less<>()(element, elements + _size);
+	}
+
+#pragma region CompactTypes
+	template <typename T>
+	inline T& Datum::Element(size_t index) const
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Index out of bounds");
+		}
+
+		if (_type != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot access an element of a different type than the Datum's.");
+		}
+
+		return reinterpret_cast<T*>(Values().vp)[index];
+	}
+
+	template <typename T>
+	inline void Datum::AssignElement(const T& value)
+	{
+		SetType(TypeOf<T>());
+		if (_size != 1_z)
+		{
+			Resize(1_z);
+		}
+		Element<T>(0_z) = value;
+	}
+
+	template <typename IncrementFunctor, typename T>
+	inline void Datum::PushBackElement(const T& value)
+	{
+		if (_isExternal)
+		{
+			throw std::runtime_error("Cannot PushBack with external memory.");
+		}
+
+		if (_type != TypeOf<T>())
+		{
+			throw std::runtime_error("Can only PushBack an element of the Datum's type.");
+		}
+
+		IncrementFunctor incrementFunc;
+
+		if (_size == _capacity)
+		{
+			size_t capacity = _capacity + std::max(1_z, incrementFunc(_size, _capacity));
+			Reserve(capacity);
+		}
+
+		new(reinterpret_cast<T*>(Values().vp) + _size++)T(value);
+	}
+
+	template <typename T>
+	inline void Datum::SetStorageElements(T* array, size_t size)
+	{
+		if (size == 0_z)
+		{
+			throw std::runtime_error("Cannot set storage with a size of 0.");
+		}
+
+		if (_type != Datum::DatumTypes::Unknown && _type != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot set storage to a type other than the Datum's.");
+		}
+
+		if (_size != 0_z && !_isExternal)
+		{
+			throw std::runtime_error("Cannot set storage to external if internal storage already exists.");
+		}
+		SetType(TypeOf<T>());
+		ReleaseBuffer();
+		_data.vp = array;
+		_size = size;
+		_capacity = size;
+		_isExternal = true;
+	}
+
+	template <std::same_as<bool> TBool>
+	inline Datum::Datum(const TBool& value) :
+		_type(Datum::DatumTypes::Boolean)
+	{
+		Resize(1_z);
+		Element<bool>(0_z) = value;
+	}
+
+	template <std::same_as<bool> TBool>
+	inline Datum::Datum(std::initializer_list<TBool> list) :
+		Datum(Datum::DatumTypes::Boolean)
+	{
+		Reserve(list.size());
+		std::uninitialized_copy(list.begin(), list.end(), reinterpret_cast<bool*>(Values().vp));
+		_size = list.size();
+	}
+
+	template <std::same_as<bool> TBool>
+	inline Datum& Datum::operator=(const TBool& value)
+	{
+		AssignElement<bool>(value);
+		return *this;
+	}
+
+	template <std::same_as<bool> TBool>
+	inline void Datum::Set(const TBool& value, size_t index)
+	{
+		Element<bool>(index) = value;
+	}
+#pragma endregion
+
+#pragma region AsSpan
+	template <typename T>
+	inline std::span<T> Datum::AsSpan()
+	{
+		if (_type != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot view the Datum as a span of a different type.");
+		}
+
+		Expose();
+		return std::span<T>(reinterpret_cast<T*>(Values().vp), _size);
+	}
+
+	template <typename T>
+	inline std::span<const T> Datum::AsSpan() const
+	{
+		if (_type != TypeOf<T>())
+		{
+			throw std::runtime_error("Cannot view the Datum as a span of a different type.");
+		}
+
+		return std::span<const T>(reinterpret_cast<const T*>(Values().vp), _size);
+	}
+#pragma endregion
+
 #pragma region CreateFunctions
 	inline const Datum::CreateFunction Datum::_createFunctions[] =
 	{
@@ -36,6 +306,13 @@ namespace FIEAGameEngine
 		&Datum::CreateMatrices,
 		&Datum::CreatePointers,
 		&Datum::CreatePointers,
+		&Datum::CreateElements<bool>,
+		&Datum::CreateElements<std::int64_t>,
+		&Datum::CreateElements<double>,
+		&Datum::CreateElements<glm::vec2>,
+		&Datum::CreateElements<glm::vec3>,
+		&Datum::CreateElements<glm::quat>,
+		&Datum::CreateElements<glm::mat3>,
 		nullptr
 	};
 
@@ -43,7 +320,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = startIndex; i < size; ++i)
 		{
-			new (_data.i + i)int();
+			new (Values().i + i)int();
 		}
 	}
 
@@ -51,7 +328,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = startIndex; i < size; ++i)
 		{
-			new (_data.f + i)float();
+			new (Values().f + i)float();
 		}
 	}
 
@@ -59,7 +336,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = startIndex; i < size; ++i)
 		{
-			new (_data.s + i)std::string();
+			new (Values().s + i)std::string();
 		}
 	}
 
@@ -67,7 +344,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = startIndex; i < size; ++i)
 		{
-			new (_data.v + i)glm::vec4();
+			new (Values().v + i)glm::vec4();
 		}
 	}
 
@@ -75,7 +352,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = startIndex; i < size; ++i)
 		{
-			new (_data.m + i)glm::mat4();
+			new (Values().m + i)glm::mat4();
 		}
 	}
 
@@ -83,7 +360,16 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = startIndex; i < size; ++i)
 		{
-			new (_data.p + i)RTTI*();
+			new (Values().p + i)RTTI*();
+		}
+	}
+
+	template <typename T>
+	inline void Datum::CreateElements(size_t startIndex, size_t size) const
+	{
+		for (std::size_t i = startIndex; i < size; ++i)
+		{
+			new (reinterpret_cast<T*>(Values().vp) + i)T();
 		}
 	}
 #pragma endregion
@@ -98,6 +384,13 @@ namespace FIEAGameEngine
 		&Datum::CopyMatrices,
 		&Datum::CopyPointers,
 		&Datum::CopyPointers,
+		&Datum::CopyElements<bool>,
+		&Datum::CopyElements<std::int64_t>,
+		&Datum::CopyElements<double>,
+		&Datum::CopyElements<glm::vec2>,
+		&Datum::CopyElements<glm::vec3>,
+		&Datum::CopyElements<glm::quat>,
+		&Datum::CopyElements<glm::mat3>,
 		nullptr
 	};
 	// Changes paramaters
@@ -105,7 +398,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = 0_z; i < other._size; ++i)
 		{
-			new (_data.i + i)int(*(other._data.i + i));
+			new (Values().i + i)int(*(other.Values().i + i));
 		}
 	}
 
@@ -113,7 +406,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = 0_z; i < other._size; ++i)
 		{
-			new (_data.f + i)float(*(other._data.f + i));
+			new (Values().f + i)float(*(other.Values().f + i));
 		}
 	}
 
@@ -121,7 +414,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = 0_z; i < other._size; ++i)
 		{
-			new (_data.s + i)std::string(*(other._data.s + i));
+			new (Values().s + i)std::string(*(other.Values().s + i));
 		}
 	}
 
@@ -129,7 +422,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = 0_z; i < other._size; ++i)
 		{
-			new (_data.v + i)glm::vec4(*(other._data.v + i));
+			new (Values().v + i)glm::vec4(*(other.Values().v + i));
 		}
 	}
 
@@ -137,7 +430,7 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = 0_z; i < other._size; ++i)
 		{
-			new (_data.m + i)glm::mat4(*(other._data.m + i));
+			new (Values().m + i)glm::mat4(*(other.Values().m + i));
 		}
 	}
 
@@ -145,9 +438,15 @@ namespace FIEAGameEngine
 	{
 		for (std::size_t i = 0_z; i < other._size; ++i)
 		{
-			new (_data.p + i)RTTI*(*(other._data.p + i));
+			new (Values().p + i)RTTI*(*(other.Values().p + i));
 		}
 	}
+
+	template <typename T>
+	inline void Datum::CopyElements(const Datum& other) const
+	{
+		std::uninitialized_copy_n(reinterpret_cast<const T*>(other.Values().vp), other._size, reinterpret_cast<T*>(Values().vp));
+	}
 #pragma endregion
 
 #pragma region ToStringFunctions
@@ -160,17 +459,26 @@ namespace FIEAGameEngine
 		&Datum::ToStringMatrices,
 		&Datum::ToStringPointers,
 		&Datum::ToStringPointers,
+		&Datum::ToStringElements<bool>,
+		&Datum::ToStringElements<std::int64_t>,
+		&Datum::ToStringElements<double>,
+		&Datum::ToStringElements<glm::vec2>,
+		&Datum::ToStringElements<glm::vec3>,
+		&Datum::ToStringElements<glm::quat>,
+		&Datum::ToStringElements<glm::mat3>,
 		nullptr
 	};
 
 	inline std::string Datum::ToStringIntegers(size_t index) const
 	{
-		return std::to_string(GetInteger(index));
+		char buffer[TextConversion::MaxIntegerLength];
+		return std::string(buffer, TextConversion::Format(GetInteger(index), buffer));
 	}
 
 	inline std::string Datum::ToStringFloats(size_t index) const
 	{
-		return std::to_string(GetFloat(index));
+		char buffer[TextConversion::MaxFloatLength];
+		return std::string(buffer, TextConversion::Format(GetFloat(index), buffer));
 	}
 
 	inline std::string Datum::ToStringStrings(size_t index) const
@@ -180,12 +488,14 @@ namespace FIEAGameEngine
 
 	inline std::string Datum::ToStringVectors(size_t index) const
 	{
-		return glm::to_string(GetVector(index));
+		char buffer[TextConversion::MaxVectorLength];
+		return std::string(buffer, TextConversion::Format(GetVector(index), buffer));
 	}
 
 	inline std::string Datum::ToStringMatrices(size_t index) const
 	{
-		return glm::to_string(GetMatrix(index));
+		char buffer[TextConversion::MaxMatrixLength];
+		return std::string(buffer, TextConversion::Format(GetMatrix(index), buffer));
 	}
 
 	inline std::string Datum::ToStringPointers(size_t index) const
@@ -194,37 +504,70 @@ namespace FIEAGameEngine
 		assert(ptr != nullptr);
 		return ptr->ToString();
 	}
+
+	template <typename T>
+	inline std::string Datum::ToStringElements(size_t index) const
+	{
+		// A mat3 is the longest of the compact types.
+		char buffer[TextConversion::MaxMatrix3Length];
+		return std::string(buffer, TextConversion::Format(Element<T>(index), buffer));
+	}
 #pragma endregion
 
 #pragma region FromStringFunctions
 
-	inline int32_t Datum::FromStringInteger(const std::string& value) const
+	inline int32_t Datum::FromStringInteger(std::string_view value) const
+	{
+		return TextConversion::ParseInteger(value);
+	}
+
+	inline float Datum::FromStringFloat(std::string_view value) const
 	{
-		return stoi(value);
+		return TextConversion::ParseFloat(value);
 	}
 
-	inline float Datum::FromStringFloat(const std::string& value) const
+	inline glm::vec4 Datum::FromStringVector(std::string_view value) const
 	{
-		return stof(value);
+		return TextConversion::ParseVector(value);
 	}
 
-	inline glm::vec4 Datum::FromStringVector(const std::string& value) const
+	inline glm::mat4 Datum::FromStringMatrix(std::string_view value) const
 	{
-		glm::vec4 data;
-		sscanf_s(value.c_str(), "vec4(%f, %f, %f, %f)", &data[0], &data[1], &data[2], &data[3]);
-		return data;
+		return TextConversion::ParseMatrix(value);
 	}
 
-	inline glm::mat4 Datum::FromStringMatrix(const std::string& value) const
+	template <typename T>
+	inline T Datum::FromString(std::string_view value)
 	{
-		glm::mat4 data;
-		sscanf_s(value.c_str(), "mat4x4((%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f), (%f, %f, %f, %f))",
-			&data[0][0], &data[0][1], &data[0][2], &data[0][3],
-			&data[1][0], &data[1][1], &data[1][2], &data[1][3],
-			&data[2][0], &data[2][1], &data[2][2], &data[2][3],
-			&data[3][0], &data[3][1], &data[3][2], &data[3][3]
-		);
-		return data;
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			return TextConversion::ParseBoolean(value);
+		}
+		else if constexpr (std::is_same_v<T, std::int64_t>)
+		{
+			return TextConversion::ParseInteger64(value);
+		}
+		else if constexpr (std::is_same_v<T, double>)
+		{
+			return TextConversion::ParseDouble(value);
+		}
+		else if constexpr (std::is_same_v<T, glm::vec2>)
+		{
+			return TextConversion::ParseVector2(value);
+		}
+		else if constexpr (std::is_same_v<T, glm::vec3>)
+		{
+			return TextConversion::ParseVector3(value);
+		}
+		else if constexpr (std::is_same_v<T, glm::quat>)
+		{
+			return TextConversion::ParseQuaternion(value);
+		}
+		else
+		{
+			static_assert(std::is_same_v<T, glm::mat3>, "Only the compact types are read through FromString.");
+			return TextConversion::ParseMatrix3(value);
+		}
 	}
 
 #pragma endregion
@@ -239,33 +582,46 @@ namespace FIEAGameEngine
 		&Datum::SetFromStringMatrices,
 		nullptr,
 		nullptr,
+		&Datum::SetFromStringElements<bool>,
+		&Datum::SetFromStringElements<std::int64_t>,
+		&Datum::SetFromStringElements<double>,
+		&Datum::SetFromStringElements<glm::vec2>,
+		&Datum::SetFromStringElements<glm::vec3>,
+		&Datum::SetFromStringElements<glm::quat>,
+		&Datum::SetFromStringElements<glm::mat3>,
 		nullptr
 	};
 
-	inline void Datum::SetFromStringIntegers(const std::string& str, size_t index)
+	inline void Datum::SetFromStringIntegers(std::string_view str, size_t index)
 	{
 		Set(FromStringInteger(str), index);
 	}
 
-	inline void Datum::SetFromStringFloats(const std::string& str, size_t index)
+	inline void Datum::SetFromStringFloats(std::string_view str, size_t index)
 	{
 		Set(FromStringFloat(str), index);
 	}
 
-	inline void Datum::SetFromStringStrings(const std::string& str, size_t index)
+	inline void Datum::SetFromStringStrings(std::string_view str, size_t index)
 	{
-		Set(str, index);
+		Set(std::string(str), index);
 	}
 
-	inline void Datum::SetFromStringVectors(const std::string& str, size_t index)
+	inline void Datum::SetFromStringVectors(std::string_view str, size_t index)
 	{
 		Set(FromStringVector(str), index);
 	}
 
-	inline void Datum::SetFromStringMatrices(const std::string& str, size_t index)
+	inline void Datum::SetFromStringMatrices(std::string_view str, size_t index)
 	{
 		Set(FromStringMatrix(str), index);
 	}
+
+	template <typename T>
+	inline void Datum::SetFromStringElements(std::string_view str, size_t index)
+	{
+		Element<T>(index) = FromString<T>(str);
+	}
 #pragma endregion
 
 #pragma region PushBackFromStringFunctions
@@ -278,33 +634,46 @@ namespace FIEAGameEngine
 		&Datum::PushBackFromStringMatrices,
 		nullptr,
 		nullptr,
+		&Datum::PushBackFromStringElements<bool>,
+		&Datum::PushBackFromStringElements<std::int64_t>,
+		&Datum::PushBackFromStringElements<double>,
+		&Datum::PushBackFromStringElements<glm::vec2>,
+		&Datum::PushBackFromStringElements<glm::vec3>,
+		&Datum::PushBackFromStringElements<glm::quat>,
+		&Datum::PushBackFromStringElements<glm::mat3>,
 		nullptr
 	};
 
-	inline void Datum::PushBackFromStringIntegers(const std::string& str)
+	inline void Datum::PushBackFromStringIntegers(std::string_view str)
 	{
 		PushBack(FromStringInteger(str));
 	}
 
-	inline void Datum::PushBackFromStringFloats(const std::string& str)
+	inline void Datum::PushBackFromStringFloats(std::string_view str)
 	{
 		PushBack(FromStringFloat(str));
 	}
 
-	inline void Datum::PushBackFromStringStrings(const std::string& str)
+	inline void Datum::PushBackFromStringStrings(std::string_view str)
 	{
-		PushBack(str);
+		PushBack(std::string(str));
 	}
 
-	inline void Datum::PushBackFromStringVectors(const std::string& str)
+	inline void Datum::PushBackFromStringVectors(std::string_view str)
 	{
 		PushBack(FromStringVector(str));
 	}
 
-	inline void Datum::PushBackFromStringMatrices(const std::string& str)
+	inline void Datum::PushBackFromStringMatrices(std::string_view str)
 	{
 		PushBack(FromStringMatrix(str));
 	}
+
+	template <typename T>
+	inline void Datum::PushBackFromStringElements(std::string_view str)
+	{
+		PushBackElement<DefaultIncrement>(FromString<T>(str));
+	}
 #pragma endregion
 
 #pragma region CompareFunctions
@@ -317,12 +686,19 @@ namespace FIEAGameEngine
 		&Datum::ComparePODs,
 		&Datum::ComparePointers,
 		&Datum::ComparePointers,
+		&Datum::ComparePODs,
+		&Datum::ComparePODs,
+		&Datum::ComparePODs,
+		&Datum::ComparePODs,
+		&Datum::ComparePODs,
+		&Datum::ComparePODs,
+		&Datum::ComparePODs,
 		nullptr
 	};
 
 	inline bool Datum::ComparePODs(const Datum& rhs) const
 	{
-		return memcmp(_data.vp, rhs._data.vp, _sizeMap[static_cast<int>(_type)] * _size) == 0;
+		return memcmp(Values().vp, rhs.Values().vp, _sizeMap[static_cast<int>(_type)] * _size) == 0;
 	}
 
 	inline bool Datum::CompareStrings(const Datum& rhs) const
@@ -330,7 +706,7 @@ namespace FIEAGameEngine
 		bool isEqual = true;
 		for (size_t i = 0_z; i < _size; i++)
 		{
-			if (_data.s[i].compare(rhs._data.s[i]) != 0)
+			if (Values().s[i].compare(rhs.Values().s[i]) != 0)
 			{
 				isEqual = false;
 			}
@@ -344,8 +720,8 @@ namespace FIEAGameEngine
 		bool isEqual = true;
 		for (size_t i = 0_z; i < _size; ++i)
 		{
-			RTTI* lhsRtti = _data.p[i];
-			RTTI* rhsRtti = rhs._data.p[i];
+			RTTI* lhsRtti = Values().p[i];
+			RTTI* rhsRtti = rhs.Values().p[i];
 			if ((lhsRtti != rhsRtti) && (lhsRtti != nullptr) && !(lhsRtti->Equals(rhsRtti)))
 			{
 				isEqual = false;
@@ -378,7 +754,7 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.i + _size++)int(value);
+		new(Values().i + _size++)int(value);
 
 	}
 	template<typename IncrementFunctor>
@@ -402,7 +778,7 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.i + _size++)int(std::forward<int>(value));
+		new(Values().i + _size++)int(std::forward<int>(value));
 	}
 
 
@@ -427,7 +803,7 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.f + _size++)float(value);
+		new(Values().f + _size++)float(value);
 	}
 	template<typename IncrementFunctor>
 	inline void Datum::PushBack(float&& value)
@@ -450,7 +826,7 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.f + _size++)float(std::forward<float>(value));
+		new(Values().f + _size++)float(std::forward<float>(value));
 	}
 
 	template<typename IncrementFunctor>
@@ -466,6 +842,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only PushBack an String if the Datum's type is String.");
 		}
 
+		Unshare();
 		IncrementFunctor incrementFunc;
 
 		if (_size == _capacity)
@@ -474,7 +851,7 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.s + _size++)std::string(value);
+		new(Values().s + _size++)std::string(value);
 	}
 
 	template<typename IncrementFunctor>
@@ -490,6 +867,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only PushBack an String if the Datum's type is String.");
 		}
 
+		Unshare();
 		IncrementFunctor incrementFunc;
 
 		if (_size == _capacity)
@@ -498,7 +876,7 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.s + _size++)std::string(std::forward<std::string>(value));
+		new(Values().s + _size++)std::string(std::forward<std::string>(value));
 	}
 
 	template<typename IncrementFunctor>
@@ -522,7 +900,30 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.v + _size++)glm::vec4(value);
+		new(Values().v + _size++)glm::vec4(value);
+	}
+	template<typename IncrementFunctor>
+	inline void Datum::PushBack(glm::vec4&& value)
+	{
+		if (_isExternal)
+		{
+			throw std::runtime_error("Cannot PushBack with external memory.");
+		}
+
+		if (_type != Datum::DatumTypes::Vector)
+		{
+			throw std::runtime_error("Can only PushBack an Vector if the Datum's type is Vector.");
+		}
+
+		IncrementFunctor incrementFunc;
+
+		if (_size == _capacity)
+		{
+			size_t capacity = _capacity + std::max(1_z, incrementFunc(_size, _capacity));
+			Reserve(capacity);
+		}
+
+		new(Values().v + _size++)glm::vec4(std::forward<glm::vec4>(value));
 	}
 
 	template<typename IncrementFunctor>
@@ -538,6 +939,31 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Can only PushBack an Matrix if the Datum's type is Matrix.");
 		}
 
+		Unshare();
+		IncrementFunctor incrementFunc;
+
+		if (_size == _capacity)
+		{
+			size_t capacity = _capacity + std::max(1_z, incrementFunc(_size, _capacity));
+			Reserve(capacity);
+		}
+
+		new(Values().m + _size++)glm::mat4(value);
+	}
+	template<typename IncrementFunctor>
+	inline void Datum::PushBack(glm::mat4&& value)
+	{
+		if (_isExternal)
+		{
+			throw std::runtime_error("Cannot PushBack with external memory.");
+		}
+		
+		if (_type != Datum::DatumTypes::Matrix)
+		{
+			throw std::runtime_error("Can only PushBack an Matrix if the Datum's type is Matrix.");
+		}
+
+		Unshare();
 		IncrementFunctor incrementFunc;
 
 		if (_size == _capacity)
@@ -546,7 +972,7 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.m + _size++)glm::mat4(value);
+		new(Values().m + _size++)glm::mat4(std::forward<glm::mat4>(value));
 	}
 
 	template<typename IncrementFunctor>
@@ -570,7 +996,7 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.t + _size++)Scope*(&value);
+		new(Values().t + _size++)Scope*(&value);
 	}
 
 	template<typename IncrementFunctor>
@@ -594,44 +1020,208 @@ namespace FIEAGameEngine
 			Reserve(capacity);
 		}
 
-		new(_data.p + _size++)RTTI* (value);
+		new(Values().p + _size++)RTTI* (value);
+	}
+
+	template <typename IncrementFunctor, std::same_as<bool> TBool>
+	inline void Datum::PushBack(const TBool& value)
+	{
+		PushBackElement<IncrementFunctor>(static_cast<bool>(value));
+	}
+
+	template <typename IncrementFunctor>
+	inline void Datum::PushBack(const std::int64_t& value)
+	{
+		PushBackElement<IncrementFunctor>(value);
+	}
+
+	template <typename IncrementFunctor>
+	inline void Datum::PushBack(const double& value)
+	{
+		PushBackElement<IncrementFunctor>(value);
+	}
+
+	template <typename IncrementFunctor>
+	inline void Datum::PushBack(const glm::vec2& value)
+	{
+		PushBackElement<IncrementFunctor>(value);
+	}
+
+	template <typename IncrementFunctor>
+	inline void Datum::PushBack(const glm::vec3& value)
+	{
+		PushBackElement<IncrementFunctor>(value);
+	}
+
+	template <typename IncrementFunctor>
+	inline void Datum::PushBack(const glm::quat& value)
+	{
+		PushBackElement<IncrementFunctor>(value);
+	}
+
+	template <typename IncrementFunctor>
+	inline void Datum::PushBack(const glm::mat3& value)
+	{
+		PushBackElement<IncrementFunctor>(value);
 	}
 #pragma endregion
 
-#pragma region IndexOf
-	inline size_t Datum::IndexOf(const int& value)
+#pragma region Bulk
+	template <typename InputIt>
+	inline void Datum::Append(InputIt first, InputIt last)
 	{
-		size_t index = 0_z;
-		for (size_t i = 0_z; i < _size; i++)
+		using T = std::iter_value_t<InputIt>;
+
+		if (_isExternal)
+		{
+			throw std::runtime_error("Cannot Append with external memory.");
+		}
+
+		CheckBulkType<T>();
+		Unshare();
+
+		DefaultIncrement incrementFunc;
+
+		if constexpr (std::contiguous_iterator<InputIt>)
 		{
-			if (_data.i[i] == value)
+			// A range of this Datum's own elements moves with the buffer, so it is found again by offset once the buffer has grown.
+			const size_t count = static_cast<size_t>(std::distance(first, last));
+			const T* source = std::to_address(first);
+			const bool isOwnRange = count > 0_z && Holds(source);
+			const size_t offset = isOwnRange ? static_cast<size_t>(source - reinterpret_cast<const T*>(Values().vp)) : 0_z;
+			if (_size + count > _capacity)
 			{
-				index = i;
-				break;
+				Reserve(std::max(_size + count, _capacity + incrementFunc(_size, _capacity)));
 			}
+
+			T* elements = reinterpret_cast<T*>(Values().vp);
+			if (isOwnRange)
+			{
+				source = elements + offset;
+			}
+			std::uninitialized_copy(source, source + count, elements + _size);
+			_size += count;
 		}
+		else if constexpr (std::forward_iterator<InputIt>)
+		{
+			const size_t count = static_cast<size_t>(std::distance(first, last));
+			if (_size + count > _capacity)
+			{
+				Reserve(std::max(_size + count, _capacity + incrementFunc(_size, _capacity)));
+			}
 
-		return index;
+			std::uninitialized_copy(first, last, reinterpret_cast<T*>(Values().vp) + _size);
+			_size += count;
+		}
+		else
+		{
+			for (; first != last; ++first)
+			{
+				if (_size == _capacity)
+				{
+					Reserve(_capacity + std::max(1_z, incrementFunc(_size, _capacity)));
+				}
+
+				new(reinterpret_cast<T*>(Values().vp) + _size)T(*first);
+				++_size;
+			}
+		}
 	}
 
-	inline size_t Datum::IndexOf(const int& value) const
+	template <typename T>
+	inline void Datum::Append(std::span<T> values)
 	{
-		return const_cast<Datum*>(this)->IndexOf(value);
+		Append(values.begin(), values.end());
 	}
 
-	inline size_t Datum::IndexOf(const float& value)
+	template <typename T>
+	inline void Datum::Assign(std::span<T> values)
 	{
-		size_t index = 0_z;
-		for (size_t i = 0_z; i < _size; i++)
+		using Element = std::remove_cv_t<T>;
+		CheckBulkType<Element>();
+
+		if (!values.empty() && Holds<Element>(values.data()))
 		{
-			if (_data.f[i] == value)
+			// Assigning destroys the elements being read, so this Datum's own elements are copied out first.
+			if (values.data() == reinterpret_cast<const Element*>(Values().vp) && values.size() == _size)
 			{
-				index = i;
-				break;
+				return;
 			}
+
+			Datum copy;
+			copy.SetType(_type);
+			copy.Append(values);
+			const Datum& constCopy = copy;
+			Assign(constCopy.AsSpan<Element>());
+			return;
 		}
 
-		return index;
+		if (_isExternal)
+		{
+			if (values.size() != _size)
+			{
+				throw std::runtime_error("Cannot Assign a different number of elements to external memory.");
+			}
+
+			std::copy(values.begin(), values.end(), reinterpret_cast<Element*>(Values().vp));
+			return;
+		}
+
+		Clear();
+		if (values.size() > _capacity)
+		{
+			// Nothing is left to keep, so a new buffer is allocated rather than the old one grown.
+			ReleaseBuffer();
+			Reserve(values.size());
+		}
+
+		std::uninitialized_copy(values.begin(), values.end(), reinterpret_cast<Element*>(Values().vp));
+		_size = values.size();
+	}
+
+	template <typename T>
+	inline void Datum::Resize(size_t size, const T& fillValue)
+	{
+		CheckBulkType<T>();
+
+		if (size <= _size)
+		{
+			Resize(size);
+			return;
+		}
+
+		if (Holds(&fillValue))
+		{
+			// The fill value would move or be freed with the buffer, so it is copied out first.
+			const T copy(fillValue);
+			Resize(size, copy);
+			return;
+		}
+
+		Unshare();
+		Reserve(size);
+		T* elements = reinterpret_cast<T*>(Values().vp);
+		std::uninitialized_fill(elements + _size, elements + size, fillValue);
+		_size = size;
+	}
+#pragma endregion
+
+#pragma region IndexOf
+	inline size_t Datum::IndexOf(const int& value)
+	{
+		const size_t index = SimdFind(Values().i, _size, value);
+		return index < _size ? index : 0_z;
+	}
+
+	inline size_t Datum::IndexOf(const int& value) const
+	{
+		return const_cast<Datum*>(this)->IndexOf(value);
+	}
+
+	inline size_t Datum::IndexOf(const float& value)
+	{
+		const size_t index = SimdFind(Values().f, _size, value);
+		return index < _size ? index : 0_z;
 	}
 
 	inline size_t Datum::IndexOf(const float& value) const
@@ -644,7 +1234,7 @@ namespace FIEAGameEngine
 		size_t index = 0_z;
 		for (size_t i = 0_z; i < _size; i++)
 		{
-			if (_data.s[i] == value)
+			if (Values().s[i] == value)
 			{
 				index = i;
 				break;
@@ -661,17 +1251,8 @@ namespace FIEAGameEngine
 
 	inline size_t Datum::IndexOf(const glm::vec4& value)
 	{
-		size_t index = 0_z;
-		for (size_t i = 0_z; i < _size; i++)
-		{
-			if (_data.v[i] == value)
-			{
-				index = i;
-				break;
-			}
-		}
-
-		return index;
+		const size_t index = SimdFind(Values().v, _size, value);
+		return index < _size ? index : 0_z;
 	}
 
 	inline size_t Datum::IndexOf(const glm::vec4& value) const
@@ -684,7 +1265,7 @@ namespace FIEAGameEngine
 		size_t index = 0_z;
 		for (size_t i = 0_z; i < _size; i++)
 		{
-			if (_data.m[i] == value)
+			if (Values().m[i] == value)
 			{
 				index = i;
 				break;
@@ -704,7 +1285,7 @@ namespace FIEAGameEngine
 		size_t index = 0_z;
 		for (size_t i = 0_z; i < _size; i++)
 		{
-			if (value->Equals(_data.p[i]))
+			if (value->Equals(Values().p[i]))
 			{
 				index = i;
 				break;
@@ -791,6 +1372,13 @@ namespace FIEAGameEngine
 		&Datum::RemoveMatrices,
 		&Datum::RemovePointers,
 		&Datum::RemovePointers,
+		&Datum::RemoveElements<bool>,
+		&Datum::RemoveElements<std::int64_t>,
+		&Datum::RemoveElements<double>,
+		&Datum::RemoveElements<glm::vec2>,
+		&Datum::RemoveElements<glm::vec3>,
+		&Datum::RemoveElements<glm::quat>,
+		&Datum::RemoveElements<glm::mat3>,
 		nullptr
 	};
 
@@ -800,9 +1388,9 @@ namespace FIEAGameEngine
 		if (size > 0)
 		{
 #ifdef _WINDOWS
-			memmove_s(_data.i + index, size, _data.i + index + 1_z, size);
+			memmove_s(Values().i + index, size, Values().i + index + 1_z, size);
 #else
-			memmove(_data.i + index, _data.i + index + 1_z, size);
+			memmove(Values().i + index, Values().i + index + 1_z, size);
 #endif 
 		}
 	}
@@ -813,24 +1401,16 @@ namespace FIEAGameEngine
 		if (size > 0)
 		{
 #ifdef _WINDOWS
-			memmove_s(_data.f + index, size, _data.f + index + 1_z, size);
+			memmove_s(Values().f + index, size, Values().f + index + 1_z, size);
 #else
-			memmove(_data.f + index, _data.f + index + 1_z, size);
+			memmove(Values().f + index, Values().f + index + 1_z, size);
 #endif 
 		}
 	}
 
 	inline void Datum::RemoveStrings(size_t index)
 	{
-		size_t size = sizeof(std::string) * (_size - index - 1_z);
-		if (size > 0)
-		{
-#ifdef _WINDOWS
-			memmove_s(_data.s + index, size, _data.s + index + 1_z, size);
-#else
-			memmove(_data.s + index, _data.s + index + 1_z, size);
-#endif 
-		}
+		RelocateElements(Values().s + index, Values().s + index + 1_z, _size - index - 1_z);
 	}
 
 	inline void Datum::RemoveVectors(size_t index)
@@ -839,9 +1419,9 @@ namespace FIEAGameEngine
 		if (size > 0)
 		{
 #ifdef _WINDOWS
-			memmove_s(_data.v + index, size, _data.v + index + 1_z, size);
+			memmove_s(Values().v + index, size, Values().v + index + 1_z, size);
 #else
-			memmove(_data.v + index, _data.v + index + 1_z, size);
+			memmove(Values().v + index, Values().v + index + 1_z, size);
 #endif 
 		}
 	}
@@ -852,9 +1432,9 @@ namespace FIEAGameEngine
 		if (size > 0)
 		{
 #ifdef _WINDOWS
-			memmove_s(_data.m + index, size, _data.m + index + 1_z, size);
+			memmove_s(Values().m + index, size, Values().m + index + 1_z, size);
 #else
-			memmove(_data.m + index, _data.m + index + 1_z, size);
+			memmove(Values().m + index, Values().m + index + 1_z, size);
 #endif 
 		}
 	}
@@ -865,9 +1445,24 @@ namespace FIEAGameEngine
 		if (size > 0)
 		{
 #ifdef _WINDOWS
-			memmove_s(_data.p + index, size, _data.p + index + 1_z, size);
+			memmove_s(Values().p + index, size, Values().p + index + 1_z, size);
+#else
+			memmove(Values().p + index, Values().p + index + 1_z, size);
+#endif 
+		}
+	}
+
+	template <typename T>
+	inline void Datum::RemoveElements(size_t index)
+	{
+		size_t size = sizeof(T) * (_size - index - 1_z);
+		if (size > 0)
+		{
+			T* elements = reinterpret_cast<T*>(Values().vp);
+#ifdef _WINDOWS
+			memmove_s(elements + index, size, elements + index + 1_z, size);
 #else
-			memmove(_data.p + index, _data.p + index + 1_z, size);
+			memmove(elements + index, elements + index + 1_z, size);
 #endif 
 		}
 	}
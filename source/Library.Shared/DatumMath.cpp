@@ -0,0 +1,189 @@
+#include "pch.h"
+#include "DatumMath.h"
+#include <span>
+#include <stdexcept>
+
+namespace FIEAGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Provides every float component of a Float, Vector or Matrix Datum as one span.
+		/// </summary>
+		std::span<const float> Components(const Datum& datum)
+		{
+			switch (datum.Type())
+			{
+			case Datum::DatumTypes::Float:
+				return datum.AsSpan<float>();
+			case Datum::DatumTypes::Vector:
+				return std::span<const float>(reinterpret_cast<const float*>(datum.AsSpan<glm::vec4>().data()), datum.Size() * 4);
+			case Datum::DatumTypes::Matrix:
+				return std::span<const float>(reinterpret_cast<const float*>(datum.AsSpan<glm::mat4>().data()), datum.Size() * 16);
+			default:
+				throw std::runtime_error("DatumMath only operates on Float, Vector and Matrix Datums.");
+			}
+		}
+
+		/// <summary>
+		/// Provides every float component of a Float, Vector or Matrix Datum as one writable span. Going through the non-const AsSpan
+		/// gives the Datum its own copy of elements it shares with its copies before anything is written.
+		/// </summary>
+		std::span<float> Components(Datum& datum)
+		{
+			switch (datum.Type())
+			{
+			case Datum::DatumTypes::Float:
+				return datum.AsSpan<float>();
+			case Datum::DatumTypes::Vector:
+				return std::span<float>(reinterpret_cast<float*>(datum.AsSpan<glm::vec4>().data()), datum.Size() * 4);
+			case Datum::DatumTypes::Matrix:
+				return std::span<float>(reinterpret_cast<float*>(datum.AsSpan<glm::mat4>().data()), datum.Size() * 16);
+			default:
+				throw std::runtime_error("DatumMath only operates on Float, Vector and Matrix Datums.");
+			}
+		}
+
+		/// <summary>
+		/// Checks that two Datums can be combined element by element.
+		/// </summary>
+		void CheckMatching(const Datum& destination, const Datum& source)
+		{
+			if (destination.Type() != source.Type() || destination.Size() != source.Size())
+			{
+				throw std::runtime_error("DatumMath requires Datums of the same type and size.");
+			}
+		}
+	}
+
+	void DatumMath::Scale(Datum& datum, float factor)
+	{
+		const std::span<float> components = Components(datum);
+		SimdScale(components.data(), components.size(), factor);
+	}
+
+	void DatumMath::Add(Datum& destination, const Datum& source)
+	{
+		CheckMatching(destination, source);
+		const std::span<float> components = Components(destination);
+		SimdAdd(components.data(), Components(source).data(), components.size());
+	}
+
+	void DatumMath::MultiplyAdd(Datum& destination, const Datum& source, float factor)
+	{
+		CheckMatching(destination, source);
+		const std::span<float> components = Components(destination);
+		SimdMultiplyAdd(components.data(), Components(source).data(), factor, components.size());
+	}
+
+	void DatumMath::Lerp(Datum& destination, const Datum& target, float t)
+	{
+		CheckMatching(destination, target);
+		const std::span<float> components = Components(destination);
+		SimdLerp(components.data(), Components(target).data(), t, components.size());
+	}
+
+	void DatumMath::Clamp(Datum& datum, float minimum, float maximum)
+	{
+		if (maximum < minimum)
+		{
+			throw std::runtime_error("Cannot clamp to a range whose maximum is less than its minimum.");
+		}
+
+		const std::span<float> components = Components(datum);
+		SimdClamp(components.data(), components.size(), minimum, maximum);
+	}
+
+	void DatumMath::Transform(Datum& datum, const glm::mat4& matrix)
+	{
+		switch (datum.Type())
+		{
+		case Datum::DatumTypes::Vector:
+			SimdTransform(datum.AsSpan<glm::vec4>().data(), datum.Size(), matrix);
+			break;
+		case Datum::DatumTypes::Matrix:
+			// A product's columns are the left matrix times each column of the right one.
+			SimdTransform(reinterpret_cast<glm::vec4*>(datum.AsSpan<glm::mat4>().data()), datum.Size() * 4, matrix);
+			break;
+		default:
+			throw std::runtime_error("DatumMath can only transform Vector and Matrix Datums.");
+		}
+	}
+
+	float DatumMath::Sum(const Datum& datum)
+	{
+		const std::span<const float> values = datum.AsSpan<float>();
+		return SimdSum(values.data(), values.size());
+	}
+
+	glm::vec4 DatumMath::SumVectors(const Datum& datum)
+	{
+		const std::span<const glm::vec4> values = datum.AsSpan<glm::vec4>();
+		return SimdSum(values.data(), values.size());
+	}
+
+	float DatumMath::Min(const Datum& datum)
+	{
+		const std::span<const float> values = datum.AsSpan<float>();
+		if (values.empty())
+		{
+			throw std::runtime_error("Cannot find the least element of an empty Datum.");
+		}
+
+		return SimdMin(values.data(), values.size());
+	}
+
+	float DatumMath::Max(const Datum& datum)
+	{
+		const std::span<const float> values = datum.AsSpan<float>();
+		if (values.empty())
+		{
+			throw std::runtime_error("Cannot find the greatest element of an empty Datum.");
+		}
+
+		return SimdMax(values.data(), values.size());
+	}
+
+	void DatumMath::Convert(const Datum& source, Datum& destination)
+	{
+		Datum::DatumTypes type;
+		switch (source.Type())
+		{
+		case Datum::DatumTypes::Integer:
+			type = Datum::DatumTypes::Float;
+			break;
+		case Datum::DatumTypes::Float:
+			type = Datum::DatumTypes::Integer;
+			break;
+		default:
+			throw std::runtime_error("DatumMath can only convert Integer and Float Datums.");
+		}
+
+		if (destination.Type() != Datum::DatumTypes::Unknown && destination.Type() != type)
+		{
+			throw std::runtime_error("Cannot convert into a Datum of a different type.");
+		}
+
+		destination.SetType(type);
+		if (destination.IsExternal())
+		{
+			if (destination.Size() != source.Size())
+			{
+				throw std::runtime_error("Cannot convert into an external Datum of a different size.");
+			}
+		}
+		else
+		{
+			destination.Resize(source.Size());
+		}
+
+		if (type == Datum::DatumTypes::Float)
+		{
+			SimdConvert(source.AsSpan<int>().data(), destination.AsSpan<float>().data(), source.Size());
+		}
+		else
+		{
+			SimdConvert(source.AsSpan<float>().data(), destination.AsSpan<int>().data(), source.Size());
+		}
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include "Datum.h"
+#include "SimdMath.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Bulk arithmetic over whole Datums, run on their storage with the SimdMath kernels instead of a Get and Set per element.
+	/// Internal and external (SetStorage) storage are treated alike; nothing here changes a Datum's size unless noted.
+	/// The element-wise functions accept Float, Vector and Matrix Datums, and work on every float component of every element.
+	/// </summary>
+	class DatumMath final
+	{
+	public:
+		DatumMath() = delete;
+		DatumMath(const DatumMath&) = delete;
+		DatumMath(DatumMath&&) = delete;
+		DatumMath& operator=(const DatumMath&) = delete;
+		DatumMath& operator=(DatumMath&&) = delete;
+		~DatumMath() = default;
+
+		/// <summary>
+		/// Multiplies every component of every element by factor.
+		/// </summary>
+		/// <param name="datum">A Float, Vector or Matrix Datum.</param>
+		/// <param name="factor">The value every component is multiplied by.</param>
+		/// <exception cref="std::runtime_error">Thrown if the Datum is not Float, Vector or Matrix.</exception>
+		static void Scale(Datum& datum, float factor);
+		/// <summary>
+		/// Adds each element of source to the element of destination at the same index.
+		/// </summary>
+		/// <param name="destination">A Float, Vector or Matrix Datum.</param>
+		/// <param name="source">A Datum of the same type and size.</param>
+		/// <exception cref="std::runtime_error">Thrown if the Datums are not both Float, Vector or Matrix, or differ in type or size.</exception>
+		static void Add(Datum& destination, const Datum& source);
+		/// <summary>
+		/// Adds each element of source times factor to the element of destination at the same index; for example, positions += velocities * deltaTime.
+		/// </summary>
+		/// <param name="destination">A Float, Vector or Matrix Datum.</param>
+		/// <param name="source">A Datum of the same type and size.</param>
+		/// <param name="factor">The value each source component is multiplied by.</param>
+		/// <exception cref="std::runtime_error">Thrown if the Datums are not both Float, Vector or Matrix, or differ in type or size.</exception>
+		static void MultiplyAdd(Datum& destination, const Datum& source, float factor);
+		/// <summary>
+		/// Moves each element of destination the fraction t of the way towards the element of target at the same index.
+		/// </summary>
+		/// <param name="destination">A Float, Vector or Matrix Datum.</param>
+		/// <param name="target">A Datum of the same type and size.</param>
+		/// <param name="t">0 leaves destination unchanged; 1 makes it a copy of target.</param>
+		/// <exception cref="std::runtime_error">Thrown if the Datums are not both Float, Vector or Matrix, or differ in type or size.</exception>
+		static void Lerp(Datum& destination, const Datum& target, float t);
+		/// <summary>
+		/// Limits every component of every element to the range [minimum, maximum].
+		/// </summary>
+		/// <param name="datum">A Float, Vector or Matrix Datum.</param>
+		/// <param name="minimum">The least value a component keeps.</param>
+		/// <param name="maximum">The greatest value a component keeps.</param>
+		/// <exception cref="std::runtime_error">Thrown if the Datum is not Float, Vector or Matrix.</exception>
+		/// <exception cref="std::runtime_error">Thrown if maximum is less than minimum.</exception>
+		static void Clamp(Datum& datum, float minimum, float maximum);
+		/// <summary>
+		/// Replaces every element with matrix * element. For a Matrix Datum that is the matrix product, with matrix on the left.
+		/// </summary>
+		/// <param name="datum">A Vector or Matrix Datum.</param>
+		/// <param name="matrix">The matrix every element is multiplied by.</param>
+		/// <exception cref="std::runtime_error">Thrown if the Datum is not Vector or Matrix.</exception>
+		static void Transform(Datum& datum, const glm::mat4& matrix);
+		/// <summary>
+		/// Adds up every element of a Float Datum.
+		/// </summary>
+		/// <param name="datum">A Float Datum.</param>
+		/// <returns>The total, or 0 if the Datum is empty.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the Datum is not Float.</exception>
+		static float Sum(const Datum& datum);
+		/// <summary>
+		/// Adds up every element of a Vector Datum, component by component.
+		/// </summary>
+		/// <param name="datum">A Vector Datum.</param>
+		/// <returns>The total, or a zero vector if the Datum is empty.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the Datum is not Vector.</exception>
+		static glm::vec4 SumVectors(const Datum& datum);
+		/// <summary>
+		/// Finds the least element of a Float Datum.
+		/// </summary>
+		/// <param name="datum">A non-empty Float Datum.</param>
+		/// <returns>The least element.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the Datum is not Float or is empty.</exception>
+		static float Min(const Datum& datum);
+		/// <summary>
+		/// Finds the greatest element of a Float Datum.
+		/// </summary>
+		/// <param name="datum">A non-empty Float Datum.</param>
+		/// <returns>The greatest element.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the Datum is not Float or is empty.</exception>
+		static float Max(const Datum& datum);
+		/// <summary>
+		/// Converts an Integer Datum to Float, or a Float Datum to Integer, rounding towards zero.
+		/// An internal destination is given the type if it has none and resized to match source; an external destination must already be the right type and size.
+		/// </summary>
+		/// <param name="source">An Integer or Float Datum.</param>
+		/// <param name="destination">Where the converted elements are written.</param>
+		/// <exception cref="std::runtime_error">Thrown if source is not Integer or Float.</exception>
+		/// <exception cref="std::runtime_error">Thrown if destination already has a type other than the converted one.</exception>
+		/// <exception cref="std::runtime_error">Thrown if destination is external and its size differs from source.</exception>
+		static void Convert(const Datum& source, Datum& destination);
+	};
+}
@@ -1,4 +1,7 @@
 #pragma once
+#include <functional>
+#include <string>
+#include <string_view>
 
 namespace FIEAGameEngine
 {
@@ -8,6 +11,42 @@ namespace FIEAGameEngine
 		bool operator()(const T& lhs, const T& rhs) const;
 	};
 
+	/// <summary>
+	/// Transparent DefaultEquality for string keys. Compares std::string keys against std::string_view or null-terminated lookups without a copy.
+	/// </summary>
+	template <>
+	struct DefaultEquality<std::string> final
+	{
+		using is_transparent = void;
+		bool operator()(std::string_view lhs, std::string_view rhs) const;
+	};
+
+	/// <summary>
+	/// Transparent DefaultEquality for const string keys, as used by Scope.
+	/// </summary>
+	template <>
+	struct DefaultEquality<const std::string> final
+	{
+		using is_transparent = void;
+		bool operator()(std::string_view lhs, std::string_view rhs) const;
+	};
+
+	/// <summary>
+	/// Type-erased equality policy for maps whose comparison is only known at runtime.
+	/// Every call goes through std::function, so prefer a policy type whenever the comparison is known at compile time.
+	/// </summary>
+	template <typename T>
+	struct DynamicEquality final
+	{
+		using FunctionType = std::function<bool(const T& lhs, const T& rhs)>;
+
+		DynamicEquality(FunctionType function = DefaultEquality<T>{});
+		bool operator()(const T& lhs, const T& rhs) const;
+
+	private:
+		FunctionType _function;
+	};
+
 }
 
 #include "DefaultEquality.inl"
@@ -1,6 +1,7 @@
 #pragma once
 #include "DefaultEquality.h"
 #include "RTTI.h"
+#include <cstring>
 #include <utility>
 namespace FIEAGameEngine
 {
@@ -65,4 +66,27 @@ namespace FIEAGameEngine
 			return strcmp(lhs, rhs) == 0;
 		}
 	};
+
+	inline bool DefaultEquality<std::string>::operator()(std::string_view lhs, std::string_view rhs) const
+	{
+		return lhs == rhs;
+	}
+
+	inline bool DefaultEquality<const std::string>::operator()(std::string_view lhs, std::string_view rhs) const
+	{
+		return lhs == rhs;
+	}
+
+	template<typename T>
+	inline DynamicEquality<T>::DynamicEquality(FunctionType function) :
+		_function(std::move(function))
+	{
+
+	}
+
+	template<typename T>
+	inline bool DynamicEquality<T>::operator()(const T& lhs, const T& rhs) const
+	{
+		return _function(lhs, rhs);
+	}
 }
\ No newline at end of file
@@ -1,13 +1,127 @@
 #pragma once
 #include "SizeLiteral.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace FIEAGameEngine
 {
+	/// <summary>
+	/// Seed used by DefaultHash. Fixed so that hash values, and therefore HashMap iteration order, are the same from run to run.
+	/// </summary>
+	inline constexpr std::uint64_t DefaultHashSeed = 0ull;
+
+	/// <summary>
+	/// Hashes a run of bytes. Short inputs go through a wyhash-style multiply-mix; inputs longer than LongHashThreshold
+	/// are consumed in 64-byte stripes by eight independent accumulators (SSE2 when available, with an identical scalar fallback).
+	/// </summary>
+	/// <param name="data">The bytes to hash. May be nullptr if size is 0.</param>
+	/// <param name="size">The number of bytes to hash.</param>
+	/// <param name="seed">Seed mixed into the result. Different seeds give unrelated hash values for the same input.</param>
+	/// <returns>A 64-bit hash of the input.</returns>
+	std::uint64_t HashBytes(const void* data, std::size_t size, std::uint64_t seed = DefaultHashSeed);
+
+	/// <summary>
+	/// Hashes the object representation of key. Only suitable for types without padding or pointers to owned data.
+	/// </summary>
+	template <typename TKey>
+	std::size_t HashKey(const TKey& key, std::uint64_t seed);
+	/// <summary>
+	/// Hashes the characters of a null-terminated string, not the pointer.
+	/// </summary>
+	std::size_t HashKey(const char* key, std::uint64_t seed);
+	/// <summary>
+	/// Hashes the characters of a null-terminated string, not the pointer.
+	/// </summary>
+	std::size_t HashKey(char* key, std::uint64_t seed);
+	/// <summary>
+	/// Hashes the characters of a string.
+	/// </summary>
+	std::size_t HashKey(const std::string& key, std::uint64_t seed);
+	/// <summary>
+	/// Hashes the characters of a string view. Gives the same value as the std::string and null-terminated overloads for the same characters.
+	/// </summary>
+	std::size_t HashKey(std::string_view key, std::uint64_t seed);
+	/// <summary>
+	/// Hashes the characters of a wide string.
+	/// </summary>
+	std::size_t HashKey(const std::wstring& key, std::uint64_t seed);
+
+	/// <summary>
+	/// Hash functor used by HashMap and FlatHashMap when none is given. Specialize it for keys that need a custom hash.
+	/// </summary>
 	template <typename TKey>
 	struct DefaultHash final
 	{
 		size_t operator()(const TKey& key) const;
 	};
+
+	/// <summary>
+	/// Transparent DefaultHash for string keys. Hashes std::string, std::string_view and null-terminated strings identically,
+	/// so a map keyed on std::string can be searched without building a std::string.
+	/// </summary>
+	template <>
+	struct DefaultHash<std::string> final
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view key) const;
+	};
+
+	/// <summary>
+	/// Transparent DefaultHash for const string keys, as used by Scope.
+	/// </summary>
+	template <>
+	struct DefaultHash<const std::string> final
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view key) const;
+	};
+
+	/// <summary>
+	/// True when both policies mark themselves with an is_transparent member type, meaning they accept lookup keys of other types
+	/// and hash and compare them consistently with TKey.
+	/// </summary>
+	template <typename THash, typename TEquality, typename = void>
+	struct IsTransparent : std::false_type
+	{
+	};
+
+	template <typename THash, typename TEquality>
+	struct IsTransparent<THash, TEquality, std::void_t<typename THash::is_transparent, typename TEquality::is_transparent>> : std::true_type
+	{
+	};
+
+	/// <summary>
+	/// DefaultHash with a caller-chosen seed, e.g. to give each map its own hash values or to rehash after a bad run of collisions.
+	/// </summary>
+	template <typename TKey>
+	struct SeededHash final
+	{
+		explicit SeededHash(std::uint64_t seed = DefaultHashSeed);
+		size_t operator()(const TKey& key) const;
+		std::uint64_t Seed() const;
+
+	private:
+		std::uint64_t _seed;
+	};
+
+	/// <summary>
+	/// Type-erased hash policy for maps whose hash function is only known at runtime.
+	/// Every call goes through std::function, so prefer a policy type whenever the hash is known at compile time.
+	/// </summary>
+	template <typename TKey>
+	struct DynamicHash final
+	{
+		using FunctionType = std::function<std::size_t(const TKey& key)>;
+
+		DynamicHash(FunctionType function = DefaultHash<TKey>{});
+		size_t operator()(const TKey& key) const;
+
+	private:
+		FunctionType _function;
+	};
 }
 
-#include "DefaultHash.inl"
\ No newline at end of file
+#include "DefaultHash.inl"
@@ -1,109 +1,361 @@
 #pragma once
 #include "DefaultHash.h"
 #include <cstdint>
-#include <string.h>
+#include <cstring>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define FIEA_HASH_SSE2 1
+#endif
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
 
 namespace FIEAGameEngine
 {
-	const size_t HashPrime = 31;
-
-	inline size_t AdditiveHash(const std::uint8_t* data, size_t size)
+	namespace HashImplementation
 	{
-		size_t hash = 0;
-		for (size_t i = 0; i < size; ++i)
+		inline constexpr std::uint64_t Secret[] =
+		{
+			0x1ac046dda8e86e2aull, 0xbe2c3b00b1d348c8ull, 0x9b1a66a95412ff75ull, 0xc448c2b1f05f7e4cull,
+			0xc111ca6b8f6e73c4ull, 0xb54861920d05b01dull, 0x8d61500f4a7bbe16ull, 0x5e0c25471f89e02eull,
+			0x48105a3d28f0e221ull, 0x2169f8846b637746ull, 0x3d628782e0c0d863ull, 0xa5ddb2216078aa40ull,
+			0xc8119d17f0571101ull, 0x98e2e2eb8f33280full, 0x8cd1e28860679cc4ull, 0x9dca6189c923aef3ull,
+			0x9d8d3071ba4f04c4ull, 0x5d395ada34220c26ull, 0xe6de42a441a1e28eull, 0x308fbf68cc864f59ull,
+			0x216a3c81332862f9ull, 0xbaceca0a77f3132eull, 0xdf2a2215339ca69cull, 0x3e4c11a103a5d859ull,
+		};
+
+		inline constexpr std::size_t LaneCount = 8;
+		inline constexpr std::size_t StripeSize = LaneCount * sizeof(std::uint64_t);
+		inline constexpr std::size_t StripesPerBlock = 16;
+		inline constexpr std::size_t BlockSize = StripeSize * StripesPerBlock;
+		inline constexpr std::uint32_t ScramblePrime = 0x9E3779B1u;
+
+		/// <summary>
+		/// Inputs longer than this use the striped path.
+		/// </summary>
+		inline constexpr std::size_t LongHashThreshold = 256;
+
+		inline std::uint64_t Read64(const std::uint8_t* data)
 		{
-			hash += HashPrime * data[i];
+			std::uint64_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
 		}
 
-		return hash;
-	}
+		inline std::uint64_t Read32(const std::uint8_t* data)
+		{
+			std::uint32_t value;
+			std::memcpy(&value, data, sizeof(value));
+			return value;
+		}
 
-	template <typename TKey>
-	inline size_t DefaultHash<TKey>::operator()(const TKey& key) const
-	{
-		const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(&key);
-		return AdditiveHash(data, sizeof(TKey));
-	}
+		inline std::uint64_t Read3(const std::uint8_t* data, std::size_t size)
+		{
+			return (static_cast<std::uint64_t>(data[0]) << 16) | (static_cast<std::uint64_t>(data[size >> 1]) << 8) | data[size - 1];
+		}
 
-	template<>
-	struct  DefaultHash <char*>
-	{
-		inline size_t operator()(const char* const key) const
+		/// <summary>
+		/// Full 64x64 to 128-bit multiply. Overwrites lhs with the low half and rhs with the high half.
+		/// </summary>
+		inline void Multiply(std::uint64_t& lhs, std::uint64_t& rhs)
 		{
-			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-			return AdditiveHash(data, strlen(key));
+#if defined(__SIZEOF_INT128__)
+			const unsigned __int128 product = static_cast<unsigned __int128>(lhs) * rhs;
+			lhs = static_cast<std::uint64_t>(product);
+			rhs = static_cast<std::uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+			lhs = _umul128(lhs, rhs, &rhs);
+#else
+			const std::uint64_t lhsHigh = lhs >> 32, lhsLow = static_cast<std::uint32_t>(lhs);
+			const std::uint64_t rhsHigh = rhs >> 32, rhsLow = static_cast<std::uint32_t>(rhs);
+			const std::uint64_t high = lhsHigh * rhsHigh, middle0 = lhsHigh * rhsLow, middle1 = lhsLow * rhsHigh, low = lhsLow * rhsLow;
+			const std::uint64_t carry = (low >> 32) + static_cast<std::uint32_t>(middle0) + static_cast<std::uint32_t>(middle1);
+			lhs = low + (middle0 << 32) + (middle1 << 32);
+			rhs = high + (middle0 >> 32) + (middle1 >> 32) + (carry >> 32);
+#endif
 		}
-	};
 
-	template<>
-	struct  DefaultHash <const char*>
-	{
-		inline size_t operator()(const char* const  key) const
+		inline std::uint64_t Mix(std::uint64_t lhs, std::uint64_t rhs)
 		{
-			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-			return AdditiveHash(data, strlen(key));
+			Multiply(lhs, rhs);
+			return lhs ^ rhs;
 		}
-	};
 
-	template<>
-	struct  DefaultHash <char* const>
-	{
-		inline size_t operator()(const char* const key) const
+		/// <summary>
+		/// Scalar version of one 64-byte stripe. Each lane adds lo32(data ^ key) * hi32(data ^ key) to itself and its raw data to its neighbour.
+		/// </summary>
+		inline void AccumulateStripe(std::uint64_t* accumulators, const std::uint8_t* data, const std::uint64_t* key)
 		{
-			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-			return AdditiveHash(data, strlen(key));
+			for (std::size_t i = 0; i < LaneCount; ++i)
+			{
+				const std::uint64_t value = Read64(data + i * sizeof(std::uint64_t));
+				const std::uint64_t keyed = value ^ key[i];
+				accumulators[i ^ 1] += value;
+				accumulators[i] += (keyed & 0xFFFFFFFFull) * (keyed >> 32);
+			}
 		}
-	};
 
-	template<>
-	struct  DefaultHash <const char* const>
-	{
-		inline size_t operator()(const char* const  key) const
+		inline void ScrambleAccumulators(std::uint64_t* accumulators, const std::uint64_t* key)
 		{
-			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key);
-			return AdditiveHash(data, strlen(key));
+			for (std::size_t i = 0; i < LaneCount; ++i)
+			{
+				std::uint64_t accumulator = accumulators[i];
+				accumulator ^= accumulator >> 47;
+				accumulator ^= key[i];
+				accumulators[i] = accumulator * ScramblePrime;
+			}
 		}
-	};
 
-	template<>
-	struct  DefaultHash <std::string>
-	{
-		inline size_t operator()(const std::string& key) const
+#if defined(FIEA_HASH_SSE2)
+		inline void AccumulateStripe(__m128i* accumulators, const std::uint8_t* data, const std::uint64_t* key)
 		{
-			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-			return AdditiveHash(data, key.length());
+			for (std::size_t i = 0; i < LaneCount / 2; ++i)
+			{
+				const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i);
+				const __m128i keyed = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(key) + i));
+				const __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+				const __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+				accumulators[i] = _mm_add_epi64(accumulators[i], _mm_add_epi64(product, swapped));
+			}
 		}
-	};
 
-	template<>
-	struct  DefaultHash <std::wstring>
+		inline void ScrambleAccumulators(__m128i* accumulators, const std::uint64_t* key)
+		{
+			const __m128i prime = _mm_set1_epi32(static_cast<int>(ScramblePrime));
+			for (std::size_t i = 0; i < LaneCount / 2; ++i)
+			{
+				__m128i accumulator = accumulators[i];
+				accumulator = _mm_xor_si128(accumulator, _mm_srli_epi64(accumulator, 47));
+				accumulator = _mm_xor_si128(accumulator, _mm_loadu_si128(reinterpret_cast<const __m128i*>(key) + i));
+				const __m128i low = _mm_mul_epu32(accumulator, prime);
+				const __m128i high = _mm_mul_epu32(_mm_srli_epi64(accumulator, 32), prime);
+				accumulators[i] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+			}
+		}
+#endif
+
+		/// <summary>
+		/// Runs the striped path over the whole input. The accumulator type picks the SSE2 or scalar kernels; both produce the same bits.
+		/// </summary>
+		template <typename TAccumulator>
+		inline void AccumulateLong(TAccumulator* accumulators, const std::uint8_t* data, std::size_t size)
+		{
+			const std::size_t blockCount = (size - 1) / BlockSize;
+			for (std::size_t block = 0; block < blockCount; ++block)
+			{
+				for (std::size_t stripe = 0; stripe < StripesPerBlock; ++stripe)
+				{
+					AccumulateStripe(accumulators, data + block * BlockSize + stripe * StripeSize, Secret + stripe);
+				}
+				ScrambleAccumulators(accumulators, Secret + StripesPerBlock);
+			}
+
+			const std::uint8_t* tail = data + blockCount * BlockSize;
+			const std::size_t stripeCount = (size - 1 - blockCount * BlockSize) / StripeSize;
+			for (std::size_t stripe = 0; stripe < stripeCount; ++stripe)
+			{
+				AccumulateStripe(accumulators, tail + stripe * StripeSize, Secret + stripe);
+			}
+
+			// The last stripe always ends at the last byte, overlapping the previous stripe if the size is not a multiple of 64.
+			AccumulateStripe(accumulators, data + size - StripeSize, Secret + 9);
+		}
+
+		inline std::uint64_t HashLong(const std::uint8_t* data, std::size_t size, std::uint64_t seed)
+		{
+			alignas(16) std::uint64_t accumulators[LaneCount] =
+			{
+				0x9E3779B185EBCA87ull ^ seed, 0xC2B2AE3D27D4EB4Full, 0x165667B19E3779F9ull ^ seed, 0x85EBCA77C2B2AE63ull,
+				0x27D4EB2F165667C5ull ^ seed, 0x61C8864E7A143579ull, 0xC2B2AE3D27D4EB4Full ^ seed, 0x9E3779B97F4A7C15ull,
+			};
+
+#if defined(FIEA_HASH_SSE2)
+			__m128i vectorAccumulators[LaneCount / 2];
+			for (std::size_t i = 0; i < LaneCount / 2; ++i)
+			{
+				vectorAccumulators[i] = _mm_load_si128(reinterpret_cast<const __m128i*>(accumulators) + i);
+			}
+			AccumulateLong(vectorAccumulators, data, size);
+			for (std::size_t i = 0; i < LaneCount / 2; ++i)
+			{
+				_mm_store_si128(reinterpret_cast<__m128i*>(accumulators) + i, vectorAccumulators[i]);
+			}
+#else
+			AccumulateLong(accumulators, data, size);
+#endif
+
+			std::uint64_t hash = size * 0x9E3779B185EBCA87ull ^ seed;
+			for (std::size_t i = 0; i < LaneCount; i += 2)
+			{
+				hash += Mix(accumulators[i] ^ Secret[i + 11], accumulators[i + 1] ^ Secret[i + 12]);
+			}
+
+			return Mix(hash ^ Secret[0], hash ^ Secret[1]);
+		}
+	}
+
+	inline std::uint64_t HashBytes(const void* data, std::size_t size, std::uint64_t seed)
 	{
-		inline size_t operator()(const std::wstring& key) const
+		using namespace HashImplementation;
+
+		const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(data);
+		if (size > LongHashThreshold)
 		{
-			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-			return AdditiveHash(data, key.length());
+			return HashLong(bytes, size, seed);
 		}
-	};
 
+		seed ^= Mix(seed ^ Secret[0], Secret[1]);
+
+		std::uint64_t a;
+		std::uint64_t b;
+		if (size <= 16)
+		{
+			if (size >= 4)
+			{
+				const std::size_t offset = (size >> 3) << 2;
+				a = (Read32(bytes) << 32) | Read32(bytes + offset);
+				b = (Read32(bytes + size - 4) << 32) | Read32(bytes + size - 4 - offset);
+			}
+			else if (size > 0)
+			{
+				a = Read3(bytes, size);
+				b = 0;
+			}
+			else
+			{
+				a = b = 0;
+			}
+		}
+		else
+		{
+			std::size_t remaining = size;
+			if (remaining > 48)
+			{
+				std::uint64_t seed1 = seed;
+				std::uint64_t seed2 = seed;
+				do
+				{
+					seed = Mix(Read64(bytes) ^ Secret[1], Read64(bytes + 8) ^ seed);
+					seed1 = Mix(Read64(bytes + 16) ^ Secret[2], Read64(bytes + 24) ^ seed1);
+					seed2 = Mix(Read64(bytes + 32) ^ Secret[3], Read64(bytes + 40) ^ seed2);
+					bytes += 48;
+					remaining -= 48;
+				} while (remaining > 48);
+				seed ^= seed1 ^ seed2;
+			}
+
+			while (remaining > 16)
+			{
+				seed = Mix(Read64(bytes) ^ Secret[1], Read64(bytes + 8) ^ seed);
+				bytes += 16;
+				remaining -= 16;
+			}
+
+			a = Read64(bytes + remaining - 16);
+			b = Read64(bytes + remaining - 8);
+		}
+
+		a ^= Secret[1];
+		b ^= seed;
+		Multiply(a, b);
+		return Mix(a ^ Secret[0] ^ size, b ^ Secret[1]);
+	}
+
+	template <typename TKey>
+	inline std::size_t HashKey(const TKey& key, std::uint64_t seed)
+	{
+		return static_cast<std::size_t>(HashBytes(&key, sizeof(TKey), seed));
+	}
+
+	inline std::size_t HashKey(const char* key, std::uint64_t seed)
+	{
+		return static_cast<std::size_t>(HashBytes(key, std::strlen(key), seed));
+	}
+
+	inline std::size_t HashKey(char* key, std::uint64_t seed)
+	{
+		return static_cast<std::size_t>(HashBytes(key, std::strlen(key), seed));
+	}
+
+	inline std::size_t HashKey(const std::string& key, std::uint64_t seed)
+	{
+		return static_cast<std::size_t>(HashBytes(key.data(), key.size(), seed));
+	}
+
+	inline std::size_t HashKey(std::string_view key, std::uint64_t seed)
+	{
+		return static_cast<std::size_t>(HashBytes(key.data(), key.size(), seed));
+	}
+
+	inline std::size_t HashKey(const std::wstring& key, std::uint64_t seed)
+	{
+		return static_cast<std::size_t>(HashBytes(key.data(), key.size() * sizeof(wchar_t), seed));
+	}
+
+	template <typename TKey>
+	inline size_t DefaultHash<TKey>::operator()(const TKey& key) const
+	{
+		return HashKey(key, DefaultHashSeed);
+	}
 
 	template<>
-	struct  DefaultHash <const std::string>
+	struct DefaultHash<char*> final
 	{
-		inline size_t operator()(const std::string& key) const
+		inline size_t operator()(const char* const key) const
 		{
-			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-			return AdditiveHash(data, key.length());
+			return HashKey(key, DefaultHashSeed);
 		}
 	};
 
 	template<>
-	struct  DefaultHash <const std::wstring>
+	struct DefaultHash<char* const> final
 	{
-		inline size_t operator()(const std::wstring& key) const
+		inline size_t operator()(const char* const key) const
 		{
-			const std::uint8_t* data = reinterpret_cast<const std::uint8_t*>(key.c_str());
-			return AdditiveHash(data, key.length());
+			return HashKey(key, DefaultHashSeed);
 		}
 	};
-}
 
+	inline size_t DefaultHash<std::string>::operator()(std::string_view key) const
+	{
+		return HashKey(key, DefaultHashSeed);
+	}
+
+	inline size_t DefaultHash<const std::string>::operator()(std::string_view key) const
+	{
+		return HashKey(key, DefaultHashSeed);
+	}
+
+	template <typename TKey>
+	inline SeededHash<TKey>::SeededHash(std::uint64_t seed) :
+		_seed(seed)
+	{
+
+	}
+
+	template <typename TKey>
+	inline size_t SeededHash<TKey>::operator()(const TKey& key) const
+	{
+		return HashKey(key, _seed);
+	}
+
+	template <typename TKey>
+	inline std::uint64_t SeededHash<TKey>::Seed() const
+	{
+		return _seed;
+	}
+
+	template <typename TKey>
+	inline DynamicHash<TKey>::DynamicHash(FunctionType function) :
+		_function(std::move(function))
+	{
+
+	}
+
+	template <typename TKey>
+	inline size_t DynamicHash<TKey>::operator()(const TKey& key) const
+	{
+		return _function(key);
+	}
+}
@@ -0,0 +1,365 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include "SizeLiteral.h"
+#include "DefaultEquality.h"
+#include "Relocation.h"
+#include "Allocator.h"
+#include "SimdFind.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// A double-ended queue kept in one ring buffer. Pushing and popping at either end is constant time and never moves the other elements,
+	/// so it can serve as a FIFO where a Vector would have to shift everything on each removal from the front.
+	/// The capacity is always a power of two, so it grows by doubling rather than through an increment functor.
+	/// Elements are only ever constructed and destroyed, never assigned, so types with reference members can be stored.
+	/// </summary>
+	/// <typeparam name="T">The type of element stored in the container.</typeparam>
+	/// <typeparam name="TAllocator">Allocator policy for the ring buffer. See DefaultAllocator.</typeparam>
+	template <typename T, typename TAllocator = DefaultAllocator>
+	class Deque final
+	{
+	public:
+		/// <summary>
+		/// Iterator over the elements of a Deque, front to back. Holds a position rather than an address, so it stays valid while the ring grows.
+		/// </summary>
+		class Iterator final
+		{
+			friend Deque;
+			friend class ConstIterator;
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			Iterator() = default;
+			Iterator(const Iterator& other) = default;
+			Iterator(Iterator&& other) noexcept = default;
+			Iterator& operator=(const Iterator& other) = default;
+			Iterator& operator=(Iterator&& other) noexcept = default;
+			~Iterator() = default;
+
+			/// <summary>
+			/// Determines whether two iterators refer to the same position of the same deque.
+			/// </summary>
+			bool operator==(const Iterator& other) const;
+			/// <summary>
+			/// Determines whether two iterators refer to different positions or deques.
+			/// </summary>
+			bool operator!=(const Iterator& other) const;
+			/// <summary>
+			/// Moves to the next element. Stays at end() once there.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the iterator is not associated with a deque.</exception>
+			Iterator& operator++();
+			/// <summary>
+			/// Moves to the next element, returning the iterator as it was.
+			/// </summary>
+			Iterator operator++(int);
+			/// <summary>
+			/// Moves to the previous element. Stays at begin() once there.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the iterator is not associated with a deque.</exception>
+			Iterator& operator--();
+			/// <summary>
+			/// Moves to the previous element, returning the iterator as it was.
+			/// </summary>
+			Iterator operator--(int);
+			/// <summary>
+			/// Provides an iterator increment positions further on.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the iterator is not associated with a deque.</exception>
+			Iterator operator+(size_t increment) const;
+			/// <summary>
+			/// Provides an iterator decrement positions further back.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the iterator is not associated with a deque.</exception>
+			Iterator operator-(size_t decrement) const;
+			/// <summary>
+			/// Provides the element at the iterator's position.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the iterator is not associated with a deque, or is at end().</exception>
+			T& operator*() const;
+			/// <summary>
+			/// Provides access to the members of the element at the iterator's position.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the iterator is not associated with a deque, or is at end().</exception>
+			T* operator->() const;
+
+		private:
+			Iterator(Deque& owner, size_t index);
+
+			/// <summary>
+			/// The deque being iterated over.
+			/// </summary>
+			Deque* _owner{ nullptr };
+			/// <summary>
+			/// The position counted from the front, not the slot in the ring.
+			/// </summary>
+			size_t _index{ 0_z };
+		};
+
+		/// <summary>
+		/// Read-only iterator over the elements of a Deque, front to back.
+		/// </summary>
+		class ConstIterator final
+		{
+			friend Deque;
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const T*;
+			using reference = const T&;
+
+			ConstIterator() = default;
+			/// <summary>
+			/// Converts an Iterator into a ConstIterator at the same position.
+			/// </summary>
+			ConstIterator(const Iterator& other);
+			ConstIterator(const ConstIterator& other) = default;
+			ConstIterator(ConstIterator&& other) noexcept = default;
+			ConstIterator& operator=(const ConstIterator& other) = default;
+			ConstIterator& operator=(ConstIterator&& other) noexcept = default;
+			~ConstIterator() = default;
+
+			bool operator==(const ConstIterator& other) const;
+			bool operator!=(const ConstIterator& other) const;
+			ConstIterator& operator++();
+			ConstIterator operator++(int);
+			ConstIterator& operator--();
+			ConstIterator operator--(int);
+			ConstIterator operator+(size_t increment) const;
+			ConstIterator operator-(size_t decrement) const;
+			const T& operator*() const;
+			const T* operator->() const;
+
+		private:
+			ConstIterator(const Deque& owner, size_t index);
+
+			const Deque* _owner{ nullptr };
+			size_t _index{ 0_z };
+		};
+
+		/// <summary>
+		/// Creates an empty deque.
+		/// </summary>
+		/// <param name="capacity">The number of elements to reserve room for up front. Rounded up to a power of two.</param>
+		/// <param name="allocator">The allocator the ring buffer comes from.</param>
+		explicit Deque(size_t capacity = 0_z, TAllocator allocator = TAllocator{});
+		/// <summary>
+		/// Creates a deque holding copies of the elements of list, in order.
+		/// </summary>
+		Deque(std::initializer_list<T> list, TAllocator allocator = TAllocator{});
+		/// <summary>
+		/// Copies every element of other, front first. The copy starts at the beginning of its own ring.
+		/// </summary>
+		Deque(const Deque& other);
+		/// <summary>
+		/// Takes the ring buffer of other, leaving it empty.
+		/// </summary>
+		Deque(Deque&& other) noexcept;
+		/// <summary>
+		/// Replaces the elements of this deque with copies of those of other.
+		/// </summary>
+		Deque& operator=(const Deque& other);
+		/// <summary>
+		/// Frees this deque's elements and takes the ring buffer of other, leaving it empty.
+		/// </summary>
+		Deque& operator=(Deque&& other) noexcept;
+		/// <summary>
+		/// Destroys every element and frees the ring buffer.
+		/// </summary>
+		~Deque();
+
+		/// <summary>
+		/// Provides the element at a position counted from the front.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if index is not less than Size().</exception>
+		T& operator[](size_t index);
+		/// <summary>
+		/// Provides the element at a position counted from the front.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if index is not less than Size().</exception>
+		const T& operator[](size_t index) const;
+		/// <summary>
+		/// Provides the element at a position counted from the front.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if index is not less than Size().</exception>
+		T& At(size_t index);
+		/// <summary>
+		/// Provides the element at a position counted from the front.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if index is not less than Size().</exception>
+		const T& At(size_t index) const;
+
+		/// <summary>
+		/// Determines whether the deque holds no elements.
+		/// </summary>
+		bool IsEmpty() const;
+		/// <summary>
+		/// Provides the number of elements in the deque.
+		/// </summary>
+		size_t Size() const;
+		/// <summary>
+		/// Provides the number of elements the deque can hold before its ring has to grow. Always zero or a power of two.
+		/// </summary>
+		size_t Capacity() const;
+
+		/// <summary>
+		/// Provides the first element.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if the deque is empty.</exception>
+		T& Front();
+		/// <summary>
+		/// Provides the first element.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if the deque is empty.</exception>
+		const T& Front() const;
+		/// <summary>
+		/// Provides the last element.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if the deque is empty.</exception>
+		T& Back();
+		/// <summary>
+		/// Provides the last element.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if the deque is empty.</exception>
+		const T& Back() const;
+
+		/// <summary>
+		/// Appends a copy of value.
+		/// </summary>
+		/// <returns>An Iterator to the new last element.</returns>
+		Iterator PushBack(const T& value);
+		/// <summary>
+		/// Appends value by moving it.
+		/// </summary>
+		/// <returns>An Iterator to the new last element.</returns>
+		Iterator PushBack(T&& value);
+		/// <summary>
+		/// Constructs an element in place after the last one.
+		/// Arguments must not refer to elements of this deque, since growing moves them before the new element is constructed.
+		/// </summary>
+		/// <returns>An Iterator to the new last element.</returns>
+		template <typename... TArgs>
+		Iterator EmplaceBack(TArgs&&... args);
+		/// <summary>
+		/// Prepends a copy of value.
+		/// </summary>
+		/// <returns>An Iterator to the new first element.</returns>
+		Iterator PushFront(const T& value);
+		/// <summary>
+		/// Prepends value by moving it.
+		/// </summary>
+		/// <returns>An Iterator to the new first element.</returns>
+		Iterator PushFront(T&& value);
+		/// <summary>
+		/// Constructs an element in place before the first one.
+		/// Arguments must not refer to elements of this deque, since growing moves them before the new element is constructed.
+		/// </summary>
+		/// <returns>An Iterator to the new first element.</returns>
+		template <typename... TArgs>
+		Iterator EmplaceFront(TArgs&&... args);
+		/// <summary>
+		/// Removes the last element. Does nothing if the deque is empty.
+		/// </summary>
+		void PopBack();
+		/// <summary>
+		/// Removes the first element. Does nothing if the deque is empty.
+		/// </summary>
+		void PopFront();
+
+		/// <summary>
+		/// Makes room for capacity elements, so that many pushes do not allocate. Never shrinks the deque.
+		/// </summary>
+		/// <param name="capacity">The number of elements to make room for. Rounded up to a power of two.</param>
+		void Reserve(size_t capacity);
+		/// <summary>
+		/// Removes every element. Keeps the capacity, so a queue that is drained and refilled every frame does not allocate again.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Provides the allocator the ring buffer comes from.
+		/// </summary>
+		TAllocator GetAllocator() const;
+
+		Iterator begin();
+		ConstIterator begin() const;
+		ConstIterator cbegin() const;
+		Iterator end();
+		ConstIterator end() const;
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// Searches for the given element, front first. With the default equality, int, float, glm::vec4 and pointer elements are compared by SimdFind.
+		/// </summary>
+		/// <param name="value">The element we are searching for.</param>
+		/// <returns>An Iterator to the first equal element, or end().</returns>
+		template <typename EqualityFunctor = DefaultEquality<T>>
+		Iterator Find(const T& value);
+		/// <summary>
+		/// Searches for the given element, front first.
+		/// </summary>
+		/// <param name="value">The element we are searching for.</param>
+		/// <returns>A ConstIterator to the first equal element, or end().</returns>
+		template <typename EqualityFunctor = DefaultEquality<T>>
+		ConstIterator Find(const T& value) const;
+		/// <summary>
+		/// Removes the element an iterator refers to, closing the gap from whichever end is nearer.
+		/// Iterators to later positions then refer to the element after the one they did, so a loop can keep using it without incrementing.
+		/// </summary>
+		/// <param name="it">An Iterator to the element to remove.</param>
+		/// <returns>True if an element was removed, false if it was end().</returns>
+		/// <exception cref="std::runtime_error">Thrown if the iterator is not associated with this deque.</exception>
+		bool Remove(const Iterator& it);
+
+	private:
+		/// <summary>
+		/// Provides the slot in the ring that holds the element at a position counted from the front.
+		/// </summary>
+		T* Slot(size_t index) const;
+		/// <summary>
+		/// Doubles the ring if it is full.
+		/// </summary>
+		void GrowIfFull();
+
+		/// <summary>
+		/// Number of elements in the first ring allocated for a deque that had no reserved capacity.
+		/// </summary>
+		inline static constexpr size_t MinimumCapacity = 4;
+
+		/// <summary>
+		/// The ring buffer.
+		/// </summary>
+		T* _data{ nullptr };
+		/// <summary>
+		/// The slot holding the first element.
+		/// </summary>
+		size_t _head{ 0_z };
+		/// <summary>
+		/// The number of elements in the deque.
+		/// </summary>
+		size_t _size{ 0_z };
+		/// <summary>
+		/// The number of slots in the ring. Zero or a power of two, so positions wrap with a mask.
+		/// </summary>
+		size_t _capacity{ 0_z };
+		/// <summary>
+		/// The allocator the ring buffer comes from.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TAllocator _allocator;
+	};
+}
+
+#include "Deque.inl"
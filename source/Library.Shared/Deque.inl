@@ -0,0 +1,615 @@
+#include "Deque.h"
+#include <bit>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace FIEAGameEngine
+{
+#pragma region Iterator
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>::Iterator::Iterator(Deque& owner, size_t index) :
+		_owner(&owner), _index(index)
+	{
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool Deque<T, TAllocator>::Iterator::operator==(const Iterator& other) const
+	{
+		return !operator!=(other);
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool Deque<T, TAllocator>::Iterator::operator!=(const Iterator& other) const
+	{
+		return _owner != other._owner || _index != other._index;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator& Deque<T, TAllocator>::Iterator::operator++()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		if (_index < _owner->_size)
+		{
+			++_index;
+		}
+		return *this;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::Iterator::operator++(int)
+	{
+		Iterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator& Deque<T, TAllocator>::Iterator::operator--()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		if (_index > 0_z)
+		{
+			--_index;
+		}
+		return *this;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::Iterator::operator--(int)
+	{
+		Iterator temp(*this);
+		operator--();
+		return temp;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::Iterator::operator+(size_t increment) const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		return Iterator(*_owner, _index + increment);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::Iterator::operator-(size_t decrement) const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		return Iterator(*_owner, _index - decrement);
+	}
+
+	template <typename T, typename TAllocator>
+	inline T& Deque<T, TAllocator>::Iterator::operator*() const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		return _owner->At(_index);
+	}
+
+	template <typename T, typename TAllocator>
+	inline T* Deque<T, TAllocator>::Iterator::operator->() const
+	{
+		return &operator*();
+	}
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>::ConstIterator::ConstIterator(const Deque& owner, size_t index) :
+		_owner(&owner), _index(index)
+	{
+	}
+
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
+		_owner(other._owner), _index(other._index)
+	{
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool Deque<T, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return !operator!=(other);
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool Deque<T, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return _owner != other._owner || _index != other._index;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator& Deque<T, TAllocator>::ConstIterator::operator++()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		if (_index < _owner->_size)
+		{
+			++_index;
+		}
+		return *this;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator& Deque<T, TAllocator>::ConstIterator::operator--()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		if (_index > 0_z)
+		{
+			--_index;
+		}
+		return *this;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::ConstIterator::operator--(int)
+	{
+		ConstIterator temp(*this);
+		operator--();
+		return temp;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::ConstIterator::operator+(size_t increment) const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		return ConstIterator(*_owner, _index + increment);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::ConstIterator::operator-(size_t decrement) const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		return ConstIterator(*_owner, _index - decrement);
+	}
+
+	template <typename T, typename TAllocator>
+	inline const T& Deque<T, TAllocator>::ConstIterator::operator*() const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		return _owner->At(_index);
+	}
+
+	template <typename T, typename TAllocator>
+	inline const T* Deque<T, TAllocator>::ConstIterator::operator->() const
+	{
+		return &operator*();
+	}
+#pragma endregion ConstIterator
+
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>::Deque(size_t capacity, TAllocator allocator) :
+		_allocator(allocator)
+	{
+		Reserve(capacity);
+	}
+
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>::Deque(std::initializer_list<T> list, TAllocator allocator) :
+		_allocator(allocator)
+	{
+		Reserve(list.size());
+		CopyElements(_data, list.begin(), list.size());
+		_size = list.size();
+	}
+
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>::Deque(const Deque& other) :
+		_allocator(other._allocator)
+	{
+		Reserve(other._size);
+		for (size_t i = 0_z; i < other._size; ++i)
+		{
+			new(_data + i)T(*other.Slot(i));
+		}
+		_size = other._size;
+	}
+
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>::Deque(Deque&& other) noexcept :
+		_data(other._data), _head(other._head), _size(other._size), _capacity(other._capacity), _allocator(other._allocator)
+	{
+		other._data = nullptr;
+		other._head = 0_z;
+		other._size = 0_z;
+		other._capacity = 0_z;
+	}
+
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>& Deque<T, TAllocator>::operator=(const Deque& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			if (_allocator != other._allocator)
+			{
+				_allocator.Deallocate(_data, sizeof(T) * _capacity, alignof(T));
+				_data = nullptr;
+				_capacity = 0_z;
+				_allocator = other._allocator;
+			}
+
+			Reserve(other._size);
+			for (size_t i = 0_z; i < other._size; ++i)
+			{
+				new(_data + i)T(*other.Slot(i));
+			}
+			_size = other._size;
+		}
+		return *this;
+	}
+
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>& Deque<T, TAllocator>::operator=(Deque&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+			_allocator.Deallocate(_data, sizeof(T) * _capacity, alignof(T));
+
+			_data = other._data;
+			_head = other._head;
+			_size = other._size;
+			_capacity = other._capacity;
+			_allocator = other._allocator;
+
+			other._data = nullptr;
+			other._head = 0_z;
+			other._size = 0_z;
+			other._capacity = 0_z;
+		}
+		return *this;
+	}
+
+	template <typename T, typename TAllocator>
+	inline Deque<T, TAllocator>::~Deque()
+	{
+		Clear();
+		_allocator.Deallocate(_data, sizeof(T) * _capacity, alignof(T));
+	}
+
+	template <typename T, typename TAllocator>
+	inline T& Deque<T, TAllocator>::operator[](size_t index)
+	{
+		return At(index);
+	}
+
+	template <typename T, typename TAllocator>
+	inline const T& Deque<T, TAllocator>::operator[](size_t index) const
+	{
+		return At(index);
+	}
+
+	template <typename T, typename TAllocator>
+	inline T& Deque<T, TAllocator>::At(size_t index)
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Invalid index location.");
+		}
+		return *Slot(index);
+	}
+
+	template <typename T, typename TAllocator>
+	inline const T& Deque<T, TAllocator>::At(size_t index) const
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Invalid index location.");
+		}
+		return *Slot(index);
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool Deque<T, TAllocator>::IsEmpty() const
+	{
+		return _size == 0_z;
+	}
+
+	template <typename T, typename TAllocator>
+	inline size_t Deque<T, TAllocator>::Size() const
+	{
+		return _size;
+	}
+
+	template <typename T, typename TAllocator>
+	inline size_t Deque<T, TAllocator>::Capacity() const
+	{
+		return _capacity;
+	}
+
+	template <typename T, typename TAllocator>
+	inline T& Deque<T, TAllocator>::Front()
+	{
+		if (_size == 0_z)
+		{
+			throw std::runtime_error("Empty deque.");
+		}
+		return _data[_head];
+	}
+
+	template <typename T, typename TAllocator>
+	inline const T& Deque<T, TAllocator>::Front() const
+	{
+		if (_size == 0_z)
+		{
+			throw std::runtime_error("Empty deque.");
+		}
+		return _data[_head];
+	}
+
+	template <typename T, typename TAllocator>
+	inline T& Deque<T, TAllocator>::Back()
+	{
+		if (_size == 0_z)
+		{
+			throw std::runtime_error("Empty deque.");
+		}
+		return *Slot(_size - 1_z);
+	}
+
+	template <typename T, typename TAllocator>
+	inline const T& Deque<T, TAllocator>::Back() const
+	{
+		if (_size == 0_z)
+		{
+			throw std::runtime_error("Empty deque.");
+		}
+		return *Slot(_size - 1_z);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::PushBack(const T& value)
+	{
+		return EmplaceBack(value);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::PushBack(T&& value)
+	{
+		return EmplaceBack(std::move(value));
+	}
+
+	template <typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::EmplaceBack(TArgs&&... args)
+	{
+		GrowIfFull();
+		new(Slot(_size))T(std::forward<TArgs>(args)...);
+		return Iterator(*this, _size++);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::PushFront(const T& value)
+	{
+		return EmplaceFront(value);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::PushFront(T&& value)
+	{
+		return EmplaceFront(std::move(value));
+	}
+
+	template <typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::EmplaceFront(TArgs&&... args)
+	{
+		GrowIfFull();
+		const size_t head = (_head - 1_z) & (_capacity - 1_z);
+		new(_data + head)T(std::forward<TArgs>(args)...);
+		_head = head;
+		++_size;
+		return Iterator(*this, 0_z);
+	}
+
+	template <typename T, typename TAllocator>
+	inline void Deque<T, TAllocator>::PopBack()
+	{
+		if (_size > 0_z)
+		{
+			Slot(--_size)->~T();
+		}
+	}
+
+	template <typename T, typename TAllocator>
+	inline void Deque<T, TAllocator>::PopFront()
+	{
+		if (_size > 0_z)
+		{
+			_data[_head].~T();
+			_head = (_head + 1_z) & (_capacity - 1_z);
+			--_size;
+		}
+	}
+
+	template <typename T, typename TAllocator>
+	inline void Deque<T, TAllocator>::Reserve(size_t capacity)
+	{
+		if (capacity > _capacity)
+		{
+			const size_t newCapacity = std::bit_ceil(capacity);
+			T* newData = reinterpret_cast<T*>(_allocator.Allocate(sizeof(T) * newCapacity, alignof(T)));
+			assert(newData != nullptr);
+
+			// The elements may wrap past the end of the ring; they are unwrapped into the front of the new one.
+			const size_t firstRun = std::min(_size, _capacity - _head);
+			RelocateElements(newData, _data + _head, firstRun);
+			RelocateElements(newData + firstRun, _data, _size - firstRun);
+
+			_allocator.Deallocate(_data, sizeof(T) * _capacity, alignof(T));
+			_data = newData;
+			_head = 0_z;
+			_capacity = newCapacity;
+		}
+	}
+
+	template <typename T, typename TAllocator>
+	inline void Deque<T, TAllocator>::Clear()
+	{
+		const size_t firstRun = std::min(_size, _capacity - _head);
+		DestroyElements(_data + _head, firstRun);
+		DestroyElements(_data, _size - firstRun);
+		_head = 0_z;
+		_size = 0_z;
+	}
+
+	template <typename T, typename TAllocator>
+	inline TAllocator Deque<T, TAllocator>::GetAllocator() const
+	{
+		return _allocator;
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::begin()
+	{
+		return Iterator(*this, 0_z);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::begin() const
+	{
+		return ConstIterator(*this, 0_z);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::cbegin() const
+	{
+		return ConstIterator(*this, 0_z);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::end()
+	{
+		return Iterator(*this, _size);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::end() const
+	{
+		return ConstIterator(*this, _size);
+	}
+
+	template <typename T, typename TAllocator>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::cend() const
+	{
+		return ConstIterator(*this, _size);
+	}
+
+	template <typename T, typename TAllocator>
+	template <typename EqualityFunctor>
+	inline typename Deque<T, TAllocator>::Iterator Deque<T, TAllocator>::Find(const T& value)
+	{
+		const size_t firstRun = std::min(_size, _capacity - _head);
+		if constexpr (std::is_same_v<EqualityFunctor, DefaultEquality<T>> && IsSimdFindable<T>)
+		{
+			// The ring holds at most two contiguous runs: from the head to the end of the buffer, then from the start of the buffer.
+			const size_t index = SimdFind(_data + _head, firstRun, value);
+			return Iterator(*this, index < firstRun ? index : firstRun + SimdFind(_data, _size - firstRun, value));
+		}
+		else
+		{
+			EqualityFunctor eq;
+
+			size_t index = 0_z;
+			for (; index < _size; ++index)
+			{
+				if (eq(*Slot(index), value))
+				{
+					break;
+				}
+			}
+			return Iterator(*this, index);
+		}
+	}
+
+	template <typename T, typename TAllocator>
+	template <typename EqualityFunctor>
+	inline typename Deque<T, TAllocator>::ConstIterator Deque<T, TAllocator>::Find(const T& value) const
+	{
+		return const_cast<Deque*>(this)->Find<EqualityFunctor>(value);
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool Deque<T, TAllocator>::Remove(const Iterator& it)
+	{
+		if (it._owner != this)
+		{
+			throw std::runtime_error("Unassociated deque.");
+		}
+		if (it._index >= _size)
+		{
+			return false;
+		}
+
+		Slot(it._index)->~T();
+		if (it._index < _size / 2_z)
+		{
+			// Nearer the front: shift the earlier elements back by one and advance the head.
+			for (size_t i = it._index; i > 0_z; --i)
+			{
+				RelocateElements(Slot(i), Slot(i - 1_z), 1_z);
+			}
+			_head = (_head + 1_z) & (_capacity - 1_z);
+		}
+		else
+		{
+			for (size_t i = it._index + 1_z; i < _size; ++i)
+			{
+				RelocateElements(Slot(i - 1_z), Slot(i), 1_z);
+			}
+		}
+		--_size;
+		return true;
+	}
+
+	template <typename T, typename TAllocator>
+	inline T* Deque<T, TAllocator>::Slot(size_t index) const
+	{
+		return _data + ((_head + index) & (_capacity - 1_z));
+	}
+
+	template <typename T, typename TAllocator>
+	inline void Deque<T, TAllocator>::GrowIfFull()
+	{
+		if (_size == _capacity)
+		{
+			Reserve(std::max(MinimumCapacity, _capacity * 2_z));
+		}
+	}
+}
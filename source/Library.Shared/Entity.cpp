@@ -17,9 +17,9 @@ namespace FIEAGameEngine
 
 	}
 
-	const FIEAGameEngine::Vector< FIEAGameEngine::Signature> Entity::Signatures()
+	const FIEAGameEngine::SignatureList Entity::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{ NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(Entity, _name) },
 			{ ChildrenStringLiteral, Datum::DatumTypes::Table, 0, 0 },
@@ -129,7 +129,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an Entity with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an Entity.</returns>
-		static const FIEAGameEngine::Vector<FIEAGameEngine::Signature> Signatures();
+		static const FIEAGameEngine::SignatureList Signatures();
 
 	protected:
 		/// <summary>
@@ -1,6 +1,5 @@
 #pragma once
 #include "RTTI.h"
-#include "Vector.h"
 #include "EventPublisher.h"
 #include "EventSubscriber.h"
 
@@ -11,6 +10,7 @@ namespace FIEAGameEngine
 	/// <summary>
 	/// A templated extension of an EventPublisher that represents an event of the templated type.
 	/// The deliver method method of a subscriber of this event will receive the payload of this event when delivered.
+	/// Subscribing and unsubscribing are synchronized, so they may happen on any thread.
 	/// </summary>	
 	/// <typeparam name="T">The kind of payload this event is storing.</typeparam>
 	template <typename T>
@@ -77,7 +77,11 @@ namespace FIEAGameEngine
 		/// </summary>
 		static void UnsubscribeAll();
 
-		static const Vector<EventSubscriber*>& Subscribers();
+		/// <summary>
+		/// Provides a copy of the list of subscribers for this event type, taken under its lock.
+		/// </summary>
+		/// <returns>The subscribers at the time of the call.</returns>
+		static SubscriberList Subscribers();
 
 		/// <summary>
 		/// Returns a const reference to the payload that cannot be mutated.
@@ -94,7 +98,11 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// The list of subscribers to this event.
 		/// </summary>
-		static Vector<EventSubscriber*> _subscribers;
+		static SubscriberList _subscribers;
+		/// <summary>
+		/// Guards _subscribers. Shared while delivering, exclusive while subscribing or unsubscribing.
+		/// </summary>
+		static std::shared_mutex _subscribersMutex;
 
 		/// <summary>
 		/// The payload of this event.
@@ -6,18 +6,21 @@ namespace FIEAGameEngine
 	RTTI_DEFINITIONS(Event<T>)
 
 	template <typename T>
-	Vector<EventSubscriber*> Event<T>::_subscribers;
+	EventPublisher::SubscriberList Event<T>::_subscribers;
+
+	template <typename T>
+	std::shared_mutex Event<T>::_subscribersMutex;
 
 	template<typename T>
 	inline Event<T>::Event(const T& message) :
-		EventPublisher(_subscribers), _message(message)
+		EventPublisher(_subscribers, _subscribersMutex), _message(message)
 	{
 
 	}
 
 	template<typename T>
 	inline Event<T>::Event(T&& message) :
-		EventPublisher(&_subscribers), _message(std::forward(message))
+		EventPublisher(_subscribers, _subscribersMutex), _message(std::move(message))
 	{
 
 	}
@@ -25,6 +28,7 @@ namespace FIEAGameEngine
 	template<typename T>
 	inline void Event<T>::Subscribe(EventSubscriber& subscriber)
 	{
+		std::unique_lock lock(_subscribersMutex);
 		if (_subscribers.Find(&subscriber) == _subscribers.end())
 		{
 			_subscribers.PushBack(&subscriber);
@@ -34,18 +38,21 @@ namespace FIEAGameEngine
 	template<typename T>
 	inline void Event<T>::Unsubscribe(EventSubscriber& subscriber)
 	{
+		std::unique_lock lock(_subscribersMutex);
 		_subscribers.Remove(&subscriber);
 	}
 
 	template<typename T>
-	inline const Vector<EventSubscriber*>& Event<T>::Subscribers() 
+	inline EventPublisher::SubscriberList Event<T>::Subscribers()
 	{
+		std::shared_lock lock(_subscribersMutex);
 		return _subscribers;
 	}
 
 	template<typename T>
 	inline void Event<T>::UnsubscribeAll()
 	{
+		std::unique_lock lock(_subscribersMutex);
 		_subscribers.Clear();
 		_subscribers.ShrinkToFit();
 	}
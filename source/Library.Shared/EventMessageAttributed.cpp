@@ -6,7 +6,7 @@ namespace FIEAGameEngine
 	RTTI_DEFINITIONS(EventMessageAttributed)
 
 	EventMessageAttributed::EventMessageAttributed(const string& subtype, WorldState& worldState) :
-		Attributed(EventMessageAttributed::TypeIdClass()), _subtype(subtype), _worldState(&worldState)
+		Attributed(EventMessageAttributed::TypeIdClass()), _worldState(&worldState), _subtype(subtype)
 	{
 
 	}
@@ -31,9 +31,9 @@ namespace FIEAGameEngine
 		_worldState = &worldState;
 	}
 
-	const Vector<Signature> EventMessageAttributed::Signatures()
+	const SignatureList EventMessageAttributed::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{SubtypeStringLiteral, Datum::DatumTypes::String, 1, offsetof(EventMessageAttributed, _subtype) }
 		};
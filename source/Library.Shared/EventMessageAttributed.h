@@ -77,7 +77,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an EventMessageAttributed with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an EventMessageAttributed.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	protected:
 		/// <summary>
@@ -5,15 +5,21 @@ namespace FIEAGameEngine
 {
 	RTTI_DEFINITIONS(EventPublisher)
 
-	EventPublisher::EventPublisher(const Vector<EventSubscriber*>& subscribers) :
-		_subscribers(&subscribers)
+	EventPublisher::EventPublisher(const SubscriberList& subscribers, std::shared_mutex& subscribersMutex) :
+		_subscribers(&subscribers), _subscribersMutex(&subscribersMutex)
 	{
 
 	}
 
 	void EventPublisher::Deliver() const
 	{
-		for (EventSubscriber* subscriber : *_subscribers)
+		SubscriberList subscribers;
+		{
+			std::shared_lock lock(*_subscribersMutex);
+			subscribers = *_subscribers;
+		}
+
+		for (EventSubscriber* subscriber : subscribers)
 		{
 			assert(subscriber != nullptr);
 			subscriber->Notify(*this);
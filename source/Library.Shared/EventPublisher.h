@@ -1,6 +1,8 @@
 #pragma once
+#include <mutex>
+#include <shared_mutex>
 #include "RTTI.h"
-#include "Vector.h"
+#include "SmallVector.h"
 #include "EventSubscriber.h"
 
 namespace FIEAGameEngine
@@ -13,15 +15,20 @@ namespace FIEAGameEngine
 	{
 		RTTI_DECLARATIONS(EventPublisher, RTTI)
 	public:
+		/// <summary>
+		/// The subscribers to one type of event. Most events have only a few subscribers, so they are stored inline.
+		/// </summary>
+		using SubscriberList = SmallVector<EventSubscriber*, 4>;
+
 		/// <summary>
 		/// Constructor is deleted because this is an abstract class.
 		/// </summary>
 		EventPublisher() = delete;
 		/// <summary>
 		/// Creates a new instance of an EventPublisher.
-		/// Takes in a subscribers vector for the derived class of an Event.
+		/// Takes in a subscribers vector for the derived class of an Event, and the lock that guards it.
 		/// <summary>
-		explicit EventPublisher(const Vector<EventSubscriber* >& subscribers);
+		EventPublisher(const SubscriberList& subscribers, std::shared_mutex& subscribersMutex);
 		/// <summary>
 		/// Invokes the move constructor. Creates a new EventPublisher and "steals" the member variables from other EventPublisher into this EventPublisher. 
 		/// Shallow copies the member variables and sets the other EventPublisher's member variables to their uninitialized defaults.
@@ -49,6 +56,7 @@ namespace FIEAGameEngine
 
 		/// <summary>
 		/// Notifies all the subscribers of in the list of subscribers.
+		/// The list is copied under its lock first, so subscribers may subscribe and unsubscribe, on this or any other thread, during delivery.
 		/// </summary>
 		void Deliver() const;
 
@@ -57,6 +65,10 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Non-static reference to list of pointers to EventSubscribers from the derived class.
 		/// </summary>
-		const Vector<EventSubscriber*>* _subscribers;
+		const SubscriberList* _subscribers;
+		/// <summary>
+		/// The lock that guards _subscribers.
+		/// </summary>
+		std::shared_mutex* _subscribersMutex;
 	};
 }
\ No newline at end of file
@@ -5,8 +5,7 @@ namespace FIEAGameEngine
 {
 	void EventQueue::Enqueue(std::shared_ptr<EventPublisher> event, const GameTime& gameTime, std::chrono::milliseconds delay)
 	{
-		QueueEntry entry(std::move(event), gameTime.CurrentTime(), delay);
-		_events.PushBack(entry);
+		_events.EmplaceBack(std::move(event), gameTime.CurrentTime(), delay);
 	}
 
 	void EventQueue::Clear()
@@ -26,17 +25,21 @@ namespace FIEAGameEngine
 
 	void EventQueue::Update(const GameTime& gameTime)
 	{
-		if (!_events.IsEmpty())
+		// Each entry is taken off the front once: expired ones are delivered and the rest go to the back, so the queue keeps its order.
+		// Entries enqueued by a subscriber during delivery land behind the ones being visited and wait for the next update.
+		for (size_t remaining = _events.Size(); remaining > 0_z && !_events.IsEmpty(); --remaining)
 		{
-			auto it = std::partition(_events.begin(), _events.end(), [&gameTime](QueueEntry entry) { return !entry.IsExpired(gameTime.CurrentTime()); });
+			QueueEntry entry = std::move(_events.Front());
+			_events.PopFront();
 
-			size_t numDeliveredEvents = 0_z;
-			for (; it != _events.end(); ++it, ++numDeliveredEvents)
+			if (entry.IsExpired(gameTime.CurrentTime()))
 			{
-
-				(*it)._event->Deliver();
+				entry._event->Deliver();
+			}
+			else
+			{
+				_events.PushBack(std::move(entry));
 			}
-			_events.Resize(_events.Size() - numDeliveredEvents);
 		}
 	}
 
@@ -1,6 +1,6 @@
 #pragma once
 #include "RTTI.h"
-#include "Vector.h"
+#include "Deque.h"
 #include "GameTime.h"
 #include "EventPublisher.h"
 #include "EventSubscriber.h"
@@ -108,8 +108,8 @@ namespace FIEAGameEngine
 		};
 
 		/// <summary>
-		/// The queue of QueueEntries to be delivered.
+		/// The queue of QueueEntries to be delivered, oldest first.
 		/// </summary>
-		Vector<QueueEntry> _events;
+		Deque<QueueEntry> _events;
 	};
 }
\ No newline at end of file
@@ -1,12 +1,14 @@
 #pragma once
 #include <gsl/gsl>
-#include "HashMap.h"
+#include <string_view>
+#include "ConcurrentHashMap.h"
 
 namespace FIEAGameEngine
 {
 	/// <summary>
 	/// Abstract factory class used to enable to "factory" design pattern on any interface class that has a default constructor. 
 	/// Also doubles as a manager class that holds and manages all existing derived factories.
+	/// The static methods may be called from any thread. A factory must not be destroyed while another thread may still be creating from it.
 	/// </summary>
 	/// <typeparam name="T">The type of class that you are creating a factory for. This is also the type of object that this factory will generate.</typeparam>
 	template <typename T>
@@ -31,7 +33,7 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="className">The name of the class that you want to generate an object of.</param>
 		/// <returns></returns>
-		static gsl::owner<T*> Create(const std::string& className);
+		static gsl::owner<T*> Create(std::string_view className);
 		/// <summary>
 		/// Checks if the static hashmap of factories is empty.
 		/// </summary>
@@ -45,11 +47,11 @@ namespace FIEAGameEngine
 
 		/// <summary>
 		/// Finds the factory that generates objects of the class name that is provided.
-		/// Returns nullptr if the factory was not found.
+		/// Returns nullptr if the factory was not found. Looks the name up without copying it into a std::string.
 		/// </summary>
 		/// <param name="className">The name of the class that is generated by the factory you are searching.</param>
 		/// <returns>A pointer to the factory that was found using the class name or nullptr</returns>
-		static const Factory* const Find(const std::string& className);
+		static const Factory* Find(std::string_view className);
 
 	protected:
 		/// <summary>
@@ -67,7 +69,7 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// The static hashmap used to store all the types of factories in this manager.
 		/// </summary>
-		inline static HashMap<std::string, const Factory* const> _factories;
+		inline static ConcurrentHashMap<std::string, const Factory* const> _factories{};
 	};
 
 /// <summary>
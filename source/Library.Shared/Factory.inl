@@ -3,7 +3,7 @@
 namespace FIEAGameEngine
 {
 	template <typename T>
-	gsl::owner<T*> Factory<T>::Create(const std::string& className)
+	gsl::owner<T*> Factory<T>::Create(std::string_view className)
 {
 		auto ptr = Find(className);
 		if (ptr != nullptr)
@@ -26,24 +26,21 @@ namespace FIEAGameEngine
 	}
 
 	template<typename T>
-	inline const Factory<T>* const FIEAGameEngine::Factory<T>::Find(const std::string& className)
+	inline const Factory<T>* FIEAGameEngine::Factory<T>::Find(std::string_view className)
 	{
-		auto it = _factories.Find(className);
-		if (it != _factories.end())
+		const Factory* const* factory = _factories.Find(className);
+		if (factory != nullptr)
 		{
-			
-			return it->second;
+			return *factory;
 		}
-		
+
 		return nullptr;
 	}
 
 	template<typename T>
 	inline void Factory<T>::Add(const Factory& factory)
 	{
-		auto pair = std::make_pair(factory.ClassName(), &factory);
-		auto [it, wasInserted] = _factories.Insert(pair);
-		if (!wasInserted)
+		if (!_factories.TryEmplace(factory.ClassName(), &factory))
 		{
 			throw std::runtime_error("Factory has already been inserted.");
 		}
@@ -0,0 +1,610 @@
+#pragma once
+
+#include "Allocator.h"
+#include "DefaultHash.h"
+#include "DefaultEquality.h"
+#include "SizeLiteral.h"
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// A templated class for an open-addressing HashMap. FlatHashMap stores its TKey, TValue pairs inline in a single slot array
+	/// alongside an array of one-byte control values (one per slot). Lookups probe the control bytes sixteen at a time (with SSE2 when available)
+	/// and only touch a slot when its control byte matches seven bits of the key's hash.
+	/// The public interface matches HashMap. Unlike HashMap, inserting may move existing pairs in memory, so pointers and references into the map
+	/// are only valid until the next Insert, operator[] or Resize.
+	/// </summary>
+	/// <typeparam name="TKey">The templated type of the key which will be hashed to retrieve to location.</typeparam>
+	/// <typeparam name="TValue">The templated type of the value stored in the container.</typeparam>
+	/// <typeparam name="THash">Hash policy. Called directly, so a stateless policy inlines and takes no space in the FlatHashMap. Use DynamicHash for a hash chosen at runtime.</typeparam>
+	/// <typeparam name="TEquality">Equality policy. Same rules as THash; use DynamicEquality for a comparison chosen at runtime.</typeparam>
+	/// <typeparam name="TAllocator">Allocator policy for the slot and control arrays. See DefaultAllocator.</typeparam>
+	template<typename TKey, typename TValue, typename THash = DefaultHash<TKey>, typename TEquality = DefaultEquality<TKey>, typename TAllocator = DefaultAllocator>
+	class FlatHashMap
+	{
+	public:
+		using PairType = std::pair<const TKey, TValue>;
+		using HashFunctor = THash;
+		using EqualityFunctor = TEquality;
+		using value_type = PairType;
+	private:
+		using ControlType = std::int8_t;
+		/// <summary>
+		/// Enables the heterogeneous lookup overloads for TLookup when both policies are transparent and TLookup is not TKey itself.
+		/// </summary>
+		template <typename TLookup>
+		using EnableIfTransparent = std::enable_if_t<IsTransparent<THash, TEquality>::value && !std::is_same_v<TLookup, std::remove_const_t<TKey>>>;
+
+		/// <summary>
+		/// Number of control bytes that are probed together. Capacities are always a power of two that is at least this large.
+		/// </summary>
+		static constexpr std::size_t GroupWidth = 16;
+		/// <summary>
+		/// Control byte marking a slot that has never held a pair. A probe sequence ends at the first group containing one.
+		/// </summary>
+		static constexpr ControlType Empty = -128;
+		/// <summary>
+		/// Control byte marking a slot whose pair was removed. Probing continues past it.
+		/// </summary>
+		static constexpr ControlType Deleted = -2;
+
+	public:
+		/// <summary>
+		/// Iterator object for the FlatHashMap container. Can access the private members of both FlatHashMap and ConstIterator.
+		/// </summary>
+		class Iterator final
+		{
+			friend FlatHashMap;
+			friend class ConstIterator;
+
+		public:
+			/// <summary>
+			/// Creates a new instance of a FlatHashMap Iterator. Default constructor provided by the compiler.
+			/// </summary>
+			Iterator() = default;
+			/// <summary>
+			/// Invokes the copy constructor. Default copy constructor provided by the compiler.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap Iterator that is being copied from.</param>
+			Iterator(const Iterator& other) = default;
+			/// <summary>
+			/// Invokes the move constructor. Default move constructor provided by the compiler.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap Iterator that is being moved from.</param>
+			Iterator(Iterator&& other) noexcept = default;
+			/// <summary>
+			/// Invokes the copy assignment. Default copy assignment provided by the compiler.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap Iterator that is being copied from.</param>
+			/// <returns>Reference to the newly assigned iterator.</returns>
+			Iterator& operator=(const Iterator& other) = default;
+			/// <summary>
+			/// Invokes the move assignment. Default move assignment provided by the compiler.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap Iterator that is being moved from.</param>
+			/// <returns>Reference to the newly assigned iterator.</returns>
+			Iterator& operator=(Iterator&& other) noexcept = default;
+			/// <summary>
+			/// Default destructor provided by the compiler.
+			/// </summary>
+			~Iterator() = default;
+			/// <summary>
+			/// Equality operator. Tests whether a FlatHashMap Iterator is equal to another.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap Iterator that we are comparing against.</param>
+			/// <returns>True if all the members of each iterator are equal.</returns>
+			bool operator==(const Iterator& other) const;
+			/// <summary>
+			/// Not Equality operator. Tests whether a FlatHashMap Iterator is not equal to another.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap Iterator that we are comparing against.</param>
+			/// <returns>True if any of the members of each iterator are not equal.</returns>
+			bool operator!=(const Iterator& other) const;
+			/// <summary>
+			/// Prefix Increment operator. Changes the FlatHashMap Iterator to point to the next occupied slot in the FlatHashMap.
+			/// </summary>
+			/// <returns>Iterator pointing to the next element.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any FlatHashMap.</exception>
+			Iterator& operator++();
+			/// <summary>
+			/// Postfix Increment operator. Changes the FlatHashMap Iterator to point to the next occupied slot in the FlatHashMap.
+			/// </summary>
+			/// <param name="int">Fake parameter name.</param>
+			/// <returns>Iterator pointing to the element before the increment.</returns>
+			Iterator operator++(int);
+			/// <summary>
+			/// Dereference operator. Exposes the element that the FlatHashMap Iterator is pointing to.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any FlatHashMap.</exception>
+			/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+			PairType& operator*() const;
+			/// <summary>
+			/// Arrow operator. Dereferences the element that the FlatHashMap Iterator is pointing to and allows you to access any of the public members of that element.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any FlatHashMap.</exception>
+			/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+			PairType* operator->() const;
+
+		private:
+			/// <summary>
+			/// Private constructor to create an Iterator with a given Owner FlatHashMap and a slot index.
+			/// </summary>
+			/// <param name="owner">The FlatHashMap that "owns" this Iterator.</param>
+			/// <param name="index">The index of the slot in the FlatHashMap that the Iterator points to.</param>
+			Iterator(FlatHashMap& owner, size_t index);
+			/// <summary>
+			/// The FlatHashMap that "owns" this Iterator. Initialized to nullptr.
+			/// </summary>
+			FlatHashMap* _owner{ nullptr };
+			/// <summary>
+			/// The index of the slot that the Iterator points to. Equal to the capacity of the owner for end().
+			/// </summary>
+			size_t _index{ 0 };
+		};
+
+		/// <summary>
+		/// ConstIterator object for the FlatHashMap container. These methods will be invoked against a const FlatHashMap only.
+		/// </summary>
+		class ConstIterator final
+		{
+			friend FlatHashMap;
+
+		public:
+			/// <summary>
+			/// Creates a new instance of a FlatHashMap ConstIterator. Default constructor provided by the compiler.
+			/// </summary>
+			ConstIterator() = default;
+			/// <summary>
+			/// Invokes the copy constructor against an ConstIterator provided a non-const FlatHashMap Iterator. Provides a copy of the Iterator that now has been promoted to have const-ness.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap Iterator that is being copied from.</param>
+			ConstIterator(const Iterator& other);
+			/// <summary>
+			/// Invokes the copy constructor. Default copy constructor provided by the compiler.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap ConstIterator that is being copied from.</param>
+			ConstIterator(const ConstIterator& other) = default;
+			/// <summary>
+			/// Invokes the move constructor. Default move constructor provided by the compiler.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap ConstIterator that is being moved from.</param>
+			ConstIterator(ConstIterator&& other) noexcept = default;
+			/// <summary>
+			/// Invokes the copy assignment. Default copy assignment provided by the compiler.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap ConstIterator that is being copied from.</param>
+			/// <returns>Reference to the newly assigned ConstIterator.</returns>
+			ConstIterator& operator=(const ConstIterator& other) = default;
+			/// <summary>
+			/// Invokes the move assignment. Default move assignment provided by the compiler.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap ConstIterator that is being moved from.</param>
+			/// <returns>Reference to the newly assigned ConstIterator.</returns>
+			ConstIterator& operator=(ConstIterator&& other) noexcept = default;
+			/// <summary>
+			/// Default destructor provided by the compiler.
+			/// </summary>
+			~ConstIterator() = default;
+			/// <summary>
+			/// Equality operator. Tests whether a FlatHashMap ConstIterator is equal to another.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap ConstIterator that we are comparing against.</param>
+			/// <returns>True if all the members of each iterator are equal.</returns>
+			bool operator==(const ConstIterator& other) const;
+			/// <summary>
+			/// Not Equality operator. Tests whether a FlatHashMap ConstIterator is not equal to another.
+			/// </summary>
+			/// <param name="other">The instance of FlatHashMap ConstIterator that we are comparing against.</param>
+			/// <returns>True if any of the members of each iterator are not equal.</returns>
+			bool operator!=(const ConstIterator& other) const;
+			/// <summary>
+			/// Prefix Increment operator. Changes the FlatHashMap ConstIterator to point to the next occupied slot in the FlatHashMap.
+			/// </summary>
+			/// <returns>Iterator pointing to the next element.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any FlatHashMap.</exception>
+			ConstIterator& operator++();
+			/// <summary>
+			/// Postfix Increment operator. Changes the FlatHashMap ConstIterator to point to the next occupied slot in the FlatHashMap.
+			/// </summary>
+			/// <param name="int">Fake parameter name.</param>
+			/// <returns>Iterator pointing to the element before the increment.</returns>
+			ConstIterator operator++(int);
+			/// <summary>
+			/// Dereference operator. Exposes the element that the FlatHashMap ConstIterator is pointing to.
+			/// </summary>
+			/// <returns>A reference to the underlying element that this Iterator points to.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any FlatHashMap.</exception>
+			/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+			const PairType& operator*() const;
+			/// <summary>
+			/// Arrow operator. Dereferences the element that the FlatHashMap ConstIterator is pointing to and allows you to access any of the public members of that element.
+			/// </summary>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any FlatHashMap.</exception>
+			/// <exception cref="std::runtime_error">Thrown if the index is out of bounds.</exception>
+			const PairType* operator->() const;
+
+		private:
+			/// <summary>
+			/// Private constructor to create a ConstIterator with a given Owner FlatHashMap and a slot index.
+			/// </summary>
+			/// <param name="owner">The FlatHashMap that "owns" this Iterator.</param>
+			/// <param name="index">The index of the slot in the FlatHashMap that the Iterator points to.</param>
+			ConstIterator(const FlatHashMap& owner, size_t index);
+			/// <summary>
+			/// The FlatHashMap that "owns" this Iterator. Initialized to nullptr.
+			/// </summary>
+			const FlatHashMap* _owner{ nullptr };
+			/// <summary>
+			/// The index of the slot that the Iterator points to. Equal to the capacity of the owner for end().
+			/// </summary>
+			size_t _index{ 0 };
+		};
+
+		/// <summary>
+		/// Creates a new instance of FlatHashMap. Allows user to provide custom size, hash functor, and equality functor.
+		/// </summary>
+		/// <param name="size">The minimum amount of slots in the map. Rounded up to a power of two that is at least sixteen.</param>
+		/// <param name="hFunctor">The function object that provides a function for hashing keys.</param>
+		/// <param name="eqFunctor">The function object that provides a function for determining equality between two items.</param>
+		/// <param name="allocator">The allocator the slot and control arrays come from.</param>
+		/// <exception cref="std::runtime_error">Thrown when the FlatHashMap size is 0.</exception>
+		explicit FlatHashMap(size_t size = 11_z, HashFunctor hFunctor = HashFunctor{}, EqualityFunctor eqFunctor = EqualityFunctor{}, TAllocator allocator = TAllocator{});
+		/// <summary>
+		/// Invokes the copy constructor.
+		/// Creates a new FlatHashMap with the same capacity and copies each pair into the same slot it occupies in the other FlatHashMap.
+		/// </summary>
+		/// <param name="other">The instance of FlatHashMap that is being copied from.</param>
+		FlatHashMap(const FlatHashMap& other);
+		/// <summary>
+		/// Invokes the move constructor. Creates a new FlatHashMap and "steals" the slot and control arrays from the other FlatHashMap.
+		/// The other FlatHashMap is left with no slots and will allocate again on its next insert.
+		/// </summary>
+		/// <param name="other">The instance of FlatHashMap that is being moved from.</param>
+		FlatHashMap(FlatHashMap&& other) noexcept;
+		/// <summary>
+		/// Creates a FlatHashMap from an initializer list, similar to Copy Constructor.
+		/// </summary>
+		/// <param name="list">The initializer list you are copying from.</param>
+		FlatHashMap(std::initializer_list<PairType> list);
+		/// <summary>
+		/// Creates a FlatHashMap from an initializer list, similar to Copy Constructor.
+		/// </summary>
+		/// <param name="list">The initializer list you are copying from.</param>
+		FlatHashMap(std::initializer_list<PairType> list, HashFunctor hashFunctor, EqualityFunctor equalityFunctor);
+		/// <summary>
+		/// Invokes the copy assignment. Destructs all pairs in this FlatHashMap and copies each pair from the other FlatHashMap into this FlatHashMap.
+		/// </summary>
+		/// <param name="other">The instance of FlatHashMap that is being copied from.</param>
+		/// <returns>Reference to this FlatHashMap.</returns>
+		FlatHashMap& operator=(const FlatHashMap& other);
+		/// <summary>
+		/// Invokes the move assignment. Destructs all pairs in this FlatHashMap, frees its memory, then "steals" the slot and control arrays from the other FlatHashMap.
+		/// </summary>
+		/// <param name="other">The instance of FlatHashMap that is being moved from.</param>
+		/// <returns>Reference to this FlatHashMap.</returns>
+		FlatHashMap& operator=(FlatHashMap&& other) noexcept;
+		/// <summary>
+		/// Destructor that destructs every pair and frees the slot and control arrays.
+		/// </summary>
+		~FlatHashMap();
+		/// <summary>
+		/// Using a key, searches for a TValue and returns a reference to that TValue.
+		/// If the key cannot be found, a <TKey, TValue> pair is inserted where the TKey is the key provided and the TValue is default constructed.
+		/// Nothing is constructed or copied when the key is already present.
+		/// </summary>
+		/// <param name="key">The key that you want to search on.</param>
+		/// <returns>Reference to the TValue at this spot in the FlatHashMap.</returns>
+		TValue& operator[](const TKey& key);
+
+		/// <summary>
+		/// Searches for the given element and returns a FlatHashMap Iterator pointing to that found element.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <returns>A FlatHashMap Iterator pointing to that found element, or end() if it was not found.</returns>
+		Iterator Find(const TKey& key);
+		/// <summary>
+		/// Searches for the given element and returns a FlatHashMap ConstIterator pointing to that found element.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <returns>A FlatHashMap ConstIterator pointing to that found element, or end() if it was not found.</returns>
+		ConstIterator Find(const TKey& key) const;
+		/// <summary>
+		/// Searches using a hash already computed by Hash. Lets a caller that probes several maps with the same key hash it once.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <param name="hash">The value Hash(key) returns.</param>
+		/// <returns>A FlatHashMap Iterator pointing to that found element, or end() if it was not found.</returns>
+		Iterator Find(const TKey& key, size_t hash);
+		/// <summary>
+		/// Searches using a hash already computed by Hash. Invoked against a const FlatHashMap.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <param name="hash">The value Hash(key) returns.</param>
+		/// <returns>A FlatHashMap ConstIterator pointing to that found element, or end() if it was not found.</returns>
+		ConstIterator Find(const TKey& key, size_t hash) const;
+		/// <summary>
+		/// Searches for a key of another type without constructing a TKey, e.g. a std::string_view or const char* in a std::string keyed FlatHashMap.
+		/// Only available when both policies are transparent.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <returns>A FlatHashMap Iterator pointing to that found element, or end() if it was not found.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key);
+		/// <summary>
+		/// Searches for a key of another type without constructing a TKey. Invoked against a const FlatHashMap.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <returns>A FlatHashMap ConstIterator pointing to that found element, or end() if it was not found.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key) const;
+		/// <summary>
+		/// Searches for a key of another type using a hash already computed by Hash.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <param name="hash">The value Hash(key) returns.</param>
+		/// <returns>A FlatHashMap Iterator pointing to that found element, or end() if it was not found.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key, size_t hash);
+		/// <summary>
+		/// Searches for a key of another type using a hash already computed by Hash. Invoked against a const FlatHashMap.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <param name="hash">The value Hash(key) returns.</param>
+		/// <returns>A FlatHashMap ConstIterator pointing to that found element, or end() if it was not found.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key, size_t hash) const;
+
+		/// <summary>
+		/// Hashes a key with this FlatHashMap's hash policy, for use with the Find overloads that take a precomputed hash.
+		/// </summary>
+		/// <param name="key">The key to hash.</param>
+		/// <returns>The full hash of the key.</returns>
+		size_t Hash(const TKey& key) const;
+		/// <summary>
+		/// Hashes a key of another type with this FlatHashMap's hash policy. Only available when both policies are transparent.
+		/// </summary>
+		/// <param name="key">The key to hash.</param>
+		/// <returns>The full hash of the key.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		size_t Hash(const TLookup& key) const;
+
+		/// <summary>
+		/// Inserts an entry into the FlatHashMap and returns a FlatHashMap Iterator pointing to the slot where this entry was stored.
+		/// If the FlatHashMap already contains this entry, does not insert the entry again or modify. Just returns an Iterator pointing to it.
+		/// Grows the FlatHashMap when more than seven eighths of its slots would be in use.
+		/// </summary>
+		/// <param name="entry">The pair of <TKey, TValue> that is being inserted into the map.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted element and 2) a bool representing whether the insert was successful.</returns>
+		std::pair<Iterator, bool> Insert(const PairType& entry);
+		/// <summary>
+		/// Moves an entry into the FlatHashMap. If the FlatHashMap already contains the key, entry is left untouched.
+		/// </summary>
+		/// <param name="entry">The pair of <TKey, TValue> that is being inserted into the map.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether the entry was inserted.</returns>
+		std::pair<Iterator, bool> Insert(PairType&& entry);
+		/// <summary>
+		/// Inserts key with a TValue constructed in place in its slot from args, unless the key is already present.
+		/// When it is, neither the key nor the arguments are copied or moved from, and no TValue is constructed.
+		/// </summary>
+		/// <param name="key">The key to insert.</param>
+		/// <param name="args">Arguments forwarded to the constructor of TValue.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether the entry was inserted.</returns>
+		template <typename... TArgs>
+		std::pair<Iterator, bool> TryEmplace(const TKey& key, TArgs&&... args);
+		/// <summary>
+		/// Moves key into the FlatHashMap with a TValue constructed in place in its slot from args, unless the key is already present.
+		/// When it is, neither the key nor the arguments are moved from, and no TValue is constructed.
+		/// </summary>
+		/// <param name="key">The key to insert.</param>
+		/// <param name="args">Arguments forwarded to the constructor of TValue.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether the entry was inserted.</returns>
+		template <typename... TArgs>
+		std::pair<Iterator, bool> TryEmplace(std::remove_const_t<TKey>&& key, TArgs&&... args);
+		/// <summary>
+		/// Constructs a PairType from args and moves it into its slot, unless its key is already present.
+		/// The key is only known once the pair exists, so prefer TryEmplace when the key is at hand.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the constructor of PairType.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether the entry was inserted.</returns>
+		template <typename... TArgs>
+		std::pair<Iterator, bool> Emplace(TArgs&&... args);
+
+		/// <summary>
+		/// Rehashes the FlatHashMap into a new slot array. The new slot count is rounded up to a power of two and is never too small to hold the current elements.
+		/// </summary>
+		/// <param name="bucketSize">The minimum amount of slots that will be in the new FlatHashMap.</param>
+		void Resize(size_t bucketSize);
+
+		/// <summary>
+		/// Removes an entry in the FlatHashMap that matches with the key provided.
+		/// If the key does not exist in the FlatHashMap, the function does nothing.
+		/// </summary>
+		/// <param name="key">The key that matches the entry to remove from the map.</param>
+		void Remove(const TKey& key);
+
+		/// <summary>
+		/// Removes all elements from the FlatHashMap. Keeps the slot and control arrays.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Provides the number of elements currently in the FlatHashMap.
+		/// </summary>
+		/// <returns>The number of elements in the FlatHashMap.</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Determines if the FlatHashMap has no elements.
+		/// </summary>
+		/// <returns>True if the FlatHashMap has no elements.</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Provides the number of slots currently in the FlatHashMap.
+		/// </summary>
+		/// <returns>The number of slots in the FlatHashMap.</returns>
+		size_t BucketSize() const;
+		/// <summary>
+		/// Provides the allocator the slot and control arrays come from.
+		/// </summary>
+		/// <returns>A copy of the allocator.</returns>
+		TAllocator GetAllocator() const;
+
+		/// <summary>
+		/// Determines if the key is in the FlatHashMap.
+		/// </summary>
+		/// <returns>True if the key is in the FlatHashMap.</returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Provides the TValue that matches with the TKey passed in. Requires that the <TKey, TValue> pair has already been inserted.
+		/// </summary>
+		/// <param name="key">The key that matches the value you are searching for.</param>
+		/// <returns>That value that matches the key passed in.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the key is not in the FlatHashMap.</exception>
+		TValue& At(TKey key);
+		/// <summary>
+		/// Provides the TValue that matches with the TKey passed in. Requires that the <TKey, TValue> pair has already been inserted.
+		/// Invoked against a const FlatHashMap.
+		/// </summary>
+		/// <param name="key">The key that matches the value you are searching for.</param>
+		/// <returns>That value that matches the key passed in.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the key is not in the FlatHashMap.</exception>
+		const TValue& At(TKey key) const;
+
+		/// <summary>
+		/// Returns a FlatHashMap Iterator that points to the first element in the FlatHashMap.
+		/// </summary>
+		/// <returns>Iterator pointing to the first element in the FlatHashMap.</returns>
+		Iterator begin();
+		/// <summary>
+		/// Returns a FlatHashMap ConstIterator that points to the first element in the FlatHashMap.
+		/// </summary>
+		/// <returns>ConstIterator pointing to the first element in the FlatHashMap.</returns>
+		ConstIterator begin() const;
+		/// <summary>
+		/// Returns a FlatHashMap ConstIterator that points to the first element in the FlatHashMap. This version is for use on a non-const FlatHashMap.
+		/// </summary>
+		/// <returns>ConstIterator pointing to the first element in the FlatHashMap.</returns>
+		ConstIterator cbegin() const;
+		/// <summary>
+		/// Returns a FlatHashMap Iterator that points to one past the last element in the FlatHashMap.
+		/// </summary>
+		/// <returns>Iterator that points to one past the last element in the FlatHashMap.</returns>
+		Iterator end();
+		/// <summary>
+		/// Returns a FlatHashMap ConstIterator that points to one past the last element in the FlatHashMap.
+		/// </summary>
+		/// <returns>ConstIterator that points to one past the last element in the FlatHashMap.</returns>
+		ConstIterator end() const;
+		/// <summary>
+		/// Returns a FlatHashMap ConstIterator that points to one past the last element in the FlatHashMap. This version is for use on a non-const FlatHashMap.
+		/// </summary>
+		/// <returns>ConstIterator that points to one past the last element in the FlatHashMap.</returns>
+		ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// Bit masks of the slots in a group of GroupWidth control bytes that match a given condition. Bit i represents slot i of the group.
+		/// </summary>
+		static std::uint32_t MatchGroup(const ControlType* group, ControlType value);
+		static std::uint32_t MatchEmpty(const ControlType* group);
+		static std::uint32_t MatchEmptyOrDeleted(const ControlType* group);
+
+		/// <summary>
+		/// Splits a hash into the part used to choose the starting group (H1) and the seven bits stored in the control byte (H2).
+		/// </summary>
+		static size_t H1(size_t hash);
+		static ControlType H2(size_t hash);
+
+		/// <summary>
+		/// Smallest legal capacity (a power of two, at least GroupWidth) that can hold count elements without exceeding the maximum load factor.
+		/// </summary>
+		static size_t CapacityFor(size_t count);
+		/// <summary>
+		/// The number of elements that can be stored in the given capacity before a rehash is required.
+		/// </summary>
+		static size_t MaxLoadFor(size_t capacity);
+
+		/// <summary>
+		/// Finds the slot index of the given key, which is a TKey or a type the transparent policies accept. Returns the capacity if the key is not present.
+		/// </summary>
+		template <typename TLookup>
+		size_t FindIndex(const TLookup& key, size_t hash) const;
+		/// <summary>
+		/// Finds the first empty or deleted slot along the probe sequence of the given hash.
+		/// </summary>
+		size_t FindInsertIndex(size_t hash) const;
+		/// <summary>
+		/// Shared implementation of Insert, TryEmplace and Emplace. Looks key up and, only if it is missing, grows the table when needed
+		/// and constructs a PairType from pairArgs in the slot it belongs in.
+		/// </summary>
+		template <typename... TArgs>
+		std::pair<Iterator, bool> InsertHashed(const TKey& key, size_t hash, TArgs&&... pairArgs);
+		/// <summary>
+		/// Finds the index of the first occupied slot at or after the given index. Returns the capacity if there is none.
+		/// </summary>
+		size_t NextOccupied(size_t index) const;
+
+		/// <summary>
+		/// Allocates an empty slot and control array of the given capacity. Does not free the existing arrays.
+		/// </summary>
+		void Allocate(size_t capacity);
+		/// <summary>
+		/// Destructs every pair and frees the slot and control arrays.
+		/// </summary>
+		void Release();
+		/// <summary>
+		/// Moves every pair into a newly allocated slot array of the given capacity.
+		/// </summary>
+		void Rehash(size_t capacity);
+		/// <summary>
+		/// Returns a slot and control array to the allocator. The slots must hold no live pairs.
+		/// </summary>
+		void Free(ControlType* control, PairType* slots, size_t capacity);
+
+		/// <summary>
+		/// One control byte per slot. Empty, Deleted, or the H2 bits of the hash of the key stored in the slot.
+		/// </summary>
+		ControlType* _control{ nullptr };
+		/// <summary>
+		/// The inline storage for every pair. Only slots with a non-negative control byte hold a constructed pair.
+		/// </summary>
+		PairType* _slots{ nullptr };
+		/// <summary>
+		/// The number of slots. Always zero or a power of two that is at least GroupWidth.
+		/// </summary>
+		size_t _capacity{ 0 };
+		/// <summary>
+		/// The number of elements currently inserted into the FlatHashMap.
+		/// </summary>
+		size_t _size{ 0 };
+		/// <summary>
+		/// The number of empty slots that can still be filled before a rehash is required. Deleted slots do not count towards it.
+		/// </summary>
+		size_t _growthLeft{ 0 };
+		/// <summary>
+		/// The function object that provides a function for hashing keys.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS HashFunctor _hashFunctor;
+		/// <summary>
+		/// The function object that provides a function for determining equality between two items.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS EqualityFunctor _equalityFunctor;
+		/// <summary>
+		/// The allocator the slot and control arrays come from.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TAllocator _allocator;
+	};
+
+	/// <summary>
+	/// FlatHashMap whose hash and equality are supplied at runtime as std::function objects.
+	/// </summary>
+	template<typename TKey, typename TValue>
+	using DynamicFlatHashMap = FlatHashMap<TKey, TValue, DynamicHash<TKey>, DynamicEquality<TKey>>;
+}
+
+#include "FlatHashMap.inl"
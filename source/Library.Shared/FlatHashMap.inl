@@ -0,0 +1,749 @@
+#include "FlatHashMap.h"
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <tuple>
+#include <cassert>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace FIEAGameEngine
+{
+#pragma region Iterator
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::Iterator(FlatHashMap& owner, size_t index) :
+		_owner(&owner), _index(index)
+	{
+
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator==(const Iterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator!=(const Iterator& other) const
+	{
+		return _owner != other._owner || _index != other._index;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator++()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated hashmap.");
+		}
+
+		if (_index < _owner->_capacity)
+		{
+			_index = _owner->NextOccupied(_index + 1);
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator++(int)
+	{
+		Iterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::PairType& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator*() const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated hashmap.");
+		}
+		if (_index >= _owner->_capacity)
+		{
+			throw std::runtime_error("Iterator slot is out of bounds.");
+		}
+
+		return _owner->_slots[_index];
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::PairType* FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator->() const
+	{
+		return &(operator*());
+	}
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::ConstIterator(const FlatHashMap& owner, size_t index) :
+		_owner(&owner), _index(index)
+	{
+
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
+		_owner(other._owner), _index(other._index)
+	{
+
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return _owner != other._owner || _index != other._index;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator++()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated hashmap.");
+		}
+
+		if (_index < _owner->_capacity)
+		{
+			_index = _owner->NextOccupied(_index + 1);
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::PairType& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator*() const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated hashmap.");
+		}
+		if (_index >= _owner->_capacity)
+		{
+			throw std::runtime_error("Iterator slot is out of bounds.");
+		}
+
+		return _owner->_slots[_index];
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::PairType* FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator->() const
+	{
+		return &(operator*());
+	}
+#pragma endregion ConstIterator
+
+#pragma region Group
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline std::uint32_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::MatchGroup(const ControlType* group, ControlType value)
+	{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+		const __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(control, _mm_set1_epi8(value))));
+#else
+		std::uint32_t mask = 0;
+		for (size_t i = 0; i < GroupWidth; ++i)
+		{
+			mask |= static_cast<std::uint32_t>(group[i] == value) << i;
+		}
+		return mask;
+#endif
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline std::uint32_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::MatchEmpty(const ControlType* group)
+	{
+		return MatchGroup(group, Empty);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline std::uint32_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::MatchEmptyOrDeleted(const ControlType* group)
+	{
+		// Occupied slots store 0-127, so Empty and Deleted are the only negative control bytes.
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+		const __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(control));
+#else
+		std::uint32_t mask = 0;
+		for (size_t i = 0; i < GroupWidth; ++i)
+		{
+			mask |= static_cast<std::uint32_t>(group[i] < 0) << i;
+		}
+		return mask;
+#endif
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::H1(size_t hash)
+	{
+		return hash >> 7;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ControlType FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::H2(size_t hash)
+	{
+		return static_cast<ControlType>(hash & 0x7F);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::CapacityFor(size_t count)
+	{
+		size_t capacity = GroupWidth;
+		while (MaxLoadFor(capacity) < count)
+		{
+			capacity *= 2;
+		}
+		return capacity;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::MaxLoadFor(size_t capacity)
+	{
+		return capacity - capacity / 8;
+	}
+#pragma endregion Group
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::FlatHashMap(size_t size, HashFunctor hFunctor, EqualityFunctor eqFunctor, TAllocator allocator) :
+		_hashFunctor(hFunctor), _equalityFunctor(eqFunctor), _allocator(allocator)
+	{
+		if (size == 0_z)
+		{
+			throw std::runtime_error("HashMap cannot have a size of 0.");
+		}
+		Allocate(std::bit_ceil(std::max(size, GroupWidth)));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::FlatHashMap(const FlatHashMap& other) :
+		_hashFunctor(other._hashFunctor), _equalityFunctor(other._equalityFunctor), _allocator(other._allocator)
+	{
+		Allocate(other._capacity);
+		for (size_t i = other.NextOccupied(0); i < other._capacity; i = other.NextOccupied(i + 1))
+		{
+			new(_slots + i)PairType(other._slots[i]);
+		}
+		if (_capacity > 0_z)
+		{
+			// Deleted markers are copied too, since probe sequences for the copied pairs may run through them.
+			std::memcpy(_control, other._control, _capacity);
+		}
+		_size = other._size;
+		_growthLeft = other._growthLeft;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::FlatHashMap(FlatHashMap&& other) noexcept :
+		_control(other._control), _slots(other._slots), _capacity(other._capacity), _size(other._size), _growthLeft(other._growthLeft),
+		_hashFunctor(other._hashFunctor), _equalityFunctor(other._equalityFunctor), _allocator(other._allocator)
+	{
+		other._control = nullptr;
+		other._slots = nullptr;
+		other._capacity = 0_z;
+		other._size = 0_z;
+		other._growthLeft = 0_z;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::FlatHashMap(std::initializer_list<PairType> list) :
+		FlatHashMap(list, HashFunctor{}, EqualityFunctor{})
+	{
+
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::FlatHashMap(std::initializer_list<PairType> list, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
+		FlatHashMap(CapacityFor(list.size()), hashFunctor, equalityFunctor)
+	{
+		for (const auto& pair : list)
+		{
+			Insert(pair);
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::operator=(const FlatHashMap& other)
+	{
+		if (this != &other)
+		{
+			Release();
+
+			_hashFunctor = other._hashFunctor;
+			_equalityFunctor = other._equalityFunctor;
+			_allocator = other._allocator;
+
+			Allocate(other._capacity);
+			for (size_t i = other.NextOccupied(0); i < other._capacity; i = other.NextOccupied(i + 1))
+			{
+				new(_slots + i)PairType(other._slots[i]);
+			}
+			if (_capacity > 0_z)
+			{
+				std::memcpy(_control, other._control, _capacity);
+			}
+			_size = other._size;
+			_growthLeft = other._growthLeft;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::operator=(FlatHashMap&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Release();
+
+			_control = other._control;
+			_slots = other._slots;
+			_capacity = other._capacity;
+			_size = other._size;
+			_growthLeft = other._growthLeft;
+			_hashFunctor = other._hashFunctor;
+			_equalityFunctor = other._equalityFunctor;
+			_allocator = other._allocator;
+
+			other._control = nullptr;
+			other._slots = nullptr;
+			other._capacity = 0_z;
+			other._size = 0_z;
+			other._growthLeft = 0_z;
+		}
+
+		return *this;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::~FlatHashMap()
+	{
+		Release();
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline TValue& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::operator[](const TKey& key)
+	{
+		return TryEmplace(key).first->second;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TKey& key)
+	{
+		return Iterator(*this, FindIndex(key, _hashFunctor(key)));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TKey& key) const
+	{
+		return ConstIterator(*this, FindIndex(key, _hashFunctor(key)));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TKey& key, size_t hash)
+	{
+		return Iterator(*this, FindIndex(key, hash));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TKey& key, size_t hash) const
+	{
+		return ConstIterator(*this, FindIndex(key, hash));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TLookup& key)
+	{
+		return Iterator(*this, FindIndex(key, _hashFunctor(key)));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TLookup& key) const
+	{
+		return ConstIterator(*this, FindIndex(key, _hashFunctor(key)));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TLookup& key, size_t hash)
+	{
+		return Iterator(*this, FindIndex(key, hash));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TLookup& key, size_t hash) const
+	{
+		return ConstIterator(*this, FindIndex(key, hash));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Hash(const TKey& key) const
+	{
+		return _hashFunctor(key);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Hash(const TLookup& key) const
+	{
+		return _hashFunctor(key);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Insert(const PairType& entry)
+	{
+		return InsertHashed(entry.first, _hashFunctor(entry.first), entry);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Insert(PairType&& entry)
+	{
+		return InsertHashed(entry.first, _hashFunctor(entry.first), std::move(entry));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename... TArgs>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::TryEmplace(const TKey& key, TArgs&&... args)
+	{
+		return InsertHashed(key, _hashFunctor(key), std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<TArgs>(args)...));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename... TArgs>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::TryEmplace(std::remove_const_t<TKey>&& key, TArgs&&... args)
+	{
+		return InsertHashed(key, _hashFunctor(key), std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<TArgs>(args)...));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename... TArgs>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Emplace(TArgs&&... args)
+	{
+		PairType entry(std::forward<TArgs>(args)...);
+		return InsertHashed(entry.first, _hashFunctor(entry.first), std::move(entry));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename... TArgs>
+	inline std::pair<typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::InsertHashed(const TKey& key, size_t hash, TArgs&&... pairArgs)
+	{
+		size_t index = FindIndex(key, hash);
+		if (index != _capacity)
+		{
+			return std::pair<Iterator, bool>(Iterator(*this, index), false);
+		}
+
+		if (_growthLeft == 0_z)
+		{
+			// Grow when live elements fill the table; otherwise the deleted slots are what is using it up, so rehash in place to reclaim them.
+			Rehash(_size + 1 > MaxLoadFor(_capacity) / 2 ? std::max(GroupWidth, _capacity * 2) : _capacity);
+		}
+
+		index = FindInsertIndex(hash);
+		if (_control[index] == Empty)
+		{
+			--_growthLeft;
+		}
+
+		new(_slots + index)PairType(std::forward<TArgs>(pairArgs)...);
+		_control[index] = H2(hash);
+		++_size;
+
+		return std::pair<Iterator, bool>(Iterator(*this, index), true);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Resize(size_t bucketSize)
+	{
+		Rehash(std::max(std::bit_ceil(std::max(bucketSize, GroupWidth)), CapacityFor(_size)));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Remove(const TKey& key)
+	{
+		const size_t index = FindIndex(key, _hashFunctor(key));
+		if (index == _capacity)
+		{
+			return;
+		}
+
+		_slots[index].~PairType();
+		--_size;
+
+		// A probe only continues past a group that has no empty slot. If this group already has one, no probe sequence runs through it,
+		// so the slot can go straight back to empty instead of becoming a tombstone.
+		const ControlType* group = _control + (index & ~(GroupWidth - 1));
+		if (MatchEmpty(group) != 0)
+		{
+			_control[index] = Empty;
+			++_growthLeft;
+		}
+		else
+		{
+			_control[index] = Deleted;
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Clear()
+	{
+		for (size_t i = NextOccupied(0); i < _capacity; i = NextOccupied(i + 1))
+		{
+			_slots[i].~PairType();
+		}
+
+		if (_capacity > 0_z)
+		{
+			std::memset(_control, Empty, _capacity);
+		}
+		_size = 0_z;
+		_growthLeft = MaxLoadFor(_capacity);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Size() const
+	{
+		return _size;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::IsEmpty() const
+	{
+		return _size == 0_z;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::BucketSize() const
+	{
+		return _capacity;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ContainsKey(const TKey& key) const
+	{
+		return FindIndex(key, _hashFunctor(key)) != _capacity;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline TValue& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::At(TKey key)
+	{
+		const size_t index = FindIndex(key, _hashFunctor(key));
+		if (index == _capacity)
+		{
+			throw std::runtime_error("Key has not inserted into the HashMap.");
+		}
+
+		return _slots[index].second;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const TValue& FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::At(TKey key) const
+	{
+		const size_t index = FindIndex(key, _hashFunctor(key));
+		if (index == _capacity)
+		{
+			throw std::runtime_error("Key has not inserted into the HashMap.");
+		}
+
+		return _slots[index].second;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::begin()
+	{
+		return Iterator(*this, NextOccupied(0));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::begin() const
+	{
+		return ConstIterator(*this, NextOccupied(0));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::cbegin() const
+	{
+		return ConstIterator(*this, NextOccupied(0));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::end()
+	{
+		return Iterator(*this, _capacity);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::end() const
+	{
+		return ConstIterator(*this, _capacity);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::cend() const
+	{
+		return ConstIterator(*this, _capacity);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::FindIndex(const TLookup& key, size_t hash) const
+	{
+		if (_size == 0_z)
+		{
+			return _capacity;
+		}
+
+		const ControlType h2 = H2(hash);
+		const size_t groupMask = _capacity / GroupWidth - 1;
+		size_t group = H1(hash) & groupMask;
+
+		// Triangular probing over groups visits every group exactly once when the group count is a power of two.
+		for (size_t probe = 1; probe <= groupMask + 1; ++probe)
+		{
+			const size_t groupStart = group * GroupWidth;
+			for (std::uint32_t mask = MatchGroup(_control + groupStart, h2); mask != 0; mask &= mask - 1)
+			{
+				const size_t index = groupStart + static_cast<size_t>(std::countr_zero(mask));
+				if (_equalityFunctor(_slots[index].first, key))
+				{
+					return index;
+				}
+			}
+
+			if (MatchEmpty(_control + groupStart) != 0)
+			{
+				break;
+			}
+
+			group = (group + probe) & groupMask;
+		}
+
+		return _capacity;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::FindInsertIndex(size_t hash) const
+	{
+		const size_t groupMask = _capacity / GroupWidth - 1;
+		size_t group = H1(hash) & groupMask;
+
+		for (size_t probe = 1; ; ++probe)
+		{
+			const size_t groupStart = group * GroupWidth;
+			const std::uint32_t mask = MatchEmptyOrDeleted(_control + groupStart);
+			if (mask != 0)
+			{
+				return groupStart + static_cast<size_t>(std::countr_zero(mask));
+			}
+
+			group = (group + probe) & groupMask;
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::NextOccupied(size_t index) const
+	{
+		while (index < _capacity && _control[index] < 0)
+		{
+			++index;
+		}
+		return index;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline TAllocator FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::GetAllocator() const
+	{
+		return _allocator;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Allocate(size_t capacity)
+	{
+		_capacity = capacity;
+		_size = 0_z;
+		_growthLeft = MaxLoadFor(capacity);
+
+		if (capacity == 0_z)
+		{
+			_control = nullptr;
+			_slots = nullptr;
+			return;
+		}
+
+		_control = reinterpret_cast<ControlType*>(_allocator.Allocate(sizeof(ControlType) * capacity, alignof(ControlType)));
+		_slots = reinterpret_cast<PairType*>(_allocator.Allocate(sizeof(PairType) * capacity, alignof(PairType)));
+		assert(_control != nullptr && _slots != nullptr);
+		std::memset(_control, Empty, capacity);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Release()
+	{
+		for (size_t i = NextOccupied(0); i < _capacity; i = NextOccupied(i + 1))
+		{
+			_slots[i].~PairType();
+		}
+
+		Free(_control, _slots, _capacity);
+		_control = nullptr;
+		_slots = nullptr;
+		_capacity = 0_z;
+		_size = 0_z;
+		_growthLeft = 0_z;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Rehash(size_t capacity)
+	{
+		ControlType* oldControl = _control;
+		PairType* oldSlots = _slots;
+		const size_t oldCapacity = _capacity;
+		const size_t size = _size;
+
+		Allocate(capacity);
+
+		for (size_t i = 0_z; i < oldCapacity; ++i)
+		{
+			if (oldControl[i] >= 0)
+			{
+				const size_t hash = _hashFunctor(oldSlots[i].first);
+				const size_t index = FindInsertIndex(hash);
+				new(_slots + index)PairType(std::move(oldSlots[i]));
+				_control[index] = H2(hash);
+				oldSlots[i].~PairType();
+			}
+		}
+
+		_size = size;
+		_growthLeft -= size;
+
+		Free(oldControl, oldSlots, oldCapacity);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void FlatHashMap<TKey, TValue, THash, TEquality, TAllocator>::Free(ControlType* control, PairType* slots, size_t capacity)
+	{
+		_allocator.Deallocate(control, sizeof(ControlType) * capacity, alignof(ControlType));
+		_allocator.Deallocate(slots, sizeof(PairType) * capacity, alignof(PairType));
+	}
+}
@@ -1,34 +1,74 @@
 #pragma once
 
+#include "Allocator.h"
+#include "ContainerStats.h"
 #include "DefaultHash.h"
 #include "DefaultIncrement.h"
 #include "DefaultEquality.h"
 #include "SList.h"
 #include "Vector.h"
-#include <functional>
 
 namespace FIEAGameEngine
 {
 	/// <summary>
 	/// A templated class for a HashMap. HashMap contains a Vector filled with SLists that contains TKey, TValue pairs.
 	/// Access to the HashMap is performed through hashing a key.
+	/// Once an Insert would push the load factor past MaxLoadFactor, the bucket count roughly doubles. The move to the larger
+	/// bucket vector is incremental: each Insert of a new key and each Remove relinks a few of the old buckets, and lookups consult whichever
+	/// vector still owns the key's bucket. Nodes are relinked rather than copied, so pointers to stored pairs survive growth.
+	/// Each node caches the full hash of its key, so relinking during growth and Merge never hashes a stored key again,
+	/// and a lookup only calls the equality policy on keys whose hash matches.
+	/// Nodes can be moved between HashMaps, or held on their own, with Extract and Insert(NodeHandle&&).
+	/// Iterators are invalidated by an Insert that adds a key, and by Remove. Find, At and inserting a key that is already present
+	/// never move nodes, so they are safe to call while iterating.
 	/// </summary>
 	/// <typeparam name="TKey">The templated type of the key which will be hashed to retrieve to location.</typeparam>
 	/// <typeparam name="TValue">The templated type of the value stored in the container.</typeparam>
+	/// <typeparam name="THash">Hash policy. Called directly, so a stateless policy inlines and takes no space in the HashMap. Use DynamicHash for a hash chosen at runtime.</typeparam>
+	/// <typeparam name="TEquality">Equality policy. Same rules as THash; use DynamicEquality for a comparison chosen at runtime.</typeparam>
+	/// <typeparam name="TAllocator">Allocator policy shared by the bucket Vector and the chain nodes. See DefaultAllocator.</typeparam>
 
-	template<typename TKey, typename TValue>
+	template<typename TKey, typename TValue, typename THash = DefaultHash<TKey>, typename TEquality = DefaultEquality<TKey>, typename TAllocator = DefaultAllocator>
 	class HashMap
 	{
 	public:
 		using PairType = std::pair<const TKey, TValue>;
-		using HashFunctor = std::function<std::size_t(const TKey& key)>;
-		using EqualityFunctor = std::function<bool(const TKey& lhs, const TKey& rhs)>;
+		using HashFunctor = THash;
+		using EqualityFunctor = TEquality;
 		using value_type = PairType;
 	private:
-		using ChainType = SList<PairType>;
-		using BucketType = Vector<ChainType>;
+		/// <summary>
+		/// What each chain node holds: a pair and the full hash of its key.
+		/// </summary>
+		struct Entry final
+		{
+			/// <summary>
+			/// Constructs the pair in place from args.
+			/// </summary>
+			/// <param name="hash">The hash of the key the pair is constructed with.</param>
+			/// <param name="args">Arguments forwarded to the constructor of PairType.</param>
+			template <typename... TArgs>
+			explicit Entry(size_t hash, TArgs&&... args);
+
+			/// <summary>
+			/// The full hash of _pair.first, before it is reduced to a bucket index.
+			/// </summary>
+			size_t _hash;
+			/// <summary>
+			/// The stored key and value.
+			/// </summary>
+			PairType _pair;
+		};
+
+		using ChainType = SList<Entry, TAllocator>;
+		using BucketType = Vector<ChainType, TAllocator>;
 		using ChainIteratorType = typename ChainType::Iterator;
 		using ConstChainIteratorType = typename ChainType::ConstIterator;
+		/// <summary>
+		/// Enables the heterogeneous lookup overloads for TLookup when both policies are transparent and TLookup is not TKey itself.
+		/// </summary>
+		template <typename TLookup>
+		using EnableIfTransparent = std::enable_if_t<IsTransparent<THash, TEquality>::value && !std::is_same_v<TLookup, std::remove_const_t<TKey>>>;
 
 
 	public:
@@ -245,14 +285,93 @@ namespace FIEAGameEngine
 			ConstChainIteratorType _constChainIt;
 		};
 
+		/// <summary>
+		/// Owns one entry that is not in any HashMap. Extract moves a node out of a HashMap into a NodeHandle and Insert(NodeHandle&&) links it
+		/// into a HashMap again, so an entry can be moved between HashMaps, or rekeyed by extracting and reinserting it, without being copied or reallocated.
+		/// A NodeHandle can only be inserted into a HashMap whose allocator is equal to the one it was extracted from, and whose hash policy hashes keys the same way.
+		/// </summary>
+		class NodeHandle final
+		{
+			friend HashMap;
+
+		public:
+			/// <summary>
+			/// Creates an empty NodeHandle.
+			/// </summary>
+			NodeHandle() = default;
+			NodeHandle(const NodeHandle&) = delete;
+			/// <summary>
+			/// Takes the entry other owns, leaving other empty.
+			/// </summary>
+			/// <param name="other">The NodeHandle being moved from.</param>
+			NodeHandle(NodeHandle&& other) noexcept = default;
+			NodeHandle& operator=(const NodeHandle&) = delete;
+			/// <summary>
+			/// Destroys the entry this NodeHandle owns, if any, and takes the one other owns.
+			/// </summary>
+			/// <param name="other">The NodeHandle being moved from.</param>
+			/// <returns>Reference to this NodeHandle.</returns>
+			NodeHandle& operator=(NodeHandle&& other) noexcept = default;
+			/// <summary>
+			/// Destroys the entry this NodeHandle owns, if any.
+			/// </summary>
+			~NodeHandle() = default;
+
+			/// <summary>
+			/// Determines if this NodeHandle owns no entry.
+			/// </summary>
+			/// <returns>True if there is no entry.</returns>
+			bool IsEmpty() const;
+			/// <summary>
+			/// Provides the key of the owned entry.
+			/// </summary>
+			/// <returns>The key.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the NodeHandle is empty.</exception>
+			const TKey& Key() const;
+			/// <summary>
+			/// Provides the value of the owned entry.
+			/// </summary>
+			/// <returns>A mutable reference to the value.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the NodeHandle is empty.</exception>
+			TValue& Value();
+			/// <summary>
+			/// Provides the value of the owned entry. Invoked against a const NodeHandle.
+			/// </summary>
+			/// <returns>An immutable reference to the value.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the NodeHandle is empty.</exception>
+			const TValue& Value() const;
+
+		private:
+			/// <summary>
+			/// Creates an empty NodeHandle whose list uses allocator, so the node spliced into it can later be freed through it.
+			/// </summary>
+			/// <param name="allocator">The allocator of the HashMap the node comes from.</param>
+			explicit NodeHandle(TAllocator allocator);
+
+			/// <summary>
+			/// A list holding the owned node, or empty.
+			/// </summary>
+			ChainType _chain;
+		};
+
+		/// <summary>
+		/// Size of one chain node, for sizing a NodePool for this HashMap.
+		/// </summary>
+		static constexpr size_t NodeSize = ChainType::NodeSize;
+		/// <summary>
+		/// Alignment of one chain node, for sizing a NodePool for this HashMap.
+		/// </summary>
+		static constexpr size_t NodeAlignment = ChainType::NodeAlignment;
+
 		/// <summary>
 		/// Creates a new instance of HashMap. Allows user to provide custom size, hash functor, and equality functor.
 		/// </summary>
 		/// <param name="size">The amount of buckets in the vector.</param>
 		/// <param name="hFunctor">The function object that provides a function for hashing keys.</param>
 		/// <param name="eqFunctor">The function object that provides a function for determining equality between two items.</param>
+		/// <param name="allocator">The allocator the table's memory comes from.</param>
 		/// <exception cref="std::runtime_error">Thrown when the HashMap size is 0.</exception>
-		explicit HashMap(size_t size = 11_z, HashFunctor hFunctor = DefaultHash<TKey>{}, EqualityFunctor eqFunctor = DefaultEquality<TKey>{});
+		explicit HashMap(size_t size = 11_z, HashFunctor hFunctor = HashFunctor{}, EqualityFunctor eqFunctor = EqualityFunctor{}, TAllocator allocator = TAllocator{});
 
 		/// <summary>
 		/// Invokes the copy constructor. 
@@ -298,6 +417,7 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Using a key, searches for a TValue and returns a reference to that TValue. 
 		/// If the key cannot be found, a <TKey, TValue> pair is inserted where the TKey is the key provided and the TValue is default constructed. 
+		/// Nothing is constructed or copied when the key is already present.
 		/// </summary>
 		/// <param name="key">The key that you want to search on.</param>
 		/// <returns>Reference to the TValue at this spot in the HashMap.</returns>
@@ -315,6 +435,65 @@ namespace FIEAGameEngine
 		/// <param name="key">The key we are searching for.</param>
 		/// <returns>A HashMap Iterator pointing to that found element.</returns>
 		ConstIterator Find(const TKey& key) const;
+		/// <summary>
+		/// Searches using a hash already computed by Hash. Lets a caller that probes several HashMaps with the same key hash it once.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <param name="hash">The value Hash(key) returns.</param>
+		/// <returns>A HashMap Iterator pointing to that found element.</returns>
+		Iterator Find(const TKey& key, size_t hash);
+		/// <summary>
+		/// Searches using a hash already computed by Hash. Invoked against a const HashMap.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <param name="hash">The value Hash(key) returns.</param>
+		/// <returns>A HashMap ConstIterator pointing to that found element.</returns>
+		ConstIterator Find(const TKey& key, size_t hash) const;
+		/// <summary>
+		/// Searches for a key of another type without constructing a TKey, e.g. a std::string_view or const char* in a std::string keyed HashMap.
+		/// Only available when both policies are transparent.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <returns>A HashMap Iterator pointing to that found element.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key);
+		/// <summary>
+		/// Searches for a key of another type without constructing a TKey. Invoked against a const HashMap.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <returns>A HashMap ConstIterator pointing to that found element.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key) const;
+		/// <summary>
+		/// Searches for a key of another type using a hash already computed by Hash.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <param name="hash">The value Hash(key) returns.</param>
+		/// <returns>A HashMap Iterator pointing to that found element.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key, size_t hash);
+		/// <summary>
+		/// Searches for a key of another type using a hash already computed by Hash. Invoked against a const HashMap.
+		/// </summary>
+		/// <param name="key">The key we are searching for.</param>
+		/// <param name="hash">The value Hash(key) returns.</param>
+		/// <returns>A HashMap ConstIterator pointing to that found element.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key, size_t hash) const;
+
+		/// <summary>
+		/// Hashes a key with this HashMap's hash policy, for use with the Find overloads that take a precomputed hash.
+		/// </summary>
+		/// <param name="key">The key to hash.</param>
+		/// <returns>The full hash of the key, before it is reduced to a bucket index.</returns>
+		size_t Hash(const TKey& key) const;
+		/// <summary>
+		/// Hashes a key of another type with this HashMap's hash policy. Only available when both policies are transparent.
+		/// </summary>
+		/// <param name="key">The key to hash.</param>
+		/// <returns>The full hash of the key, before it is reduced to a bucket index.</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		size_t Hash(const TLookup& key) const;
 
 		/// <summary>
 		/// Inserts an entry into the HashMap and returns a newly created HashMap Iterator pointing to the location where this entry was stored.
@@ -323,14 +502,106 @@ namespace FIEAGameEngine
 		/// <param name="entry">The pair of <TKey, TValue> that is being inserted into the list.</param>
 		/// <returns>A pair with 1) the Iterator pointing to the inserted element and 2) a bool representing whether the insert was successful (also whether the Iterator provided is valid).</returns>
 		std::pair<Iterator, bool> Insert(const PairType& entry);
+		/// <summary>
+		/// Moves an entry into the HashMap. If the HashMap already contains the key, entry is left untouched.
+		/// </summary>
+		/// <param name="entry">The pair of <TKey, TValue> that is being inserted into the list.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether the entry was inserted.</returns>
+		std::pair<Iterator, bool> Insert(PairType&& entry);
+		/// <summary>
+		/// Inserts key with a TValue constructed in place from args, unless the key is already present.
+		/// When it is, neither the key nor the arguments are copied or moved from, and no TValue is constructed.
+		/// </summary>
+		/// <param name="key">The key to insert.</param>
+		/// <param name="args">Arguments forwarded to the constructor of TValue.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether the entry was inserted.</returns>
+		template <typename... TArgs>
+		std::pair<Iterator, bool> TryEmplace(const TKey& key, TArgs&&... args);
+		/// <summary>
+		/// Moves key into the HashMap with a TValue constructed in place from args, unless the key is already present.
+		/// When it is, neither the key nor the arguments are moved from, and no TValue is constructed.
+		/// </summary>
+		/// <param name="key">The key to insert.</param>
+		/// <param name="args">Arguments forwarded to the constructor of TValue.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether the entry was inserted.</returns>
+		template <typename... TArgs>
+		std::pair<Iterator, bool> TryEmplace(std::remove_const_t<TKey>&& key, TArgs&&... args);
+		/// <summary>
+		/// Constructs a PairType from args directly in a chain node and links it into the HashMap.
+		/// The key is only known once the pair exists, so the pair is built before the lookup and destroyed again if the key is already present.
+		/// Prefer TryEmplace when the key is at hand.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the constructor of PairType.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether the entry was inserted.</returns>
+		template <typename... TArgs>
+		std::pair<Iterator, bool> Emplace(TArgs&&... args);
+		/// <summary>
+		/// Links the node a NodeHandle owns into the HashMap, unless its key is already present. Nothing is allocated, copied or hashed.
+		/// </summary>
+		/// <param name="node">The NodeHandle to take the node from. Left empty if the node was inserted, and untouched otherwise.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element, or end() if node is empty, and 2) whether the node was inserted.</returns>
+		std::pair<Iterator, bool> Insert(NodeHandle&& node);
+
+		/// <summary>
+		/// Unlinks the entry with the given key and hands it over in a NodeHandle. Nothing is copied or deallocated.
+		/// </summary>
+		/// <param name="key">The key of the entry to extract.</param>
+		/// <returns>A NodeHandle owning the entry, or an empty one if the key is not in the HashMap.</returns>
+		NodeHandle Extract(const TKey& key);
+		/// <summary>
+		/// Unlinks the entry an Iterator points to and hands it over in a NodeHandle. Nothing is copied or deallocated.
+		/// </summary>
+		/// <param name="it">Iterator pointing to the entry to extract. Invalidated, like every other Iterator to this HashMap.</param>
+		/// <returns>A NodeHandle owning the entry, or an empty one if it is end().</returns>
+		/// <exception cref="std::runtime_error">Thrown if it does not belong to this HashMap.</exception>
+		NodeHandle Extract(const Iterator& it);
+		/// <summary>
+		/// Moves every entry of other whose key is not in this HashMap into this one by relinking its node. Entries whose key is already present stay in other.
+		/// Keys are not hashed again, so other must hash keys the same way this HashMap does, and its allocator must be equal to this one's.
+		/// </summary>
+		/// <param name="other">The HashMap to take entries from.</param>
+		void Merge(HashMap& other);
 
 
 		/// <summary>
-		/// Resizes the HashMap to have a new number of buckets.
+		/// Resizes the HashMap to have a new number of buckets. Finishes any incremental resize in progress and relinks every node immediately.
 		/// </summary>
 		/// <param name="bucketSize">The amount of buckets that will be in the new HashMap.</param>
+		/// <exception cref="std::runtime_error">Thrown when bucketSize is 0.</exception>
 		void Resize(size_t bucketSize);
 
+		/// <summary>
+		/// Grows the HashMap up front so that expectedCount elements can be inserted without passing the max load factor.
+		/// Does nothing if the HashMap already has enough buckets.
+		/// </summary>
+		/// <param name="expectedCount">The number of elements the caller expects the HashMap to hold.</param>
+		void Reserve(size_t expectedCount);
+
+		/// <summary>
+		/// Provides the average number of elements per bucket.
+		/// </summary>
+		/// <returns>Size divided by BucketSize.</returns>
+		float LoadFactor() const;
+
+		/// <summary>
+		/// Provides the load factor past which an Insert starts growing the HashMap.
+		/// </summary>
+		/// <returns>The current max load factor.</returns>
+		float MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the load factor past which an Insert starts growing the HashMap. Does not resize on its own; the next Insert of a new key will.
+		/// </summary>
+		/// <param name="maxLoadFactor">The new max load factor.</param>
+		/// <exception cref="std::runtime_error">Thrown when maxLoadFactor is not greater than 0.</exception>
+		void SetMaxLoadFactor(float maxLoadFactor);
+
+		/// <summary>
+		/// Determines if an incremental resize is still moving chains from the old buckets into the new ones.
+		/// </summary>
+		/// <returns>True if some keys still live in the old buckets.</returns>
+		bool IsResizing() const;
+
 
 		/// <summary>
 		/// Removes an entry in the HashMap that matches with the key provided.
@@ -357,10 +628,21 @@ namespace FIEAGameEngine
 		bool IsEmpty() const;
 
 		/// <summary>
-		/// Provides the number of buckets currently in the HashMap.
+		/// Provides the number of buckets currently in the HashMap. While an incremental resize is in progress, this is the new bucket count.
 		/// </summary>
 		/// <returns>The size of the vector in the HashMap.</returns>
 		size_t BucketSize() const;
+		/// <summary>
+		/// Provides the allocator the buckets and nodes come from.
+		/// </summary>
+		/// <returns>A copy of the allocator.</returns>
+		TAllocator GetAllocator() const;
+		/// <summary>
+		/// Reports the memory the HashMap holds and the distribution of its chain lengths. Walks every bucket.
+		/// </summary>
+		/// <returns>The entry count, the bytes of the bucket vectors plus one NodeSize per entry, the size of the pairs alone, and the bucket statistics.
+		/// While an incremental resize is in progress the old buckets are counted too.</returns>
+		HashMapStats Stats() const;
 
 		/// <summary>
 		/// Determines if the key is in the HashMap.
@@ -418,23 +700,112 @@ namespace FIEAGameEngine
 
 
 	private:
+		/// <summary>
+		/// Number of chains across both bucket vectors. Iterator indices run over the old buckets first, then the new ones.
+		/// </summary>
+		/// <returns>The number of chains an Iterator can visit.</returns>
+		size_t ChainCount() const;
+		/// <summary>
+		/// Provides the chain at an Iterator index.
+		/// </summary>
+		/// <param name="index">Index in the range [0, ChainCount()).</param>
+		/// <returns>The chain in the old buckets if index is below the old bucket count, otherwise in the new buckets.</returns>
+		ChainType& Chain(size_t index);
+		/// <summary>
+		/// Provides the chain at an Iterator index. Invoked against a const HashMap.
+		/// </summary>
+		/// <param name="index">Index in the range [0, ChainCount()).</param>
+		/// <returns>The chain in the old buckets if index is below the old bucket count, otherwise in the new buckets.</returns>
+		const ChainType& Chain(size_t index) const;
+		/// <summary>
+		/// Finds the chain that owns a hash. Keys whose old bucket has not been migrated yet still live there.
+		/// </summary>
+		/// <param name="hash">The hash of the key being looked up or inserted.</param>
+		/// <returns>The Iterator index of the chain the key belongs in.</returns>
+		size_t ChainIndex(size_t hash) const;
+		/// <summary>
+		/// Shared implementation of every non-const Find overload.
+		/// </summary>
+		/// <param name="key">The key we are searching for. Either a TKey or a type the transparent policies accept.</param>
+		/// <param name="hash">The hash of key.</param>
+		/// <returns>A HashMap Iterator pointing to that found element.</returns>
+		template <typename TLookup>
+		Iterator FindHashed(const TLookup& key, size_t hash);
+		/// <summary>
+		/// Shared implementation of every const Find overload.
+		/// </summary>
+		/// <param name="key">The key we are searching for. Either a TKey or a type the transparent policies accept.</param>
+		/// <param name="hash">The hash of key.</param>
+		/// <returns>A HashMap ConstIterator pointing to that found element.</returns>
+		template <typename TLookup>
+		ConstIterator FindHashed(const TLookup& key, size_t hash) const;
+		/// <summary>
+		/// Shared implementation of every Insert, TryEmplace, Emplace and Merge. Looks key up and, only if it is missing, grows the table when needed
+		/// and calls link to put the new node at the front of the key's chain.
+		/// </summary>
+		/// <param name="key">The key being inserted.</param>
+		/// <param name="hash">The hash of key.</param>
+		/// <param name="link">Callable taking the ChainType the key belongs in and returning a ChainIteratorType to the node it added at the front.</param>
+		/// <returns>A pair with 1) the Iterator pointing to the inserted or existing element and 2) whether link was called.</returns>
+		template <typename TLink>
+		std::pair<Iterator, bool> InsertHashed(const TKey& key, size_t hash, TLink link);
+		/// <summary>
+		/// Fills buckets, which must be empty, with count empty chains. Each chain is emplaced rather than copied from a prototype,
+		/// so a HashMap whose TValue cannot be copied can still be constructed and grown.
+		/// </summary>
+		/// <param name="buckets">The vector to fill.</param>
+		/// <param name="count">The number of chains.</param>
+		static void CreateChains(BucketType& buckets, size_t count);
+		/// <summary>
+		/// Starts an incremental resize. The current buckets become the old buckets and an empty vector of roughly twice the size takes their place.
+		/// </summary>
+		void BeginGrowth();
+		/// <summary>
+		/// Relinks the nodes of up to count old buckets into the new buckets. Releases the old buckets once every one has been moved.
+		/// </summary>
+		/// <param name="count">The maximum number of old buckets to move.</param>
+		void MigrateBuckets(size_t count);
+
+		/// <summary>
+		/// Number of old buckets moved by each Insert of a new key and each Remove during an incremental resize.
+		/// </summary>
+		inline static const size_t MigrationStep = 4_z;
+
 		/// <summary>
 		/// The vector that contains all the chains for the HashMap.
 		/// </summary>
 		BucketType _buckets;
 		/// <summary>
+		/// The buckets being drained during an incremental resize. Empty when no resize is in progress.
+		/// </summary>
+		BucketType _oldBuckets;
+		/// <summary>
+		/// Old buckets below this index have already been moved into _buckets.
+		/// </summary>
+		size_t _migrationIndex{ 0 };
+		/// <summary>
 		/// The number of elements currently inserted into the HashMap.
 		/// </summary>
 		size_t _size{ 0 };
 		/// <summary>
+		/// Load factor past which an Insert starts growing the HashMap.
+		/// </summary>
+		float _maxLoadFactor{ 1.0f };
+		/// <summary>
 		/// The function object that provides a function for hashing keys.
 		/// </summary>
-		HashFunctor _hashFunctor;
+		FIEA_NO_UNIQUE_ADDRESS HashFunctor _hashFunctor;
 		/// <summary>
 		/// The function object that provides a function for determining equality between two items.
 		/// </summary>
-		EqualityFunctor _equalityFunctor;
+		FIEA_NO_UNIQUE_ADDRESS EqualityFunctor _equalityFunctor;
 	};
+
+	/// <summary>
+	/// HashMap whose hash and equality are supplied at runtime as std::function objects.
+	/// </summary>
+	template<typename TKey, typename TValue>
+	using DynamicHashMap = HashMap<TKey, TValue, DynamicHash<TKey>, DynamicEquality<TKey>>;
 }
 
 #include "HashMap.inl"
\ No newline at end of file
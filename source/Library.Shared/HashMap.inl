@@ -1,48 +1,62 @@
 #include "HashMap.h"
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <utility>
 
 namespace FIEAGameEngine
 {
+#pragma region Entry
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename... TArgs>
+	inline HashMap<TKey, TValue, THash, TEquality, TAllocator>::Entry::Entry(size_t hash, TArgs&&... args) :
+		_hash(hash), _pair(std::forward<TArgs>(args)...)
+	{
+
+	}
+#pragma endregion Entry
+
 #pragma region Iterator
-	template<typename TKey, typename TValue>
-	inline HashMap<TKey, TValue>::Iterator::Iterator(HashMap& owner, size_t index, const ChainIteratorType& chainIt) :
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::Iterator(HashMap& owner, size_t index, const ChainIteratorType& chainIt) :
 		_owner(&owner), _index(index), _chainIt(chainIt)
 	{
 
 	}
 
-	template<typename TKey, typename TValue>
-	inline bool HashMap<TKey, TValue>::Iterator::operator==(const Iterator& other) const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator==(const Iterator& other) const
 	{
 		return !(operator!=(other));
 	}
-	template<typename TKey, typename TValue>
-	inline bool HashMap<TKey, TValue>::Iterator::operator!=(const Iterator& other) const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		return _owner != other._owner || _index != other._index || _chainIt != other._chainIt;
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::Iterator& HashMap<TKey, TValue>::Iterator::operator++()
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator& HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator++()
 	{
 		if (_owner == nullptr)
 		{
 			throw std::runtime_error("Unassociated hashmap.");
 		}
 
-		if (_index < _owner->BucketSize())
+		if (_index < _owner->ChainCount())
 		{
 			_chainIt++;
-			if(_chainIt == _owner->_buckets[_index].end())
+			if(_chainIt == _owner->Chain(_index).end())
 			{
-				for (_index += 1; _index < _owner->BucketSize(); ++_index)
+				for (_index += 1; _index < _owner->ChainCount(); ++_index)
 				{
-					if (!_owner->_buckets[_index].IsEmpty())
+					if (!_owner->Chain(_index).IsEmpty())
 					{
-						_chainIt = _owner->_buckets[_index].begin();
+						_chainIt = _owner->Chain(_index).begin();
 						break;
 					}
 				}
-				if (_index == _owner->BucketSize())
+				if (_index == _owner->ChainCount())
 				{
 					_chainIt = ChainIteratorType();
 				}
@@ -52,42 +66,42 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::Iterator::operator++(int)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator temp(*this);
 		operator++();
 		return temp;
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::PairType& HashMap<TKey, TValue>::Iterator::operator*() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::PairType& HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator*() const
 	{
 		if (_owner == nullptr)
 		{
 			throw std::runtime_error("Unassociated hashmap.");
 		}
-		if (_index >= _owner->BucketSize())
+		if (_index >= _owner->ChainCount())
 		{
 			throw std::runtime_error("Iterator bucket is out of bounds.");
 		}
 
-		return (*_chainIt);
+		return (*_chainIt)._pair;
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::PairType* HashMap<TKey, TValue>::Iterator::operator->() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::PairType* HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator::operator->() const
 	{
 		if (_owner == nullptr)
 		{
 			throw std::runtime_error("Unassociated hashmap.");
 		}
-		if (_index >= _owner->BucketSize())
+		if (_index >= _owner->ChainCount())
 		{
 			throw std::runtime_error("Iterator bucket is out of bounds.");
 		}
 
-		return &(*_chainIt);
+		return &(*_chainIt)._pair;
 	}
 
 
@@ -95,54 +109,54 @@ namespace FIEAGameEngine
 
 #pragma region ConstIterator
 
-	template<typename TKey, typename TValue>
-	inline HashMap<TKey, TValue>::ConstIterator::ConstIterator(const HashMap& owner, size_t index, const ConstChainIteratorType& constChainIt) :
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::ConstIterator(const HashMap& owner, size_t index, const ConstChainIteratorType& constChainIt) :
 		_owner(&owner), _index(index), _constChainIt(constChainIt)
 	{
 
 	}
 
-	template<typename TKey, typename TValue>
-	inline HashMap<TKey, TValue>::ConstIterator::ConstIterator(const Iterator& other) :
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
 		_owner(other._owner), _index(other._index)
 	{
 
 	}
 
-	template<typename TKey, typename TValue>
-	inline bool HashMap<TKey, TValue>::ConstIterator::operator==(const ConstIterator& other) const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template<typename TKey, typename TValue>
-	inline bool HashMap<TKey, TValue>::ConstIterator::operator!=(const ConstIterator& other) const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return _owner != other._owner || _index != other._index;
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::ConstIterator& HashMap<TKey, TValue>::ConstIterator::operator++()
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator& HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator++()
 	{
 		if (_owner == nullptr)
 		{
 			throw std::runtime_error("Unassociated hashmap.");
 		}
 
-		if (_index < _owner->BucketSize())
+		if (_index < _owner->ChainCount())
 		{
 			_constChainIt++;
-			if (_constChainIt == _owner->_buckets[_index].end())
+			if (_constChainIt == _owner->Chain(_index).end())
 			{
-				for (_index += 1; _index < _owner->BucketSize(); ++_index)
+				for (_index += 1; _index < _owner->ChainCount(); ++_index)
 				{
-					if (!_owner->_buckets[_index].IsEmpty())
+					if (!_owner->Chain(_index).IsEmpty())
 					{
-						_constChainIt = _owner->_buckets[_index].begin();
+						_constChainIt = _owner->Chain(_index).begin();
 						break;
 					}
 				}
-				if (_index == _owner->BucketSize())
+				if (_index == _owner->ChainCount())
 				{
 					_constChainIt = ConstChainIteratorType();
 				}
@@ -152,67 +166,110 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::ConstIterator::operator++(int)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp(*this);
 		operator++();
 		return temp;
 	}
 
-	template<typename TKey, typename TValue>
-	inline const typename HashMap<TKey, TValue>::PairType& HashMap<TKey, TValue>::ConstIterator::operator*() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::PairType& HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator*() const
 	{
 		if (_owner == nullptr)
 		{
 			throw std::runtime_error("Unassociated hashmap.");
 		}
-		if (_index >= _owner->BucketSize())
+		if (_index >= _owner->ChainCount())
 		{
 			throw std::runtime_error("Iterator bucket is out of bounds.");
 		}
 
-		return (*_constChainIt);
+		return (*_constChainIt)._pair;
 	}
 
-	template<typename TKey, typename TValue>
-	inline const typename HashMap<TKey, TValue>::PairType* HashMap<TKey, TValue>::ConstIterator::operator->() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::PairType* HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator::operator->() const
 	{
 		if (_owner == nullptr)
 		{
 			throw std::runtime_error("Unassociated hashmap.");
 		}
-		if (_index >= _owner->BucketSize())
+		if (_index >= _owner->ChainCount())
 		{
 			throw std::runtime_error("Iterator bucket is out of bounds.");
 		}
 
-		return &(*_constChainIt);
+		return &(*_constChainIt)._pair;
 	}
 
 #pragma endregion ConstIterator
 
+#pragma region NodeHandle
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline HashMap<TKey, TValue, THash, TEquality, TAllocator>::NodeHandle::NodeHandle(TAllocator allocator) :
+		_chain(allocator)
+	{
+
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THash, TEquality, TAllocator>::NodeHandle::IsEmpty() const
+	{
+		return _chain.IsEmpty();
+	}
 
-	template<typename TKey, typename TValue>
-	inline HashMap<TKey, TValue>::HashMap(size_t size, HashFunctor hFunctor, EqualityFunctor eqFunctor) :
-		_hashFunctor(hFunctor), _equalityFunctor(eqFunctor)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const TKey& HashMap<TKey, TValue, THash, TEquality, TAllocator>::NodeHandle::Key() const
+	{
+		if (_chain.IsEmpty())
+		{
+			throw std::runtime_error("Empty node handle.");
+		}
+
+		return _chain.Front()._pair.first;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline TValue& HashMap<TKey, TValue, THash, TEquality, TAllocator>::NodeHandle::Value()
+	{
+		return const_cast<TValue&>(std::as_const(*this).Value());
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const TValue& HashMap<TKey, TValue, THash, TEquality, TAllocator>::NodeHandle::Value() const
+	{
+		if (_chain.IsEmpty())
+		{
+			throw std::runtime_error("Empty node handle.");
+		}
+
+		return _chain.Front()._pair.second;
+	}
+#pragma endregion NodeHandle
+
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline HashMap<TKey, TValue, THash, TEquality, TAllocator>::HashMap(size_t size, HashFunctor hFunctor, EqualityFunctor eqFunctor, TAllocator allocator) :
+		_buckets(0_z, allocator), _oldBuckets(0_z, allocator), _hashFunctor(hFunctor), _equalityFunctor(eqFunctor)
 	{
 		if (size == 0_z)
 		{
 			throw std::runtime_error("HashMap cannot have a size of 0.");
 		}
-		_buckets.Resize(size);
+		CreateChains(_buckets, size);
 	}
 
-	template<typename TKey, typename TValue>
-	inline HashMap<TKey, TValue>::HashMap(std::initializer_list<PairType> list) :
-		HashMap(list, DefaultHash<TKey>(), DefaultEquality<TKey>())
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline HashMap<TKey, TValue, THash, TEquality, TAllocator>::HashMap(std::initializer_list<PairType> list) :
+		HashMap(list, HashFunctor{}, EqualityFunctor{})
 	{
 
 	}
 
-	template<typename TKey, typename TValue>
-	inline HashMap<TKey, TValue>::HashMap(std::initializer_list<PairType> list, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline HashMap<TKey, TValue, THash, TEquality, TAllocator>::HashMap(std::initializer_list<PairType> list, HashFunctor hashFunctor, EqualityFunctor equalityFunctor) :
 		HashMap(list.size(), hashFunctor, equalityFunctor)
 	{
 		for (const auto& pair : list)
@@ -221,77 +278,219 @@ namespace FIEAGameEngine
 		}
 	}
 
-	template<typename TKey, typename TValue>
-	inline TValue& HashMap<TKey, TValue>::operator[](const TKey& key)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline TValue& HashMap<TKey, TValue, THash, TEquality, TAllocator>::operator[](const TKey& key)
 	{
-		auto [it, wasInserted] = Insert(std::make_pair(key, TValue()));
-		return it->second;
+		return TryEmplace(key).first->second;
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::Find(const TKey& key) 
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TKey& key)
 	{
-		size_t index = _hashFunctor(key) % BucketSize();
-		ChainIteratorType chainIt = _buckets[index].begin();
+		return FindHashed(key, _hashFunctor(key));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TKey& key) const
+	{
+		return FindHashed(key, _hashFunctor(key));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TKey& key, size_t hash)
+	{
+		return FindHashed(key, hash);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TKey& key, size_t hash) const
+	{
+		return FindHashed(key, hash);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TLookup& key)
+	{
+		return FindHashed(key, _hashFunctor(key));
+	}
 
-		for (; chainIt != _buckets[index].end(); chainIt++)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TLookup& key) const
+	{
+		return FindHashed(key, _hashFunctor(key));
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TLookup& key, size_t hash)
+	{
+		return FindHashed(key, hash);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::Find(const TLookup& key, size_t hash) const
+	{
+		return FindHashed(key, hash);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THash, TEquality, TAllocator>::Hash(const TKey& key) const
+	{
+		return _hashFunctor(key);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup, typename>
+	inline size_t HashMap<TKey, TValue, THash, TEquality, TAllocator>::Hash(const TLookup& key) const
+	{
+		return _hashFunctor(key);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator> 
+	inline std::pair<typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THash, TEquality, TAllocator>::Insert(const PairType& entry)
+	{
+		const size_t hash = _hashFunctor(entry.first);
+		return InsertHashed(entry.first, hash, [&entry, hash](ChainType& chain) { return chain.EmplaceFront(hash, entry); });
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline std::pair<typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THash, TEquality, TAllocator>::Insert(PairType&& entry)
+	{
+		const size_t hash = _hashFunctor(entry.first);
+		return InsertHashed(entry.first, hash, [&entry, hash](ChainType& chain) { return chain.EmplaceFront(hash, std::move(entry)); });
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename... TArgs>
+	inline std::pair<typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THash, TEquality, TAllocator>::TryEmplace(const TKey& key, TArgs&&... args)
+	{
+		const size_t hash = _hashFunctor(key);
+		return InsertHashed(key, hash, [&](ChainType& chain)
 		{
-			if (_equalityFunctor(chainIt->first, key))
-			{
-				break;
-			}
-		}
+			return chain.EmplaceFront(hash, std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<TArgs>(args)...));
+		});
+	}
 
-		if (chainIt == _buckets[index].end())
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename... TArgs>
+	inline std::pair<typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THash, TEquality, TAllocator>::TryEmplace(std::remove_const_t<TKey>&& key, TArgs&&... args)
+	{
+		const size_t hash = _hashFunctor(key);
+		return InsertHashed(key, hash, [&](ChainType& chain)
 		{
-			index = BucketSize();
-			chainIt = ChainIteratorType();
+			return chain.EmplaceFront(hash, std::piecewise_construct, std::forward_as_tuple(std::move(key)), std::forward_as_tuple(std::forward<TArgs>(args)...));
+		});
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename... TArgs>
+	inline std::pair<typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THash, TEquality, TAllocator>::Emplace(TArgs&&... args)
+	{
+		// The node is built in a list of its own and relinked, so the pair is never copied or moved once it exists.
+		ChainType staging(GetAllocator());
+		Entry& entry = *staging.EmplaceFront(0_z, std::forward<TArgs>(args)...);
+		entry._hash = _hashFunctor(entry._pair.first);
+		return InsertHashed(entry._pair.first, entry._hash, [&staging](ChainType& chain) { return chain.SpliceFront(staging); });
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline std::pair<typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THash, TEquality, TAllocator>::Insert(NodeHandle&& node)
+	{
+		if (node.IsEmpty())
+		{
+			return std::pair<Iterator, bool>(end(), false);
 		}
 
-		return Iterator(*this, index, chainIt);
+		const Entry& entry = node._chain.Front();
+		return InsertHashed(entry._pair.first, entry._hash, [&node](ChainType& chain) { return chain.SpliceFront(node._chain); });
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::NodeHandle HashMap<TKey, TValue, THash, TEquality, TAllocator>::Extract(const TKey& key)
+	{
+		return Extract(Find(key));
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::Find(const TKey& key) const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::NodeHandle HashMap<TKey, TValue, THash, TEquality, TAllocator>::Extract(const Iterator& it)
 	{
-		size_t index = _hashFunctor(key) % BucketSize();
-		ConstChainIteratorType chainIt = _buckets[index].begin();
+		if (it._owner != this)
+		{
+			throw std::runtime_error("Unassociated hashmap.");
+		}
 
-		for (; chainIt != _buckets[index].end(); chainIt++)
+		NodeHandle node(GetAllocator());
+		if (it._index < ChainCount())
 		{
-			if (_equalityFunctor((*chainIt).first, key))
-			{
-				break;
-			}
+			node._chain.SpliceFront(Chain(it._index), it._chainIt);
+			--_size;
 		}
+		return node;
+	}
 
-		if (chainIt == _buckets[index].end())
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::Merge(HashMap& other)
+	{
+		if (&other == this)
 		{
-			index = BucketSize();
-			chainIt = ConstChainIteratorType();
+			return;
 		}
 
-		return ConstIterator(*this, index, chainIt);
+		ChainType kept(other.GetAllocator());
+		for (size_t index = 0_z; index < other.ChainCount(); ++index)
+		{
+			// Every node leaves the chain: either into this HashMap, or into kept and then back again.
+			ChainType& chain = other.Chain(index);
+			while (!chain.IsEmpty())
+			{
+				const Entry& entry = chain.Front();
+				if (InsertHashed(entry._pair.first, entry._hash, [&chain](ChainType& target) { return target.SpliceFront(chain); }).second)
+				{
+					--other._size;
+				}
+				else
+				{
+					kept.SpliceFront(chain);
+				}
+			}
+
+			while (!kept.IsEmpty())
+			{
+				chain.SpliceFront(kept);
+			}
+		}
 	}
 
-	template<typename TKey, typename TValue> 
-	inline std::pair<typename HashMap<TKey, TValue>::Iterator, bool> HashMap<TKey, TValue>::Insert(const PairType& entry)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLink>
+	inline std::pair<typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THash, TEquality, TAllocator>::InsertHashed(const TKey& key, size_t hash, TLink link)
 	{
-		size_t index = _hashFunctor(entry.first) % BucketSize();
-		ChainIteratorType chainIt = _buckets[index].begin();
+		size_t index = ChainIndex(hash);
+		ChainIteratorType chainIt = Chain(index).begin();
 
 		bool wasInserted = false;
-		for (; chainIt != _buckets[index].end(); chainIt++)
+		for (; chainIt != Chain(index).end(); chainIt++)
 		{
-			if (_equalityFunctor(chainIt->first, entry.first))
+			if (chainIt->_hash == hash && _equalityFunctor(chainIt->_pair.first, key))
 			{
 				break;
 			}
 		}
 
-		if (chainIt == _buckets[index].end())
+		if (chainIt == Chain(index).end())
 		{
-			chainIt = _buckets[index].PushFront(entry);
+			// Only an actual insertion moves buckets, so inserting a key that is already present leaves iterators valid.
+			MigrateBuckets(MigrationStep);
+			if (static_cast<float>(_size + 1) > _maxLoadFactor * static_cast<float>(BucketSize()))
+			{
+				BeginGrowth();
+			}
+			index = ChainIndex(hash);
+
+			chainIt = link(Chain(index));
 			++_size;
 			wasInserted = true;
 		}
@@ -300,68 +499,146 @@ namespace FIEAGameEngine
 		return std::pair<Iterator, bool>(hashMapIt, wasInserted);
 	}
 
-	template<typename TKey, typename TValue>
-	inline void HashMap<TKey, TValue>::Resize(size_t bucketSize)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::Resize(size_t bucketSize)
 	{
-		HashMap map(bucketSize, _hashFunctor, _equalityFunctor);
+		if (bucketSize == 0_z)
+		{
+			throw std::runtime_error("HashMap cannot have a size of 0.");
+		}
+
+		MigrateBuckets(_oldBuckets.Size());
+
+		BucketType buckets(0_z, GetAllocator());
+		CreateChains(buckets, bucketSize);
+		for (ChainType& chain : _buckets)
+		{
+			while (!chain.IsEmpty())
+			{
+				buckets[chain.Front()._hash % bucketSize].SpliceFront(chain);
+			}
+		}
+
+		_buckets = std::move(buckets);
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::Reserve(size_t expectedCount)
+	{
+		const size_t bucketSize = static_cast<size_t>(std::ceil(static_cast<float>(expectedCount) / _maxLoadFactor));
+		if (bucketSize > BucketSize())
+		{
+			Resize(bucketSize);
+		}
+	}
 
-		for (auto& item : *this)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline float HashMap<TKey, TValue, THash, TEquality, TAllocator>::LoadFactor() const
+	{
+		return static_cast<float>(_size) / static_cast<float>(BucketSize());
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline float HashMap<TKey, TValue, THash, TEquality, TAllocator>::MaxLoadFactor() const
+	{
+		return _maxLoadFactor;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::SetMaxLoadFactor(float maxLoadFactor)
+	{
+		if (!(maxLoadFactor > 0.0f))
 		{
-			map.Insert(std::move(item));
+			throw std::runtime_error("Max load factor must be greater than 0.");
 		}
 
-		*this = std::move(map);
+		_maxLoadFactor = maxLoadFactor;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THash, TEquality, TAllocator>::IsResizing() const
+	{
+		return !_oldBuckets.IsEmpty();
 	}
 
-	template<typename TKey, typename TValue>
-	inline void HashMap<TKey, TValue>::Remove(const TKey& key)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::Remove(const TKey& key)
 	{
+		MigrateBuckets(MigrationStep);
 		auto it = Find(key);
 
 		if (it != end())
 		{
-			_buckets[it._index].Remove(it._chainIt);
+			Chain(it._index).Remove(it._chainIt);
 			--_size;
 		}
 	}
 
-	template<typename TKey, typename TValue>
-	inline void HashMap<TKey, TValue>::Clear()
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::Clear()
 	{
 		for (ChainType& bucket : _buckets)
 		{
 			bucket.Clear();
 		}
 
+		_oldBuckets.Clear();
+		_oldBuckets.ShrinkToFit();
+		_migrationIndex = 0_z;
 		_size = 0;
 	}
 
-	template<typename TKey, typename TValue>
-	inline size_t HashMap<TKey, TValue>::Size() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THash, TEquality, TAllocator>::Size() const
 	{
 		return _size;
 	}
 
-	template<typename TKey, typename TValue>
-	inline bool HashMap<TKey, TValue>::IsEmpty() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THash, TEquality, TAllocator>::IsEmpty() const
 	{
 		return _size == 0;
 	}
 
-	template<typename TKey, typename TValue>
-	inline size_t HashMap<TKey, TValue>::BucketSize() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THash, TEquality, TAllocator>::BucketSize() const
 	{
 		return _buckets.Size();
 	}
 
-	template<typename TKey, typename TValue>
-	inline bool HashMap<TKey, TValue>::ContainsKey(const TKey& key) const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline TAllocator HashMap<TKey, TValue, THash, TEquality, TAllocator>::GetAllocator() const
+	{
+		return _buckets.GetAllocator();
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline HashMapStats HashMap<TKey, TValue, THash, TEquality, TAllocator>::Stats() const
+	{
+		HashMapStats stats;
+		stats._memory._elementCount = _size;
+		stats._memory._bytesAllocated = _buckets.Stats()._bytesAllocated + _oldBuckets.Stats()._bytesAllocated + _size * NodeSize;
+		stats._memory._bytesInUse = _size * sizeof(PairType);
+		stats._bucketCount = ChainCount();
+
+		for (size_t i = 0_z; i < ChainCount(); ++i)
+		{
+			const size_t length = Chain(i).Size();
+			stats._longestChain = std::max(stats._longestChain, length);
+			++stats._chainLengths[std::min(length, HashMapStats::HistogramSize - 1_z)];
+		}
+		stats._emptyBucketCount = stats._chainLengths[0];
+		return stats;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THash, TEquality, TAllocator>::ContainsKey(const TKey& key) const
 	{
 		return !(Find(key) == end());
 	}
 
-	template<typename TKey, typename TValue>
-	inline TValue& HashMap<TKey, TValue>::At(TKey key)
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline TValue& HashMap<TKey, TValue, THash, TEquality, TAllocator>::At(TKey key)
 	{
 		Iterator it = Find(key);
 		if (it == end())
@@ -373,8 +650,8 @@ namespace FIEAGameEngine
 
 	}
 
-	template<typename TKey, typename TValue>
-	inline const TValue& HashMap<TKey, TValue>::At(TKey key) const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const TValue& HashMap<TKey, TValue, THash, TEquality, TAllocator>::At(TKey key) const
 	{
 		ConstIterator it = Find(key);
 		if (it == end())
@@ -386,63 +663,191 @@ namespace FIEAGameEngine
 
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::begin()
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::begin()
 	{
-		for (size_t i = 0_z; i < BucketSize(); ++i)
+		for (size_t i = 0_z; i < ChainCount(); ++i)
 		{
-			if (!_buckets[i].IsEmpty())
+			if (!Chain(i).IsEmpty())
 			{
-				return Iterator(*this, i, _buckets[i].begin());
+				return Iterator(*this, i, Chain(i).begin());
 			}
 		}
 
 		return end();
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::begin() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::begin() const
 	{
-		for (size_t i = 0_z; i < BucketSize(); ++i)
+		for (size_t i = 0_z; i < ChainCount(); ++i)
 		{
-			if (!_buckets[i].IsEmpty())
+			if (!Chain(i).IsEmpty())
 			{
-				return ConstIterator(*this, i, _buckets[i].begin());
+				return ConstIterator(*this, i, Chain(i).begin());
 			}
 		}
 
 		return end();
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::cbegin() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::cbegin() const
 	{
-		for (size_t i = 0_z; i < BucketSize(); ++i)
+		for (size_t i = 0_z; i < ChainCount(); ++i)
 		{
-			if (!_buckets[i].IsEmpty())
+			if (!Chain(i).IsEmpty())
 			{
-				return ConstIterator(*this, i, _buckets[i].cbegin());
+				return ConstIterator(*this, i, Chain(i).cbegin());
 			}
 		}
 
 		return cend();
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::Iterator HashMap<TKey, TValue>::end()
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::end()
+	{
+		return Iterator(*this, ChainCount(), ChainIteratorType());
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::end() const
+	{
+		return ConstIterator(*this, ChainCount(), ConstChainIteratorType());
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::cend() const
+	{
+		return ConstIterator(*this, ChainCount(), ConstChainIteratorType());
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THash, TEquality, TAllocator>::ChainCount() const
+	{
+		return _oldBuckets.Size() + _buckets.Size();
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ChainType& HashMap<TKey, TValue, THash, TEquality, TAllocator>::Chain(size_t index)
+	{
+		return (index < _oldBuckets.Size()) ? _oldBuckets[index] : _buckets[index - _oldBuckets.Size()];
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline const typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ChainType& HashMap<TKey, TValue, THash, TEquality, TAllocator>::Chain(size_t index) const
+	{
+		return (index < _oldBuckets.Size()) ? _oldBuckets[index] : _buckets[index - _oldBuckets.Size()];
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THash, TEquality, TAllocator>::ChainIndex(size_t hash) const
+	{
+		if (!_oldBuckets.IsEmpty())
+		{
+			const size_t oldIndex = hash % _oldBuckets.Size();
+			if (oldIndex >= _migrationIndex)
+			{
+				return oldIndex;
+			}
+		}
+
+		return _oldBuckets.Size() + hash % _buckets.Size();
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::CreateChains(BucketType& buckets, size_t count)
+	{
+		buckets.Reserve(count);
+		for (size_t i = 0_z; i < count; ++i)
+		{
+			buckets.EmplaceBack(buckets.GetAllocator());
+		}
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::BeginGrowth()
 	{
-		return Iterator(*this, BucketSize(), ChainIteratorType());
+		MigrateBuckets(_oldBuckets.Size());
+
+		_oldBuckets = std::move(_buckets);
+		CreateChains(_buckets, _oldBuckets.Size() * 2_z + 1_z);
+		_migrationIndex = 0_z;
+	}
+
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	inline void HashMap<TKey, TValue, THash, TEquality, TAllocator>::MigrateBuckets(size_t count)
+	{
+		if (_oldBuckets.IsEmpty())
+		{
+			return;
+		}
+
+		for (; count > 0_z && _migrationIndex < _oldBuckets.Size(); --count, ++_migrationIndex)
+		{
+			ChainType& chain = _oldBuckets[_migrationIndex];
+			while (!chain.IsEmpty())
+			{
+				_buckets[chain.Front()._hash % _buckets.Size()].SpliceFront(chain);
+			}
+		}
+
+		if (_migrationIndex == _oldBuckets.Size())
+		{
+			_oldBuckets.Clear();
+			_oldBuckets.ShrinkToFit();
+			_migrationIndex = 0_z;
+		}
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::end() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::Iterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::FindHashed(const TLookup& key, size_t hash)
 	{
-		return ConstIterator(*this, BucketSize(), ConstChainIteratorType());
+		size_t index = ChainIndex(hash);
+		ChainType& chain = Chain(index);
+		ChainIteratorType chainIt = chain.begin();
+
+		for (; chainIt != chain.end(); chainIt++)
+		{
+			if (chainIt->_hash == hash && _equalityFunctor(chainIt->_pair.first, key))
+			{
+				break;
+			}
+		}
+
+		if (chainIt == chain.end())
+		{
+			index = ChainCount();
+			chainIt = ChainIteratorType();
+		}
+
+		return Iterator(*this, index, chainIt);
 	}
 
-	template<typename TKey, typename TValue>
-	inline typename HashMap<TKey, TValue>::ConstIterator HashMap<TKey, TValue>::cend() const
+	template<typename TKey, typename TValue, typename THash, typename TEquality, typename TAllocator>
+	template <typename TLookup>
+	inline typename HashMap<TKey, TValue, THash, TEquality, TAllocator>::ConstIterator HashMap<TKey, TValue, THash, TEquality, TAllocator>::FindHashed(const TLookup& key, size_t hash) const
 	{
-		return ConstIterator(*this, BucketSize(), ConstChainIteratorType());
+		size_t index = ChainIndex(hash);
+		const ChainType& chain = Chain(index);
+		ConstChainIteratorType chainIt = chain.begin();
+
+		for (; chainIt != chain.end(); chainIt++)
+		{
+			if (chainIt->_hash == hash && _equalityFunctor(chainIt->_pair.first, key))
+			{
+				break;
+			}
+		}
+
+		if (chainIt == chain.end())
+		{
+			index = ChainCount();
+			chainIt = ConstChainIteratorType();
+		}
+
+		return ConstIterator(*this, index, chainIt);
 	}
 }
\ No newline at end of file
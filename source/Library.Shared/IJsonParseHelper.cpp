@@ -10,6 +10,14 @@ namespace FIEAGameEngine
 
 	}
 
+	bool IJsonParseHelper::ArrayHandler(JsonParseCoordinator::SharedData& sharedData, const std::string& key, const Json::Value& value)
+	{
+		UNREFERENCED_LOCAL(sharedData);
+		UNREFERENCED_LOCAL(key);
+		UNREFERENCED_LOCAL(value);
+		return false;
+	}
+
 	IJsonParseHelper::~IJsonParseHelper()
 	{
 
@@ -44,6 +44,15 @@ namespace FIEAGameEngine
 		/// <returns>Whether the pair was handled.</returns>
 		virtual bool EndHandler(JsonParseCoordinator::SharedData& sharedData, const std::string& key, bool isArray) = 0;
 		/// <summary>
+		/// Offered a whole Json array before its elements are handed to StartHandler one at a time, so that a helper can load it in one step.
+		/// If a helper handles the array, StartHandler and EndHandler are not called for its elements. By default, no array is handled.
+		/// </summary>
+		/// <param name="sharedData">The SharedData associated with the JsonParseCoordinator you are wanting to use with this helper.</param>
+		/// <param name="key">The key for the array.</param>
+		/// <param name="value">The Json array.</param>
+		/// <returns>Whether the whole array was handled.</returns>
+		virtual bool ArrayHandler(JsonParseCoordinator::SharedData& sharedData, const std::string& key, const Json::Value& value);
+		/// <summary>
 		/// Destructor marked as virtual so derived classes can create their own implementation.
 		/// </summary>
 		virtual ~IJsonParseHelper();
@@ -244,6 +244,14 @@ namespace FIEAGameEngine
 	{
 		if (isArray)
 		{
+			for (auto helper : _helpers)
+			{
+				if (helper->ArrayHandler(*_sharedData, key, value))
+				{
+					return;
+				}
+			}
+
 			for (Json::ArrayIndex i = 0; i < value.size(); i++)
 			{
 				HandlerLoop(key, value[i], isArray, i);
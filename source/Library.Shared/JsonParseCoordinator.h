@@ -215,7 +215,7 @@ namespace FIEAGameEngine
 		void HandlerLoop(const std::string& key, const Json::Value& value, bool isArray, size_t index);
 		/// <summary>
 		/// Parses a Json value. Calls helper loop to parse the value.
-		/// Accounts for arrays by calling helper on each item in the array.
+		/// Accounts for arrays by first offering the whole array to each helper's ArrayHandler, and otherwise calling helper on each item in the array.
 		/// </summary>
 		/// <param name="key">The key for the current Json value.</param>
 		/// <param name="value">The Json value that is being parsed.</param>
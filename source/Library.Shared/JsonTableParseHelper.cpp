@@ -2,6 +2,7 @@
 #include "JsonTableParseHelper.h"
 #include "Factory.h"
 #include <json\json.h>
+#include <array>
 
 using namespace std;
 using namespace FIEAGameEngine;
@@ -9,6 +10,65 @@ using namespace string_literals;
 
 namespace FIEAGameEngine
 {
+	namespace
+	{
+		/// <summary>
+		/// Provides the text of a Json value. String values are read in place; only other kinds of value are converted, into converted.
+		/// </summary>
+		std::string_view ValueText(const Json::Value& value, std::string& converted)
+		{
+			const char* begin = nullptr;
+			const char* end = nullptr;
+			if (!value.getString(&begin, &end))
+			{
+				converted = value.asString();
+				begin = converted.data();
+				end = begin + converted.size();
+			}
+
+			return std::string_view(begin, static_cast<size_t>(end - begin));
+		}
+
+		/// <summary>
+		/// Converts every element of a Json array and adds it to a Datum of elements of type T.
+		/// An internal Datum is reserved for the whole array once, then appended to in batches converted on the stack.
+		/// An external Datum keeps its storage, and the array is written over its elements from the first.
+		/// </summary>
+		template <typename T, typename Converter>
+		void LoadArray(Datum& datum, const Json::Value& array, Converter convert)
+		{
+			if (datum.IsExternal())
+			{
+				const std::span<T> elements = datum.AsSpan<T>();
+				if (array.size() > elements.size())
+				{
+					throw std::runtime_error("Index out of bounds.");
+				}
+
+				for (Json::ArrayIndex i = 0; i < array.size(); ++i)
+				{
+					elements[i] = convert(array[i]);
+				}
+				return;
+			}
+
+			datum.Reserve(datum.Size() + array.size());
+
+			std::array<T, 32> batch;
+			Json::ArrayIndex index = 0;
+			while (index < array.size())
+			{
+				size_t batchSize = 0_z;
+				for (; batchSize < batch.size() && index < array.size(); ++batchSize, ++index)
+				{
+					batch[batchSize] = convert(array[index]);
+				}
+
+				datum.Append(std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.begin() + batchSize));
+			}
+		}
+	}
+
 #pragma region SharedData
 
 	RTTI_DEFINITIONS(JsonTableParseHelper::SharedData)
@@ -88,6 +148,7 @@ namespace FIEAGameEngine
 					Scope* product = Factory<Scope>::Create(contextFrame._className);
 					assert(product != nullptr);
 					contextFrame._currentRoot.Adopt(*product, contextFrame._key);
+					// Built before pushing: the arguments refer to the top frame, which growing the stack would move.
 					_contextStack.Push(StackFrame(*product, contextFrame._currentDatum, _contextStack.Top()._className, _contextStack.Top()._key));
 				}
 			}
@@ -101,9 +162,24 @@ namespace FIEAGameEngine
 				{
 					contextFrame._currentDatum.IsExternal() ? contextFrame._currentDatum.Set(value.asFloat(), index) : contextFrame._currentDatum.PushBack(value.asFloat());
 				}
+				else if (contextFrame._currentDatum.Type() == Datum::DatumTypes::Boolean)
+				{
+					contextFrame._currentDatum.IsExternal() ? contextFrame._currentDatum.Set(value.asBool(), index) : contextFrame._currentDatum.PushBack(value.asBool());
+				}
+				else if (contextFrame._currentDatum.Type() == Datum::DatumTypes::Integer64)
+				{
+					const std::int64_t integer = value.asInt64();
+					contextFrame._currentDatum.IsExternal() ? contextFrame._currentDatum.Set(integer, index) : contextFrame._currentDatum.PushBack(integer);
+				}
+				else if (contextFrame._currentDatum.Type() == Datum::DatumTypes::Double)
+				{
+					contextFrame._currentDatum.IsExternal() ? contextFrame._currentDatum.Set(value.asDouble(), index) : contextFrame._currentDatum.PushBack(value.asDouble());
+				}
 				else
 				{
-					contextFrame._currentDatum.IsExternal() ? contextFrame._currentDatum.SetFromString(value.asString(), index) : contextFrame._currentDatum.PushBackFromString(value.asString());
+					std::string converted;
+					const std::string_view text = ValueText(value, converted);
+					contextFrame._currentDatum.IsExternal() ? contextFrame._currentDatum.SetFromString(text, index) : contextFrame._currentDatum.PushBackFromString(text);
 				}
 			}
 		}
@@ -111,12 +187,70 @@ namespace FIEAGameEngine
 		{
 			Scope& context = _contextStack.IsEmpty() ? *customSharedData->Root : _contextStack.Top()._currentRoot;
 			Datum& datum = context.Append(key);
-			_contextStack.Push(StackFrame(context, datum, ScopeClassName, key));
+			_contextStack.Emplace(context, datum, ScopeClassName, key);
 		}
 		
 		return true;
 	}
 
+	bool JsonTableParseHelper::ArrayHandler(FIEAGameEngine::JsonParseCoordinator::SharedData& sharedData, const std::string& key, const Json::Value& value)
+	{
+		assert(sharedData.Is(JsonTableParseHelper::SharedData::TypeIdClass()));
+		UNREFERENCED_LOCAL(sharedData);
+
+		if (key != ValueKey || _contextStack.IsEmpty())
+		{
+			return false;
+		}
+
+		Datum& datum = _contextStack.Top()._currentDatum;
+		std::string converted;
+		switch (datum.Type())
+		{
+		case Datum::DatumTypes::Integer:
+			LoadArray<int>(datum, value, [](const Json::Value& element) { return element.asInt(); });
+			break;
+		case Datum::DatumTypes::Float:
+			LoadArray<float>(datum, value, [](const Json::Value& element) { return element.asFloat(); });
+			break;
+		case Datum::DatumTypes::String:
+			LoadArray<std::string>(datum, value, [&converted](const Json::Value& element) { return std::string(ValueText(element, converted)); });
+			break;
+		case Datum::DatumTypes::Vector:
+			LoadArray<glm::vec4>(datum, value, [&converted](const Json::Value& element) { return TextConversion::ParseVector(ValueText(element, converted)); });
+			break;
+		case Datum::DatumTypes::Matrix:
+			LoadArray<glm::mat4>(datum, value, [&converted](const Json::Value& element) { return TextConversion::ParseMatrix(ValueText(element, converted)); });
+			break;
+		case Datum::DatumTypes::Boolean:
+			LoadArray<bool>(datum, value, [](const Json::Value& element) { return element.asBool(); });
+			break;
+		case Datum::DatumTypes::Integer64:
+			LoadArray<std::int64_t>(datum, value, [](const Json::Value& element) { return static_cast<std::int64_t>(element.asInt64()); });
+			break;
+		case Datum::DatumTypes::Double:
+			LoadArray<double>(datum, value, [](const Json::Value& element) { return element.asDouble(); });
+			break;
+		case Datum::DatumTypes::Vector2:
+			LoadArray<glm::vec2>(datum, value, [&converted](const Json::Value& element) { return TextConversion::ParseVector2(ValueText(element, converted)); });
+			break;
+		case Datum::DatumTypes::Vector3:
+			LoadArray<glm::vec3>(datum, value, [&converted](const Json::Value& element) { return TextConversion::ParseVector3(ValueText(element, converted)); });
+			break;
+		case Datum::DatumTypes::Quaternion:
+			LoadArray<glm::quat>(datum, value, [&converted](const Json::Value& element) { return TextConversion::ParseQuaternion(ValueText(element, converted)); });
+			break;
+		case Datum::DatumTypes::Matrix3:
+			LoadArray<glm::mat3>(datum, value, [&converted](const Json::Value& element) { return TextConversion::ParseMatrix3(ValueText(element, converted)); });
+			break;
+		default:
+			// Arrays of tables are nested Scopes, which StartHandler builds one at a time.
+			return false;
+		}
+
+		return true;
+	}
+
 	bool JsonTableParseHelper::EndHandler(FIEAGameEngine::JsonParseCoordinator::SharedData& sharedData, const std::string& key, bool isArray)
 	{
 		assert(sharedData.Is(JsonTableParseHelper::SharedData::TypeIdClass()));
@@ -3,7 +3,7 @@
 #include "JsonParseCoordinator.h"
 #include "IJsonParseHelper.h"
 #include "HashMap.h"
-#include "Stack.h"
+#include "ContiguousStack.h"
 
 namespace FIEAGameEngine
 {
@@ -83,6 +83,12 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <returns>Whether the handling of the pair was completed successfully.</returns>
 		bool EndHandler(FIEAGameEngine::JsonParseCoordinator::SharedData& sharedData, const std::string& key, bool isArray) override;
+		/// <summary>
+		/// Loads a value array of integers, floats, strings, vectors or matrices into the current Datum in one step,
+		/// reserving for every element at once and appending them in batches. Arrays of tables are left to StartHandler.
+		/// </summary>
+		/// <returns>Whether the array was loaded.</returns>
+		bool ArrayHandler(FIEAGameEngine::JsonParseCoordinator::SharedData& sharedData, const std::string& key, const Json::Value& value) override;
 
 	private:
 		/// <summary>
@@ -136,6 +142,6 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Stack data structure used to hold StackFrame objects, so they can be pushed and popped according to Start and End Handler calls.
 		/// </summary>
-		Stack<StackFrame> _contextStack;
+		ContiguousStack<StackFrame> _contextStack;
 	};
 }
\ No newline at end of file
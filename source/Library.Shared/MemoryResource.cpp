@@ -0,0 +1,270 @@
+#include "pch.h"
+#include "MemoryResource.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace FIEAGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Rounds value up to a multiple of alignment, which must be a power of two.
+		/// </summary>
+		size_t AlignUp(size_t value, size_t alignment)
+		{
+			return (value + alignment - 1_z) & ~(alignment - 1_z);
+		}
+
+		/// <summary>
+		/// Rounds pointer up to a multiple of alignment, which must be a power of two.
+		/// </summary>
+		std::byte* AlignUp(std::byte* pointer, size_t alignment)
+		{
+			return reinterpret_cast<std::byte*>(AlignUp(reinterpret_cast<std::uintptr_t>(pointer), alignment));
+		}
+
+		/// <summary>
+		/// malloc, realloc and free behind the MemoryResource interface.
+		/// </summary>
+		class MallocResource final : public MemoryResource
+		{
+		public:
+			void* Allocate(size_t size, size_t alignment) override
+			{
+				assert(alignment <= alignof(std::max_align_t));
+				UNREFERENCED_LOCAL(alignment);
+
+				void* memory = malloc(size);
+				if (memory == nullptr)
+				{
+					throw std::bad_alloc();
+				}
+				return memory;
+			}
+
+			void Deallocate(void* memory, size_t, size_t) override
+			{
+				free(memory);
+			}
+
+			void* Reallocate(void* memory, size_t, size_t newSize, size_t alignment) override
+			{
+				assert(alignment <= alignof(std::max_align_t));
+				UNREFERENCED_LOCAL(alignment);
+
+				void* newMemory = realloc(memory, newSize);
+				if (newMemory == nullptr)
+				{
+					throw std::bad_alloc();
+				}
+				return newMemory;
+			}
+		};
+	}
+
+#pragma region MemoryResource
+	void* MemoryResource::Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment)
+	{
+		void* newMemory = Allocate(newSize, alignment);
+		std::memcpy(newMemory, memory, std::min(oldSize, newSize));
+		Deallocate(memory, oldSize, alignment);
+		return newMemory;
+	}
+
+	MemoryResource& DefaultResource()
+	{
+		static MallocResource resource;
+		return resource;
+	}
+#pragma endregion MemoryResource
+
+#pragma region MonotonicResource
+	MonotonicResource::MonotonicResource(size_t initialBlockSize, MemoryResource* upstream) :
+		_nextBlockSize(std::max(initialBlockSize, 2_z * sizeof(Block))), _upstream(upstream != nullptr ? upstream : &DefaultResource())
+	{
+	}
+
+	MonotonicResource::MonotonicResource(void* buffer, size_t size, MemoryResource* upstream) :
+		_current(static_cast<std::byte*>(buffer)), _end(static_cast<std::byte*>(buffer) + size), _buffer(static_cast<std::byte*>(buffer)), _bufferSize(size),
+		_nextBlockSize(std::max(size, 2_z * sizeof(Block))), _upstream(upstream != nullptr ? upstream : &DefaultResource())
+	{
+	}
+
+	MonotonicResource::~MonotonicResource()
+	{
+		Release();
+	}
+
+	void* MonotonicResource::Allocate(size_t size, size_t alignment)
+	{
+		std::byte* memory = AlignUp(_current, alignment);
+		if (_current == nullptr || memory > _end || size > static_cast<size_t>(_end - memory))
+		{
+			AddBlock(size, alignment);
+			memory = AlignUp(_current, alignment);
+		}
+
+		_current = memory + size;
+		_last = memory;
+		return memory;
+	}
+
+	void MonotonicResource::Deallocate(void* memory, size_t, size_t)
+	{
+		if (memory == _last)
+		{
+			_current = _last;
+			_last = nullptr;
+		}
+	}
+
+	void* MonotonicResource::Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment)
+	{
+		if (memory == _last && newSize <= static_cast<size_t>(_end - _last))
+		{
+			_current = _last + newSize;
+			return memory;
+		}
+
+		void* newMemory = Allocate(newSize, alignment);
+		std::memcpy(newMemory, memory, std::min(oldSize, newSize));
+		return newMemory;
+	}
+
+	void MonotonicResource::Release()
+	{
+		while (_blocks != nullptr)
+		{
+			Block* next = _blocks->_next;
+			_upstream->Deallocate(_blocks, _blocks->_size, alignof(std::max_align_t));
+			_blocks = next;
+		}
+
+		_current = _buffer;
+		_end = _buffer + _bufferSize;
+		_last = nullptr;
+	}
+
+	void MonotonicResource::AddBlock(size_t size, size_t alignment)
+	{
+		const size_t blockSize = std::max(_nextBlockSize, sizeof(Block) + alignment + size);
+		Block* block = static_cast<Block*>(_upstream->Allocate(blockSize, alignof(std::max_align_t)));
+		block->_next = _blocks;
+		block->_size = blockSize;
+		_blocks = block;
+
+		_current = reinterpret_cast<std::byte*>(block) + sizeof(Block);
+		_end = reinterpret_cast<std::byte*>(block) + blockSize;
+		_nextBlockSize = blockSize * 2_z;
+	}
+#pragma endregion MonotonicResource
+
+#pragma region PoolResource
+	PoolResource::PoolResource(size_t chunkSize, MemoryResource* upstream) :
+		_chunkSize(chunkSize), _upstream(upstream != nullptr ? upstream : &DefaultResource())
+	{
+	}
+
+	PoolResource::~PoolResource()
+	{
+		Release();
+	}
+
+	void* PoolResource::Allocate(size_t size, size_t alignment)
+	{
+		const size_t poolIndex = PoolIndex(size, alignment);
+		if (poolIndex == PoolCount)
+		{
+			return _upstream->Allocate(size, alignment);
+		}
+
+		if (_pools[poolIndex] == nullptr)
+		{
+			Refill(poolIndex);
+		}
+
+		FreeBlock* block = _pools[poolIndex];
+		_pools[poolIndex] = block->_next;
+		return block;
+	}
+
+	void PoolResource::Deallocate(void* memory, size_t size, size_t alignment)
+	{
+		const size_t poolIndex = PoolIndex(size, alignment);
+		if (poolIndex == PoolCount)
+		{
+			_upstream->Deallocate(memory, size, alignment);
+			return;
+		}
+
+		FreeBlock* block = static_cast<FreeBlock*>(memory);
+		block->_next = _pools[poolIndex];
+		_pools[poolIndex] = block;
+	}
+
+	void* PoolResource::Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment)
+	{
+		const size_t poolIndex = PoolIndex(oldSize, alignment);
+		if (poolIndex == PoolCount && PoolIndex(newSize, alignment) == PoolCount)
+		{
+			return _upstream->Reallocate(memory, oldSize, newSize, alignment);
+		}
+		if (poolIndex != PoolCount && poolIndex == PoolIndex(newSize, alignment))
+		{
+			return memory;
+		}
+
+		return MemoryResource::Reallocate(memory, oldSize, newSize, alignment);
+	}
+
+	void PoolResource::Release()
+	{
+		while (_chunks != nullptr)
+		{
+			Chunk* next = _chunks->_next;
+			_upstream->Deallocate(_chunks, _chunks->_size, MinimumBlockSize);
+			_chunks = next;
+		}
+
+		std::fill(std::begin(_pools), std::end(_pools), nullptr);
+	}
+
+	size_t PoolResource::PoolIndex(size_t size, size_t alignment)
+	{
+		if (size > MaximumBlockSize || alignment > MinimumBlockSize)
+		{
+			return PoolCount;
+		}
+
+		size_t index = 0_z;
+		for (size_t blockSize = MinimumBlockSize; blockSize < size; blockSize *= 2_z)
+		{
+			++index;
+		}
+		return index;
+	}
+
+	void PoolResource::Refill(size_t poolIndex)
+	{
+		const size_t blockSize = MinimumBlockSize << poolIndex;
+		const size_t header = AlignUp(sizeof(Chunk), MinimumBlockSize);
+		const size_t chunkSize = std::max(_chunkSize, header + blockSize);
+
+		Chunk* chunk = static_cast<Chunk*>(_upstream->Allocate(chunkSize, MinimumBlockSize));
+		chunk->_next = _chunks;
+		chunk->_size = chunkSize;
+		_chunks = chunk;
+
+		std::byte* first = reinterpret_cast<std::byte*>(chunk) + header;
+		const size_t blockCount = (chunkSize - header) / blockSize;
+		for (size_t i = blockCount; i > 0_z; --i)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(first + (i - 1_z) * blockSize);
+			block->_next = _pools[poolIndex];
+			_pools[poolIndex] = block;
+		}
+	}
+#pragma endregion PoolResource
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <cstddef>
+#include "SizeLiteral.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Untyped source of memory that containers can be pointed at through ResourceAllocator.
+	/// A resource must outlive every container that allocates from it.
+	/// </summary>
+	class MemoryResource
+	{
+	public:
+		MemoryResource() = default;
+		MemoryResource(const MemoryResource&) = delete;
+		MemoryResource(MemoryResource&&) = delete;
+		MemoryResource& operator=(const MemoryResource&) = delete;
+		MemoryResource& operator=(MemoryResource&&) = delete;
+		virtual ~MemoryResource() = default;
+
+		/// <summary>
+		/// Provides size bytes aligned to alignment.
+		/// </summary>
+		/// <param name="size">The number of bytes needed. Greater than 0.</param>
+		/// <param name="alignment">A power of two.</param>
+		/// <returns>The memory. Never null.</returns>
+		/// <exception cref="std::bad_alloc">Thrown when the memory cannot be provided.</exception>
+		virtual void* Allocate(size_t size, size_t alignment) = 0;
+		/// <summary>
+		/// Returns memory obtained from Allocate or Reallocate on this resource.
+		/// </summary>
+		/// <param name="memory">The memory. Never null.</param>
+		/// <param name="size">The size it was allocated with.</param>
+		/// <param name="alignment">The alignment it was allocated with.</param>
+		virtual void Deallocate(void* memory, size_t size, size_t alignment) = 0;
+		/// <summary>
+		/// Resizes memory obtained from this resource, keeping the first min(oldSize, newSize) bytes.
+		/// The default allocates, copies and deallocates. Resources that can grow in place override it.
+		/// </summary>
+		/// <param name="memory">The memory. Never null.</param>
+		/// <param name="oldSize">The size it was allocated with.</param>
+		/// <param name="newSize">The size needed. Greater than 0.</param>
+		/// <param name="alignment">The alignment it was allocated with.</param>
+		/// <returns>The resized memory, which may be at a new address.</returns>
+		virtual void* Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment);
+	};
+
+	/// <summary>
+	/// The resource containers use when none is given: malloc, realloc and free, the same as DefaultAllocator.
+	/// </summary>
+	/// <returns>The process-wide malloc resource.</returns>
+	MemoryResource& DefaultResource();
+
+	/// <summary>
+	/// Arena that hands out memory by bumping a pointer through blocks obtained from an upstream resource.
+	/// Deallocate only reclaims the most recent allocation; everything else is returned at once by Release or the destructor.
+	/// Suited to data that is built once and thrown away together, such as a Scope tree loaded for a level.
+	/// </summary>
+	class MonotonicResource final : public MemoryResource
+	{
+	public:
+		/// <summary>
+		/// Creates an empty arena. No memory is taken from upstream until the first allocation.
+		/// </summary>
+		/// <param name="initialBlockSize">Size of the first block. Each later block is twice the size of the one before.</param>
+		/// <param name="upstream">Where blocks come from. Null means DefaultResource.</param>
+		explicit MonotonicResource(size_t initialBlockSize = 1024_z, MemoryResource* upstream = nullptr);
+		/// <summary>
+		/// Creates an arena that fills a caller-owned buffer before it asks upstream for more.
+		/// </summary>
+		/// <param name="buffer">The first block. Must outlive the resource and is never returned to upstream.</param>
+		/// <param name="size">The size of buffer in bytes.</param>
+		/// <param name="upstream">Where blocks come from once buffer is full. Null means DefaultResource.</param>
+		MonotonicResource(void* buffer, size_t size, MemoryResource* upstream = nullptr);
+		~MonotonicResource();
+
+		void* Allocate(size_t size, size_t alignment) override;
+		void Deallocate(void* memory, size_t size, size_t alignment) override;
+		/// <summary>
+		/// Grows or shrinks the most recent allocation in place when the current block has room; otherwise allocates and copies.
+		/// </summary>
+		void* Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment) override;
+
+		/// <summary>
+		/// Returns every block to upstream. Memory handed out before the call must no longer be used.
+		/// </summary>
+		void Release();
+
+	private:
+		/// <summary>
+		/// Header at the start of each block obtained from upstream.
+		/// </summary>
+		struct Block final
+		{
+			Block* _next;
+			size_t _size;
+		};
+
+		/// <summary>
+		/// Takes a block from upstream with room for at least size bytes at alignment and makes it current.
+		/// </summary>
+		void AddBlock(size_t size, size_t alignment);
+
+		/// <summary>
+		/// Blocks taken from upstream, most recent first.
+		/// </summary>
+		Block* _blocks{ nullptr };
+		/// <summary>
+		/// Next free byte in the current block.
+		/// </summary>
+		std::byte* _current{ nullptr };
+		/// <summary>
+		/// One past the last byte of the current block.
+		/// </summary>
+		std::byte* _end{ nullptr };
+		/// <summary>
+		/// Start of the most recent allocation, which Deallocate and Reallocate can adjust in place.
+		/// </summary>
+		std::byte* _last{ nullptr };
+		/// <summary>
+		/// The caller-owned buffer given to the constructor, reused after Release.
+		/// </summary>
+		std::byte* _buffer{ nullptr };
+		/// <summary>
+		/// The size of _buffer.
+		/// </summary>
+		size_t _bufferSize{ 0_z };
+		/// <summary>
+		/// Size of the next block taken from upstream.
+		/// </summary>
+		size_t _nextBlockSize;
+		/// <summary>
+		/// Where blocks come from.
+		/// </summary>
+		MemoryResource* _upstream;
+	};
+
+	/// <summary>
+	/// Keeps a free list for each power-of-two size class from MinimumBlockSize to MaximumBlockSize,
+	/// so the many small, equally sized allocations of node-based containers are recycled without going to upstream.
+	/// Larger or more strictly aligned requests are passed to upstream.
+	/// Memory in the pools is returned to upstream only by Release or the destructor.
+	/// </summary>
+	class PoolResource final : public MemoryResource
+	{
+	public:
+		/// <summary>
+		/// Smallest size class. Also the alignment every pooled block is guaranteed.
+		/// </summary>
+		static constexpr size_t MinimumBlockSize = 16;
+		/// <summary>
+		/// Largest size class. Requests above it go to upstream.
+		/// </summary>
+		static constexpr size_t MaximumBlockSize = 512;
+
+		/// <summary>
+		/// Creates empty pools.
+		/// </summary>
+		/// <param name="chunkSize">Bytes taken from upstream each time a pool runs dry.</param>
+		/// <param name="upstream">Where chunks and oversized requests go. Null means DefaultResource.</param>
+		explicit PoolResource(size_t chunkSize = 4096_z, MemoryResource* upstream = nullptr);
+		~PoolResource();
+
+		void* Allocate(size_t size, size_t alignment) override;
+		void Deallocate(void* memory, size_t size, size_t alignment) override;
+		/// <summary>
+		/// Keeps the block when the new size falls in the same size class; otherwise allocates, copies and deallocates.
+		/// </summary>
+		void* Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment) override;
+
+		/// <summary>
+		/// Returns every chunk to upstream. Memory handed out from the pools before the call must no longer be used.
+		/// </summary>
+		void Release();
+
+	private:
+		/// <summary>
+		/// Header at the start of each chunk obtained from upstream.
+		/// </summary>
+		struct Chunk final
+		{
+			Chunk* _next;
+			size_t _size;
+		};
+
+		/// <summary>
+		/// Link stored in a free block.
+		/// </summary>
+		struct FreeBlock final
+		{
+			FreeBlock* _next;
+		};
+
+		/// <summary>
+		/// Number of size classes between MinimumBlockSize and MaximumBlockSize.
+		/// </summary>
+		static constexpr size_t PoolCount = 6;
+
+		/// <summary>
+		/// Finds the size class of a request.
+		/// </summary>
+		/// <returns>The pool index, or PoolCount if the request goes to upstream.</returns>
+		static size_t PoolIndex(size_t size, size_t alignment);
+		/// <summary>
+		/// Carves a new chunk from upstream into free blocks for one pool.
+		/// </summary>
+		void Refill(size_t poolIndex);
+
+		/// <summary>
+		/// The free list of each size class.
+		/// </summary>
+		FreeBlock* _pools[PoolCount]{};
+		/// <summary>
+		/// Chunks taken from upstream, most recent first.
+		/// </summary>
+		Chunk* _chunks{ nullptr };
+		/// <summary>
+		/// Bytes taken from upstream by Refill.
+		/// </summary>
+		size_t _chunkSize;
+		/// <summary>
+		/// Where chunks and oversized requests go.
+		/// </summary>
+		MemoryResource* _upstream;
+	};
+}
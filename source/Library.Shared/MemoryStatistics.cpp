@@ -0,0 +1,118 @@
+#include "pch.h"
+#include "MemoryStatistics.h"
+#include <mutex>
+#include <ostream>
+#include "Scope.h"
+
+namespace FIEAGameEngine
+{
+#if FIEA_MEMORY_STATISTICS
+	/// <summary>
+	/// Guards the live Scope list. A function-local static so that Scopes with static storage duration in other translation units can register safely.
+	/// </summary>
+	static std::mutex& ScopeListMutex()
+	{
+		static std::mutex mutex;
+		return mutex;
+	}
+#endif
+
+	std::size_t MemoryReport::TotalBytes() const
+	{
+		return _dictionaries._memory._bytesAllocated + _orders._bytesAllocated + _datumBufferBytes;
+	}
+
+	MemoryReport MemoryStatistics::Report()
+	{
+		MemoryReport report;
+#if FIEA_MEMORY_STATISTICS
+		{
+			std::lock_guard<std::mutex> lock(ScopeListMutex());
+			for (const Scope* scope = _newestScope; scope != nullptr; scope = scope->_olderScope)
+			{
+				++report._scopeCount;
+				report._dictionaries += scope->_dictionary.Stats();
+				report._orders += scope->_order.Stats();
+				for (const Scope::PairType* pair : scope->_order)
+				{
+					report._scopeDatums += pair->second.Stats();
+				}
+			}
+		}
+
+		report._datumBufferCount = _datumBufferCount.load(std::memory_order_relaxed);
+		report._datumBufferBytes = _datumBufferBytes.load(std::memory_order_relaxed);
+#endif
+		return report;
+	}
+
+	void MemoryStatistics::WriteReport(std::ostream& stream)
+	{
+		const MemoryReport report = Report();
+		const HashMapStats& dictionaries = report._dictionaries;
+
+		stream << "Scopes: " << report._scopeCount << "\n";
+		stream << "Dictionaries: " << dictionaries._memory._elementCount << " entries, " << dictionaries._memory._bytesAllocated << " bytes allocated, "
+			<< dictionaries._memory._bytesInUse << " in use, " << dictionaries._bucketCount << " buckets, load factor " << dictionaries.LoadFactor()
+			<< ", " << dictionaries.EmptyBucketRatio() * 100.0f << "% empty, longest chain " << dictionaries._longestChain << "\n";
+		stream << "Chain lengths:";
+		for (std::size_t i = 0; i < HashMapStats::HistogramSize; ++i)
+		{
+			stream << " " << i << ((i + 1 == HashMapStats::HistogramSize) ? "+" : "") << "=" << dictionaries._chainLengths[i];
+		}
+		stream << "\n";
+		stream << "Order lists: " << report._orders._elementCount << " entries, " << report._orders._bytesAllocated << " bytes allocated\n";
+		stream << "Scope Datums: " << report._scopeDatums._elementCount << " elements, " << report._scopeDatums._bytesAllocated << " bytes allocated, "
+			<< report._scopeDatums._bytesInUse << " in use\n";
+		stream << "Datum buffers: " << report._datumBufferCount << " buffers, " << report._datumBufferBytes << " bytes\n";
+		stream << "Total: " << report.TotalBytes() << " bytes\n";
+	}
+
+#if FIEA_MEMORY_STATISTICS
+	void MemoryStatistics::Register(Scope& scope)
+	{
+		std::lock_guard<std::mutex> lock(ScopeListMutex());
+		scope._olderScope = _newestScope;
+		scope._newerScope = nullptr;
+		if (_newestScope != nullptr)
+		{
+			_newestScope->_newerScope = &scope;
+		}
+		_newestScope = &scope;
+	}
+
+	void MemoryStatistics::Unregister(Scope& scope)
+	{
+		std::lock_guard<std::mutex> lock(ScopeListMutex());
+		if (scope._newerScope != nullptr)
+		{
+			scope._newerScope->_olderScope = scope._olderScope;
+		}
+		else
+		{
+			_newestScope = scope._olderScope;
+		}
+		if (scope._olderScope != nullptr)
+		{
+			scope._olderScope->_newerScope = scope._newerScope;
+		}
+		scope._olderScope = nullptr;
+		scope._newerScope = nullptr;
+	}
+
+	void MemoryStatistics::RecordDatumBuffer(std::size_t oldBytes, std::size_t newBytes)
+	{
+		if (oldBytes == 0 && newBytes != 0)
+		{
+			_datumBufferCount.fetch_add(1, std::memory_order_relaxed);
+		}
+		else if (oldBytes != 0 && newBytes == 0)
+		{
+			_datumBufferCount.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		// Unsigned wraparound makes a shrinking buffer subtract.
+		_datumBufferBytes.fetch_add(newBytes - oldBytes, std::memory_order_relaxed);
+	}
+#endif
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <iosfwd>
+#include "ContainerStats.h"
+
+/// Set to 0 to compile out the live Scope list and the Datum buffer counters, so that constructing a Scope or allocating a Datum buffer
+/// costs nothing extra. MemoryStatistics::Report then returns an empty report.
+#if !defined(FIEA_MEMORY_STATISTICS)
+#define FIEA_MEMORY_STATISTICS 1
+#endif
+
+namespace FIEAGameEngine
+{
+	class Datum;
+	class Scope;
+
+	/// <summary>
+	/// Totals MemoryStatistics::Report gathers across the engine.
+	/// </summary>
+	struct MemoryReport final
+	{
+		/// <summary>
+		/// Provides the bytes accounted for: Scope dictionaries and order lists, plus every internally managed Datum buffer.
+		/// </summary>
+		/// <returns>The sum of the allocated bytes in this report.</returns>
+		std::size_t TotalBytes() const;
+
+		/// <summary>
+		/// Number of live Scopes, including Attributed objects and every other Scope subclass.
+		/// </summary>
+		std::size_t _scopeCount{ 0 };
+		/// <summary>
+		/// The name-to-Datum dictionaries of every live Scope, added together.
+		/// </summary>
+		HashMapStats _dictionaries;
+		/// <summary>
+		/// The insertion order lists of every live Scope, added together.
+		/// </summary>
+		ContainerStats _orders;
+		/// <summary>
+		/// The internally managed buffers of the Datums held by live Scopes, added together. A subset of the Datum buffers counted below.
+		/// </summary>
+		ContainerStats _scopeDatums;
+		/// <summary>
+		/// Number of internally managed Datum buffers allocated anywhere, inside Scopes or not.
+		/// </summary>
+		std::size_t _datumBufferCount{ 0 };
+		/// <summary>
+		/// Bytes held by those buffers.
+		/// </summary>
+		std::size_t _datumBufferBytes{ 0 };
+	};
+
+	/// <summary>
+	/// Engine-wide memory accounting, for answering "where is our RAM going" in a running game.
+	/// Every Scope registers itself for its lifetime, linked through its own members so that registering never allocates.
+	/// Datum buffers are only counted, with atomic counters updated whenever a Datum allocates, grows or frees its buffer.
+	/// All of it is compiled out when FIEA_MEMORY_STATISTICS is 0.
+	/// </summary>
+	class MemoryStatistics final
+	{
+		friend Datum;
+		friend Scope;
+
+	public:
+		MemoryStatistics() = delete;
+		MemoryStatistics(const MemoryStatistics&) = delete;
+		MemoryStatistics(MemoryStatistics&&) = delete;
+		MemoryStatistics& operator=(const MemoryStatistics&) = delete;
+		MemoryStatistics& operator=(MemoryStatistics&&) = delete;
+		~MemoryStatistics() = default;
+
+		/// <summary>
+		/// Whether this build keeps the statistics at all. When false, Report returns an empty report.
+		/// </summary>
+		static constexpr bool Enabled = FIEA_MEMORY_STATISTICS != 0;
+
+		/// <summary>
+		/// Walks every live Scope and adds up its dictionary, order list and Datums. Scopes can be created and destroyed on other threads meanwhile,
+		/// but no other thread may be modifying the contents of a live Scope.
+		/// </summary>
+		/// <returns>The totals.</returns>
+		static MemoryReport Report();
+		/// <summary>
+		/// Writes a Report as readable text, one line per category.
+		/// </summary>
+		/// <param name="stream">Where the report is written.</param>
+		static void WriteReport(std::ostream& stream);
+
+	private:
+		/// <summary>
+		/// Adds a Scope to the live list. Called once by every Scope constructor.
+		/// </summary>
+		/// <param name="scope">The Scope being constructed.</param>
+		static void Register(Scope& scope);
+		/// <summary>
+		/// Removes a Scope from the live list. Called by the Scope destructor.
+		/// </summary>
+		/// <param name="scope">The Scope being destroyed.</param>
+		static void Unregister(Scope& scope);
+		/// <summary>
+		/// Records that a Datum buffer went from oldBytes to newBytes. Zero means no buffer.
+		/// </summary>
+		/// <param name="oldBytes">Size of the buffer before, or 0 if the Datum had none.</param>
+		/// <param name="newBytes">Size of the buffer after, or 0 if it was freed.</param>
+		static void RecordDatumBuffer(std::size_t oldBytes, std::size_t newBytes);
+
+#if FIEA_MEMORY_STATISTICS
+		/// <summary>
+		/// Most recently constructed live Scope. Each Scope links to the next older and newer one.
+		/// </summary>
+		inline static Scope* _newestScope{ nullptr };
+		/// <summary>
+		/// Number of internally managed Datum buffers currently allocated.
+		/// </summary>
+		inline static std::atomic<std::size_t> _datumBufferCount{ 0 };
+		/// <summary>
+		/// Bytes held by those buffers.
+		/// </summary>
+		inline static std::atomic<std::size_t> _datumBufferBytes{ 0 };
+#endif
+	};
+
+#if !FIEA_MEMORY_STATISTICS
+	inline void MemoryStatistics::Register(Scope&)
+	{
+	}
+
+	inline void MemoryStatistics::Unregister(Scope&)
+	{
+	}
+
+	inline void MemoryStatistics::RecordDatumBuffer(std::size_t, std::size_t)
+	{
+	}
+#endif
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include "SizeLiteral.h"
+#include "Allocator.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Bounded FIFO for any number of producer threads and one consumer thread, without locks.
+	/// Every slot carries a sequence number that says whether it is free for the producer claiming that position or full for the consumer,
+	/// so producers only contend on claiming a position and never wait on each other while constructing their elements.
+	/// Elements come out in the order their positions were claimed. A producer that has claimed a position but not finished constructing
+	/// holds back the elements behind it, so TryPop can report empty while later pushes have already completed.
+	/// </summary>
+	/// <typeparam name="T">The type of element stored in the queue. Must be move constructible.</typeparam>
+	/// <typeparam name="TAllocator">Allocator policy for the slots. See DefaultAllocator.</typeparam>
+	template <typename T, typename TAllocator = DefaultAllocator>
+	class MpscQueue final
+	{
+	public:
+		/// <summary>
+		/// Creates an empty queue. Its capacity never changes.
+		/// </summary>
+		/// <param name="capacity">The number of elements the queue can hold. Rounded up to a power of two, and at least two.</param>
+		/// <param name="allocator">The allocator the slots come from.</param>
+		explicit MpscQueue(size_t capacity, TAllocator allocator = TAllocator{});
+		MpscQueue(const MpscQueue&) = delete;
+		MpscQueue(MpscQueue&&) = delete;
+		MpscQueue& operator=(const MpscQueue&) = delete;
+		MpscQueue& operator=(MpscQueue&&) = delete;
+		/// <summary>
+		/// Destroys the elements still queued and frees the slots. No thread may be using the queue.
+		/// </summary>
+		~MpscQueue();
+
+		/// <summary>
+		/// Appends a copy of value. Any thread.
+		/// </summary>
+		/// <returns>True if the value was queued, false if the queue was full.</returns>
+		bool TryPush(const T& value);
+		/// <summary>
+		/// Appends value by moving it. Any thread. value is left untouched if the queue is full.
+		/// </summary>
+		/// <returns>True if the value was queued, false if the queue was full.</returns>
+		bool TryPush(T&& value);
+		/// <summary>
+		/// Constructs an element in place at the back of the queue. Any thread.
+		/// </summary>
+		/// <returns>True if the element was queued, false if the queue was full.</returns>
+		template <typename... TArgs>
+		bool TryEmplace(TArgs&&... args);
+		/// <summary>
+		/// Moves the front element into value and removes it. Consumer thread only.
+		/// </summary>
+		/// <param name="value">Assigned the front element.</param>
+		/// <returns>True if an element was removed, false if the front element is not there yet.</returns>
+		bool TryPop(T& value);
+
+		/// <summary>
+		/// Provides the number of claimed positions not yet popped. Exact when no thread is working on the queue, otherwise a snapshot.
+		/// </summary>
+		size_t Size() const;
+		/// <summary>
+		/// Determines whether the queue holds no elements. A snapshot while other threads are working on the queue.
+		/// </summary>
+		bool IsEmpty() const;
+		/// <summary>
+		/// Provides the number of elements the queue can hold.
+		/// </summary>
+		size_t Capacity() const;
+
+	private:
+		/// <summary>
+		/// One element's storage and its sequence number. The sequence equals the position a producer may claim the slot for while it is free,
+		/// and that position plus one once the element is constructed.
+		/// </summary>
+		struct Cell final
+		{
+			std::atomic<size_t> _sequence;
+			alignas(T) unsigned char _storage[sizeof(T)];
+		};
+
+		/// <summary>
+		/// Size of the cache line the two indices are kept apart by.
+		/// </summary>
+		inline static constexpr size_t CacheLineSize = 64;
+
+		/// <summary>
+		/// The slots. Slot i holds the element with position i modulo the capacity.
+		/// </summary>
+		Cell* _cells;
+		/// <summary>
+		/// Capacity minus one; positions wrap into the slots with it.
+		/// </summary>
+		size_t _mask;
+		/// <summary>
+		/// The allocator the slots come from.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TAllocator _allocator;
+
+		/// <summary>
+		/// Position of the next element to pop. Only the consumer writes it.
+		/// </summary>
+		alignas(CacheLineSize) std::atomic<size_t> _head{ 0_z };
+		/// <summary>
+		/// Position the next producer claims. Producers advance it with compare-exchange.
+		/// </summary>
+		alignas(CacheLineSize) std::atomic<size_t> _tail{ 0_z };
+	};
+}
+
+#include "MpscQueue.inl"
@@ -0,0 +1,121 @@
+#include "MpscQueue.h"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace FIEAGameEngine
+{
+	template <typename T, typename TAllocator>
+	inline MpscQueue<T, TAllocator>::MpscQueue(size_t capacity, TAllocator allocator) :
+		_mask(std::bit_ceil(std::max(capacity, 2_z)) - 1_z), _allocator(allocator)
+	{
+		_cells = reinterpret_cast<Cell*>(_allocator.Allocate(sizeof(Cell) * (_mask + 1_z), alignof(Cell)));
+		assert(_cells != nullptr);
+		for (size_t i = 0_z; i <= _mask; ++i)
+		{
+			new(&_cells[i]._sequence) std::atomic<size_t>(i);
+		}
+	}
+
+	template <typename T, typename TAllocator>
+	inline MpscQueue<T, TAllocator>::~MpscQueue()
+	{
+		const size_t tail = _tail.load(std::memory_order_relaxed);
+		for (size_t position = _head.load(std::memory_order_relaxed); position != tail; ++position)
+		{
+			std::launder(reinterpret_cast<T*>(_cells[position & _mask]._storage))->~T();
+		}
+		_allocator.Deallocate(_cells, sizeof(Cell) * (_mask + 1_z), alignof(Cell));
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool MpscQueue<T, TAllocator>::TryPush(const T& value)
+	{
+		return TryEmplace(value);
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool MpscQueue<T, TAllocator>::TryPush(T&& value)
+	{
+		return TryEmplace(std::move(value));
+	}
+
+	template <typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline bool MpscQueue<T, TAllocator>::TryEmplace(TArgs&&... args)
+	{
+		size_t position = _tail.load(std::memory_order_relaxed);
+		Cell* cell;
+		for (;;)
+		{
+			cell = &_cells[position & _mask];
+			const size_t sequence = cell->_sequence.load(std::memory_order_acquire);
+			const std::make_signed_t<size_t> difference = static_cast<std::make_signed_t<size_t>>(sequence - position);
+			if (difference == 0)
+			{
+				// The slot is free for this position; claim it. On failure position is reloaded with the current tail.
+				if (_tail.compare_exchange_weak(position, position + 1_z, std::memory_order_relaxed))
+				{
+					break;
+				}
+			}
+			else if (difference < 0)
+			{
+				// The slot still holds the element from one lap ago: the queue is full.
+				return false;
+			}
+			else
+			{
+				// Another producer claimed this position first.
+				position = _tail.load(std::memory_order_relaxed);
+			}
+		}
+
+		new(cell->_storage)T(std::forward<TArgs>(args)...);
+		cell->_sequence.store(position + 1_z, std::memory_order_release);
+		return true;
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool MpscQueue<T, TAllocator>::TryPop(T& value)
+	{
+		const size_t position = _head.load(std::memory_order_relaxed);
+		Cell& cell = _cells[position & _mask];
+		if (cell._sequence.load(std::memory_order_acquire) != position + 1_z)
+		{
+			return false;
+		}
+
+		T* element = std::launder(reinterpret_cast<T*>(cell._storage));
+		value = std::move(*element);
+		element->~T();
+
+		// Frees the slot for the producer that claims it on the next lap.
+		cell._sequence.store(position + _mask + 1_z, std::memory_order_release);
+		_head.store(position + 1_z, std::memory_order_relaxed);
+		return true;
+	}
+
+	template <typename T, typename TAllocator>
+	inline size_t MpscQueue<T, TAllocator>::Size() const
+	{
+		const size_t head = _head.load(std::memory_order_acquire);
+		const size_t tail = _tail.load(std::memory_order_acquire);
+		return tail > head ? tail - head : 0_z;
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool MpscQueue<T, TAllocator>::IsEmpty() const
+	{
+		return Size() == 0_z;
+	}
+
+	template <typename T, typename TAllocator>
+	inline size_t MpscQueue<T, TAllocator>::Capacity() const
+	{
+		return _mask + 1_z;
+	}
+}
@@ -0,0 +1,208 @@
+#include "pch.h"
+#include "NodePool.h"
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <new>
+
+namespace FIEAGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Rounds value up to a multiple of alignment, which must be a power of two.
+		/// </summary>
+		size_t AlignUp(size_t value, size_t alignment)
+		{
+			return (value + alignment - 1_z) & ~(alignment - 1_z);
+		}
+
+		/// <summary>
+		/// Distance between the block sizes of neighbouring shared pools, and the alignment of every shared block.
+		/// </summary>
+		constexpr size_t SharedGranularity = alignof(std::max_align_t);
+
+		/// <summary>
+		/// Number of shared pools.
+		/// </summary>
+		constexpr size_t SharedPoolCount = NodePool::MaximumSharedBlockSize / SharedGranularity;
+
+		/// <summary>
+		/// A shared pool and the lock every allocator using it takes.
+		/// </summary>
+		struct SharedPool final
+		{
+			explicit SharedPool(size_t blockSize) :
+				Pool(blockSize, SharedGranularity)
+			{
+			}
+
+			NodePool Pool;
+			std::mutex Mutex;
+		};
+
+		/// <summary>
+		/// Provides the shared pools, indexed by size class. All of them are constructed by the first call, which the function-local
+		/// static makes safe for threads to race on. They live in static storage and are deliberately never destroyed.
+		/// </summary>
+		SharedPool* SharedPools()
+		{
+			alignas(SharedPool) static std::byte storage[SharedPoolCount * sizeof(SharedPool)];
+			static SharedPool* const pools = []
+			{
+				for (size_t i = 0_z; i < SharedPoolCount; ++i)
+				{
+					new (storage + i * sizeof(SharedPool)) SharedPool((i + 1_z) * SharedGranularity);
+				}
+				return reinterpret_cast<SharedPool*>(storage);
+			}();
+			return pools;
+		}
+
+		/// <summary>
+		/// Finds the size class of a request.
+		/// </summary>
+		/// <returns>The index of the shared pool, or SharedPoolCount if the request is too large or too strictly aligned to share.</returns>
+		size_t SharedIndex(size_t size, size_t alignment)
+		{
+			if (size == 0_z || size > NodePool::MaximumSharedBlockSize || alignment > SharedGranularity)
+			{
+				return SharedPoolCount;
+			}
+
+			return (size - 1_z) / SharedGranularity;
+		}
+	}
+
+	NodePool::NodePool(size_t blockSize, size_t alignment, size_t blocksPerChunk, MemoryResource* upstream) :
+		_alignment(std::max(alignment, alignof(FreeBlock))), _blocksPerChunk(std::max(blocksPerChunk, 1_z)),
+		_upstream(upstream != nullptr ? upstream : &DefaultResource())
+	{
+		_blockSize = AlignUp(std::max(blockSize, sizeof(FreeBlock)), _alignment);
+	}
+
+	NodePool::~NodePool()
+	{
+		Release();
+	}
+
+	void* NodePool::Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment)
+	{
+		const bool oldFits = Fits(oldSize, alignment);
+		const bool newFits = Fits(newSize, alignment);
+		if (oldFits && newFits)
+		{
+			return memory;
+		}
+		if (!oldFits && !newFits)
+		{
+			return _upstream->Reallocate(memory, oldSize, newSize, alignment);
+		}
+
+		void* newMemory = Allocate(newSize, alignment);
+		std::memcpy(newMemory, memory, std::min(oldSize, newSize));
+		Deallocate(memory, oldSize, alignment);
+		return newMemory;
+	}
+
+	void NodePool::Release()
+	{
+		while (_chunks != nullptr)
+		{
+			Chunk* next = _chunks->_next;
+			_upstream->Deallocate(_chunks, _chunks->_size, std::max(_alignment, alignof(Chunk)));
+			_chunks = next;
+		}
+
+		_free = nullptr;
+	}
+
+	NodePool* NodePool::Shared(size_t size, size_t alignment)
+	{
+		const size_t index = SharedIndex(size, alignment);
+		return index < SharedPoolCount ? &SharedPools()[index].Pool : nullptr;
+	}
+
+	void NodePool::ReleaseShared()
+	{
+		SharedPool* pools = SharedPools();
+		for (size_t i = 0_z; i < SharedPoolCount; ++i)
+		{
+			std::lock_guard lock(pools[i].Mutex);
+			pools[i].Pool.Release();
+		}
+	}
+
+	void* NodePool::AllocateShared(size_t size, size_t alignment)
+	{
+		const size_t index = SharedIndex(size, alignment);
+		if (index == SharedPoolCount)
+		{
+			return DefaultResource().Allocate(size, alignment);
+		}
+
+		SharedPool& shared = SharedPools()[index];
+		std::lock_guard lock(shared.Mutex);
+		return shared.Pool.Allocate(size, alignment);
+	}
+
+	void* NodePool::ReallocateShared(void* memory, size_t oldSize, size_t newSize, size_t alignment)
+	{
+		const size_t oldIndex = SharedIndex(oldSize, alignment);
+		const size_t newIndex = SharedIndex(newSize, alignment);
+		if (oldIndex == newIndex)
+		{
+			// Both sizes fit the same block, so only memory from DefaultResource has anything to do.
+			return oldIndex == SharedPoolCount ? DefaultResource().Reallocate(memory, oldSize, newSize, alignment) : memory;
+		}
+
+		void* newMemory = AllocateShared(newSize, alignment);
+		std::memcpy(newMemory, memory, std::min(oldSize, newSize));
+		DeallocateShared(memory, oldSize, alignment);
+		return newMemory;
+	}
+
+	void NodePool::DeallocateShared(void* memory, size_t size, size_t alignment)
+	{
+		const size_t index = SharedIndex(size, alignment);
+		if (index == SharedPoolCount)
+		{
+			DefaultResource().Deallocate(memory, size, alignment);
+			return;
+		}
+
+		SharedPool& shared = SharedPools()[index];
+		std::lock_guard lock(shared.Mutex);
+		shared.Pool.Deallocate(memory, size, alignment);
+	}
+
+	void NodePool::Refill()
+	{
+		const size_t chunkAlignment = std::max(_alignment, alignof(Chunk));
+		const size_t header = AlignUp(sizeof(Chunk), _alignment);
+		const size_t chunkSize = header + _blockSize * _blocksPerChunk;
+
+		Chunk* chunk = static_cast<Chunk*>(_upstream->Allocate(chunkSize, chunkAlignment));
+		chunk->_next = _chunks;
+		chunk->_size = chunkSize;
+		_chunks = chunk;
+
+		std::byte* first = reinterpret_cast<std::byte*>(chunk) + header;
+		for (size_t i = _blocksPerChunk; i > 0_z; --i)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(first + (i - 1_z) * _blockSize);
+			block->_next = _free;
+			_free = block;
+		}
+	}
+
+	void* NodePoolAllocator::Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment) const
+	{
+		if (memory == nullptr)
+		{
+			return Allocate(newSize, alignment);
+		}
+
+		return _pool != nullptr ? _pool->Reallocate(memory, oldSize, newSize, alignment) : NodePool::ReallocateShared(memory, oldSize, newSize, alignment);
+	}
+}
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <cstddef>
+#include "MemoryResource.h"
+#include "SizeLiteral.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Slab of fixed-size blocks for node-based containers, such as the nodes of an SList or of a HashMap's chains.
+	/// Blocks are carved out of chunks taken from an upstream resource and recycled through a free list, so pushing and popping
+	/// nodes does not go back to the general-purpose heap. Requests that do not fit in a block are passed to upstream.
+	/// Chunks are returned to upstream only by Release or the destructor. A NodePool is not synchronized.
+	/// </summary>
+	class NodePool final
+	{
+	public:
+		/// <summary>
+		/// Largest block a shared pool serves. Larger requests made through a shared NodePoolAllocator go to DefaultResource.
+		/// </summary>
+		static constexpr size_t MaximumSharedBlockSize = 256;
+
+		/// <summary>
+		/// Creates an empty pool. No memory is taken from upstream until the first allocation.
+		/// </summary>
+		/// <param name="blockSize">Largest request served from the pool, typically SList::NodeSize or HashMap::NodeSize.</param>
+		/// <param name="alignment">Alignment of every block, typically SList::NodeAlignment or HashMap::NodeAlignment. A power of two.</param>
+		/// <param name="blocksPerChunk">Number of blocks taken from upstream each time the free list runs dry.</param>
+		/// <param name="upstream">Where chunks and requests that do not fit come from. Null means DefaultResource.</param>
+		explicit NodePool(size_t blockSize, size_t alignment = alignof(std::max_align_t), size_t blocksPerChunk = 64_z, MemoryResource* upstream = nullptr);
+		NodePool(const NodePool&) = delete;
+		NodePool(NodePool&&) = delete;
+		NodePool& operator=(const NodePool&) = delete;
+		NodePool& operator=(NodePool&&) = delete;
+		~NodePool();
+
+		/// <summary>
+		/// Provides a block when the request fits, otherwise forwards to upstream.
+		/// </summary>
+		/// <param name="size">The number of bytes needed.</param>
+		/// <param name="alignment">A power of two.</param>
+		/// <returns>The memory. Never null.</returns>
+		void* Allocate(size_t size, size_t alignment);
+		/// <summary>
+		/// Keeps the block when both sizes fit; otherwise allocates, copies and deallocates.
+		/// </summary>
+		/// <param name="memory">The memory, obtained from this pool.</param>
+		/// <param name="oldSize">The size it was allocated with.</param>
+		/// <param name="newSize">The size needed.</param>
+		/// <param name="alignment">The alignment it was allocated with.</param>
+		/// <returns>The resized memory, which may be at a new address.</returns>
+		void* Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment);
+		/// <summary>
+		/// Puts a block back on the free list, or returns a request that did not fit to upstream.
+		/// </summary>
+		/// <param name="memory">The memory, obtained from this pool.</param>
+		/// <param name="size">The size it was allocated with.</param>
+		/// <param name="alignment">The alignment it was allocated with.</param>
+		void Deallocate(void* memory, size_t size, size_t alignment);
+
+		/// <summary>
+		/// Determines whether a request is served from the pool rather than upstream.
+		/// </summary>
+		/// <returns>True if size and alignment fit in a block.</returns>
+		bool Fits(size_t size, size_t alignment) const;
+		/// <summary>
+		/// Provides the usable size of each block, which may be larger than the blockSize given to the constructor.
+		/// </summary>
+		/// <returns>The block size in bytes.</returns>
+		size_t BlockSize() const;
+
+		/// <summary>
+		/// Returns every chunk to upstream. Blocks handed out before the call must no longer be used.
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Finds the process-wide pool for a request, one per multiple of alignof(std::max_align_t) up to MaximumSharedBlockSize.
+		/// Node types of the same size share a pool. Shared pools are created together on first use and never destroyed,
+		/// so containers with static storage duration can still give their nodes back during shutdown.
+		/// The pool itself is not synchronized; allocate from it through a default constructed NodePoolAllocator, which locks it.
+		/// </summary>
+		/// <param name="size">The number of bytes needed.</param>
+		/// <param name="alignment">A power of two.</param>
+		/// <returns>The shared pool, or null if the request is too large or too strictly aligned to share.</returns>
+		static NodePool* Shared(size_t size, size_t alignment);
+		/// <summary>
+		/// Returns the chunks of every shared pool to DefaultResource. No container may still hold blocks from a shared pool.
+		/// </summary>
+		static void ReleaseShared();
+
+		/// <summary>
+		/// Allocates from the shared pool for the request while holding its lock, or from DefaultResource if no shared pool fits.
+		/// </summary>
+		/// <param name="size">The number of bytes needed.</param>
+		/// <param name="alignment">A power of two.</param>
+		/// <returns>The memory. Never null.</returns>
+		static void* AllocateShared(size_t size, size_t alignment);
+		/// <summary>
+		/// Resizes memory obtained from AllocateShared, moving it between shared pools or to DefaultResource as needed.
+		/// </summary>
+		/// <param name="memory">The memory, obtained from AllocateShared.</param>
+		/// <param name="oldSize">The size it was allocated with.</param>
+		/// <param name="newSize">The size needed.</param>
+		/// <param name="alignment">The alignment it was allocated with.</param>
+		/// <returns>The resized memory, which may be at a new address.</returns>
+		static void* ReallocateShared(void* memory, size_t oldSize, size_t newSize, size_t alignment);
+		/// <summary>
+		/// Returns memory obtained from AllocateShared while holding the lock of the pool it came from.
+		/// </summary>
+		/// <param name="memory">The memory, obtained from AllocateShared.</param>
+		/// <param name="size">The size it was allocated with.</param>
+		/// <param name="alignment">The alignment it was allocated with.</param>
+		static void DeallocateShared(void* memory, size_t size, size_t alignment);
+
+	private:
+		/// <summary>
+		/// Header at the start of each chunk obtained from upstream.
+		/// </summary>
+		struct Chunk final
+		{
+			Chunk* _next;
+			size_t _size;
+		};
+
+		/// <summary>
+		/// Link stored in a free block.
+		/// </summary>
+		struct FreeBlock final
+		{
+			FreeBlock* _next;
+		};
+
+		/// <summary>
+		/// Carves a new chunk from upstream into free blocks.
+		/// </summary>
+		void Refill();
+
+		/// <summary>
+		/// Head of the free list.
+		/// </summary>
+		FreeBlock* _free{ nullptr };
+		/// <summary>
+		/// Chunks taken from upstream, most recent first.
+		/// </summary>
+		Chunk* _chunks{ nullptr };
+		/// <summary>
+		/// Distance between blocks, which is also the largest request that fits.
+		/// </summary>
+		size_t _blockSize;
+		/// <summary>
+		/// Alignment of every block.
+		/// </summary>
+		size_t _alignment;
+		/// <summary>
+		/// Number of blocks carved from each chunk.
+		/// </summary>
+		size_t _blocksPerChunk;
+		/// <summary>
+		/// Where chunks and requests that do not fit come from.
+		/// </summary>
+		MemoryResource* _upstream;
+	};
+
+	/// <summary>
+	/// Allocator policy that serves node allocations from a NodePool.
+	/// Given a pool, everything a container allocates goes through that pool, which suits a pool per list or per HashMap.
+	/// Default constructed, it uses the shared pool for each request's size, so every container of the same node type shares one pool.
+	/// Shared pools are locked on every allocation, so containers on different threads can use them. A given pool is not synchronized,
+	/// so containers using one must stay on one thread.
+	/// </summary>
+	class NodePoolAllocator final
+	{
+	public:
+		/// <summary>
+		/// Creates an allocator for the shared pools.
+		/// </summary>
+		NodePoolAllocator() = default;
+		/// <summary>
+		/// Creates an allocator for a pool. The pool must outlive every container that allocates from it.
+		/// </summary>
+		/// <param name="pool">The pool to allocate from.</param>
+		NodePoolAllocator(NodePool& pool);
+
+		void* Allocate(size_t size, size_t alignment) const;
+		void* Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment) const;
+		void Deallocate(void* memory, size_t size, size_t alignment) const;
+
+		/// <summary>
+		/// Provides the pool this allocator was given.
+		/// </summary>
+		/// <returns>The pool, or null if this allocator uses the shared pools.</returns>
+		NodePool* Pool() const;
+
+		bool operator==(const NodePoolAllocator& other) const;
+		bool operator!=(const NodePoolAllocator& other) const;
+
+	private:
+		/// <summary>
+		/// The pool this allocator was given, or null for the shared pools.
+		/// </summary>
+		NodePool* _pool{ nullptr };
+	};
+
+	inline void* NodePool::Allocate(size_t size, size_t alignment)
+	{
+		if (!Fits(size, alignment))
+		{
+			return _upstream->Allocate(size, alignment);
+		}
+
+		if (_free == nullptr)
+		{
+			Refill();
+		}
+
+		FreeBlock* block = _free;
+		_free = block->_next;
+		return block;
+	}
+
+	inline void NodePool::Deallocate(void* memory, size_t size, size_t alignment)
+	{
+		if (!Fits(size, alignment))
+		{
+			_upstream->Deallocate(memory, size, alignment);
+			return;
+		}
+
+		FreeBlock* block = static_cast<FreeBlock*>(memory);
+		block->_next = _free;
+		_free = block;
+	}
+
+	inline bool NodePool::Fits(size_t size, size_t alignment) const
+	{
+		return size <= _blockSize && alignment <= _alignment;
+	}
+
+	inline size_t NodePool::BlockSize() const
+	{
+		return _blockSize;
+	}
+
+	inline NodePoolAllocator::NodePoolAllocator(NodePool& pool) :
+		_pool(&pool)
+	{
+	}
+
+	inline void* NodePoolAllocator::Allocate(size_t size, size_t alignment) const
+	{
+		return _pool != nullptr ? _pool->Allocate(size, alignment) : NodePool::AllocateShared(size, alignment);
+	}
+
+	inline void NodePoolAllocator::Deallocate(void* memory, size_t size, size_t alignment) const
+	{
+		if (memory == nullptr)
+		{
+			return;
+		}
+
+		if (_pool != nullptr)
+		{
+			_pool->Deallocate(memory, size, alignment);
+		}
+		else
+		{
+			NodePool::DeallocateShared(memory, size, alignment);
+		}
+	}
+
+	inline NodePool* NodePoolAllocator::Pool() const
+	{
+		return _pool;
+	}
+
+	inline bool NodePoolAllocator::operator==(const NodePoolAllocator& other) const
+	{
+		return _pool == other._pool;
+	}
+
+	inline bool NodePoolAllocator::operator!=(const NodePoolAllocator& other) const
+	{
+		return !operator==(other);
+	}
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <functional>
+#include "ThreadPool.h"
+#include "Vector.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Ranges shorter than this run serially on the calling thread: below it, handing out chunks costs more than it saves.
+	/// </summary>
+	inline constexpr size_t ParallelSerialThreshold = 4096;
+	/// <summary>
+	/// Smallest number of elements given to one task.
+	/// </summary>
+	inline constexpr size_t ParallelMinimumChunkSize = 2048;
+	/// <summary>
+	/// Number of chunks made per thread, so a thread that finishes early can take another chunk rather than sit idle.
+	/// </summary>
+	inline constexpr size_t ParallelChunksPerThread = 4;
+
+	/// <summary>
+	/// Decides how many contiguous chunks a range is split into.
+	/// </summary>
+	/// <param name="count">The number of elements in the range.</param>
+	/// <param name="pool">The pool the chunks will run on.</param>
+	/// <returns>1 for a serial run, otherwise enough chunks to keep every thread busy, each at least ParallelMinimumChunkSize long.</returns>
+	size_t ParallelChunkCount(size_t count, const ThreadPool& pool);
+	/// <summary>
+	/// Provides the offset at which a chunk starts. The chunks of a range differ in length by at most one element.
+	/// </summary>
+	/// <param name="count">The number of elements in the range.</param>
+	/// <param name="chunkCount">The number of chunks the range is split into.</param>
+	/// <param name="chunk">The chunk index. chunkCount gives the end of the range.</param>
+	/// <returns>The offset of the chunk's first element.</returns>
+	size_t ParallelChunkBegin(size_t count, size_t chunkCount, size_t chunk);
+
+	/// <summary>
+	/// Calls func with every element of [first, last), several chunks at a time.
+	/// </summary>
+	/// <param name="first">The first element.</param>
+	/// <param name="last">One past the last element.</param>
+	/// <param name="func">Callable taking a T&. Called concurrently for different elements.</param>
+	/// <param name="pool">The pool to run on.</param>
+	template <typename T, typename TFunc>
+	void ParallelForEach(T* first, T* last, TFunc func, ThreadPool& pool = ThreadPool::Default());
+	/// <summary>
+	/// Calls func with every element of vector, several chunks at a time.
+	/// </summary>
+	template <typename T, typename TAllocator, typename TFunc>
+	void ParallelForEach(Vector<T, TAllocator>& vector, TFunc func, ThreadPool& pool = ThreadPool::Default());
+	/// <summary>
+	/// Calls func with every element of a const vector, several chunks at a time.
+	/// </summary>
+	template <typename T, typename TAllocator, typename TFunc>
+	void ParallelForEach(const Vector<T, TAllocator>& vector, TFunc func, ThreadPool& pool = ThreadPool::Default());
+
+	/// <summary>
+	/// Stores func(first[i]) in output[i] for every element of [first, last).
+	/// </summary>
+	/// <param name="first">The first input element.</param>
+	/// <param name="last">One past the last input element.</param>
+	/// <param name="output">The first of last - first elements to assign. May equal first.</param>
+	/// <param name="func">Callable taking a const TIn& and returning something assignable to TOut. Called concurrently.</param>
+	/// <param name="pool">The pool to run on.</param>
+	/// <returns>One past the last element assigned.</returns>
+	template <typename TIn, typename TOut, typename TFunc>
+	TOut* ParallelTransform(const TIn* first, const TIn* last, TOut* output, TFunc func, ThreadPool& pool = ThreadPool::Default());
+	/// <summary>
+	/// Resizes output to input's size and stores func(input[i]) in output[i] for every element.
+	/// </summary>
+	template <typename TIn, typename TInAllocator, typename TOut, typename TOutAllocator, typename TFunc>
+	void ParallelTransform(const Vector<TIn, TInAllocator>& input, Vector<TOut, TOutAllocator>& output, TFunc func, ThreadPool& pool = ThreadPool::Default());
+
+	/// <summary>
+	/// Combines every element of [first, last) with init. Each chunk is folded on its own, starting from its first element converted to TResult,
+	/// and the chunk results are then folded into init in order. reduce must therefore be associative, and callable both as
+	/// reduce(TResult, const T&) and as reduce(TResult, TResult). The grouping differs from a serial fold, which matters for floating point.
+	/// </summary>
+	/// <param name="first">The first element.</param>
+	/// <param name="last">One past the last element.</param>
+	/// <param name="init">The starting value, included exactly once.</param>
+	/// <param name="reduce">The associative operation. Called concurrently.</param>
+	/// <param name="pool">The pool to run on.</param>
+	/// <returns>The combined value, or init for an empty range.</returns>
+	template <typename T, typename TResult, typename TReduce = std::plus<>>
+	TResult ParallelReduce(const T* first, const T* last, TResult init, TReduce reduce = TReduce{}, ThreadPool& pool = ThreadPool::Default());
+	/// <summary>
+	/// Combines every element of vector with init. See the pointer overload.
+	/// </summary>
+	template <typename T, typename TAllocator, typename TResult, typename TReduce = std::plus<>>
+	TResult ParallelReduce(const Vector<T, TAllocator>& vector, TResult init, TReduce reduce = TReduce{}, ThreadPool& pool = ThreadPool::Default());
+
+	/// <summary>
+	/// Sorts [first, last). Each chunk is sorted with std::sort, then neighbouring runs are merged pairwise in rounds, each round's merges running in parallel.
+	/// The final round is a single merge on one thread. Not stable.
+	/// </summary>
+	/// <param name="first">The first element.</param>
+	/// <param name="last">One past the last element.</param>
+	/// <param name="compare">Strict weak ordering, as for std::sort.</param>
+	/// <param name="pool">The pool to run on.</param>
+	template <typename T, typename TCompare = std::less<>>
+	void ParallelSort(T* first, T* last, TCompare compare = TCompare{}, ThreadPool& pool = ThreadPool::Default());
+	/// <summary>
+	/// Sorts vector. See the pointer overload.
+	/// </summary>
+	template <typename T, typename TAllocator, typename TCompare = std::less<>>
+	void ParallelSort(Vector<T, TAllocator>& vector, TCompare compare = TCompare{}, ThreadPool& pool = ThreadPool::Default());
+
+	/// <summary>
+	/// Reorders [first, last) so every element satisfying predicate comes before every element that does not.
+	/// Each chunk is partitioned with std::partition, then neighbouring chunks are joined pairwise in rounds by rotating
+	/// the left chunk's rejected elements past the right chunk's accepted ones. Like std::partition, relative order is not kept.
+	/// </summary>
+	/// <param name="first">The first element.</param>
+	/// <param name="last">One past the last element.</param>
+	/// <param name="predicate">Callable taking a const T& and returning bool. Called concurrently.</param>
+	/// <param name="pool">The pool to run on.</param>
+	/// <returns>The first element that does not satisfy predicate, or last.</returns>
+	template <typename T, typename TPredicate>
+	T* ParallelPartition(T* first, T* last, TPredicate predicate, ThreadPool& pool = ThreadPool::Default());
+	/// <summary>
+	/// Partitions vector. See the pointer overload.
+	/// </summary>
+	/// <returns>An Iterator to the first element that does not satisfy predicate, or end().</returns>
+	template <typename T, typename TAllocator, typename TPredicate>
+	typename Vector<T, TAllocator>::Iterator ParallelPartition(Vector<T, TAllocator>& vector, TPredicate predicate, ThreadPool& pool = ThreadPool::Default());
+}
+
+#include "ParallelAlgorithms.inl"
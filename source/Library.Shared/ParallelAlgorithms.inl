@@ -0,0 +1,184 @@
+#include "ParallelAlgorithms.h"
+#include <algorithm>
+#include <optional>
+
+namespace FIEAGameEngine
+{
+	inline size_t ParallelChunkCount(size_t count, const ThreadPool& pool)
+	{
+		if (count < ParallelSerialThreshold || pool.Concurrency() == 1_z)
+		{
+			return 1_z;
+		}
+
+		return std::min(count / ParallelMinimumChunkSize, pool.Concurrency() * ParallelChunksPerThread);
+	}
+
+	inline size_t ParallelChunkBegin(size_t count, size_t chunkCount, size_t chunk)
+	{
+		return count / chunkCount * chunk + std::min(chunk, count % chunkCount);
+	}
+
+	template <typename T, typename TFunc>
+	inline void ParallelForEach(T* first, T* last, TFunc func, ThreadPool& pool)
+	{
+		const size_t count = static_cast<size_t>(last - first);
+		const size_t chunkCount = ParallelChunkCount(count, pool);
+		pool.Run(chunkCount, [first, count, chunkCount, &func](size_t chunk)
+		{
+			T* const chunkLast = first + ParallelChunkBegin(count, chunkCount, chunk + 1_z);
+			for (T* element = first + ParallelChunkBegin(count, chunkCount, chunk); element != chunkLast; ++element)
+			{
+				func(*element);
+			}
+		});
+	}
+
+	template <typename T, typename TAllocator, typename TFunc>
+	inline void ParallelForEach(Vector<T, TAllocator>& vector, TFunc func, ThreadPool& pool)
+	{
+		ParallelForEach(vector.Data(), vector.Data() + vector.Size(), std::move(func), pool);
+	}
+
+	template <typename T, typename TAllocator, typename TFunc>
+	inline void ParallelForEach(const Vector<T, TAllocator>& vector, TFunc func, ThreadPool& pool)
+	{
+		ParallelForEach(vector.Data(), vector.Data() + vector.Size(), std::move(func), pool);
+	}
+
+	template <typename TIn, typename TOut, typename TFunc>
+	inline TOut* ParallelTransform(const TIn* first, const TIn* last, TOut* output, TFunc func, ThreadPool& pool)
+	{
+		const size_t count = static_cast<size_t>(last - first);
+		const size_t chunkCount = ParallelChunkCount(count, pool);
+		pool.Run(chunkCount, [first, output, count, chunkCount, &func](size_t chunk)
+		{
+			const size_t chunkLast = ParallelChunkBegin(count, chunkCount, chunk + 1_z);
+			for (size_t i = ParallelChunkBegin(count, chunkCount, chunk); i < chunkLast; ++i)
+			{
+				output[i] = func(first[i]);
+			}
+		});
+
+		return output + count;
+	}
+
+	template <typename TIn, typename TInAllocator, typename TOut, typename TOutAllocator, typename TFunc>
+	inline void ParallelTransform(const Vector<TIn, TInAllocator>& input, Vector<TOut, TOutAllocator>& output, TFunc func, ThreadPool& pool)
+	{
+		output.Resize(input.Size());
+		ParallelTransform(input.Data(), input.Data() + input.Size(), output.Data(), std::move(func), pool);
+	}
+
+	template <typename T, typename TResult, typename TReduce>
+	inline TResult ParallelReduce(const T* first, const T* last, TResult init, TReduce reduce, ThreadPool& pool)
+	{
+		const size_t count = static_cast<size_t>(last - first);
+		if (count == 0_z)
+		{
+			return init;
+		}
+
+		const size_t chunkCount = ParallelChunkCount(count, pool);
+		Vector<std::optional<TResult>> partials;
+		partials.Resize(chunkCount);
+		pool.Run(chunkCount, [first, count, chunkCount, &reduce, &partials](size_t chunk)
+		{
+			const T* element = first + ParallelChunkBegin(count, chunkCount, chunk);
+			const T* const chunkLast = first + ParallelChunkBegin(count, chunkCount, chunk + 1_z);
+			TResult partial(*element);
+			for (++element; element != chunkLast; ++element)
+			{
+				partial = reduce(std::move(partial), *element);
+			}
+			partials[chunk].emplace(std::move(partial));
+		});
+
+		for (std::optional<TResult>& partial : partials)
+		{
+			init = reduce(std::move(init), std::move(*partial));
+		}
+		return init;
+	}
+
+	template <typename T, typename TAllocator, typename TResult, typename TReduce>
+	inline TResult ParallelReduce(const Vector<T, TAllocator>& vector, TResult init, TReduce reduce, ThreadPool& pool)
+	{
+		return ParallelReduce(vector.Data(), vector.Data() + vector.Size(), std::move(init), std::move(reduce), pool);
+	}
+
+	template <typename T, typename TCompare>
+	inline void ParallelSort(T* first, T* last, TCompare compare, ThreadPool& pool)
+	{
+		const size_t count = static_cast<size_t>(last - first);
+		const size_t chunkCount = ParallelChunkCount(count, pool);
+		pool.Run(chunkCount, [first, count, chunkCount, &compare](size_t chunk)
+		{
+			std::sort(first + ParallelChunkBegin(count, chunkCount, chunk), first + ParallelChunkBegin(count, chunkCount, chunk + 1_z), compare);
+		});
+
+		// Runs of width chunks are merged in pairs; the last run of a round may have no partner and is left as it is.
+		for (size_t width = 1_z; width < chunkCount; width *= 2_z)
+		{
+			const size_t pairCount = (chunkCount + 2_z * width - 1_z) / (2_z * width);
+			pool.Run(pairCount, [first, count, chunkCount, width, &compare](size_t pair)
+			{
+				const size_t low = 2_z * width * pair;
+				const size_t middle = std::min(low + width, chunkCount);
+				const size_t high = std::min(low + 2_z * width, chunkCount);
+				if (middle < high)
+				{
+					std::inplace_merge(first + ParallelChunkBegin(count, chunkCount, low), first + ParallelChunkBegin(count, chunkCount, middle), first + ParallelChunkBegin(count, chunkCount, high), compare);
+				}
+			});
+		}
+	}
+
+	template <typename T, typename TAllocator, typename TCompare>
+	inline void ParallelSort(Vector<T, TAllocator>& vector, TCompare compare, ThreadPool& pool)
+	{
+		ParallelSort(vector.Data(), vector.Data() + vector.Size(), std::move(compare), pool);
+	}
+
+	template <typename T, typename TPredicate>
+	inline T* ParallelPartition(T* first, T* last, TPredicate predicate, ThreadPool& pool)
+	{
+		const size_t count = static_cast<size_t>(last - first);
+		const size_t chunkCount = ParallelChunkCount(count, pool);
+
+		// splits[i] is the offset of the first rejected element of the run that starts at chunk i.
+		Vector<size_t> splits;
+		splits.Resize(chunkCount);
+		pool.Run(chunkCount, [first, count, chunkCount, &predicate, &splits](size_t chunk)
+		{
+			T* const chunkLast = first + ParallelChunkBegin(count, chunkCount, chunk + 1_z);
+			splits[chunk] = static_cast<size_t>(std::partition(first + ParallelChunkBegin(count, chunkCount, chunk), chunkLast, predicate) - first);
+		});
+
+		for (size_t width = 1_z; width < chunkCount; width *= 2_z)
+		{
+			const size_t pairCount = (chunkCount + 2_z * width - 1_z) / (2_z * width);
+			pool.Run(pairCount, [first, count, chunkCount, width, &splits](size_t pair)
+			{
+				const size_t low = 2_z * width * pair;
+				const size_t middle = low + width;
+				if (middle < chunkCount)
+				{
+					// [accepted, rejected][accepted, rejected] becomes [accepted, accepted][rejected, rejected].
+					const size_t middleBegin = ParallelChunkBegin(count, chunkCount, middle);
+					std::rotate(first + splits[low], first + middleBegin, first + splits[middle]);
+					splits[low] += splits[middle] - middleBegin;
+				}
+			});
+		}
+
+		return first + splits[0];
+	}
+
+	template <typename T, typename TAllocator, typename TPredicate>
+	inline typename Vector<T, TAllocator>::Iterator ParallelPartition(Vector<T, TAllocator>& vector, TPredicate predicate, ThreadPool& pool)
+	{
+		T* const partitionPoint = ParallelPartition(vector.Data(), vector.Data() + vector.Size(), std::move(predicate), pool);
+		return vector.begin() + static_cast<size_t>(partitionPoint - vector.Data());
+	}
+}
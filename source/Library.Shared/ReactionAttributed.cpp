@@ -57,9 +57,9 @@ namespace FIEAGameEngine
 		return clone;
 	}
 
-	const Vector<Signature> ReactionAttributed::Signatures()
+	const SignatureList ReactionAttributed::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ NameStringLiteral, Datum::DatumTypes::String, 1, offsetof(ReactionAttributed, _name) },
 			{ ActionStringLiteral, Datum::DatumTypes::Table, 0, 0 },
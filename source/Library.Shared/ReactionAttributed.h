@@ -83,7 +83,7 @@ namespace FIEAGameEngine
 		/// Provides the Signatures Vector for an ReactionAttributed with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an ReactionAttributed.</returns>
-		static const Vector<Signature> Signatures();
+		static const SignatureList Signatures();
 
 	protected:
 		/// <summary>
@@ -0,0 +1,100 @@
+#pragma once
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include "SizeLiteral.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Tells the containers whether a T can be moved to a new address by copying its bytes, so growth and erase can use realloc and memmove.
+	/// Defaults to std::is_trivially_copyable. Specialize it to true_type for a type that owns resources but never points into itself.
+	/// </summary>
+	/// <typeparam name="T">The element type.</typeparam>
+	template <typename T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T>
+	{
+	};
+
+	template <typename T>
+	inline constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::value;
+
+	/// <summary>
+	/// Copy constructs count elements from source into the uninitialized storage at destination.
+	/// </summary>
+	/// <param name="destination">Uninitialized storage with room for count elements. Must not overlap source.</param>
+	/// <param name="source">The elements to copy.</param>
+	/// <param name="count">The number of elements to copy.</param>
+	template <typename T>
+	void CopyElements(T* destination, const T* source, size_t count);
+
+	/// <summary>
+	/// Moves count elements from source to destination and ends the lifetime of the originals, leaving the source storage uninitialized.
+	/// The ranges may overlap as long as destination comes before source, which is what growing into a new buffer and closing a gap after an erase need.
+	/// </summary>
+	/// <param name="destination">Uninitialized storage with room for count elements.</param>
+	/// <param name="source">The elements to relocate.</param>
+	/// <param name="count">The number of elements to relocate.</param>
+	template <typename T>
+	void RelocateElements(T* destination, T* source, size_t count);
+
+	/// <summary>
+	/// Destructs count elements starting at data. Does nothing for trivially destructible types.
+	/// </summary>
+	/// <param name="data">The first element to destruct.</param>
+	/// <param name="count">The number of elements to destruct.</param>
+	template <typename T>
+	void DestroyElements(T* data, size_t count);
+
+	template <typename T>
+	inline void CopyElements(T* destination, const T* source, size_t count)
+	{
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (count > 0_z)
+			{
+				std::memcpy(static_cast<void*>(destination), static_cast<const void*>(source), sizeof(T) * count);
+			}
+		}
+		else
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				new(destination + i)T(source[i]);
+			}
+		}
+	}
+
+	template <typename T>
+	inline void RelocateElements(T* destination, T* source, size_t count)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			if (count > 0_z)
+			{
+				std::memmove(static_cast<void*>(destination), static_cast<const void*>(source), sizeof(T) * count);
+			}
+		}
+		else
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				new(destination + i)T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+	}
+
+	template <typename T>
+	inline void DestroyElements(T* data, size_t count)
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				data[i].~T();
+			}
+		}
+	}
+}
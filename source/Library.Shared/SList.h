@@ -1,9 +1,12 @@
 #pragma once
 
+#include <cassert>
 #include <initializer_list>
 #include <stdexcept>
+#include "Allocator.h"
 #include "DefaultEquality.h"
 #include "SizeLiteral.h"
+#include "ContainerStats.h"
 
 
 namespace FIEAGameEngine
@@ -12,7 +15,9 @@ namespace FIEAGameEngine
 	/// <summary>
 	/// A templated class for a singly-linked list. Each element in the list is a Node structure which contains a T-type piece of data.
 	/// </summary>
-	template <typename T>
+	/// <typeparam name="T">The type of element stored in the container.</typeparam>
+	/// <typeparam name="TAllocator">Allocator policy the nodes come from. See DefaultAllocator.</typeparam>
+	template <typename T, typename TAllocator = DefaultAllocator>
 	class SList
 	{
 	private:
@@ -22,18 +27,13 @@ namespace FIEAGameEngine
 		struct Node final
 		{
 			/// <summary>
-			/// Constuctor for a node using a const lvalue. Copies the data from the reference provided into the internal data member.
+			/// Constructor for a node. Constructs the data in place from the arguments provided, so pushing an lvalue copies it, pushing an rvalue moves it
+			/// and emplacing builds the element directly inside the node.
 			/// </summary>
-			/// <param name="data">Data to be copied into this node.</param>
 			/// <param name="next">Pointer to the next node in the list.</param>
-			Node(const T& data, Node* next = nullptr);
-
-			/// <summary>
-			/// Constuctor for a node using a rvalue. Takes the data from the reference provided into the internal data member. 
-			/// </summary>
-			/// <param name="data">Data to be copied into this node.</param>
-			/// <param name="next">Pointer to the next node in the list.</param>
-			Node(T&& data, Node* next = nullptr);
+			/// <param name="args">Arguments forwarded to the constructor of T.</param>
+			template <typename... TArgs>
+			Node(Node* next, TArgs&&... args);
 
 			/// <summary>
 			/// Data that this node represents.
@@ -253,11 +253,25 @@ namespace FIEAGameEngine
 			const Node* _node{ nullptr };
 		};
 
+		/// <summary>
+		/// Size of one node, for sizing a NodePool for this list.
+		/// </summary>
+		static constexpr size_t NodeSize = sizeof(Node);
+		/// <summary>
+		/// Alignment of one node, for sizing a NodePool for this list.
+		/// </summary>
+		static constexpr size_t NodeAlignment = alignof(Node);
+
 		/// <summary>
 		/// Creates a new instance of SList. Default constructor provided by the compiler.
 		/// </summary>
 		SList() = default;
 		/// <summary>
+		/// Creates a new, empty instance of SList whose nodes come from allocator.
+		/// </summary>
+		/// <param name="allocator">The allocator the nodes come from.</param>
+		explicit SList(TAllocator allocator);
+		/// <summary>
 		/// Invokes the copy constructor. 
 		/// Creates a new SList and deep copies each member variable from other SList into this SList. 
 		/// Deep copies each node using the PushBack() method.
@@ -316,6 +330,20 @@ namespace FIEAGameEngine
 		/// <returns>An iterator pointing to the element that was just pushed onto the back of the list.</returns>
 		Iterator PushBack(T&& value);
 		/// <summary>
+		/// Constructs a T element in place at the front of the list from the arguments provided. Updates the front pointer and size.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the constructor of T.</param>
+		/// <returns>An iterator pointing to the element that was just constructed at the front of the list.</returns>
+		template <typename... TArgs>
+		Iterator EmplaceFront(TArgs&&... args);
+		/// <summary>
+		/// Constructs a T element in place at the back of the list from the arguments provided. Updates the back pointer and size.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the constructor of T.</param>
+		/// <returns>An iterator pointing to the element that was just constructed at the back of the list.</returns>
+		template <typename... TArgs>
+		Iterator EmplaceBack(TArgs&&... args);
+		/// <summary>
 		/// Removes a T element onto the front of the list. Updates the back pointer and size.
 		/// </summary>
 		void PopFront();
@@ -324,6 +352,22 @@ namespace FIEAGameEngine
 		/// </summary>
 		void PopBack();
 		/// <summary>
+		/// Unlinks the front node of other and links it onto the front of this list. The element is neither copied nor moved,
+		/// so pointers and references to it stay valid. Updates the front pointer and size of both lists.
+		/// </summary>
+		/// <param name="other">The list whose front element is being transferred. Must not be empty, and must use an allocator equal to this list's.</param>
+		/// <returns>An iterator pointing to the transferred element, now at the front of this list.</returns>
+		Iterator SpliceFront(SList& other);
+		/// <summary>
+		/// Unlinks the node it points to from other and links it onto the front of this list. Like SpliceFront(SList&) the element is neither
+		/// copied nor moved, but finding the node's predecessor walks other from its front.
+		/// </summary>
+		/// <param name="other">The list the element is being transferred from. Must use an allocator equal to this list's.</param>
+		/// <param name="it">An SList Iterator pointing into other at the element to transfer.</param>
+		/// <returns>An iterator pointing to the transferred element, now at the front of this list.</returns>
+		/// <exception cref="std::runtime_error">Thrown if it does not belong to other, or is other's end().</exception>
+		Iterator SpliceFront(SList& other, const Iterator& it);
+		/// <summary>
 		/// Returns a boolean valule representing whether the list has no elements.
 		/// </summary>
 		/// <returns>A boolean value representing whether the size is 0.</returns>
@@ -432,7 +476,32 @@ namespace FIEAGameEngine
 		/// <exception cref="std::runtime_error">Thrown if this function is called using an Iterator that is not associated with this list.</exception>
 		bool Remove(const Iterator& it);
 
+		/// <summary>
+		/// Provides the allocator the nodes come from.
+		/// </summary>
+		/// <returns>A copy of the allocator.</returns>
+		TAllocator GetAllocator() const;
+		/// <summary>
+		/// Reports the elements held and the bytes their nodes take.
+		/// </summary>
+		/// <returns>The element count, one NodeSize per element, and the size of the elements alone.</returns>
+		ContainerStats Stats() const;
+
 	private:
+		/// <summary>
+		/// Allocates a node from the allocator and constructs it.
+		/// </summary>
+		/// <param name="next">Pointer to the next node in the list.</param>
+		/// <param name="args">Arguments forwarded to the constructor of T.</param>
+		/// <returns>The new node.</returns>
+		template <typename... TArgs>
+		Node* CreateNode(Node* next, TArgs&&... args);
+		/// <summary>
+		/// Destructs a node and returns its memory to the allocator.
+		/// </summary>
+		/// <param name="node">The node to destroy.</param>
+		void DestroyNode(Node* node);
+
 		/// <summary>
 		/// Node pointer to the T element at the front of the list.
 		/// </summary>
@@ -445,6 +514,10 @@ namespace FIEAGameEngine
 		/// Internal size_t member representing the number of T elements in the list.
 		/// </summary>
 		size_t _size{ 0 };
+		/// <summary>
+		/// The allocator the nodes come from.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TAllocator _allocator;
 	};
 
 }
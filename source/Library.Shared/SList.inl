@@ -3,41 +3,35 @@
 namespace FIEAGameEngine
 {
 #pragma region Node
-	template<typename T>
-	inline SList<T>::Node::Node(const T& data, Node* next) :
-		_data(data), _next(next)
-	{
-
-	}
-
-	template<typename T>
-	inline SList<T>::Node::Node(T&& data, Node* next) :
-		_data(std::forward<T>(data)), _next(next)
+	template<typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline SList<T, TAllocator>::Node::Node(Node* next, TArgs&&... args) :
+		_data(std::forward<TArgs>(args)...), _next(next)
 	{
 
 	}
 #pragma endregion Node
 
 #pragma region Iterator
-	template<typename T>
-	inline SList<T>::Iterator::Iterator(const SList& owner, Node* node) :
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::Iterator::Iterator(const SList& owner, Node* node) :
 		_owner(&owner), _node(node)
 	{
 
 	}
-	template<typename T>
-	inline bool SList<T>::Iterator::operator==(const Iterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::Iterator::operator==(const Iterator& other) const
 	{
 		return !(operator!=(other));
 	}
-	template<typename T>
-	inline bool SList<T>::Iterator::operator!=(const Iterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		return _owner != other._owner || _node != other._node;
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator& SList<T>::Iterator::operator++()
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator& SList<T, TAllocator>::Iterator::operator++()
 	{
 		if (_owner == nullptr)
 		{
@@ -51,16 +45,16 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::Iterator::operator++(int)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator temp(*this);
 		operator++();
 		return temp;
 	}
 
-	template<typename T>
-	inline T& SList<T>::Iterator::operator*() const
+	template<typename T, typename TAllocator>
+	inline T& SList<T, TAllocator>::Iterator::operator*() const
 	{
 		if (_node == nullptr)
 		{
@@ -69,8 +63,8 @@ namespace FIEAGameEngine
 		return _node->_data;
 	}
 
-	template<typename T>
-	inline T* SList<T>::Iterator::operator->() const
+	template<typename T, typename TAllocator>
+	inline T* SList<T, TAllocator>::Iterator::operator->() const
 	{
 		if (_node == nullptr)
 		{
@@ -84,34 +78,34 @@ namespace FIEAGameEngine
 
 #pragma region ConstIterator
 
-	template<typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const SList& owner, Node* node) :
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::ConstIterator::ConstIterator(const SList& owner, Node* node) :
 		_owner(&owner), _node(node)
 	{
 
 	}
 
-	template<typename T>
-	inline SList<T>::ConstIterator::ConstIterator(const Iterator& other) :
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
 		_owner(other._owner), _node(other._node)
 	{
 
 	}
 
-	template<typename T>
-	inline bool SList<T>::ConstIterator::operator==(const ConstIterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template<typename T>
-	inline bool SList<T>::ConstIterator::operator!=(const ConstIterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return _owner != other._owner || _node != other._node;
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator& SList<T>::ConstIterator::operator++()
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator& SList<T, TAllocator>::ConstIterator::operator++()
 	{
 		if (_owner == nullptr)
 		{
@@ -125,16 +119,16 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::ConstIterator::operator++(int)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp(*this);
 		operator++();
 		return temp;
 	}
 
-	template<typename T>
-	inline const T& SList<T>::ConstIterator::operator*() const
+	template<typename T, typename TAllocator>
+	inline const T& SList<T, TAllocator>::ConstIterator::operator*() const
 	{
 		if (_node == nullptr)
 		{
@@ -143,8 +137,8 @@ namespace FIEAGameEngine
 		return _node->_data;
 	}
 
-	template<typename T>
-	inline const T* SList<T>::ConstIterator::operator->() const
+	template<typename T, typename TAllocator>
+	inline const T* SList<T, TAllocator>::ConstIterator::operator->() const
 	{
 		if (_node == nullptr)
 		{
@@ -157,8 +151,16 @@ namespace FIEAGameEngine
 #pragma endregion ConstIterator
 
 #pragma region SList
-	template<typename T>
-	inline SList<T>::SList(const SList& other)
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::SList(TAllocator allocator) :
+		_allocator(allocator)
+	{
+
+	}
+
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::SList(const SList& other) :
+		_allocator(other._allocator)
 	{
 		for (const T& value : other)
 		{
@@ -166,21 +168,22 @@ namespace FIEAGameEngine
 		}
 	}
 
-	template<typename T>
-	inline SList<T>::SList(SList&& other) noexcept :
-		_front(other._front), _back(other._back), _size(other._size)
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::SList(SList&& other) noexcept :
+		_front(other._front), _back(other._back), _size(other._size), _allocator(other._allocator)
 	{
 		other._front = nullptr;
 		other._back = nullptr;
 		other._size = 0_z;
 	}
 
-	template<typename T>
-	inline SList<T>& SList<T>::operator=(const SList& other)
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>& SList<T, TAllocator>::operator=(const SList& other)
 	{
 		if (this != &other)
 		{
 			Clear();
+			_allocator = other._allocator;
 
 			for (const T& value : other)
 			{
@@ -191,8 +194,8 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline SList<T>& SList<T>::operator=(SList&& other) noexcept
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>& SList<T, TAllocator>::operator=(SList&& other) noexcept
 	{
 		if (this != &other)
 		{
@@ -201,6 +204,7 @@ namespace FIEAGameEngine
 			_front = other._front;
 			_back = other._back;
 			_size = other._size;
+			_allocator = other._allocator;
 
 
 			other._front = nullptr;
@@ -211,59 +215,54 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline SList<T>::~SList()
+	template<typename T, typename TAllocator>
+	inline SList<T, TAllocator>::~SList()
 	{
 		Clear();
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::PushFront(const T& value)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushFront(const T& value)
 	{
-		_front = new Node(value, _front);
-		if (_size == 0_z)
-		{
-			_back = _front;
-		}
-		++_size;
-		return Iterator(*this, _front);
+		return EmplaceFront(value);
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::PushFront(T&& value)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushFront(T&& value)
 	{
-		_front = new Node(std::forward<T>(value), _front);
-		if (_size == 0_z)
-		{
-			_back = _front;
-		}
-		++_size;
-		return Iterator(*this, _front);
+		return EmplaceFront(std::move(value));
 	}
 
-	template<typename T> 
-	inline typename SList<T>::Iterator SList<T>::PushBack(const T& value)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushBack(const T& value)
 	{
-		Node* node = new Node(value);
+		return EmplaceBack(value);
+	}
 
-		if (_size == 0)
-		{
-			_front = node;
-		}
-		else
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushBack(T&& value)
+	{
+		return EmplaceBack(std::move(value));
+	}
+
+	template<typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::EmplaceFront(TArgs&&... args)
+	{
+		_front = CreateNode(_front, std::forward<TArgs>(args)...);
+		if (_size == 0_z)
 		{
-			_back->_next = node;
+			_back = _front;
 		}
-
-		_back = node;
 		++_size;
-		return Iterator(*this, _back);
+		return Iterator(*this, _front);
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::PushBack(T&& value)
+	template<typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::EmplaceBack(TArgs&&... args)
 	{
-		Node* node = new Node(std::forward<T>(value));
+		Node* node = CreateNode(nullptr, std::forward<TArgs>(args)...);
 
 		if (_size == 0_z)
 		{
@@ -279,20 +278,20 @@ namespace FIEAGameEngine
 		return Iterator(*this, _back);
 	}
 
-	template<typename T>
-	inline void SList<T>::PopFront()
+	template<typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::PopFront()
 	{
 		if (_size > 0_z)
 		{
 			Node* temp = _front;
 			_front = _front->_next;
-			delete temp;
+			DestroyNode(temp);
 			--_size;
 		}
 	}
 
-	template<typename T>
-	inline void SList<T>::PopBack()
+	template<typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::PopBack()
 	{
 		if (_size == 1_z)
 		{
@@ -308,19 +307,86 @@ namespace FIEAGameEngine
 			Node* nodeToDelete = currentNode->_next;
 			currentNode->_next = nullptr;
 			_back = currentNode;
-			delete nodeToDelete;
+			DestroyNode(nodeToDelete);
 			--_size;
 		}
 	}
 
-	template<typename T>
-	inline bool SList<T>::IsEmpty() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::SpliceFront(SList& other)
+	{
+		if (other._size == 0_z)
+		{
+			throw std::runtime_error("Empty list.");
+		}
+		assert(_allocator == other._allocator);
+
+		Node* node = other._front;
+		other._front = node->_next;
+		if (--other._size == 0_z)
+		{
+			other._back = nullptr;
+		}
+
+		node->_next = _front;
+		_front = node;
+		if (_size == 0_z)
+		{
+			_back = _front;
+		}
+		++_size;
+		return Iterator(*this, _front);
+	}
+
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::SpliceFront(SList& other, const Iterator& it)
+	{
+		if (it._owner != &other)
+		{
+			throw std::runtime_error("Iterator owners are not the same. Passed in iterator may be nullptr.");
+		}
+		if (it._node == nullptr)
+		{
+			throw std::runtime_error("Cannot splice end().");
+		}
+		if (it._node == other._front)
+		{
+			return SpliceFront(other);
+		}
+		assert(_allocator == other._allocator);
+
+		Node* previous = other._front;
+		while (previous->_next != it._node)
+		{
+			previous = previous->_next;
+		}
+
+		Node* node = it._node;
+		previous->_next = node->_next;
+		if (other._back == node)
+		{
+			other._back = previous;
+		}
+		--other._size;
+
+		node->_next = _front;
+		_front = node;
+		if (_size == 0_z)
+		{
+			_back = _front;
+		}
+		++_size;
+		return Iterator(*this, _front);
+	}
+
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::IsEmpty() const
 	{
 		return _size == 0_z;
 	}
 
-	template<typename T>
-	inline T& SList<T>::Front()
+	template<typename T, typename TAllocator>
+	inline T& SList<T, TAllocator>::Front()
 	{
 		if (_size == 0_z)
 		{
@@ -329,8 +395,8 @@ namespace FIEAGameEngine
 		return _front->_data;
 	}
 
-	template<typename T>
-	inline const T& SList<T>::Front() const
+	template<typename T, typename TAllocator>
+	inline const T& SList<T, TAllocator>::Front() const
 	{
 		if (_size == 0_z)
 		{
@@ -339,8 +405,8 @@ namespace FIEAGameEngine
 		return _front->_data;  
 	}
 
-	template<typename T>
-	inline T& SList<T>::Back()
+	template<typename T, typename TAllocator>
+	inline T& SList<T, TAllocator>::Back()
 	{
 		if (_size == 0_z)
 		{
@@ -349,8 +415,8 @@ namespace FIEAGameEngine
 		return _back->_data;
 	}
 
-	template<typename T>
-	inline const T& SList<T>::Back() const
+	template<typename T, typename TAllocator>
+	inline const T& SList<T, TAllocator>::Back() const
 	{
 		if (_size == 0_z)
 		{
@@ -359,60 +425,60 @@ namespace FIEAGameEngine
 		return _back->_data; 
 	}
 
-	template<typename T>
-	inline size_t SList<T>::Size() const
+	template<typename T, typename TAllocator>
+	inline size_t SList<T, TAllocator>::Size() const
 	{
 		return _size;
 	}
 
-	template<typename T>
-	inline void SList<T>::Clear()
+	template<typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::Clear()
 	{
 		Node* currentNode = _front;
 		while (currentNode != nullptr)
 		{
 			Node* nodeToDelete = currentNode;
 			currentNode = currentNode->_next;
-			delete nodeToDelete;
+			DestroyNode(nodeToDelete);
 		}
 
 		_size = 0_z;
 		_front = _back = nullptr;
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::begin()
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::begin()
 	{
 		return Iterator(*this, _front);
 	}
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::begin() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::begin() const
 	{
 		return ConstIterator(*this, _front);
 	}
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cbegin() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::cbegin() const
 	{
 		return ConstIterator(*this, _front);
 	}
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::end()
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::end()
 	{
 		return Iterator(*this, nullptr);
 	}
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::end() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::end() const
 	{
 		return ConstIterator(*this, nullptr);
 	}
-	template<typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cend() const
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::cend() const
 	{
 		return ConstIterator(*this, nullptr);
 	}
 
-	template<typename T>
-	inline typename SList<T>::Iterator SList<T>::InsertAfter(const T& value, const Iterator& it)
+	template<typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::InsertAfter(const T& value, const Iterator& it)
 	{
 		if (this != it._owner)
 		{
@@ -424,15 +490,15 @@ namespace FIEAGameEngine
 			return PushBack(value);
 		}
 
-		Node* newNode = new Node(value, it._node->_next);
+		Node* newNode = CreateNode(it._node->_next, value);
 		it._node->_next = newNode;
 		++_size;
 		return Iterator(*this, newNode);
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template <typename EqualityFunctor>
-	inline typename SList<T>::Iterator SList<T>::Find(const T& value)
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Find(const T& value)
 	{
 		EqualityFunctor eq;
 
@@ -447,22 +513,22 @@ namespace FIEAGameEngine
 		return it;
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template <typename EqualityFunctor>
-	inline typename SList<T>::ConstIterator SList<T>::Find(const T& value) const
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::Find(const T& value) const
 	{
 		return const_cast<SList*>(this)->Find<EqualityFunctor>(value);
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template<typename EqualityFunctor>
-	inline bool SList<T>::Remove(const T& value)
+	inline bool SList<T, TAllocator>::Remove(const T& value)
 	{
 		return Remove(Find<EqualityFunctor>(value));
 	}
 
-	template<typename T>
-	inline bool SList<T>::Remove(const Iterator& it)
+	template<typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::Remove(const Iterator& it)
 	{
 		if (this != it._owner)
 		{
@@ -484,7 +550,7 @@ namespace FIEAGameEngine
 				it._node->_data.~T();
 				new(&it._node->_data)T(std::move(next->_data));
 				it._node->_next = next->_next;
-				delete next;
+				DestroyNode(next);
 
 				if (it._node->_next == nullptr)
 				{
@@ -496,6 +562,41 @@ namespace FIEAGameEngine
 		}
 		return found;
 	}
+	template<typename T, typename TAllocator>
+	inline TAllocator SList<T, TAllocator>::GetAllocator() const
+	{
+		return _allocator;
+	}
+
+	template<typename T, typename TAllocator>
+	inline ContainerStats SList<T, TAllocator>::Stats() const
+	{
+		return ContainerStats{ _size, _size * NodeSize, _size * sizeof(T) };
+	}
+
+	template<typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline typename SList<T, TAllocator>::Node* SList<T, TAllocator>::CreateNode(Node* next, TArgs&&... args)
+	{
+		void* memory = _allocator.Allocate(sizeof(Node), alignof(Node));
+		assert(memory != nullptr);
+		try
+		{
+			return new(memory)Node(next, std::forward<TArgs>(args)...);
+		}
+		catch (...)
+		{
+			_allocator.Deallocate(memory, sizeof(Node), alignof(Node));
+			throw;
+		}
+	}
+
+	template<typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::DestroyNode(Node* node)
+	{
+		node->~Node();
+		_allocator.Deallocate(node, sizeof(Node), alignof(Node));
+	}
 #pragma endregion SList
 }
 
@@ -1,18 +1,20 @@
 #include "pch.h"
 #include "Scope.h"
+#include <algorithm>
 
 namespace FIEAGameEngine
 {
 	RTTI_DEFINITIONS(Scope)
 
-	Scope::Scope(size_t capacity) :
-		_order(capacity)
+	Scope::Scope(size_t capacity, MemoryResource* resource) :
+		_dictionary(11_z, {}, {}, ResourceAllocator(resource)), _order(0_z, ResourceAllocator(resource))
 	{
-
+		_dictionary.Reserve(capacity);
+		MemoryStatistics::Register(*this);
 	}
 
 	Scope::Scope(const Scope& other) : 
-		_dictionary(other._dictionary.BucketSize()), _order(other._order.Size()) 
+		_dictionary(other._dictionary.BucketSize(), {}, {}, other._dictionary.GetAllocator()), _order(other._order.Size(), other._order.GetAllocator())
 	{ 
 		for (auto& item : other._order) 
 		{ 
@@ -34,6 +36,7 @@ namespace FIEAGameEngine
 				newDatum = existingDatum; 
 			} 
 		} 
+		MemoryStatistics::Register(*this);
 	}
 
 	Scope::Scope(Scope&& other) noexcept : 
@@ -65,6 +68,7 @@ namespace FIEAGameEngine
 			}
 
 		}
+		MemoryStatistics::Register(*this);
 	}
 
 	Scope& Scope::operator=(const Scope& other)
@@ -143,6 +147,7 @@ namespace FIEAGameEngine
 
 	Scope::~Scope()
 	{
+		MemoryStatistics::Unregister(*this);
 		Clear();
 	}
 
@@ -189,9 +194,10 @@ namespace FIEAGameEngine
 		return _order[index]->second;
 	}
 
-	Datum& Scope::operator[](const std::string name)
+	Datum& Scope::operator[](std::string_view name)
 	{
-		return Append(name);
+		Datum* datum = Find(name);
+		return (datum != nullptr) ? *datum : Append(std::string(name));
 	}
 
 	size_t Scope::Size() const
@@ -210,9 +216,9 @@ namespace FIEAGameEngine
 		{
 			if (item.second.Type() == Datum::DatumTypes::Table)
 			{
-				for (std::uint32_t i = 0; i < item.second.Size(); ++i)
+				for (Scope* scope : item.second.AsSpan<Scope*>())
 				{
-					delete& item.second.GetScope(i);
+					delete scope;
 				}
 			}
 		}
@@ -225,66 +231,60 @@ namespace FIEAGameEngine
 		return new Scope(*this);
 	}
 
-	Datum* Scope::Find(const std::string& name)
+	Datum* Scope::Find(std::string_view name)
 	{
 		auto result = _dictionary.Find(name);
 		return (result == _dictionary.end()) ? nullptr : &(result->second);
 	}
 
-	const Datum* Scope::Find(const std::string& name) const
+	const Datum* Scope::Find(std::string_view name) const
 	{
 		auto result = _dictionary.Find(name);
 		return (result == _dictionary.end()) ? nullptr : &(result->second);
 	}
 
-	Datum* Scope::Search(const std::string& name)
+	Datum* Scope::Search(std::string_view name)
 	{
 		Scope* found;
 		return Search(name, found);
 	}
 
-	const Datum* Scope::Search(const std::string& name) const
+	const Datum* Scope::Search(std::string_view name) const
 	{
 		const Scope* found;
 		return Search(name, found);
 	}
 
-	Datum* Scope::Search(const std::string& name, Scope*& scope)
+	Datum* Scope::Search(std::string_view name, Scope*& scope)
 	{
-		Datum* datum = Find(name);
-
-		scope = this;
+		const size_t hash = _dictionary.Hash(name);
 
-		if (datum == nullptr)
+		for (scope = this; scope != nullptr; scope = scope->_parent)
 		{
-			scope = nullptr;
-
-			if (_parent != nullptr)
+			auto result = scope->_dictionary.Find(name, hash);
+			if (result != scope->_dictionary.end())
 			{
-				datum = _parent->Search(name, scope);
+				return &(result->second);
 			}
 		}
 
-		return datum;
+		return nullptr;
 	}
 
-	const Datum* Scope::Search(const std::string& name, const Scope*& scope) const
+	const Datum* Scope::Search(std::string_view name, const Scope*& scope) const
 	{
-		const Datum* datum = Find(name);
+		const size_t hash = _dictionary.Hash(name);
 
-		scope = this;
-
-		if (datum == nullptr)
+		for (scope = this; scope != nullptr; scope = scope->_parent)
 		{
-			scope = nullptr;
-
-			if (_parent != nullptr)
+			auto result = scope->_dictionary.Find(name, hash);
+			if (result != scope->_dictionary.end())
 			{
-				datum = _parent->Search(name, scope);
+				return &(result->second);
 			}
 		}
 
-		return datum;
+		return nullptr;
 	}
 
 	Datum& Scope::Append(const std::string& name)
@@ -294,8 +294,21 @@ namespace FIEAGameEngine
 			throw std::invalid_argument("Cannot append with an empty string.");
 		}
 
-		const auto& result = _dictionary.Insert(std::make_pair(name, Datum()));
+		return AddToOrder(_dictionary.TryEmplace(name));
+	}
+
+	Datum& Scope::Append(std::string&& name)
+	{
+		if (name.empty())
+		{
+			throw std::invalid_argument("Cannot append with an empty string.");
+		}
+
+		return AddToOrder(_dictionary.TryEmplace(std::move(name)));
+	}
 
+	Datum& Scope::AddToOrder(const std::pair<DictionaryType::Iterator, bool>& result)
+	{
 		auto& it = result.first;
 		Datum& datum = it->second;
 		bool wasInserted = result.second;
@@ -317,7 +330,7 @@ namespace FIEAGameEngine
 			throw std::runtime_error("Cannot append a scope to a Datum that is not of type Unknown or type Table.");
 		}
 
-		Scope* s = new Scope();
+		Scope* s = new Scope(11_z, Resource());
 
 		s->_parent = this;
 		
@@ -417,12 +430,11 @@ namespace FIEAGameEngine
 		{
 			if (item.second.Type() == Datum::DatumTypes::Table)
 			{
-				for (std::uint32_t i = 0; i < item.second.Size(); ++i)
+				const std::span<Scope*> scopes = item.second.AsSpan<Scope*>();
+				const auto position = std::find(scopes.begin(), scopes.end(), &scope);
+				if (position != scopes.end())
 				{
-					if (&scope == &item.second.GetScope(i))
-					{
-						return std::make_pair(&item.second, i);
-					}
+					return std::make_pair(&item.second, static_cast<std::uint32_t>(position - scopes.begin()));
 				}
 			}
 		}
@@ -441,17 +453,22 @@ namespace FIEAGameEngine
 		return std::to_string(Size());
 	}
 
-	FIEAGameEngine::Datum& Scope::At(const std::string& name)
+	FIEAGameEngine::Datum& Scope::At(std::string_view name)
 	{
 		FIEAGameEngine::Datum* datum = Find(name);
 		assert(datum != nullptr);
 		return *datum;
 	}
 
-	const FIEAGameEngine::Datum& Scope::At(const std::string& name) const
+	const FIEAGameEngine::Datum& Scope::At(std::string_view name) const
 	{
 		return const_cast<Scope*>(this)->At(name);
 	}
+
+	MemoryResource* Scope::Resource() const
+	{
+		return _dictionary.GetAllocator().Resource();
+	}
 }
 
 
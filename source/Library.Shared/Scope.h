@@ -1,9 +1,12 @@
 #pragma once
 #include "Datum.h"
 #include "HashMap.h"
+#include "SmallVector.h"
 #include "RTTI.h"
 #include "Factory.h"
+#include "MemoryStatistics.h"
 #include "gsl/gsl"
+#include <string_view>
 
 namespace FIEAGameEngine
 {
@@ -15,15 +18,28 @@ namespace FIEAGameEngine
 	class Scope : public FIEAGameEngine::RTTI
 	{
 		RTTI_DECLARATIONS(Scope, RTTI)
+		friend MemoryStatistics;
 
 	public:
-		using PairType = HashMap<const std::string, Datum>::PairType;
+		/// <summary>
+		/// The name-to-Datum dictionary. Its buckets and nodes come from the MemoryResource the Scope was created with.
+		/// </summary>
+		using DictionaryType = HashMap<const std::string, Datum, DefaultHash<const std::string>, DefaultEquality<const std::string>, ResourceAllocator>;
+		using PairType = DictionaryType::PairType;
+		/// <summary>
+		/// Pointers to the pairs of a Scope in insertion order. Most Scopes are Actions or Entities with a handful of attributes, so the first few are stored inline.
+		/// </summary>
+		using OrderType = SmallVector<PairType*, 4, ResourceAllocator>;
 		/// <summary>
 		/// Creates a new instance of Scope. Takes in a capacity if user knows how much memory to allocate.
-		/// No memory is allocated by default.
+		/// The dictionary is sized for capacity attributes, so that many can be appended before it grows.
+		/// The order list is not reserved up front; it keeps its first few entries inline and only allocates once a Scope outgrows them.
 		/// </summary>
 		/// <param name="capacity">Gives user the option to specify a capacity upfront. Default value is 0.</param>
-		explicit Scope(size_t capacity = 11_z);
+		/// <param name="resource">Where the dictionary and order list allocate from, e.g. a MonotonicResource that holds a whole level.
+		/// Scopes created by AppendScope and copies of this Scope use it too, so it must outlive all of them. Null means DefaultResource.
+		/// The Scope objects themselves and the arrays inside each Datum are still allocated normally.</param>
+		explicit Scope(size_t capacity = 11_z, MemoryResource* resource = nullptr);
 
 		/// <summary>
 		/// Invokes the copy constructor. 
@@ -93,11 +109,12 @@ namespace FIEAGameEngine
 		/// <returns>Reference to the Scope at that index in the Datum.</returns>
 		Datum& operator[](std::uint32_t index) const;
 		/// <summary>
-		/// Bracket overload to return the Scope with the provided name in the Datum.
+		/// Bracket overload to return the Datum with the provided name, appending it if it does not exist yet.
+		/// Only builds a std::string when the name has to be appended.
 		/// </summary>
-		/// <param name="index">The name of the Datum inside this Scope.</param>
-		/// <returns>Reference to the Scope with the provided name in the Datum.</returns>
-		Datum& operator[](const std::string name);
+		/// <param name="name">The name of the Datum inside this Scope.</param>
+		/// <returns>Reference to the Datum with the provided name.</returns>
+		Datum& operator[](std::string_view name);
 
 		/// <summary>
 		/// Provides the number of elements currently in the dictionary.
@@ -127,7 +144,7 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="name">The name associated with the Datum.</param>
 		/// <returns>The address of the Datum associated with the given name. </returns>
-		Datum* Find(const std::string& name);
+		Datum* Find(std::string_view name);
 
 		/// <summary>
 		/// Finds a Datum in the dictionary of this scope based on its name.
@@ -135,15 +152,16 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="name">The name associated with the Datum.</param>
 		/// <returns>The address of the Datum associated with the given name. </returns>
-		const Datum* Find(const std::string& name) const;
+		const Datum* Find(std::string_view name) const;
 
 		/// <summary>
 		/// Searches through this scope and its ancestors to find the most-closely nested Datum associated with the given name.
 		/// If it does not find the datum, returns nullptr.
+		/// The name is hashed once and the hash is reused at every level of the parent chain.
 		/// </summary>
 		/// <param name="name">The name of the Datum to find.</param>
 		/// <returns>Pointer to the Datum being searched for if found and nullptr otherwise.</returns>
-		Datum* Search(const std::string& name);
+		Datum* Search(std::string_view name);
 
 		/// <summary>
 		/// Searches through this scope and its ancestors to find the most-closely nested Datum associated with the given name.
@@ -152,7 +170,7 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="name">The name of the Datum to find.</param>
 		/// <returns>Pointer to the Datum being searched for if found and nullptr otherwise.</returns>
-		const Datum* Search(const std::string& name) const;
+		const Datum* Search(std::string_view name) const;
 
 
 		/// <summary>
@@ -163,7 +181,7 @@ namespace FIEAGameEngine
 		/// <param name="name">The name of the Datum to find.</param>
 		/// <param name="scope">The scope reference that will have the address of the Scope object which contains the match.</param>
 		/// <returns>Pointer to the Datum being searched for if found and nullptr otherwise.</returns>
-		Datum* Search(const std::string& name, Scope*& scope);
+		Datum* Search(std::string_view name, Scope*& scope);
 
 		/// <summary>
 		/// Searches through this scope and its ancestors to find the most-closely nested Datum associated with the given name.
@@ -174,7 +192,7 @@ namespace FIEAGameEngine
 		/// <param name="name">The name of the Datum to find.</param>
 		/// <param name="scope">The scope reference that will have the address of the Scope object which contains the match.</param>
 		/// <returns>Pointer to the Datum being searched for if found and nullptr otherwise.</returns>
-		const Datum* Search(const std::string& name, const Scope*& scope) const;
+		const Datum* Search(std::string_view name, const Scope*& scope) const;
 
 		/// <summary>
 		/// Returns a Datum in the dictionary. 
@@ -184,6 +202,13 @@ namespace FIEAGameEngine
 		/// <returns>Reference to the Datum associated with the name provided.</returns>
 		/// <exception cref="std::invalid_argument">Thrown when a empty string is passed in for the name.</exception>
 		Datum& Append(const std::string& name);
+		/// <summary>
+		/// Returns a Datum in the dictionary, moving name into the dictionary if a new Datum has to be created.
+		/// </summary>
+		/// <param name="name">The name associated with the Datum.</param>
+		/// <returns>Reference to the Datum associated with the name provided.</returns>
+		/// <exception cref="std::invalid_argument">Thrown when a empty string is passed in for the name.</exception>
+		Datum& Append(std::string&& name);
 
 		/// <summary>
 		/// Returns a Scope in the dictionary. (Special case of Append)
@@ -263,7 +288,7 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="name">The name associated with the Datum to be searched for.</param>
 		/// <returns>The datum associated with the name provided.</returns>
-		FIEAGameEngine::Datum& At(const std::string& name);
+		FIEAGameEngine::Datum& At(std::string_view name);
 		/// <summary>
 		/// For use with a const Scope
 		/// Provides the Datum associated with the name inside this object.
@@ -271,21 +296,47 @@ namespace FIEAGameEngine
 		/// </summary>
 		/// <param name="name">The name associated with the Datum to be searched for.</param>
 		/// <returns>The datum associated with the name provided.</returns>
-		const FIEAGameEngine::Datum& At(const std::string& name) const;
+		const FIEAGameEngine::Datum& At(std::string_view name) const;
+
+		/// <summary>
+		/// Provides the resource the dictionary and order list allocate from.
+		/// </summary>
+		/// <returns>The resource given to the constructor, or DefaultResource. Never null.</returns>
+		MemoryResource* Resource() const;
 
 	protected:
+		/// <summary>
+		/// Records a newly inserted pair in _order. Shared by both Append overloads.
+		/// </summary>
+		/// <param name="result">The result of inserting into _dictionary.</param>
+		/// <returns>Reference to the Datum of the pair, whether or not it was just inserted.</returns>
+		Datum& AddToOrder(const std::pair<DictionaryType::Iterator, bool>& result);
+
 		/// <summary>
 		/// Hashmap that maps names to datums of an available type.
+		/// Stays on the chained HashMap rather than FlatHashMap: _order and callers of Append hold pointers into it, which must survive later inserts.
 		/// </summary>
-		HashMap<const std::string, Datum> _dictionary;
+		DictionaryType _dictionary;
 		/// <summary>
-		/// Vector that tracks the order of insertions into the dictionary by storing pointers to those pairs.
+		/// Tracks the order of insertions into the dictionary by storing pointers to those pairs.
 		/// </summary>
-		Vector<HashMap<const std::string, Datum>::PairType*> _order;
+		OrderType _order;
 		/// <summary>
 		/// Pointer to scope for its parent
 		/// </summary>
 		Scope* _parent{ nullptr };
+
+#if FIEA_MEMORY_STATISTICS
+	private:
+		/// <summary>
+		/// The live Scope constructed just before this one, for MemoryStatistics. Not copied or moved with the Scope.
+		/// </summary>
+		Scope* _olderScope{ nullptr };
+		/// <summary>
+		/// The live Scope constructed just after this one, for MemoryStatistics. Not copied or moved with the Scope.
+		/// </summary>
+		Scope* _newerScope{ nullptr };
+#endif
 	};
 	ConcreteFactory(Scope, Scope)
 }
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "Datum.h"
+#include "SmallVector.h"
 
 namespace FIEAGameEngine
 {
@@ -25,4 +26,9 @@ namespace FIEAGameEngine
 		/// </summary>
 		size_t StorageOffset;
 	};
+
+	/// <summary>
+	/// The signatures prescribed by one type. Types rarely prescribe more than a few attributes, so they are stored inline.
+	/// </summary>
+	using SignatureList = SmallVector<Signature, 4>;
 }
\ No newline at end of file
@@ -0,0 +1,315 @@
+#include "pch.h"
+#include "SimdFind.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define FIEA_SIMD_X86
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#include <cpuid.h>
+#define FIEA_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#include <intrin.h>
+#define FIEA_TARGET_AVX2
+#endif
+#endif
+
+namespace FIEAGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Pointers compared as integers of the same width, so 32-bit builds get 32-bit lanes.
+		/// </summary>
+		using PointerBits = std::conditional_t<sizeof(void*) == 8, std::uint64_t, std::uint32_t>;
+
+		/// <summary>
+		/// One search routine per element type, all of the same level.
+		/// </summary>
+		struct FindKernels final
+		{
+			size_t (*_int)(const int* data, size_t count, int value);
+			size_t (*_float)(const float* data, size_t count, float value);
+			size_t (*_vec4)(const glm::vec4* data, size_t count, const glm::vec4& value);
+			size_t (*_pointer)(const PointerBits* data, size_t count, PointerBits value);
+		};
+
+		template <typename T>
+		size_t ScalarFind(const T* data, size_t count, const T& value)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				if (data[i] == value)
+				{
+					return i;
+				}
+			}
+			return count;
+		}
+
+		template <typename T>
+		size_t ScalarFindByValue(const T* data, size_t count, T value)
+		{
+			return ScalarFind(data, count, value);
+		}
+
+		constexpr FindKernels ScalarKernels{ &ScalarFindByValue<int>, &ScalarFindByValue<float>, &ScalarFind<glm::vec4>, &ScalarFindByValue<PointerBits> };
+
+#ifdef FIEA_SIMD_X86
+		// Each kernel compares whole vectors of elements against the broadcast value. MatchMask turns one comparison into MaskBitsPerElement bits
+		// per element, and WholeElements keeps the lowest bit of each element that matched in full, so the lowest set bit is the first match.
+		// The main loop tests four vectors per branch; what is left is done a vector, then an element, at a time.
+
+		template <typename T>
+		inline constexpr size_t MaskBitsPerElement = 1;
+		template <>
+		inline constexpr size_t MaskBitsPerElement<glm::vec4> = 4;
+
+		template <typename T>
+		constexpr unsigned int WholeElements(unsigned int mask)
+		{
+			if constexpr (MaskBitsPerElement<T> == 4)
+			{
+				// A vector matches when all four of its component bits are set.
+				return mask & (mask >> 1) & (mask >> 2) & (mask >> 3) & 0x11111111u;
+			}
+			else
+			{
+				return mask;
+			}
+		}
+
+		inline __m128i BroadcastSSE2(int value) { return _mm_set1_epi32(value); }
+		inline __m128 BroadcastSSE2(float value) { return _mm_set1_ps(value); }
+		inline __m128 BroadcastSSE2(const glm::vec4& value) { return _mm_loadu_ps(&value.x); }
+		inline __m128i BroadcastSSE2(PointerBits value)
+		{
+			if constexpr (sizeof(PointerBits) == 8)
+			{
+				return _mm_set1_epi64x(static_cast<long long>(value));
+			}
+			else
+			{
+				return _mm_set1_epi32(static_cast<int>(value));
+			}
+		}
+
+		inline unsigned int MatchMaskSSE2(const int* data, __m128i target)
+		{
+			return static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), target))));
+		}
+
+		inline unsigned int MatchMaskSSE2(const float* data, __m128 target)
+		{
+			return static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data), target)));
+		}
+
+		inline unsigned int MatchMaskSSE2(const glm::vec4* data, __m128 target)
+		{
+			return static_cast<unsigned int>(_mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(&data->x), target)));
+		}
+
+		inline unsigned int MatchMaskSSE2(const PointerBits* data, __m128i target)
+		{
+			const __m128i equal = _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)), target);
+			if constexpr (sizeof(PointerBits) == 8)
+			{
+				// SSE2 has no 64-bit compare: a pointer matches when both of its 32-bit halves do.
+				return static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(_mm_and_si128(equal, _mm_shuffle_epi32(equal, _MM_SHUFFLE(2, 3, 0, 1))))));
+			}
+			else
+			{
+				return static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+			}
+		}
+
+		template <typename T>
+		size_t FindSSE2(const T* data, size_t count, const T& value)
+		{
+			constexpr size_t Width = 16 / sizeof(T);
+			constexpr size_t Bits = MaskBitsPerElement<T>;
+			const auto target = BroadcastSSE2(value);
+			size_t i = 0_z;
+			for (; i + 4 * Width <= count; i += 4 * Width)
+			{
+				const unsigned int mask = WholeElements<T>(MatchMaskSSE2(data + i, target) | MatchMaskSSE2(data + i + Width, target) << (Width * Bits) |
+					MatchMaskSSE2(data + i + 2 * Width, target) << (2 * Width * Bits) | MatchMaskSSE2(data + i + 3 * Width, target) << (3 * Width * Bits));
+				if (mask != 0)
+				{
+					return i + std::countr_zero(mask) / Bits;
+				}
+			}
+			for (; i + Width <= count; i += Width)
+			{
+				const unsigned int mask = WholeElements<T>(MatchMaskSSE2(data + i, target));
+				if (mask != 0)
+				{
+					return i + std::countr_zero(mask) / Bits;
+				}
+			}
+			return i + ScalarFind(data + i, count - i, value);
+		}
+
+		template <typename T>
+		size_t FindByValueSSE2(const T* data, size_t count, T value)
+		{
+			return FindSSE2(data, count, value);
+		}
+
+		constexpr FindKernels SSE2Kernels{ &FindByValueSSE2<int>, &FindByValueSSE2<float>, &FindSSE2<glm::vec4>, &FindByValueSSE2<PointerBits> };
+
+		FIEA_TARGET_AVX2 inline __m256i BroadcastAVX2(int value) { return _mm256_set1_epi32(value); }
+		FIEA_TARGET_AVX2 inline __m256 BroadcastAVX2(float value) { return _mm256_set1_ps(value); }
+		FIEA_TARGET_AVX2 inline __m256 BroadcastAVX2(const glm::vec4& value) { return _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&value.x)); }
+		FIEA_TARGET_AVX2 inline __m256i BroadcastAVX2(PointerBits value)
+		{
+			if constexpr (sizeof(PointerBits) == 8)
+			{
+				return _mm256_set1_epi64x(static_cast<long long>(value));
+			}
+			else
+			{
+				return _mm256_set1_epi32(static_cast<int>(value));
+			}
+		}
+
+		FIEA_TARGET_AVX2 inline unsigned int MatchMaskAVX2(const int* data, __m256i target)
+		{
+			return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)), target))));
+		}
+
+		FIEA_TARGET_AVX2 inline unsigned int MatchMaskAVX2(const float* data, __m256 target)
+		{
+			return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(data), target, _CMP_EQ_OQ)));
+		}
+
+		FIEA_TARGET_AVX2 inline unsigned int MatchMaskAVX2(const glm::vec4* data, __m256 target)
+		{
+			return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(&data->x), target, _CMP_EQ_OQ)));
+		}
+
+		FIEA_TARGET_AVX2 inline unsigned int MatchMaskAVX2(const PointerBits* data, __m256i target)
+		{
+			const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+			if constexpr (sizeof(PointerBits) == 8)
+			{
+				return static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, target))));
+			}
+			else
+			{
+				return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, target))));
+			}
+		}
+
+		template <typename T>
+		FIEA_TARGET_AVX2 size_t FindAVX2(const T* data, size_t count, const T& value)
+		{
+			constexpr size_t Width = 32 / sizeof(T);
+			constexpr size_t Bits = MaskBitsPerElement<T>;
+			const auto target = BroadcastAVX2(value);
+			size_t i = 0_z;
+			for (; i + 4 * Width <= count; i += 4 * Width)
+			{
+				const unsigned int mask = WholeElements<T>(MatchMaskAVX2(data + i, target) | MatchMaskAVX2(data + i + Width, target) << (Width * Bits) |
+					MatchMaskAVX2(data + i + 2 * Width, target) << (2 * Width * Bits) | MatchMaskAVX2(data + i + 3 * Width, target) << (3 * Width * Bits));
+				if (mask != 0)
+				{
+					return i + std::countr_zero(mask) / Bits;
+				}
+			}
+			for (; i + Width <= count; i += Width)
+			{
+				const unsigned int mask = WholeElements<T>(MatchMaskAVX2(data + i, target));
+				if (mask != 0)
+				{
+					return i + std::countr_zero(mask) / Bits;
+				}
+			}
+			return i + ScalarFind(data + i, count - i, value);
+		}
+
+		template <typename T>
+		FIEA_TARGET_AVX2 size_t FindByValueAVX2(const T* data, size_t count, T value)
+		{
+			return FindAVX2(data, count, value);
+		}
+
+		constexpr FindKernels AVX2Kernels{ &FindByValueAVX2<int>, &FindByValueAVX2<float>, &FindAVX2<glm::vec4>, &FindByValueAVX2<PointerBits> };
+
+		bool ProcessorSupportsAVX2()
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("avx2");
+#else
+			int registers[4];
+			__cpuid(registers, 0);
+			if (registers[0] < 7)
+			{
+				return false;
+			}
+
+			// The processor must have AVX2, and the operating system must save the 256-bit registers on a context switch.
+			__cpuid(registers, 1);
+			constexpr int OSXSAVE = 1 << 27;
+			constexpr int AVX = 1 << 28;
+			if ((registers[2] & (OSXSAVE | AVX)) != (OSXSAVE | AVX) || (_xgetbv(0) & 0x6) != 0x6)
+			{
+				return false;
+			}
+
+			__cpuidex(registers, 7, 0);
+			constexpr int AVX2 = 1 << 5;
+			return (registers[1] & AVX2) != 0;
+#endif
+		}
+#endif
+
+		const FindKernels& KernelsFor(SimdLevel level)
+		{
+			switch (std::min(level, SupportedSimdLevel()))
+			{
+#ifdef FIEA_SIMD_X86
+			case SimdLevel::AVX2:
+				return AVX2Kernels;
+			case SimdLevel::SSE2:
+				return SSE2Kernels;
+#endif
+			default:
+				return ScalarKernels;
+			}
+		}
+	}
+
+	SimdLevel SupportedSimdLevel()
+	{
+#ifdef FIEA_SIMD_X86
+		static const SimdLevel level = ProcessorSupportsAVX2() ? SimdLevel::AVX2 : SimdLevel::SSE2;
+		return level;
+#else
+		return SimdLevel::Scalar;
+#endif
+	}
+
+	size_t SimdFind(const int* data, size_t count, int value, SimdLevel level)
+	{
+		return KernelsFor(level)._int(data, count, value);
+	}
+
+	size_t SimdFind(const float* data, size_t count, float value, SimdLevel level)
+	{
+		return KernelsFor(level)._float(data, count, value);
+	}
+
+	size_t SimdFind(const glm::vec4* data, size_t count, const glm::vec4& value, SimdLevel level)
+	{
+		return KernelsFor(level)._vec4(data, count, value);
+	}
+
+	size_t SimdFindPointer(const void* const* data, size_t count, const void* value, SimdLevel level)
+	{
+		return KernelsFor(level)._pointer(reinterpret_cast<const PointerBits*>(data), count, reinterpret_cast<PointerBits>(value));
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <glm/glm.hpp>
+#include "SizeLiteral.h"
+
+namespace FIEAGameEngine
+{
+	class RTTI;
+
+	/// <summary>
+	/// The instruction sets the SimdFind kernels are written for, from slowest to fastest.
+	/// </summary>
+	enum class SimdLevel
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	/// <summary>
+	/// Provides the fastest level this build and processor support. Checked once, on first use.
+	/// SSE2 is part of every x86-64 processor; AVX2 is detected at runtime, so one binary runs everywhere and uses it where it exists.
+	/// Builds for other architectures always report Scalar.
+	/// </summary>
+	/// <returns>The level SimdFind uses when none is given.</returns>
+	SimdLevel SupportedSimdLevel();
+
+	/// <summary>
+	/// Tells the containers whether SimdFind can stand in for a linear search with DefaultEquality&lt;T&gt;.
+	/// True for int, float, glm::vec4 and object pointers, except the pointer types whose DefaultEquality compares what they point to (RTTI* and C strings).
+	/// </summary>
+	/// <typeparam name="T">The element type.</typeparam>
+	template <typename T>
+	inline constexpr bool IsSimdFindable =
+		std::is_same_v<T, int> || std::is_same_v<T, float> || std::is_same_v<T, glm::vec4> ||
+		(std::is_pointer_v<T> && !std::is_function_v<std::remove_pointer_t<T>> && !std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, char> && !std::is_same_v<std::remove_cv_t<std::remove_pointer_t<T>>, RTTI>);
+
+	/// <summary>
+	/// Searches count ints for value, several at a time.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of elements.</param>
+	/// <param name="value">The element we are searching for.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	/// <returns>The index of the first match, or count if there is none.</returns>
+	size_t SimdFind(const int* data, size_t count, int value, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Searches count floats for value, several at a time. Matches exactly as operator== does: NaN never matches and -0 matches +0.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of elements.</param>
+	/// <param name="value">The element we are searching for.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	/// <returns>The index of the first match, or count if there is none.</returns>
+	size_t SimdFind(const float* data, size_t count, float value, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Searches count vectors for value, comparing every component as operator== on floats does.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of elements.</param>
+	/// <param name="value">The element we are searching for.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	/// <returns>The index of the first match, or count if there is none.</returns>
+	size_t SimdFind(const glm::vec4* data, size_t count, const glm::vec4& value, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Searches count pointers for one with the same address as value, several at a time.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of elements.</param>
+	/// <param name="value">The address we are searching for.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	/// <returns>The index of the first match, or count if there is none.</returns>
+	size_t SimdFindPointer(const void* const* data, size_t count, const void* value, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Searches count pointers of any type for one with the same address as value. See SimdFindPointer.
+	/// </summary>
+	template <typename T>
+	size_t SimdFind(T* const* data, size_t count, T* value, SimdLevel level = SupportedSimdLevel());
+}
+
+#include "SimdFind.inl"
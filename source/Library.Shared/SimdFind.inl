@@ -0,0 +1,11 @@
+#include "SimdFind.h"
+
+namespace FIEAGameEngine
+{
+	template <typename T>
+	inline size_t SimdFind(T* const* data, size_t count, T* value, SimdLevel level)
+	{
+		// Every object pointer has the same size and representation, so the array can be read as const void* elements.
+		return SimdFindPointer(reinterpret_cast<const void* const*>(data), count, value, level);
+	}
+}
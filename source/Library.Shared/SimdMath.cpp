@@ -0,0 +1,588 @@
+#include "pch.h"
+#include "SimdMath.h"
+#include <algorithm>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define FIEA_SIMD_X86
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#include <cpuid.h>
+#define FIEA_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#include <intrin.h>
+#define FIEA_TARGET_AVX2
+#endif
+#endif
+
+namespace FIEAGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// One routine per operation, all of the same level.
+		/// </summary>
+		struct MathKernels final
+		{
+			void (*_scale)(float* data, size_t count, float factor);
+			void (*_add)(float* destination, const float* source, size_t count);
+			void (*_multiplyAdd)(float* destination, const float* source, float factor, size_t count);
+			void (*_lerp)(float* destination, const float* target, float t, size_t count);
+			void (*_clamp)(float* data, size_t count, float minimum, float maximum);
+			void (*_transform)(glm::vec4* data, size_t count, const glm::mat4& matrix);
+			float (*_sum)(const float* data, size_t count);
+			glm::vec4 (*_sumVectors)(const glm::vec4* data, size_t count);
+			float (*_min)(const float* data, size_t count);
+			float (*_max)(const float* data, size_t count);
+			void (*_toFloat)(const int* source, float* destination, size_t count);
+			void (*_toInt)(const float* source, int* destination, size_t count);
+		};
+
+#pragma region Scalar
+		// The scalar kernels are also what the SIMD kernels finish their last few elements with.
+
+		void ScalarScale(float* data, size_t count, float factor)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				data[i] *= factor;
+			}
+		}
+
+		void ScalarAdd(float* destination, const float* source, size_t count)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				destination[i] += source[i];
+			}
+		}
+
+		void ScalarMultiplyAdd(float* destination, const float* source, float factor, size_t count)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				destination[i] += source[i] * factor;
+			}
+		}
+
+		void ScalarLerp(float* destination, const float* target, float t, size_t count)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				destination[i] += (target[i] - destination[i]) * t;
+			}
+		}
+
+		void ScalarClamp(float* data, size_t count, float minimum, float maximum)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				data[i] = std::min(std::max(data[i], minimum), maximum);
+			}
+		}
+
+		void ScalarTransform(glm::vec4* data, size_t count, const glm::mat4& matrix)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				data[i] = matrix * data[i];
+			}
+		}
+
+		float ScalarSum(const float* data, size_t count)
+		{
+			float total = 0.0f;
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				total += data[i];
+			}
+			return total;
+		}
+
+		glm::vec4 ScalarSumVectors(const glm::vec4* data, size_t count)
+		{
+			glm::vec4 total(0.0f);
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				total += data[i];
+			}
+			return total;
+		}
+
+		float ScalarMin(const float* data, size_t count)
+		{
+			return *std::min_element(data, data + count);
+		}
+
+		float ScalarMax(const float* data, size_t count)
+		{
+			return *std::max_element(data, data + count);
+		}
+
+		void ScalarToFloat(const int* source, float* destination, size_t count)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				destination[i] = static_cast<float>(source[i]);
+			}
+		}
+
+		void ScalarToInt(const float* source, int* destination, size_t count)
+		{
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				destination[i] = static_cast<int>(source[i]);
+			}
+		}
+
+		constexpr MathKernels ScalarKernels{ &ScalarScale, &ScalarAdd, &ScalarMultiplyAdd, &ScalarLerp, &ScalarClamp, &ScalarTransform,
+			&ScalarSum, &ScalarSumVectors, &ScalarMin, &ScalarMax, &ScalarToFloat, &ScalarToInt };
+#pragma endregion
+
+#ifdef FIEA_SIMD_X86
+#pragma region SSE2
+		// Four floats per register. Every load and store is unaligned, because Datum and Vector storage is only aligned to its element.
+
+		void ScaleSSE2(float* data, size_t count, float factor)
+		{
+			const __m128 scale = _mm_set1_ps(factor);
+			size_t i = 0_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(data + i, _mm_mul_ps(_mm_loadu_ps(data + i), scale));
+			}
+			ScalarScale(data + i, count - i, factor);
+		}
+
+		void AddSSE2(float* destination, const float* source, size_t count)
+		{
+			size_t i = 0_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(destination + i, _mm_add_ps(_mm_loadu_ps(destination + i), _mm_loadu_ps(source + i)));
+			}
+			ScalarAdd(destination + i, source + i, count - i);
+		}
+
+		void MultiplyAddSSE2(float* destination, const float* source, float factor, size_t count)
+		{
+			const __m128 scale = _mm_set1_ps(factor);
+			size_t i = 0_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(destination + i, _mm_add_ps(_mm_loadu_ps(destination + i), _mm_mul_ps(_mm_loadu_ps(source + i), scale)));
+			}
+			ScalarMultiplyAdd(destination + i, source + i, factor, count - i);
+		}
+
+		void LerpSSE2(float* destination, const float* target, float t, size_t count)
+		{
+			const __m128 fraction = _mm_set1_ps(t);
+			size_t i = 0_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 from = _mm_loadu_ps(destination + i);
+				_mm_storeu_ps(destination + i, _mm_add_ps(from, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(target + i), from), fraction)));
+			}
+			ScalarLerp(destination + i, target + i, t, count - i);
+		}
+
+		void ClampSSE2(float* data, size_t count, float minimum, float maximum)
+		{
+			const __m128 lower = _mm_set1_ps(minimum);
+			const __m128 upper = _mm_set1_ps(maximum);
+			size_t i = 0_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(data + i, _mm_min_ps(_mm_max_ps(_mm_loadu_ps(data + i), lower), upper));
+			}
+			ScalarClamp(data + i, count - i, minimum, maximum);
+		}
+
+		void TransformSSE2(glm::vec4* data, size_t count, const glm::mat4& matrix)
+		{
+			const __m128 column0 = _mm_loadu_ps(&matrix[0].x);
+			const __m128 column1 = _mm_loadu_ps(&matrix[1].x);
+			const __m128 column2 = _mm_loadu_ps(&matrix[2].x);
+			const __m128 column3 = _mm_loadu_ps(&matrix[3].x);
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				// Summed in the same order as glm, so the result matches matrix * vector exactly.
+				const __m128 vector = _mm_loadu_ps(&data[i].x);
+				const __m128 xy = _mm_add_ps(_mm_mul_ps(column0, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0))),
+					_mm_mul_ps(column1, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+				const __m128 zw = _mm_add_ps(_mm_mul_ps(column2, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))),
+					_mm_mul_ps(column3, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3))));
+				_mm_storeu_ps(&data[i].x, _mm_add_ps(xy, zw));
+			}
+		}
+
+		/// <summary>
+		/// Adds the four lanes of a register together.
+		/// </summary>
+		inline float HorizontalSumSSE2(__m128 value)
+		{
+			const __m128 pairs = _mm_add_ps(value, _mm_movehl_ps(value, value));
+			return _mm_cvtss_f32(_mm_add_ss(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 1, 1, 1))));
+		}
+
+		float SumSSE2(const float* data, size_t count)
+		{
+			__m128 total = _mm_setzero_ps();
+			size_t i = 0_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				total = _mm_add_ps(total, _mm_loadu_ps(data + i));
+			}
+			return HorizontalSumSSE2(total) + ScalarSum(data + i, count - i);
+		}
+
+		glm::vec4 SumVectorsSSE2(const glm::vec4* data, size_t count)
+		{
+			__m128 total = _mm_setzero_ps();
+			for (size_t i = 0_z; i < count; ++i)
+			{
+				total = _mm_add_ps(total, _mm_loadu_ps(&data[i].x));
+			}
+
+			glm::vec4 result;
+			_mm_storeu_ps(&result.x, total);
+			return result;
+		}
+
+		float MinSSE2(const float* data, size_t count)
+		{
+			if (count < 4)
+			{
+				return ScalarMin(data, count);
+			}
+
+			__m128 least = _mm_loadu_ps(data);
+			size_t i = 4_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				least = _mm_min_ps(least, _mm_loadu_ps(data + i));
+			}
+			// The last four elements overlap ones already seen, which min does not mind.
+			least = _mm_min_ps(least, _mm_loadu_ps(data + count - 4));
+			least = _mm_min_ps(least, _mm_movehl_ps(least, least));
+			return _mm_cvtss_f32(_mm_min_ss(least, _mm_shuffle_ps(least, least, _MM_SHUFFLE(1, 1, 1, 1))));
+		}
+
+		float MaxSSE2(const float* data, size_t count)
+		{
+			if (count < 4)
+			{
+				return ScalarMax(data, count);
+			}
+
+			__m128 greatest = _mm_loadu_ps(data);
+			size_t i = 4_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				greatest = _mm_max_ps(greatest, _mm_loadu_ps(data + i));
+			}
+			greatest = _mm_max_ps(greatest, _mm_loadu_ps(data + count - 4));
+			greatest = _mm_max_ps(greatest, _mm_movehl_ps(greatest, greatest));
+			return _mm_cvtss_f32(_mm_max_ss(greatest, _mm_shuffle_ps(greatest, greatest, _MM_SHUFFLE(1, 1, 1, 1))));
+		}
+
+		void ToFloatSSE2(const int* source, float* destination, size_t count)
+		{
+			size_t i = 0_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(destination + i, _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i))));
+			}
+			ScalarToFloat(source + i, destination + i, count - i);
+		}
+
+		void ToIntSSE2(const float* source, int* destination, size_t count)
+		{
+			size_t i = 0_z;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i), _mm_cvttps_epi32(_mm_loadu_ps(source + i)));
+			}
+			ScalarToInt(source + i, destination + i, count - i);
+		}
+
+		constexpr MathKernels SSE2Kernels{ &ScaleSSE2, &AddSSE2, &MultiplyAddSSE2, &LerpSSE2, &ClampSSE2, &TransformSSE2,
+			&SumSSE2, &SumVectorsSSE2, &MinSSE2, &MaxSSE2, &ToFloatSSE2, &ToIntSSE2 };
+#pragma endregion
+
+#pragma region AVX2
+		// Eight floats per register, two vectors per register for the vec4 kernels. Every processor with AVX2 also has FMA,
+		// which the multiply-add, lerp and transform kernels use; SupportedMathLevel checks for it all the same.
+
+		FIEA_TARGET_AVX2 void ScaleAVX2(float* data, size_t count, float factor)
+		{
+			const __m256 scale = _mm256_set1_ps(factor);
+			size_t i = 0_z;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(data + i, _mm256_mul_ps(_mm256_loadu_ps(data + i), scale));
+			}
+			ScalarScale(data + i, count - i, factor);
+		}
+
+		FIEA_TARGET_AVX2 void AddAVX2(float* destination, const float* source, size_t count)
+		{
+			size_t i = 0_z;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(destination + i, _mm256_add_ps(_mm256_loadu_ps(destination + i), _mm256_loadu_ps(source + i)));
+			}
+			ScalarAdd(destination + i, source + i, count - i);
+		}
+
+		FIEA_TARGET_AVX2 void MultiplyAddAVX2(float* destination, const float* source, float factor, size_t count)
+		{
+			const __m256 scale = _mm256_set1_ps(factor);
+			size_t i = 0_z;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(destination + i, _mm256_fmadd_ps(_mm256_loadu_ps(source + i), scale, _mm256_loadu_ps(destination + i)));
+			}
+			ScalarMultiplyAdd(destination + i, source + i, factor, count - i);
+		}
+
+		FIEA_TARGET_AVX2 void LerpAVX2(float* destination, const float* target, float t, size_t count)
+		{
+			const __m256 fraction = _mm256_set1_ps(t);
+			size_t i = 0_z;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 from = _mm256_loadu_ps(destination + i);
+				_mm256_storeu_ps(destination + i, _mm256_fmadd_ps(_mm256_sub_ps(_mm256_loadu_ps(target + i), from), fraction, from));
+			}
+			ScalarLerp(destination + i, target + i, t, count - i);
+		}
+
+		FIEA_TARGET_AVX2 void ClampAVX2(float* data, size_t count, float minimum, float maximum)
+		{
+			const __m256 lower = _mm256_set1_ps(minimum);
+			const __m256 upper = _mm256_set1_ps(maximum);
+			size_t i = 0_z;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(data + i, _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(data + i), lower), upper));
+			}
+			ScalarClamp(data + i, count - i, minimum, maximum);
+		}
+
+		FIEA_TARGET_AVX2 void TransformAVX2(glm::vec4* data, size_t count, const glm::mat4& matrix)
+		{
+			const __m256 column0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[0].x));
+			const __m256 column1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[1].x));
+			const __m256 column2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[2].x));
+			const __m256 column3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(&matrix[3].x));
+			size_t i = 0_z;
+			for (; i + 2 <= count; i += 2)
+			{
+				// _mm256_permute_ps repeats one component across each vector's half of the register.
+				const __m256 vectors = _mm256_loadu_ps(&data[i].x);
+				__m256 result = _mm256_mul_ps(column0, _mm256_permute_ps(vectors, _MM_SHUFFLE(0, 0, 0, 0)));
+				result = _mm256_fmadd_ps(column1, _mm256_permute_ps(vectors, _MM_SHUFFLE(1, 1, 1, 1)), result);
+				result = _mm256_fmadd_ps(column2, _mm256_permute_ps(vectors, _MM_SHUFFLE(2, 2, 2, 2)), result);
+				result = _mm256_fmadd_ps(column3, _mm256_permute_ps(vectors, _MM_SHUFFLE(3, 3, 3, 3)), result);
+				_mm256_storeu_ps(&data[i].x, result);
+			}
+			ScalarTransform(data + i, count - i, matrix);
+		}
+
+		FIEA_TARGET_AVX2 float SumAVX2(const float* data, size_t count)
+		{
+			// Two accumulators, so each add does not wait on the one before it.
+			__m256 total0 = _mm256_setzero_ps();
+			__m256 total1 = _mm256_setzero_ps();
+			size_t i = 0_z;
+			for (; i + 16 <= count; i += 16)
+			{
+				total0 = _mm256_add_ps(total0, _mm256_loadu_ps(data + i));
+				total1 = _mm256_add_ps(total1, _mm256_loadu_ps(data + i + 8));
+			}
+			const __m256 total = _mm256_add_ps(total0, total1);
+			return HorizontalSumSSE2(_mm_add_ps(_mm256_castps256_ps128(total), _mm256_extractf128_ps(total, 1))) + ScalarSum(data + i, count - i);
+		}
+
+		FIEA_TARGET_AVX2 glm::vec4 SumVectorsAVX2(const glm::vec4* data, size_t count)
+		{
+			__m256 total = _mm256_setzero_ps();
+			size_t i = 0_z;
+			for (; i + 2 <= count; i += 2)
+			{
+				total = _mm256_add_ps(total, _mm256_loadu_ps(&data[i].x));
+			}
+
+			glm::vec4 result;
+			_mm_storeu_ps(&result.x, _mm_add_ps(_mm256_castps256_ps128(total), _mm256_extractf128_ps(total, 1)));
+			return result + ScalarSumVectors(data + i, count - i);
+		}
+
+		FIEA_TARGET_AVX2 float MinAVX2(const float* data, size_t count)
+		{
+			if (count < 8)
+			{
+				return MinSSE2(data, count);
+			}
+
+			__m256 least = _mm256_loadu_ps(data);
+			for (size_t i = 8_z; i + 8 <= count; i += 8)
+			{
+				least = _mm256_min_ps(least, _mm256_loadu_ps(data + i));
+			}
+			least = _mm256_min_ps(least, _mm256_loadu_ps(data + count - 8));
+
+			float lanes[8];
+			_mm256_storeu_ps(lanes, least);
+			return ScalarMin(lanes, 8_z);
+		}
+
+		FIEA_TARGET_AVX2 float MaxAVX2(const float* data, size_t count)
+		{
+			if (count < 8)
+			{
+				return MaxSSE2(data, count);
+			}
+
+			__m256 greatest = _mm256_loadu_ps(data);
+			for (size_t i = 8_z; i + 8 <= count; i += 8)
+			{
+				greatest = _mm256_max_ps(greatest, _mm256_loadu_ps(data + i));
+			}
+			greatest = _mm256_max_ps(greatest, _mm256_loadu_ps(data + count - 8));
+
+			float lanes[8];
+			_mm256_storeu_ps(lanes, greatest);
+			return ScalarMax(lanes, 8_z);
+		}
+
+		FIEA_TARGET_AVX2 void ToFloatAVX2(const int* source, float* destination, size_t count)
+		{
+			size_t i = 0_z;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(destination + i, _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + i))));
+			}
+			ScalarToFloat(source + i, destination + i, count - i);
+		}
+
+		FIEA_TARGET_AVX2 void ToIntAVX2(const float* source, int* destination, size_t count)
+		{
+			size_t i = 0_z;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + i), _mm256_cvttps_epi32(_mm256_loadu_ps(source + i)));
+			}
+			ScalarToInt(source + i, destination + i, count - i);
+		}
+
+		constexpr MathKernels AVX2Kernels{ &ScaleAVX2, &AddAVX2, &MultiplyAddAVX2, &LerpAVX2, &ClampAVX2, &TransformAVX2,
+			&SumAVX2, &SumVectorsAVX2, &MinAVX2, &MaxAVX2, &ToFloatAVX2, &ToIntAVX2 };
+#pragma endregion
+
+		bool ProcessorSupportsFMA()
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			__builtin_cpu_init();
+			return __builtin_cpu_supports("fma");
+#else
+			int registers[4];
+			__cpuid(registers, 1);
+			constexpr int FMA = 1 << 12;
+			return (registers[2] & FMA) != 0;
+#endif
+		}
+#endif
+
+		/// <summary>
+		/// The fastest level the math kernels can run at. Like SupportedSimdLevel, except that AVX2 also needs FMA.
+		/// </summary>
+		SimdLevel SupportedMathLevel()
+		{
+#ifdef FIEA_SIMD_X86
+			static const SimdLevel level = SupportedSimdLevel() == SimdLevel::AVX2 && ProcessorSupportsFMA() ? SimdLevel::AVX2 : std::min(SupportedSimdLevel(), SimdLevel::SSE2);
+			return level;
+#else
+			return SimdLevel::Scalar;
+#endif
+		}
+
+		const MathKernels& KernelsFor(SimdLevel level)
+		{
+			switch (std::min(level, SupportedMathLevel()))
+			{
+#ifdef FIEA_SIMD_X86
+			case SimdLevel::AVX2:
+				return AVX2Kernels;
+			case SimdLevel::SSE2:
+				return SSE2Kernels;
+#endif
+			default:
+				return ScalarKernels;
+			}
+		}
+	}
+
+	void SimdScale(float* data, size_t count, float factor, SimdLevel level)
+	{
+		KernelsFor(level)._scale(data, count, factor);
+	}
+
+	void SimdAdd(float* destination, const float* source, size_t count, SimdLevel level)
+	{
+		KernelsFor(level)._add(destination, source, count);
+	}
+
+	void SimdMultiplyAdd(float* destination, const float* source, float factor, size_t count, SimdLevel level)
+	{
+		KernelsFor(level)._multiplyAdd(destination, source, factor, count);
+	}
+
+	void SimdLerp(float* destination, const float* target, float t, size_t count, SimdLevel level)
+	{
+		KernelsFor(level)._lerp(destination, target, t, count);
+	}
+
+	void SimdClamp(float* data, size_t count, float minimum, float maximum, SimdLevel level)
+	{
+		KernelsFor(level)._clamp(data, count, minimum, maximum);
+	}
+
+	void SimdTransform(glm::vec4* data, size_t count, const glm::mat4& matrix, SimdLevel level)
+	{
+		KernelsFor(level)._transform(data, count, matrix);
+	}
+
+	float SimdSum(const float* data, size_t count, SimdLevel level)
+	{
+		return KernelsFor(level)._sum(data, count);
+	}
+
+	glm::vec4 SimdSum(const glm::vec4* data, size_t count, SimdLevel level)
+	{
+		return KernelsFor(level)._sumVectors(data, count);
+	}
+
+	float SimdMin(const float* data, size_t count, SimdLevel level)
+	{
+		assert(count > 0_z);
+		return KernelsFor(level)._min(data, count);
+	}
+
+	float SimdMax(const float* data, size_t count, SimdLevel level)
+	{
+		assert(count > 0_z);
+		return KernelsFor(level)._max(data, count);
+	}
+
+	void SimdConvert(const int* source, float* destination, size_t count, SimdLevel level)
+	{
+		KernelsFor(level)._toFloat(source, destination, count);
+	}
+
+	void SimdConvert(const float* source, int* destination, size_t count, SimdLevel level)
+	{
+		KernelsFor(level)._toInt(source, destination, count);
+	}
+}
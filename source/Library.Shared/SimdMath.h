@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <glm/glm.hpp>
+#include "SimdFind.h"
+
+namespace FIEAGameEngine
+{
+	// Bulk arithmetic over contiguous floats, vectors and matrices, several elements at a time. Each function takes the level to run at,
+	// clamped to SupportedSimdLevel, as SimdFind does. glm::vec4 and glm::mat4 arrays are plain floats, so the element-wise functions
+	// work on them too when given four or sixteen floats per element. Where noted, the result may differ from a scalar loop in the last bit,
+	// because the AVX2 kernels use fused multiply-add and the reductions add in a different order.
+
+	/// <summary>
+	/// Multiplies count floats by factor, in place.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of floats.</param>
+	/// <param name="factor">The value every element is multiplied by.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	void SimdScale(float* data, size_t count, float factor, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Adds each of count source floats to the destination float at the same index.
+	/// </summary>
+	/// <param name="destination">The first element to add to.</param>
+	/// <param name="source">The first element to add. May be the same array as destination.</param>
+	/// <param name="count">The number of floats.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	void SimdAdd(float* destination, const float* source, size_t count, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Adds source times factor to destination, element by element. The AVX2 kernel rounds once per element.
+	/// </summary>
+	/// <param name="destination">The first element to add to.</param>
+	/// <param name="source">The first element to scale and add. May be the same array as destination.</param>
+	/// <param name="factor">The value each source element is multiplied by.</param>
+	/// <param name="count">The number of floats.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	void SimdMultiplyAdd(float* destination, const float* source, float factor, size_t count, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Moves each destination float the fraction t of the way to the target float at the same index: destination + (target - destination) * t.
+	/// </summary>
+	/// <param name="destination">The first element to move.</param>
+	/// <param name="target">The first element to move towards.</param>
+	/// <param name="t">0 leaves destination unchanged; 1 makes it target.</param>
+	/// <param name="count">The number of floats.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	void SimdLerp(float* destination, const float* target, float t, size_t count, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Limits count floats to the range [minimum, maximum], in place.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of floats.</param>
+	/// <param name="minimum">The least value an element keeps.</param>
+	/// <param name="maximum">The greatest value an element keeps. Must not be less than minimum.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	void SimdClamp(float* data, size_t count, float minimum, float maximum, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Replaces each of count vectors with matrix * vector. Transforming the four columns of a matrix this way multiplies the whole matrix.
+	/// </summary>
+	/// <param name="data">The first vector.</param>
+	/// <param name="count">The number of vectors.</param>
+	/// <param name="matrix">The matrix every vector is multiplied by.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	void SimdTransform(glm::vec4* data, size_t count, const glm::mat4& matrix, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Adds up count floats. The kernels keep several running sums, so the result can differ from a scalar loop in the last bits.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of floats.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	/// <returns>The total, or 0 if count is 0.</returns>
+	float SimdSum(const float* data, size_t count, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Adds up count vectors, component by component.
+	/// </summary>
+	/// <param name="data">The first vector.</param>
+	/// <param name="count">The number of vectors.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	/// <returns>The total, or a zero vector if count is 0.</returns>
+	glm::vec4 SimdSum(const glm::vec4* data, size_t count, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Finds the least of count floats. The result is unspecified if any of them is NaN.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of floats. Must not be 0.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	/// <returns>The least element.</returns>
+	float SimdMin(const float* data, size_t count, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Finds the greatest of count floats. The result is unspecified if any of them is NaN.
+	/// </summary>
+	/// <param name="data">The first element.</param>
+	/// <param name="count">The number of floats. Must not be 0.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	/// <returns>The greatest element.</returns>
+	float SimdMax(const float* data, size_t count, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Converts count ints to floats, as static_cast does.
+	/// </summary>
+	/// <param name="source">The first int.</param>
+	/// <param name="destination">The first float written.</param>
+	/// <param name="count">The number of elements.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	void SimdConvert(const int* source, float* destination, size_t count, SimdLevel level = SupportedSimdLevel());
+	/// <summary>
+	/// Converts count floats to ints, rounding towards zero as static_cast does. The result is unspecified for values outside the range of int.
+	/// </summary>
+	/// <param name="source">The first float.</param>
+	/// <param name="destination">The first int written.</param>
+	/// <param name="count">The number of elements.</param>
+	/// <param name="level">The kernel to use. Clamped to SupportedSimdLevel.</param>
+	void SimdConvert(const float* source, int* destination, size_t count, SimdLevel level = SupportedSimdLevel());
+}
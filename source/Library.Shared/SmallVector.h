@@ -0,0 +1,544 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include "SizeLiteral.h"
+#include "DefaultIncrement.h"
+#include "DefaultEquality.h"
+#include "Relocation.h"
+#include "Allocator.h"
+#include "SimdFind.h"
+#include "ContainerStats.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// A templated vector that stores its first N elements inside the object itself and only allocates heap memory once it grows past N.
+	/// Has the same interface and iterator semantics as Vector, so it can replace a Vector that usually holds only a handful of elements.
+	/// Elements are moved the same way Vector moves them (see IsTriviallyRelocatable).
+	/// Unlike Vector, pushing, reserving or shrinking can move the elements between the inline buffer and the heap, so pointers and references into the
+	/// container are invalidated by any operation that changes its capacity. Iterators stay valid because they store an index, not an address.
+	/// </summary>
+	/// <typeparam name="T">The type of element stored in the container.</typeparam>
+	/// <typeparam name="N">The number of elements stored inline before the first heap allocation.</typeparam>
+	/// <typeparam name="TAllocator">Allocator policy for the heap buffer. See DefaultAllocator.</typeparam>
+	template <typename T, std::size_t N, typename TAllocator = DefaultAllocator>
+	class SmallVector
+	{
+		static_assert(N > 0, "A SmallVector needs room for at least one inline element.");
+
+	public:
+		/// <summary>
+		/// Iterator object for the SmallVector container. Can access the private members of both SmallVector and ConstIterator.
+		/// </summary>
+		class Iterator final
+		{
+			friend SmallVector;
+			friend class ConstIterator;
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+			/// <summary>
+			/// Creates a new instance of a SmallVector Iterator that is not associated with any container.
+			/// </summary>
+			Iterator() = default;
+			Iterator(const Iterator& other) = default;
+			Iterator(Iterator&& other) noexcept = default;
+			Iterator& operator=(const Iterator& other) = default;
+			Iterator& operator=(Iterator&& other) noexcept = default;
+			~Iterator() = default;
+
+			/// <summary>
+			/// Equality operator. Two iterators are equal if they belong to the same SmallVector and point at the same index.
+			/// </summary>
+			/// <param name="other">The instance of SmallVector Iterator that we are comparing against.</param>
+			/// <returns>A boolean representing whether equality test was true.</returns>
+			bool operator==(const Iterator& other) const;
+			/// <summary>
+			/// Not Equality operator. Tests whether a SmallVector Iterator is not equal to another.
+			/// </summary>
+			/// <param name="other">The instance of SmallVector Iterator that we are comparing against.</param>
+			/// <returns>A boolean representing whether equality test was true.</returns>
+			bool operator!=(const Iterator& other) const;
+			/// <summary>
+			/// Prefix Increment operator. Changes the SmallVector Iterator to point to the next element in the SmallVector.
+			/// </summary>
+			/// <returns>A reference to this Iterator.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any vector.</exception>
+			Iterator& operator++();
+			/// <summary>
+			/// Postfix Increment operator. Changes the SmallVector Iterator to point to the next element in the SmallVector.
+			/// </summary>
+			/// <param name="int">Fake parameter name.</param>
+			/// <returns>A copy of this Iterator from before the increment.</returns>
+			Iterator operator++(int);
+			/// <summary>
+			/// Prefix Decrement operator. Changes the SmallVector Iterator to point to the previous element in the SmallVector.
+			/// </summary>
+			/// <returns>A reference to this Iterator.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any vector.</exception>
+			Iterator& operator--();
+			/// <summary>
+			/// Postfix Decrement operator. Changes the SmallVector Iterator to point to the previous element in the SmallVector.
+			/// </summary>
+			/// <param name="int">Fake parameter name.</param>
+			/// <returns>A copy of this Iterator from before the decrement.</returns>
+			Iterator operator--(int);
+			/// <summary>
+			/// Addition operator. Gives an iterator that has been moved forward a certain number of elements.
+			/// </summary>
+			/// <param name="increment">The amount of elements that the iterator will move forward.</param>
+			/// <returns>The new iterator that has been moved forward.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any vector.</exception>
+			Iterator operator+(size_t increment) const;
+			/// <summary>
+			/// Subtraction operator. Gives an iterator that has been moved backward a certain number of elements.
+			/// </summary>
+			/// <param name="decrement">The amount of elements that the iterator will move backward.</param>
+			/// <returns>The new iterator that has been moved backward.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any vector.</exception>
+			Iterator operator-(size_t decrement) const;
+			/// <summary>
+			/// Dereference operator. Exposes the element that the SmallVector Iterator is pointing to.
+			/// </summary>
+			/// <returns>A reference to the underlying element that this Iterator points to.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any vector, or is past the last element.</exception>
+			T& operator*() const;
+			/// <summary>
+			/// Member access operator. Exposes the element that the SmallVector Iterator is pointing to.
+			/// </summary>
+			/// <returns>A pointer to the underlying element that this Iterator points to.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the Iterator is not associated with any vector, or is past the last element.</exception>
+			T* operator->() const;
+
+		private:
+			/// <summary>
+			/// Private constructor to create an Iterator with a given owner SmallVector and index.
+			/// </summary>
+			/// <param name="owner">The SmallVector that "owns" this Iterator.</param>
+			/// <param name="index">The index of the element in the SmallVector that the Iterator points to.</param>
+			Iterator(SmallVector& owner, size_t index);
+			/// <summary>
+			/// The SmallVector that "owns" this Iterator. Initialized to nullptr.
+			/// </summary>
+			SmallVector* _owner{ nullptr };
+			/// <summary>
+			/// The index of the element that this Iterator points to in the SmallVector.
+			/// </summary>
+			size_t _index{ 0_z };
+		};
+
+		/// <summary>
+		/// ConstIterator object for the SmallVector container. These methods will be invoked against a const SmallVector only.
+		/// </summary>
+		class ConstIterator final
+		{
+			friend SmallVector;
+
+		public:
+			using iterator_category = std::bidirectional_iterator_tag;
+			using value_type = T;
+			using difference_type = std::ptrdiff_t;
+			using pointer = const T*;
+			using reference = const T&;
+
+			/// <summary>
+			/// Creates a new instance of a SmallVector ConstIterator that is not associated with any container.
+			/// </summary>
+			ConstIterator() = default;
+			/// <summary>
+			/// Promotes a non-const Iterator to a ConstIterator pointing at the same element.
+			/// </summary>
+			/// <param name="other">The instance of SmallVector Iterator that is being copied from.</param>
+			ConstIterator(const Iterator& other);
+			ConstIterator(const ConstIterator& other) = default;
+			ConstIterator(ConstIterator&& other) noexcept = default;
+			ConstIterator& operator=(const ConstIterator& other) = default;
+			ConstIterator& operator=(ConstIterator&& other) noexcept = default;
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Equality operator. Two iterators are equal if they belong to the same SmallVector and point at the same index.
+			/// </summary>
+			/// <param name="other">The instance of SmallVector ConstIterator that we are comparing against.</param>
+			/// <returns>A boolean representing whether equality test was true.</returns>
+			bool operator==(const ConstIterator& other) const;
+			/// <summary>
+			/// Not Equality operator. Tests whether a SmallVector ConstIterator is not equal to another.
+			/// </summary>
+			/// <param name="other">The instance of SmallVector ConstIterator that we are comparing against.</param>
+			/// <returns>A boolean representing whether equality test was true.</returns>
+			bool operator!=(const ConstIterator& other) const;
+			/// <summary>
+			/// Prefix Increment operator. Changes the SmallVector ConstIterator to point to the next element in the SmallVector.
+			/// </summary>
+			/// <returns>A reference to this ConstIterator.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any vector.</exception>
+			ConstIterator& operator++();
+			/// <summary>
+			/// Postfix Increment operator. Changes the SmallVector ConstIterator to point to the next element in the SmallVector.
+			/// </summary>
+			/// <param name="int">Fake parameter name.</param>
+			/// <returns>A copy of this ConstIterator from before the increment.</returns>
+			ConstIterator operator++(int);
+			/// <summary>
+			/// Prefix Decrement operator. Changes the SmallVector ConstIterator to point to the previous element in the SmallVector.
+			/// </summary>
+			/// <returns>A reference to this ConstIterator.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any vector.</exception>
+			ConstIterator& operator--();
+			/// <summary>
+			/// Postfix Decrement operator. Changes the SmallVector ConstIterator to point to the previous element in the SmallVector.
+			/// </summary>
+			/// <param name="int">Fake parameter name.</param>
+			/// <returns>A copy of this ConstIterator from before the decrement.</returns>
+			ConstIterator operator--(int);
+			/// <summary>
+			/// Addition operator. Gives a ConstIterator that has been moved forward a certain number of elements.
+			/// </summary>
+			/// <param name="increment">The amount of elements that the ConstIterator will move forward.</param>
+			/// <returns>The new ConstIterator that has been moved forward.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any vector.</exception>
+			ConstIterator operator+(size_t increment) const;
+			/// <summary>
+			/// Subtraction operator. Gives a ConstIterator that has been moved backward a certain number of elements.
+			/// </summary>
+			/// <param name="decrement">The amount of elements that the ConstIterator will move backward.</param>
+			/// <returns>The new ConstIterator that has been moved backward.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any vector.</exception>
+			ConstIterator operator-(size_t decrement) const;
+			/// <summary>
+			/// Dereference operator. Exposes the element that the SmallVector ConstIterator is pointing to.
+			/// </summary>
+			/// <returns>A const reference to the underlying element that this ConstIterator points to.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any vector, or is past the last element.</exception>
+			const T& operator*() const;
+			/// <summary>
+			/// Member access operator. Exposes the element that the SmallVector ConstIterator is pointing to.
+			/// </summary>
+			/// <returns>A const pointer to the underlying element that this ConstIterator points to.</returns>
+			/// <exception cref="std::runtime_error">Thrown if the ConstIterator is not associated with any vector, or is past the last element.</exception>
+			const T* operator->() const;
+
+		private:
+			/// <summary>
+			/// Private constructor to create a ConstIterator with a given owner SmallVector and index.
+			/// </summary>
+			/// <param name="owner">The SmallVector that "owns" this ConstIterator.</param>
+			/// <param name="index">The index of the element in the SmallVector that the ConstIterator points to.</param>
+			ConstIterator(const SmallVector& owner, size_t index);
+			/// <summary>
+			/// The SmallVector that "owns" this ConstIterator. Initialized to nullptr.
+			/// </summary>
+			const SmallVector* _owner{ nullptr };
+			/// <summary>
+			/// The index of the element that this ConstIterator points to in the SmallVector.
+			/// </summary>
+			size_t _index{ 0_z };
+		};
+
+		/// <summary>
+		/// The number of elements that fit in the inline buffer.
+		/// </summary>
+		static constexpr size_t InlineCapacity = N;
+
+		/// <summary>
+		/// Creates a new instance of SmallVector. The capacity starts at N; a larger requested capacity is allocated on the heap immediately.
+		/// </summary>
+		/// <param name="capacity">Gives user the option to specify a capacity upfront. Default value is 0.</param>
+		/// <param name="allocator">The allocator the heap buffer comes from.</param>
+		SmallVector(size_t capacity = 0_z, TAllocator allocator = TAllocator{});
+		/// <summary>
+		/// Creates a new instance of SmallVector from an initializer list.
+		/// </summary>
+		/// <param name="list">Initializer list used to populate the vector.</param>
+		/// <param name="allocator">The allocator the heap buffer comes from.</param>
+		SmallVector(std::initializer_list<T> list, TAllocator allocator = TAllocator{});
+		/// <summary>
+		/// Invokes the copy constructor. Copies each element of other into this SmallVector, staying inline if they fit.
+		/// </summary>
+		/// <param name="other">The instance of SmallVector that is being copied from.</param>
+		SmallVector(const SmallVector& other);
+		/// <summary>
+		/// Invokes the move constructor. Steals the heap buffer of other if it has one; otherwise moves its inline elements one by one.
+		/// Other is left empty and back on its inline buffer.
+		/// </summary>
+		/// <param name="other">The instance of SmallVector that is being moved from.</param>
+		SmallVector(SmallVector&& other) noexcept;
+		/// <summary>
+		/// Invokes the copy assignment. Destructs all elements in this SmallVector and copies each element from other into it.
+		/// The current capacity is kept if it is already large enough and other uses an equal allocator; otherwise other's allocator is taken.
+		/// </summary>
+		/// <param name="other">The instance of SmallVector that is being copied from.</param>
+		/// <returns>A SmallVector reference to this object.</returns>
+		SmallVector& operator=(const SmallVector& other);
+		/// <summary>
+		/// Invokes the move assignment. Destructs all elements in this SmallVector and frees its heap buffer, then takes the elements of other
+		/// the same way the move constructor does.
+		/// </summary>
+		/// <param name="other">The instance of SmallVector that is being moved from.</param>
+		/// <returns>A SmallVector reference to this object.</returns>
+		SmallVector& operator=(SmallVector&& other) noexcept;
+		/// <summary>
+		/// Destructor that clears the vector and frees its heap buffer, if it has one.
+		/// </summary>
+		~SmallVector();
+
+		/// <summary>
+		/// Returns a reference to the element at the provided index.
+		/// </summary>
+		/// <param name="index">The index of the element being referenced.</param>
+		/// <returns>A reference to the element at this index in the vector.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the index is not less than size.</exception>
+		T& operator[](size_t index);
+		/// <summary>
+		/// Returns a const reference to the element at the provided index. Invoked against a const vector.
+		/// </summary>
+		/// <param name="index">The index of the element being referenced.</param>
+		/// <returns>A reference to the element at this index in the vector.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the index is not less than size.</exception>
+		const T& operator[](size_t index) const;
+		/// <summary>
+		/// Returns a reference to the element at the provided index.
+		/// </summary>
+		/// <param name="index">The index of the element being referenced.</param>
+		/// <returns>A reference to the element at this index in the vector.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the index is not less than size.</exception>
+		T& At(size_t index);
+		/// <summary>
+		/// Returns a const reference to the element at the provided index. Invoked against a const vector.
+		/// </summary>
+		/// <param name="index">The index of the element being referenced.</param>
+		/// <returns>A reference to the element at this index in the vector.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the index is not less than size.</exception>
+		const T& At(size_t index) const;
+
+		/// <summary>
+		/// Returns a boolean value representing whether the vector has no elements.
+		/// </summary>
+		/// <returns>A boolean value representing whether the size is 0.</returns>
+		bool IsEmpty() const;
+		/// <summary>
+		/// Provides the current size of the vector.
+		/// </summary>
+		/// <returns>A size_t representing the number of elements in the vector.</returns>
+		size_t Size() const;
+		/// <summary>
+		/// Provides the current capacity of the vector. Never less than N.
+		/// </summary>
+		/// <returns>The amount of elements that can fit in the space currently available to the vector.</returns>
+		size_t Capacity() const;
+		/// <summary>
+		/// Tells whether the elements are currently stored in the inline buffer rather than on the heap.
+		/// </summary>
+		/// <returns>True if the vector has not allocated any heap memory.</returns>
+		bool IsInline() const;
+		/// <summary>
+		/// Provides the front element as a reference.
+		/// </summary>
+		/// <returns>A mutable reference to the element at the front of the vector.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the vector is empty.</exception>
+		T& Front();
+		/// <summary>
+		/// Provides the front element as a const reference.
+		/// </summary>
+		/// <returns>An immutable reference to the element at the front of the vector.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the vector is empty.</exception>
+		const T& Front() const;
+		/// <summary>
+		/// Provides the back element as a reference.
+		/// </summary>
+		/// <returns>A mutable reference to the element at the back of the vector.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the vector is empty.</exception>
+		T& Back();
+		/// <summary>
+		/// Provides the back element as a const reference.
+		/// </summary>
+		/// <returns>An immutable reference to the element at the back of the vector.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the vector is empty.</exception>
+		const T& Back() const;
+
+		/// <summary>
+		/// Adds a T element onto the back of the SmallVector using an lvalue. Requires a copy. Moves to the heap once the inline buffer is full.
+		/// </summary>
+		/// <param name="value">The T element that is being added.</param>
+		/// <returns>An iterator pointing to the element that was just pushed onto the back of the SmallVector.</returns>
+		template <typename IncrementFunctor = DefaultIncrement>
+		Iterator PushBack(const T& value);
+		/// <summary>
+		/// Adds a T element onto the back of the SmallVector using an rvalue. Does not require a copy. Moves to the heap once the inline buffer is full.
+		/// </summary>
+		/// <param name="value">The T element that is being added.</param>
+		/// <returns>An iterator pointing to the element that was just pushed onto the back of the SmallVector.</returns>
+		template <typename IncrementFunctor = DefaultIncrement>
+		Iterator PushBack(T&& value);
+		/// <summary>
+		/// Constructs a T element in place at the back of the SmallVector from the arguments provided. Updates the capacity and size.
+		/// Arguments must not refer to elements of this SmallVector, since growing moves them before the new element is constructed.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the constructor of T.</param>
+		/// <returns>An iterator pointing to the element that was just constructed at the back of the SmallVector.</returns>
+		template <typename IncrementFunctor = DefaultIncrement, typename... TArgs>
+		Iterator EmplaceBack(TArgs&&... args);
+		/// <summary>
+		/// Removes the element at the back of the vector, if there is one. Updates the size.
+		/// </summary>
+		void PopBack();
+		/// <summary>
+		/// Makes room for at least capacity elements. Does nothing if the vector can already hold that many.
+		/// </summary>
+		/// <param name="capacity">The number of elements that can be stored in the SmallVector.</param>
+		void Reserve(size_t capacity);
+		/// <summary>
+		/// Destructs or default constructs elements until the vector holds the specified number of elements.
+		/// </summary>
+		/// <param name="size">The number of elements that will be in the SmallVector.</param>
+		void Resize(size_t size);
+		/// <summary>
+		/// Removes all elements from the SmallVector. The capacity is unchanged.
+		/// </summary>
+		void Clear();
+		/// <summary>
+		/// Reduces the capacity to the current size, or back to the inline buffer if the elements fit in it.
+		/// </summary>
+		void ShrinkToFit();
+
+		/// <summary>
+		/// Returns a SmallVector Iterator that points to the first element in the vector.
+		/// </summary>
+		/// <returns>A SmallVector Iterator that points to the first element in the vector.</returns>
+		Iterator begin();
+		/// <summary>
+		/// Returns a SmallVector ConstIterator that points to the first element in the vector.
+		/// </summary>
+		/// <returns>A SmallVector ConstIterator that points to the first element in the vector.</returns>
+		ConstIterator begin() const;
+		/// <summary>
+		/// Returns a SmallVector ConstIterator that points to the first element in the vector. This version is for use on a non-const SmallVector.
+		/// </summary>
+		/// <returns>A SmallVector ConstIterator that points to the first element in the vector.</returns>
+		ConstIterator cbegin() const;
+		/// <summary>
+		/// Returns a SmallVector Iterator that points to one past the last element in the vector.
+		/// </summary>
+		/// <returns>A SmallVector Iterator that points to one past the last element in the vector.</returns>
+		Iterator end();
+		/// <summary>
+		/// Returns a SmallVector ConstIterator that points to one past the last element in the vector.
+		/// </summary>
+		/// <returns>A SmallVector ConstIterator that points to one past the last element in the vector.</returns>
+		ConstIterator end() const;
+		/// <summary>
+		/// Returns a SmallVector ConstIterator that points to one past the last element in the vector. This version is for use on a non-const SmallVector.
+		/// </summary>
+		/// <returns>A SmallVector ConstIterator that points to one past the last element in the vector.</returns>
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// Searches for the given element and returns a SmallVector Iterator pointing to that found element, or end() if it is not found.
+		/// With the default equality, int, float, glm::vec4 and pointer elements are compared several at a time by SimdFind.
+		/// </summary>
+		/// <param name="value">The element we are searching for.</param>
+		/// <returns>A SmallVector Iterator pointing to that found element.</returns>
+		template <typename EqualityFunctor = DefaultEquality<T>>
+		Iterator Find(const T& value);
+		/// <summary>
+		/// Searches for the given element and returns a SmallVector ConstIterator pointing to that found element, or end() if it is not found.
+		/// </summary>
+		/// <param name="value">The element we are searching for.</param>
+		/// <returns>A SmallVector ConstIterator pointing to that found element.</returns>
+		template <typename EqualityFunctor = DefaultEquality<T>>
+		ConstIterator Find(const T& value) const;
+		/// <summary>
+		/// Removes the first element equal to the given element.
+		/// </summary>
+		/// <param name="value">The element to remove from the vector.</param>
+		/// <returns>Boolean that represents whether the remove was successful or not.</returns>
+		template <typename EqualityFunctor = DefaultEquality<T>>
+		bool Remove(const T& value);
+		/// <summary>
+		/// Removes the element that is pointed to by the given SmallVector Iterator. Later elements are shifted down by one.
+		/// </summary>
+		/// <param name="it">The SmallVector Iterator that points to the element that will be removed.</param>
+		/// <returns>Boolean that represents whether the remove was successful or not.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the iterator passed in is not associated with this vector.</exception>
+		bool Remove(const Iterator& it);
+		/// <summary>
+		/// Removes the contiguous range of elements starting at first and ending just before last. Later elements are shifted down to fill the gap.
+		/// </summary>
+		/// <param name="first">The SmallVector Iterator that points to the first element in the range.</param>
+		/// <param name="last">The SmallVector Iterator that points one past the last element in the range.</param>
+		/// <exception cref="std::runtime_error">Thrown if either iterator is not associated with this vector, or they are out of order.</exception>
+		void Remove(const Iterator& first, const Iterator& last);
+
+		/// <summary>
+		/// Provides the allocator the heap buffer comes from.
+		/// </summary>
+		/// <returns>A copy of the allocator.</returns>
+		TAllocator GetAllocator() const;
+		/// <summary>
+		/// Reports the elements held and the bytes taken from the allocator. Nothing is allocated while the elements fit inline.
+		/// </summary>
+		/// <returns>The element count, the heap buffer's capacity in bytes, and Size in bytes.</returns>
+		ContainerStats Stats() const;
+
+	private:
+		/// <summary>
+		/// Provides the start of the inline buffer as an array of T.
+		/// </summary>
+		/// <returns>The address of the first inline element.</returns>
+		T* InlineData();
+		/// <summary>
+		/// Moves the elements of a buffer into a heap buffer with room for capacity elements and frees the old buffer if it was on the heap.
+		/// Static for the same reason as Vector's: growth should not make PushBack reload its members.
+		/// </summary>
+		/// <param name="allocator">The allocator the heap buffer comes from.</param>
+		/// <param name="data">The current buffer.</param>
+		/// <param name="size">The number of constructed elements in data.</param>
+		/// <param name="oldCapacity">The capacity data was allocated with.</param>
+		/// <param name="capacity">The new capacity. Must be more than N and at least size.</param>
+		/// <param name="isInline">Whether data is the inline buffer, which must not be freed or realloc'd.</param>
+		/// <returns>The new heap buffer.</returns>
+		static T* Reallocate(TAllocator allocator, T* data, size_t size, size_t oldCapacity, size_t capacity, bool isInline);
+		/// <summary>
+		/// Frees the heap buffer, if there is one, and points the vector back at its inline buffer. The heap buffer must hold no live elements.
+		/// </summary>
+		void ReleaseHeap();
+		/// <summary>
+		/// Takes the elements of other and leaves it empty and inline. This SmallVector must be empty and inline when it is called.
+		/// </summary>
+		/// <param name="other">The instance of SmallVector that is being moved from.</param>
+		void MoveFrom(SmallVector& other) noexcept;
+
+		/// <summary>
+		/// The array where elements are stored. Points at _inline until the vector grows past N elements.
+		/// </summary>
+		T* _data{ InlineData() };
+		/// <summary>
+		/// The number of elements currently in the vector.
+		/// </summary>
+		size_t _size{ 0_z };
+		/// <summary>
+		/// The number of elements that can be stored in _data without reallocating.
+		/// </summary>
+		size_t _capacity{ N };
+		/// <summary>
+		/// The allocator the heap buffer comes from.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TAllocator _allocator;
+		/// <summary>
+		/// Uninitialized storage for the first N elements.
+		/// </summary>
+		alignas(T) std::byte _inline[sizeof(T) * N];
+	};
+}
+
+#include "SmallVector.inl"
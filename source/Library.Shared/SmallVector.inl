@@ -0,0 +1,682 @@
+#include "SmallVector.h"
+
+namespace FIEAGameEngine
+{
+
+#pragma region Iterator
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>::Iterator::Iterator(SmallVector& owner, size_t index) :
+		_owner(&owner), _index(index)
+	{
+
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline bool SmallVector<T, N, TAllocator>::Iterator::operator==(const Iterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline bool SmallVector<T, N, TAllocator>::Iterator::operator!=(const Iterator& other) const
+	{
+		return _owner != other._owner || _index != other._index;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::Iterator& SmallVector<T, N, TAllocator>::Iterator::operator++()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+		if (_index <= _owner->_size)
+		{
+			_index++;
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::Iterator::operator++(int)
+	{
+		Iterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::Iterator& SmallVector<T, N, TAllocator>::Iterator::operator--()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+		if (_index > 0_z)
+		{
+			_index--;
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::Iterator::operator--(int)
+	{
+		Iterator temp(*this);
+		operator--();
+		return temp;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::Iterator::operator+(size_t increment) const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+
+		return Iterator(*_owner, _index + increment);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::Iterator::operator-(size_t decrement) const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+
+		return Iterator(*_owner, _index - decrement);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline T& SmallVector<T, N, TAllocator>::Iterator::operator*() const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+		return _owner->At(_index);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline T* SmallVector<T, N, TAllocator>::Iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+#pragma endregion Iterator
+
+#pragma region ConstIterator
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>::ConstIterator::ConstIterator(const SmallVector& owner, size_t index) :
+		_owner(&owner), _index(index)
+	{
+
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
+		_owner(other._owner), _index(other._index)
+	{
+
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline bool SmallVector<T, N, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return !(operator!=(other));
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline bool SmallVector<T, N, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return _owner != other._owner || _index != other._index;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator& SmallVector<T, N, TAllocator>::ConstIterator::operator++()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+		if (_index <= _owner->_size)
+		{
+			_index++;
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp(*this);
+		operator++();
+		return temp;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator& SmallVector<T, N, TAllocator>::ConstIterator::operator--()
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+		if (_index > 0_z)
+		{
+			_index--;
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::ConstIterator::operator--(int)
+	{
+		ConstIterator temp(*this);
+		operator--();
+		return temp;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::ConstIterator::operator+(size_t increment) const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+
+		return ConstIterator(*_owner, _index + increment);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::ConstIterator::operator-(size_t decrement) const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+
+		return ConstIterator(*_owner, _index - decrement);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline const T& SmallVector<T, N, TAllocator>::ConstIterator::operator*() const
+	{
+		if (_owner == nullptr)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+		return _owner->At(_index);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline const T* SmallVector<T, N, TAllocator>::ConstIterator::operator->() const
+	{
+		return &operator*();
+	}
+
+#pragma endregion ConstIterator
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>::SmallVector(size_t capacity, TAllocator allocator) :
+		_allocator(allocator)
+	{
+		Reserve(capacity);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>::SmallVector(std::initializer_list<T> list, TAllocator allocator) :
+		_allocator(allocator)
+	{
+		Reserve(list.size());
+		CopyElements(_data, list.begin(), list.size());
+		_size = list.size();
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>::SmallVector(const SmallVector& other) :
+		_allocator(other._allocator)
+	{
+		Reserve(other._size);
+		CopyElements(_data, other._data, other._size);
+		_size = other._size;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>::SmallVector(SmallVector&& other) noexcept :
+		_allocator(other._allocator)
+	{
+		MoveFrom(other);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>& SmallVector<T, N, TAllocator>::operator=(const SmallVector& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			if (_allocator != other._allocator)
+			{
+				ReleaseHeap();
+				_allocator = other._allocator;
+			}
+
+			Reserve(other._size);
+			CopyElements(_data, other._data, other._size);
+			_size = other._size;
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>& SmallVector<T, N, TAllocator>::operator=(SmallVector&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+			ReleaseHeap();
+			_allocator = other._allocator;
+
+			MoveFrom(other);
+		}
+
+		return *this;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline SmallVector<T, N, TAllocator>::~SmallVector()
+	{
+		Clear();
+		ReleaseHeap();
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline T& SmallVector<T, N, TAllocator>::operator[](size_t index)
+	{
+		return At(index);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline const T& SmallVector<T, N, TAllocator>::operator[](size_t index) const
+	{
+		return At(index);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline T& SmallVector<T, N, TAllocator>::At(size_t index)
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Invalid index location.");
+		}
+		return _data[index];
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline const T& SmallVector<T, N, TAllocator>::At(size_t index) const
+	{
+		if (index >= _size)
+		{
+			throw std::runtime_error("Invalid index location.");
+		}
+		return _data[index];
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline bool SmallVector<T, N, TAllocator>::IsEmpty() const
+	{
+		return _size == 0_z;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline size_t SmallVector<T, N, TAllocator>::Size() const
+	{
+		return _size;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline size_t SmallVector<T, N, TAllocator>::Capacity() const
+	{
+		return _capacity;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline bool SmallVector<T, N, TAllocator>::IsInline() const
+	{
+		return _data == reinterpret_cast<const T*>(_inline);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline T& SmallVector<T, N, TAllocator>::Front()
+	{
+		if (_size == 0_z)
+		{
+			throw std::runtime_error("Empty vector.");
+		}
+		return _data[0];
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline const T& SmallVector<T, N, TAllocator>::Front() const
+	{
+		if (_size == 0_z)
+		{
+			throw std::runtime_error("Empty vector.");
+		}
+		return _data[0];
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline T& SmallVector<T, N, TAllocator>::Back()
+	{
+		if (_size == 0_z)
+		{
+			throw std::runtime_error("Empty vector.");
+		}
+		return _data[_size - 1];
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline const T& SmallVector<T, N, TAllocator>::Back() const
+	{
+		if (_size == 0_z)
+		{
+			throw std::runtime_error("Empty vector.");
+		}
+		return _data[_size - 1];
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	template<typename IncrementFunctor>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::PushBack(const T& value)
+	{
+		return EmplaceBack<IncrementFunctor>(value);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	template<typename IncrementFunctor>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::PushBack(T&& value)
+	{
+		return EmplaceBack<IncrementFunctor>(std::move(value));
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	template<typename IncrementFunctor, typename... TArgs>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::EmplaceBack(TArgs&&... args)
+	{
+		if (_size == _capacity)
+		{
+			IncrementFunctor incrementFunc;
+			Reserve(_capacity + std::max(1_z, incrementFunc(_size, _capacity)));
+		}
+
+		new(_data + _size)T(std::forward<TArgs>(args)...);
+
+		return Iterator(*this, _size++);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline void SmallVector<T, N, TAllocator>::PopBack()
+	{
+		if (!IsEmpty())
+		{
+			_data[--_size].~T();
+		}
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline void SmallVector<T, N, TAllocator>::Reserve(size_t capacity)
+	{
+		if (capacity > _capacity)
+		{
+			_data = Reallocate(_allocator, _data, _size, _capacity, capacity, IsInline());
+			_capacity = capacity;
+		}
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline void SmallVector<T, N, TAllocator>::Resize(size_t size)
+	{
+		if (size < _size)
+		{
+			for (size_t i = size; i < _size; ++i)
+			{
+				_data[i].~T();
+			}
+		}
+		else
+		{
+			Reserve(size);
+			for (size_t i = _size; i < size; ++i)
+			{
+				new(_data + i)T();
+			}
+		}
+
+		_size = size;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline void SmallVector<T, N, TAllocator>::Clear()
+	{
+		DestroyElements(_data, _size);
+		_size = 0_z;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline void SmallVector<T, N, TAllocator>::ShrinkToFit()
+	{
+		if (IsInline())
+		{
+			return;
+		}
+
+		if (_size <= N)
+		{
+			RelocateElements(InlineData(), _data, _size);
+			ReleaseHeap();
+		}
+		else if (_size < _capacity)
+		{
+			_data = Reallocate(_allocator, _data, _size, _capacity, _size, false);
+			_capacity = _size;
+		}
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::begin()
+	{
+		return Iterator(*this, 0_z);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::begin() const
+	{
+		return ConstIterator(*this, 0_z);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::cbegin() const
+	{
+		return ConstIterator(*this, 0_z);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::end()
+	{
+		return Iterator(*this, _size);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::end() const
+	{
+		return ConstIterator(*this, _size);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::cend() const
+	{
+		return ConstIterator(*this, _size);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	template<typename EqualityFunctor>
+	inline typename SmallVector<T, N, TAllocator>::Iterator SmallVector<T, N, TAllocator>::Find(const T& value)
+	{
+		if constexpr (std::is_same_v<EqualityFunctor, DefaultEquality<T>> && IsSimdFindable<T>)
+		{
+			return Iterator(*this, SimdFind(_data, _size, value));
+		}
+		else
+		{
+			EqualityFunctor eq;
+
+			size_t index = 0_z;
+			for (; index < _size; ++index)
+			{
+				if (eq(_data[index], value))
+				{
+					break;
+				}
+			}
+			return Iterator(*this, index);
+		}
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	template<typename EqualityFunctor>
+	inline typename SmallVector<T, N, TAllocator>::ConstIterator SmallVector<T, N, TAllocator>::Find(const T& value) const
+	{
+		return const_cast<SmallVector*>(this)->Find<EqualityFunctor>(value);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	template<typename EqualityFunctor>
+	inline bool SmallVector<T, N, TAllocator>::Remove(const T& value)
+	{
+		return Remove(Find<EqualityFunctor>(value));
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline bool SmallVector<T, N, TAllocator>::Remove(const Iterator& it)
+	{
+		if (it._owner != this)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+
+		if (it._index >= _size)
+		{
+			return false;
+		}
+
+		_data[it._index].~T();
+		RelocateElements(_data + it._index, _data + it._index + 1_z, _size - it._index - 1_z);
+		--_size;
+
+		return true;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline void SmallVector<T, N, TAllocator>::Remove(const Iterator& first, const Iterator& last)
+	{
+		if (first._owner != this || last._owner != this)
+		{
+			throw std::runtime_error("Unassociated vector.");
+		}
+
+		if (first._index > last._index || last._index > _size)
+		{
+			throw std::runtime_error("Iterators are out of order and do not represent a contiguous range of elements.");
+		}
+
+		const size_t elementsToRemove = last._index - first._index;
+		if (elementsToRemove > 0_z)
+		{
+			DestroyElements(_data + first._index, elementsToRemove);
+			RelocateElements(_data + first._index, _data + last._index, _size - last._index);
+			_size -= elementsToRemove;
+		}
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline T* SmallVector<T, N, TAllocator>::InlineData()
+	{
+		return reinterpret_cast<T*>(_inline);
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline T* SmallVector<T, N, TAllocator>::Reallocate(TAllocator allocator, T* data, size_t size, size_t oldCapacity, size_t capacity, bool isInline)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			if (!isInline)
+			{
+				T* newData = reinterpret_cast<T*>(allocator.Reallocate(data, sizeof(T) * oldCapacity, sizeof(T) * capacity, alignof(T)));
+				assert(newData != nullptr);
+				return newData;
+			}
+		}
+
+		T* newData = reinterpret_cast<T*>(allocator.Allocate(sizeof(T) * capacity, alignof(T)));
+		assert(newData != nullptr);
+		RelocateElements(newData, data, size);
+		if (!isInline)
+		{
+			allocator.Deallocate(data, sizeof(T) * oldCapacity, alignof(T));
+		}
+		return newData;
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline void SmallVector<T, N, TAllocator>::ReleaseHeap()
+	{
+		if (!IsInline())
+		{
+			_allocator.Deallocate(_data, sizeof(T) * _capacity, alignof(T));
+			_data = InlineData();
+			_capacity = N;
+		}
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline TAllocator SmallVector<T, N, TAllocator>::GetAllocator() const
+	{
+		return _allocator;
+	}
+
+	template <typename T, size_t N, typename TAllocator>
+	inline ContainerStats SmallVector<T, N, TAllocator>::Stats() const
+	{
+		return ContainerStats{ _size, IsInline() ? 0_z : _capacity * sizeof(T), _size * sizeof(T) };
+	}
+
+	template<typename T, std::size_t N, typename TAllocator>
+	inline void SmallVector<T, N, TAllocator>::MoveFrom(SmallVector& other) noexcept
+	{
+		assert(IsEmpty() && IsInline());
+
+		if (other.IsInline())
+		{
+			RelocateElements(_data, other._data, other._size);
+			_size = other._size;
+			other._size = 0_z;
+		}
+		else
+		{
+			_data = other._data;
+			_size = other._size;
+			_capacity = other._capacity;
+
+			other._data = other.InlineData();
+			other._size = 0_z;
+			other._capacity = N;
+		}
+	}
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include "SizeLiteral.h"
+#include "Allocator.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Bounded FIFO for exactly one producer thread and one consumer thread, without locks.
+	/// The producer only writes the tail and the consumer only writes the head, each on its own cache line, and each side keeps a cached copy
+	/// of the other's index so it reads the shared one only when the queue looks full or empty.
+	/// TryPush may be called from one thread at a time and TryPop from one thread at a time; for several producers use MpscQueue.
+	/// </summary>
+	/// <typeparam name="T">The type of element stored in the queue. Must be move constructible.</typeparam>
+	/// <typeparam name="TAllocator">Allocator policy for the ring buffer. See DefaultAllocator.</typeparam>
+	template <typename T, typename TAllocator = DefaultAllocator>
+	class SpscQueue final
+	{
+	public:
+		/// <summary>
+		/// Creates an empty queue. Its capacity never changes.
+		/// </summary>
+		/// <param name="capacity">The number of elements the queue can hold. Rounded up to a power of two, and at least one.</param>
+		/// <param name="allocator">The allocator the ring buffer comes from.</param>
+		explicit SpscQueue(size_t capacity, TAllocator allocator = TAllocator{});
+		SpscQueue(const SpscQueue&) = delete;
+		SpscQueue(SpscQueue&&) = delete;
+		SpscQueue& operator=(const SpscQueue&) = delete;
+		SpscQueue& operator=(SpscQueue&&) = delete;
+		/// <summary>
+		/// Destroys the elements still queued and frees the ring buffer. Neither thread may be using the queue.
+		/// </summary>
+		~SpscQueue();
+
+		/// <summary>
+		/// Appends a copy of value. Producer thread only.
+		/// </summary>
+		/// <returns>True if the value was queued, false if the queue was full.</returns>
+		bool TryPush(const T& value);
+		/// <summary>
+		/// Appends value by moving it. Producer thread only. value is left untouched if the queue is full.
+		/// </summary>
+		/// <returns>True if the value was queued, false if the queue was full.</returns>
+		bool TryPush(T&& value);
+		/// <summary>
+		/// Constructs an element in place at the back of the queue. Producer thread only.
+		/// </summary>
+		/// <returns>True if the element was queued, false if the queue was full.</returns>
+		template <typename... TArgs>
+		bool TryEmplace(TArgs&&... args);
+		/// <summary>
+		/// Moves the front element into value and removes it. Consumer thread only.
+		/// </summary>
+		/// <param name="value">Assigned the front element.</param>
+		/// <returns>True if an element was removed, false if the queue was empty.</returns>
+		bool TryPop(T& value);
+
+		/// <summary>
+		/// Provides the number of queued elements. Exact when neither thread is working on the queue, otherwise a snapshot.
+		/// </summary>
+		size_t Size() const;
+		/// <summary>
+		/// Determines whether the queue holds no elements. A snapshot while the other thread is working on the queue.
+		/// </summary>
+		bool IsEmpty() const;
+		/// <summary>
+		/// Provides the number of elements the queue can hold.
+		/// </summary>
+		size_t Capacity() const;
+
+	private:
+		/// <summary>
+		/// Size of the cache line the two indices are kept apart by.
+		/// </summary>
+		inline static constexpr size_t CacheLineSize = 64;
+
+		/// <summary>
+		/// The ring buffer. Slot i holds the element with position i modulo the capacity.
+		/// </summary>
+		T* _data;
+		/// <summary>
+		/// Capacity minus one; positions wrap into the ring with it.
+		/// </summary>
+		size_t _mask;
+		/// <summary>
+		/// The allocator the ring buffer comes from.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TAllocator _allocator;
+
+		/// <summary>
+		/// Position of the next element to pop. Only the consumer writes it.
+		/// </summary>
+		alignas(CacheLineSize) std::atomic<size_t> _head{ 0_z };
+		/// <summary>
+		/// The consumer's last reading of _tail.
+		/// </summary>
+		size_t _cachedTail{ 0_z };
+
+		/// <summary>
+		/// Position the next element is pushed to. Only the producer writes it.
+		/// </summary>
+		alignas(CacheLineSize) std::atomic<size_t> _tail{ 0_z };
+		/// <summary>
+		/// The producer's last reading of _head.
+		/// </summary>
+		size_t _cachedHead{ 0_z };
+	};
+}
+
+#include "SpscQueue.inl"
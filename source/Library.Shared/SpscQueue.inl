@@ -0,0 +1,100 @@
+#include "SpscQueue.h"
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <new>
+#include <utility>
+
+namespace FIEAGameEngine
+{
+	template <typename T, typename TAllocator>
+	inline SpscQueue<T, TAllocator>::SpscQueue(size_t capacity, TAllocator allocator) :
+		_mask(std::bit_ceil(std::max(capacity, 1_z)) - 1_z), _allocator(allocator)
+	{
+		_data = reinterpret_cast<T*>(_allocator.Allocate(sizeof(T) * (_mask + 1_z), alignof(T)));
+		assert(_data != nullptr);
+	}
+
+	template <typename T, typename TAllocator>
+	inline SpscQueue<T, TAllocator>::~SpscQueue()
+	{
+		const size_t tail = _tail.load(std::memory_order_relaxed);
+		for (size_t position = _head.load(std::memory_order_relaxed); position != tail; ++position)
+		{
+			_data[position & _mask].~T();
+		}
+		_allocator.Deallocate(_data, sizeof(T) * (_mask + 1_z), alignof(T));
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool SpscQueue<T, TAllocator>::TryPush(const T& value)
+	{
+		return TryEmplace(value);
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool SpscQueue<T, TAllocator>::TryPush(T&& value)
+	{
+		return TryEmplace(std::move(value));
+	}
+
+	template <typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline bool SpscQueue<T, TAllocator>::TryEmplace(TArgs&&... args)
+	{
+		const size_t tail = _tail.load(std::memory_order_relaxed);
+		if (tail - _cachedHead > _mask)
+		{
+			// Acquire pairs with the consumer's release, so the slot it vacated is no longer being read.
+			_cachedHead = _head.load(std::memory_order_acquire);
+			if (tail - _cachedHead > _mask)
+			{
+				return false;
+			}
+		}
+
+		new(_data + (tail & _mask))T(std::forward<TArgs>(args)...);
+		_tail.store(tail + 1_z, std::memory_order_release);
+		return true;
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool SpscQueue<T, TAllocator>::TryPop(T& value)
+	{
+		const size_t head = _head.load(std::memory_order_relaxed);
+		if (head == _cachedTail)
+		{
+			// Acquire pairs with the producer's release, so the element it constructed is visible.
+			_cachedTail = _tail.load(std::memory_order_acquire);
+			if (head == _cachedTail)
+			{
+				return false;
+			}
+		}
+
+		T& slot = _data[head & _mask];
+		value = std::move(slot);
+		slot.~T();
+		_head.store(head + 1_z, std::memory_order_release);
+		return true;
+	}
+
+	template <typename T, typename TAllocator>
+	inline size_t SpscQueue<T, TAllocator>::Size() const
+	{
+		const size_t head = _head.load(std::memory_order_acquire);
+		return _tail.load(std::memory_order_acquire) - head;
+	}
+
+	template <typename T, typename TAllocator>
+	inline bool SpscQueue<T, TAllocator>::IsEmpty() const
+	{
+		return Size() == 0_z;
+	}
+
+	template <typename T, typename TAllocator>
+	inline size_t SpscQueue<T, TAllocator>::Capacity() const
+	{
+		return _mask + 1_z;
+	}
+}
@@ -4,12 +4,20 @@
 
 namespace FIEAGameEngine
 {
-	template <typename T>
+	template <typename T, typename TAllocator = DefaultAllocator>
 	class Stack final
 	{
 	public:
+		static constexpr std::size_t NodeSize = SList<T, TAllocator>::NodeSize;
+		static constexpr std::size_t NodeAlignment = SList<T, TAllocator>::NodeAlignment;
+
+		Stack() = default;
+		explicit Stack(TAllocator allocator);
+
 		void Push(const T& value);
 		void Push(T&& value);
+		template <typename... TArgs>
+		T& Emplace(TArgs&&... args);
 		void Pop();
 		T& Top();
 		const T& Top() const;
@@ -20,7 +28,7 @@ namespace FIEAGameEngine
 		void Clear();
 
 	private:
-		SList<T> mList;
+		SList<T, TAllocator> mList;
 	};
 }
 
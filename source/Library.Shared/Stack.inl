@@ -1,50 +1,62 @@
 namespace FIEAGameEngine
 {
+	template <typename T, typename TAllocator>
+	inline Stack<T, TAllocator>::Stack(TAllocator allocator) :
+		mList(allocator)
+	{
+	}
 
-	template <typename T>
-	inline void Stack<T>::Push(const T& value)
+	template <typename T, typename TAllocator>
+	inline void Stack<T, TAllocator>::Push(const T& value)
 	{
 		mList.PushFront(value);
 	}
 
-	template <typename T>
-	inline void Stack<T>::Push(T&& value)
+	template <typename T, typename TAllocator>
+	inline void Stack<T, TAllocator>::Push(T&& value)
 	{
 		mList.PushFront(std::move(value));
 	}
 
-	template <typename T>
-	inline void Stack<T>::Pop()
+	template <typename T, typename TAllocator>
+	template <typename... TArgs>
+	inline T& Stack<T, TAllocator>::Emplace(TArgs&&... args)
+	{
+		return *mList.EmplaceFront(std::forward<TArgs>(args)...);
+	}
+
+	template <typename T, typename TAllocator>
+	inline void Stack<T, TAllocator>::Pop()
 	{
 		mList.PopFront();
 	}
 
-	template <typename T>
-	inline T& Stack<T>::Top()
+	template <typename T, typename TAllocator>
+	inline T& Stack<T, TAllocator>::Top()
 	{
 		return mList.Front();
 	}
 
-	template <typename T>
-	inline const T& Stack<T>::Top() const
+	template <typename T, typename TAllocator>
+	inline const T& Stack<T, TAllocator>::Top() const
 	{
 		return mList.Front();
 	}
 
-	template <typename T>
-	inline std::size_t Stack<T>::Size() const
+	template <typename T, typename TAllocator>
+	inline std::size_t Stack<T, TAllocator>::Size() const
 	{
 		return mList.Size();
 	}
 
-	template <typename T>
-	inline bool Stack<T>::IsEmpty() const
+	template <typename T, typename TAllocator>
+	inline bool Stack<T, TAllocator>::IsEmpty() const
 	{
 		return mList.IsEmpty();
 	}
 
-	template <typename T>
-	inline void Stack<T>::Clear()
+	template <typename T, typename TAllocator>
+	inline void Stack<T, TAllocator>::Clear()
 	{
 		return mList.Clear();
 	}
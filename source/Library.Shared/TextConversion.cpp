@@ -0,0 +1,389 @@
+#include "pch.h"
+#include "TextConversion.h"
+#include <charconv>
+#include <cstring>
+#include <stdexcept>
+
+namespace FIEAGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Appends text to a caller's buffer, failing rather than writing past its end.
+		/// </summary>
+		class Writer final
+		{
+		public:
+			explicit Writer(std::span<char> buffer) :
+				_buffer(buffer)
+			{
+			}
+
+			void Append(std::string_view text)
+			{
+				if (text.size() > _buffer.size() - _length)
+				{
+					throw std::runtime_error("The buffer is too small for the formatted value.");
+				}
+
+				std::memcpy(_buffer.data() + _length, text.data(), text.size());
+				_length += text.size();
+			}
+
+			template <typename T>
+			void AppendNumber(T value)
+			{
+				const std::to_chars_result result = std::to_chars(_buffer.data() + _length, _buffer.data() + _buffer.size(), value);
+				if (result.ec != std::errc())
+				{
+					throw std::runtime_error("The buffer is too small for the formatted value.");
+				}
+
+				_length = static_cast<std::size_t>(result.ptr - _buffer.data());
+			}
+
+			void AppendComponents(const float* components, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					if (i > 0)
+					{
+						Append(", ");
+					}
+
+					AppendNumber(components[i]);
+				}
+			}
+
+			std::size_t Length() const
+			{
+				return _length;
+			}
+
+		private:
+			std::span<char> _buffer;
+			std::size_t _length{ 0 };
+		};
+
+		/// <summary>
+		/// Reads a value from text front to back, failing on anything the expected format does not allow.
+		/// </summary>
+		class Reader final
+		{
+		public:
+			explicit Reader(std::string_view text) :
+				_text(text)
+			{
+			}
+
+			void SkipWhitespace()
+			{
+				while (_position < _text.size() && (_text[_position] == ' ' || _text[_position] == '\t' || _text[_position] == '\n' || _text[_position] == '\r'))
+				{
+					++_position;
+				}
+			}
+
+			void Expect(std::string_view token)
+			{
+				SkipWhitespace();
+				if (_text.substr(_position, token.size()) != token)
+				{
+					throw std::runtime_error("The text is not in the expected format.");
+				}
+
+				_position += token.size();
+			}
+
+			template <typename T>
+			T Read()
+			{
+				SkipWhitespace();
+				if (_position + 1 < _text.size() && _text[_position] == '+' && _text[_position + 1] != '-')
+				{
+					++_position;
+				}
+
+				T value;
+				const std::from_chars_result result = std::from_chars(_text.data() + _position, _text.data() + _text.size(), value);
+				if (result.ec != std::errc())
+				{
+					throw std::runtime_error(result.ec == std::errc::result_out_of_range ? "The value in the text is out of range." : "The text is not in the expected format.");
+				}
+
+				_position = static_cast<std::size_t>(result.ptr - _text.data());
+				return value;
+			}
+
+			void ReadComponents(float* components, std::size_t count)
+			{
+				for (std::size_t i = 0; i < count; ++i)
+				{
+					if (i > 0)
+					{
+						Expect(",");
+					}
+
+					components[i] = Read<float>();
+				}
+			}
+
+			bool ReadBoolean()
+			{
+				SkipWhitespace();
+				if (_text.substr(_position, 4) == "true")
+				{
+					_position += 4;
+					return true;
+				}
+
+				Expect("false");
+				return false;
+			}
+
+			void ExpectEnd()
+			{
+				SkipWhitespace();
+				if (_position != _text.size())
+				{
+					throw std::runtime_error("The text is not in the expected format.");
+				}
+			}
+
+		private:
+			std::string_view _text;
+			std::size_t _position{ 0 };
+		};
+	}
+
+	std::size_t TextConversion::Format(int value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.AppendNumber(value);
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(float value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.AppendNumber(value);
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(const glm::vec4& value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.Append("vec4(");
+		writer.AppendComponents(&value.x, 4);
+		writer.Append(")");
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(const glm::mat4& value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.Append("mat4x4(");
+		for (glm::length_t column = 0; column < 4; ++column)
+		{
+			writer.Append(column > 0 ? ", (" : "(");
+			writer.AppendComponents(&value[column].x, 4);
+			writer.Append(")");
+		}
+		writer.Append(")");
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(bool value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.Append(value ? "true" : "false");
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(std::int64_t value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.AppendNumber(value);
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(double value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.AppendNumber(value);
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(const glm::vec2& value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.Append("vec2(");
+		writer.AppendComponents(&value.x, 2);
+		writer.Append(")");
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(const glm::vec3& value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.Append("vec3(");
+		writer.AppendComponents(&value.x, 3);
+		writer.Append(")");
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(const glm::quat& value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.Append("quat(");
+		writer.AppendNumber(value.w);
+		writer.Append(", {");
+		writer.AppendComponents(&value.x, 3);
+		writer.Append("})");
+		return writer.Length();
+	}
+
+	std::size_t TextConversion::Format(const glm::mat3& value, std::span<char> buffer)
+	{
+		Writer writer(buffer);
+		writer.Append("mat3x3(");
+		for (glm::length_t column = 0; column < 3; ++column)
+		{
+			writer.Append(column > 0 ? ", (" : "(");
+			writer.AppendComponents(&value[column].x, 3);
+			writer.Append(")");
+		}
+		writer.Append(")");
+		return writer.Length();
+	}
+
+	int TextConversion::ParseInteger(std::string_view text)
+	{
+		Reader reader(text);
+		const int value = reader.Read<int>();
+		reader.ExpectEnd();
+		return value;
+	}
+
+	float TextConversion::ParseFloat(std::string_view text)
+	{
+		Reader reader(text);
+		const float value = reader.Read<float>();
+		reader.ExpectEnd();
+		return value;
+	}
+
+	glm::vec4 TextConversion::ParseVector(std::string_view text)
+	{
+		Reader reader(text);
+		reader.Expect("vec4(");
+		glm::vec4 value;
+		reader.ReadComponents(&value.x, 4);
+		reader.Expect(")");
+		reader.ExpectEnd();
+		return value;
+	}
+
+	glm::mat4 TextConversion::ParseMatrix(std::string_view text)
+	{
+		Reader reader(text);
+		glm::mat4 value;
+		reader.Expect("mat4x4(");
+		for (glm::length_t column = 0; column < 4; ++column)
+		{
+			if (column > 0)
+			{
+				reader.Expect(",");
+			}
+
+			reader.Expect("(");
+			reader.ReadComponents(&value[column].x, 4);
+			reader.Expect(")");
+		}
+		reader.Expect(")");
+		reader.ExpectEnd();
+		return value;
+	}
+
+	bool TextConversion::ParseBoolean(std::string_view text)
+	{
+		Reader reader(text);
+		const bool value = reader.ReadBoolean();
+		reader.ExpectEnd();
+		return value;
+	}
+
+	std::int64_t TextConversion::ParseInteger64(std::string_view text)
+	{
+		Reader reader(text);
+		const std::int64_t value = reader.Read<std::int64_t>();
+		reader.ExpectEnd();
+		return value;
+	}
+
+	double TextConversion::ParseDouble(std::string_view text)
+	{
+		Reader reader(text);
+		const double value = reader.Read<double>();
+		reader.ExpectEnd();
+		return value;
+	}
+
+	glm::vec2 TextConversion::ParseVector2(std::string_view text)
+	{
+		Reader reader(text);
+		glm::vec2 value;
+		reader.Expect("vec2(");
+		reader.ReadComponents(&value.x, 2);
+		reader.Expect(")");
+		reader.ExpectEnd();
+		return value;
+	}
+
+	glm::vec3 TextConversion::ParseVector3(std::string_view text)
+	{
+		Reader reader(text);
+		glm::vec3 value;
+		reader.Expect("vec3(");
+		reader.ReadComponents(&value.x, 3);
+		reader.Expect(")");
+		reader.ExpectEnd();
+		return value;
+	}
+
+	glm::quat TextConversion::ParseQuaternion(std::string_view text)
+	{
+		Reader reader(text);
+		glm::quat value;
+		reader.Expect("quat(");
+		value.w = reader.Read<float>();
+		reader.Expect(",");
+		reader.Expect("{");
+		reader.ReadComponents(&value.x, 3);
+		reader.Expect("}");
+		reader.Expect(")");
+		reader.ExpectEnd();
+		return value;
+	}
+
+	glm::mat3 TextConversion::ParseMatrix3(std::string_view text)
+	{
+		Reader reader(text);
+		glm::mat3 value;
+		reader.Expect("mat3x3(");
+		for (glm::length_t column = 0; column < 3; ++column)
+		{
+			if (column > 0)
+			{
+				reader.Expect(",");
+			}
+
+			reader.Expect("(");
+			reader.ReadComponents(&value[column].x, 3);
+			reader.Expect(")");
+		}
+		reader.Expect(")");
+		reader.ExpectEnd();
+		return value;
+	}
+}
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Converts the values a Datum holds to and from text, with std::to_chars and std::from_chars.
+	/// Nothing here allocates or depends on the current locale, and a float formatted here parses back to exactly the same float.
+	/// Vectors are written as vec4(x, y, z, w) and matrices as mat4x4((...), (...), (...), (...)), one column per parenthesis, as glm::to_string does.
+	/// The smaller vectors and matrices follow suit, and quaternions are written as quat(w, {x, y, z}), also as glm::to_string does.
+	/// </summary>
+	class TextConversion final
+	{
+	public:
+		/// <summary>
+		/// The longest text Format writes for an int: "-2147483648".
+		/// </summary>
+		static constexpr std::size_t MaxIntegerLength = 11;
+		/// <summary>
+		/// The longest text Format writes for a float, e.g. "-1.00053455e-36". Floats are written with the fewest digits that parse back exactly.
+		/// </summary>
+		static constexpr std::size_t MaxFloatLength = 15;
+		/// <summary>
+		/// The longest text Format writes for a vec4.
+		/// </summary>
+		static constexpr std::size_t MaxVectorLength = 6 + 4 * MaxFloatLength + 3 * 2;
+		/// <summary>
+		/// The longest text Format writes for a mat4.
+		/// </summary>
+		static constexpr std::size_t MaxMatrixLength = 8 + 4 * (2 + 4 * MaxFloatLength + 3 * 2) + 3 * 2;
+		/// <summary>
+		/// The longest text Format writes for a bool: "false".
+		/// </summary>
+		static constexpr std::size_t MaxBooleanLength = 5;
+		/// <summary>
+		/// The longest text Format writes for an int64_t: "-9223372036854775808".
+		/// </summary>
+		static constexpr std::size_t MaxInteger64Length = 20;
+		/// <summary>
+		/// The longest text Format writes for a double, e.g. "-2.2250738585072014e-308".
+		/// </summary>
+		static constexpr std::size_t MaxDoubleLength = 24;
+		/// <summary>
+		/// The longest text Format writes for a vec2.
+		/// </summary>
+		static constexpr std::size_t MaxVector2Length = 6 + 2 * MaxFloatLength + 1 * 2;
+		/// <summary>
+		/// The longest text Format writes for a vec3.
+		/// </summary>
+		static constexpr std::size_t MaxVector3Length = 6 + 3 * MaxFloatLength + 2 * 2;
+		/// <summary>
+		/// The longest text Format writes for a quat.
+		/// </summary>
+		static constexpr std::size_t MaxQuaternionLength = 10 + 4 * MaxFloatLength + 2 * 2;
+		/// <summary>
+		/// The longest text Format writes for a mat3.
+		/// </summary>
+		static constexpr std::size_t MaxMatrix3Length = 8 + 3 * (2 + 3 * MaxFloatLength + 2 * 2) + 2 * 2;
+
+		TextConversion() = delete;
+		TextConversion(const TextConversion&) = delete;
+		TextConversion(TextConversion&&) = delete;
+		TextConversion& operator=(const TextConversion&) = delete;
+		TextConversion& operator=(TextConversion&&) = delete;
+		~TextConversion() = default;
+
+		/// <summary>
+		/// Writes an int in decimal. No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxIntegerLength characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(int value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a float with the fewest digits that parse back to the same value. No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxFloatLength characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(float value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a vec4 as vec4(x, y, z, w). No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxVectorLength characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(const glm::vec4& value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a mat4 as mat4x4((...), (...), (...), (...)), column by column. No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxMatrixLength characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(const glm::mat4& value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a bool as true or false. No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxBooleanLength characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(bool value, std::span<char> buffer);
+		/// <summary>
+		/// Writes an int64_t in decimal. No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxInteger64Length characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(std::int64_t value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a double with the fewest digits that parse back to the same value. No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxDoubleLength characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(double value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a vec2 as vec2(x, y). No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxVector2Length characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(const glm::vec2& value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a vec3 as vec3(x, y, z). No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxVector3Length characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(const glm::vec3& value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a quat as quat(w, {x, y, z}). No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxQuaternionLength characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(const glm::quat& value, std::span<char> buffer);
+		/// <summary>
+		/// Writes a mat3 as mat3x3((...), (...), (...)), column by column. No terminating null is written.
+		/// </summary>
+		/// <param name="value">The value to write.</param>
+		/// <param name="buffer">Where the text is written. MaxMatrix3Length characters always suffice.</param>
+		/// <returns>The number of characters written.</returns>
+		/// <exception cref="std::runtime_error">Thrown if the text does not fit in buffer.</exception>
+		static std::size_t Format(const glm::mat3& value, std::span<char> buffer);
+
+		/// <summary>
+		/// Reads a decimal int. Surrounding whitespace and a leading + are allowed.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not an int, or the value is out of range.</exception>
+		static int ParseInteger(std::string_view text);
+		/// <summary>
+		/// Reads a float in fixed or scientific notation. Surrounding whitespace and a leading + are allowed.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a float, or the value is out of range.</exception>
+		static float ParseFloat(std::string_view text);
+		/// <summary>
+		/// Reads a vec4 written as vec4(x, y, z, w). Whitespace is allowed between the parts.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a vec4.</exception>
+		static glm::vec4 ParseVector(std::string_view text);
+		/// <summary>
+		/// Reads a mat4 written as mat4x4((...), (...), (...), (...)), column by column. Whitespace is allowed between the parts.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a mat4.</exception>
+		static glm::mat4 ParseMatrix(std::string_view text);
+		/// <summary>
+		/// Reads a bool written as true or false. Surrounding whitespace is allowed.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a bool.</exception>
+		static bool ParseBoolean(std::string_view text);
+		/// <summary>
+		/// Reads a decimal int64_t. Surrounding whitespace and a leading + are allowed.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not an int64_t, or the value is out of range.</exception>
+		static std::int64_t ParseInteger64(std::string_view text);
+		/// <summary>
+		/// Reads a double in fixed or scientific notation. Surrounding whitespace and a leading + are allowed.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a double, or the value is out of range.</exception>
+		static double ParseDouble(std::string_view text);
+		/// <summary>
+		/// Reads a vec2 written as vec2(x, y). Whitespace is allowed between the parts.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a vec2.</exception>
+		static glm::vec2 ParseVector2(std::string_view text);
+		/// <summary>
+		/// Reads a vec3 written as vec3(x, y, z). Whitespace is allowed between the parts.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a vec3.</exception>
+		static glm::vec3 ParseVector3(std::string_view text);
+		/// <summary>
+		/// Reads a quat written as quat(w, {x, y, z}). Whitespace is allowed between the parts.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a quat.</exception>
+		static glm::quat ParseQuaternion(std::string_view text);
+		/// <summary>
+		/// Reads a mat3 written as mat3x3((...), (...), (...)), column by column. Whitespace is allowed between the parts.
+		/// </summary>
+		/// <param name="text">The text to read, which must hold nothing else.</param>
+		/// <returns>The value read.</returns>
+		/// <exception cref="std::runtime_error">Thrown if text is not a mat3.</exception>
+		static glm::mat3 ParseMatrix3(std::string_view text);
+	};
+}
@@ -0,0 +1,142 @@
+#include "pch.h"
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace FIEAGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Set while a thread is running tasks, so a nested Run stays on that thread.
+		/// </summary>
+		thread_local bool sInsideJob = false;
+	}
+
+	ThreadPool::ThreadPool(size_t workerCount)
+	{
+		_workers.Reserve(workerCount);
+		for (size_t i = 0_z; i < workerCount; ++i)
+		{
+			_workers.EmplaceBack([this] { WorkerLoop(); });
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock(_mutex);
+			_stopping = true;
+		}
+		_jobPosted.notify_all();
+
+		for (std::thread& worker : _workers)
+		{
+			worker.join();
+		}
+	}
+
+	size_t ThreadPool::Concurrency() const
+	{
+		return _workers.Size() + 1_z;
+	}
+
+	ThreadPool& ThreadPool::Default()
+	{
+		static ThreadPool pool;
+		return pool;
+	}
+
+	size_t ThreadPool::DefaultWorkerCount()
+	{
+		const size_t hardwareThreads = std::thread::hardware_concurrency();
+		return std::max(hardwareThreads, 1_z) - 1_z;
+	}
+
+	void ThreadPool::Execute(Job& job)
+	{
+		if (job._taskCount == 0_z)
+		{
+			return;
+		}
+
+		if (sInsideJob || _workers.IsEmpty() || job._taskCount == 1_z)
+		{
+			const bool wasInsideJob = sInsideJob;
+			sInsideJob = true;
+			WorkOn(job);
+			sInsideJob = wasInsideJob;
+		}
+		else
+		{
+			std::lock_guard runLock(_runMutex);
+			{
+				std::lock_guard lock(_mutex);
+				_job = &job;
+				++_generation;
+			}
+			_jobPosted.notify_all();
+
+			sInsideJob = true;
+			WorkOn(job);
+			sInsideJob = false;
+
+			// Every task has been claimed, but workers may still be finishing theirs and must not touch job once we return.
+			std::unique_lock lock(_mutex);
+			_job = nullptr;
+			_workersIdle.wait(lock, [this] { return _activeWorkers == 0_z; });
+		}
+
+		if (job._exception != nullptr)
+		{
+			std::rethrow_exception(job._exception);
+		}
+	}
+
+	void ThreadPool::WorkOn(Job& job)
+	{
+		for (size_t index = job._nextTask.fetch_add(1_z, std::memory_order_relaxed); index < job._taskCount; index = job._nextTask.fetch_add(1_z, std::memory_order_relaxed))
+		{
+			try
+			{
+				job._invoke(job._task, index);
+			}
+			catch (...)
+			{
+				std::lock_guard lock(job._exceptionMutex);
+				if (job._exception == nullptr)
+				{
+					job._exception = std::current_exception();
+				}
+			}
+		}
+	}
+
+	void ThreadPool::WorkerLoop()
+	{
+		sInsideJob = true;
+		size_t seenGeneration = 0_z;
+
+		std::unique_lock lock(_mutex);
+		for (;;)
+		{
+			_jobPosted.wait(lock, [this, seenGeneration] { return _stopping || (_job != nullptr && _generation != seenGeneration); });
+			if (_stopping)
+			{
+				return;
+			}
+
+			seenGeneration = _generation;
+			Job& job = *_job;
+			++_activeWorkers;
+			lock.unlock();
+
+			WorkOn(job);
+
+			lock.lock();
+			if (--_activeWorkers == 0_z)
+			{
+				_workersIdle.notify_all();
+			}
+		}
+	}
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include "SizeLiteral.h"
+#include "Vector.h"
+
+namespace FIEAGameEngine
+{
+	/// <summary>
+	/// Fixed set of worker threads for fork-join work, such as the parallel algorithms.
+	/// Run splits a job into numbered tasks that the workers and the calling thread claim one at a time, and returns once every task has finished.
+	/// A task that calls Run again, directly or through a parallel algorithm, runs the inner job serially on its own thread rather than waiting on the pool,
+	/// so nesting cannot deadlock. Jobs from different threads take turns.
+	/// </summary>
+	class ThreadPool final
+	{
+	public:
+		/// <summary>
+		/// Starts the worker threads.
+		/// </summary>
+		/// <param name="workerCount">The number of threads to start. The thread that calls Run also works, so 0 makes every job serial.</param>
+		explicit ThreadPool(size_t workerCount = DefaultWorkerCount());
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool(ThreadPool&&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+		ThreadPool& operator=(ThreadPool&&) = delete;
+		/// <summary>
+		/// Stops and joins the worker threads. Must not be called while a job is running.
+		/// </summary>
+		~ThreadPool();
+
+		/// <summary>
+		/// Calls task(i) for every i in [0, taskCount), spread over the workers and the calling thread, and waits for all of them.
+		/// If any task throws, the remaining tasks still run and the first exception is rethrown once they have finished.
+		/// </summary>
+		/// <param name="taskCount">The number of tasks.</param>
+		/// <param name="task">Callable taking the size_t index of a task. Called concurrently, so it must be safe to call from several threads.</param>
+		template <typename TTask>
+		void Run(size_t taskCount, TTask&& task);
+
+		/// <summary>
+		/// Provides the number of threads that take part in a job: the workers plus the calling thread.
+		/// </summary>
+		/// <returns>The concurrency of a job.</returns>
+		size_t Concurrency() const;
+
+		/// <summary>
+		/// Provides the process-wide pool used when no pool is given, created on first use with DefaultWorkerCount workers.
+		/// </summary>
+		/// <returns>The default pool.</returns>
+		static ThreadPool& Default();
+		/// <summary>
+		/// Provides one fewer worker than the hardware has threads, since the thread calling Run works too.
+		/// </summary>
+		/// <returns>The default number of workers.</returns>
+		static size_t DefaultWorkerCount();
+
+	private:
+		/// <summary>
+		/// One call to Run. Lives on the calling thread's stack until every thread that joined it has left.
+		/// </summary>
+		struct Job final
+		{
+			void (*_invoke)(void* task, size_t index);
+			void* _task;
+			size_t _taskCount;
+			std::atomic<size_t> _nextTask{ 0_z };
+			std::mutex _exceptionMutex;
+			std::exception_ptr _exception;
+		};
+
+		/// <summary>
+		/// Runs a job on the workers and the calling thread, or serially when it cannot or need not be shared.
+		/// </summary>
+		void Execute(Job& job);
+		/// <summary>
+		/// Claims and runs tasks of job until none are left.
+		/// </summary>
+		static void WorkOn(Job& job);
+		/// <summary>
+		/// Body of each worker thread: waits for a job, helps with it, and repeats until the pool is destroyed.
+		/// </summary>
+		void WorkerLoop();
+
+		/// <summary>
+		/// The worker threads.
+		/// </summary>
+		Vector<std::thread> _workers;
+		/// <summary>
+		/// Lets one job at a time use the workers.
+		/// </summary>
+		std::mutex _runMutex;
+		/// <summary>
+		/// Guards _job, _generation, _activeWorkers and _stopping.
+		/// </summary>
+		std::mutex _mutex;
+		/// <summary>
+		/// Signalled when a job is posted or the pool is stopping.
+		/// </summary>
+		std::condition_variable _jobPosted;
+		/// <summary>
+		/// Signalled when the last worker leaves a job.
+		/// </summary>
+		std::condition_variable _workersIdle;
+		/// <summary>
+		/// The job being run, or nullptr.
+		/// </summary>
+		Job* _job{ nullptr };
+		/// <summary>
+		/// Incremented for every posted job, so a worker joins each job at most once.
+		/// </summary>
+		size_t _generation{ 0_z };
+		/// <summary>
+		/// Number of workers currently inside WorkOn.
+		/// </summary>
+		size_t _activeWorkers{ 0_z };
+		/// <summary>
+		/// Set by the destructor to release the workers.
+		/// </summary>
+		bool _stopping{ false };
+	};
+
+	template <typename TTask>
+	inline void ThreadPool::Run(size_t taskCount, TTask&& task)
+	{
+		using TaskType = std::remove_reference_t<TTask>;
+
+		Job job;
+		job._invoke = [](void* task, size_t index) { (*static_cast<TaskType*>(task))(index); };
+		job._task = const_cast<void*>(static_cast<const void*>(&task));
+		job._taskCount = taskCount;
+		Execute(job);
+	}
+}
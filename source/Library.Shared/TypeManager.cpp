@@ -3,19 +3,23 @@
 
 namespace FIEAGameEngine
 {
-	Vector<Signature> TypeManager::GetSignaturesForType(RTTI::IdType typeId)
+	const SignatureList& TypeManager::GetSignaturesForType(RTTI::IdType typeId)
 	{
-		return _signatureMap.At(typeId);
+		const SignatureList* signatures = _signatureMap.Find(typeId);
+		if (signatures == nullptr)
+		{
+			throw std::runtime_error("Type has not been registered.");
+		}
+
+		return *signatures;
 	}
 
-	void TypeManager::AddType(RTTI::IdType typeId, Vector<Signature> signatures)
+	void TypeManager::AddType(RTTI::IdType typeId, SignatureList signatures)
 	{
-		if (_signatureMap.ContainsKey(typeId))
+		if (!_signatureMap.TryEmplace(typeId, std::move(signatures)))
 		{
 			throw std::runtime_error("Type already registered.");
 		}
-
-		_signatureMap.Insert(std::make_pair(typeId, std::move(signatures)));
 	}
 
 	void TypeManager::RemoveType(RTTI::IdType typeId)
@@ -26,7 +30,7 @@ namespace FIEAGameEngine
 	{
 		return _signatureMap.ContainsKey(typeId);
 	}
-	const HashMap<RTTI::IdType, Vector<Signature>>& TypeManager::Types()
+	const ConcurrentHashMap<RTTI::IdType, SignatureList>& TypeManager::Types()
 	{
 		return _signatureMap;
 	}
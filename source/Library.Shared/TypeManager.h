@@ -1,12 +1,14 @@
 #pragma once
 #include "Attributed.h"
 #include "Signature.h"
+#include "ConcurrentHashMap.h"
 
 namespace FIEAGameEngine
 {
 	/// <summary>
 	/// A class that contains a static hashmap used for storing all the signatures associated with each type.
 	/// RTTI typeIds are associated with Vectors of Signatures. See the signatures header for more information on this.
+	/// Every method may be called from any thread, so Attributed objects can be constructed on worker threads.
 	/// </summary>
 	class TypeManager final
 	{
@@ -42,18 +44,21 @@ namespace FIEAGameEngine
 		~TypeManager() = default;
 
 		/// <summary>
-		/// Provides a copy of the Signature Vector associated with the type that was passed in.
+		/// Provides the signatures associated with the type that was passed in.
+		/// The reference is valid until the type is removed.
 		/// </summary>
 		/// <param name="typeId">The RTTI typeId for the type that we are returning the signatures for.</param>
-		/// <returns>The signature vector associated with the type.</returns>
-		static Vector<Signature> GetSignaturesForType(RTTI::IdType typeId);
+		/// <returns>The signature list associated with the type.</returns>
+		/// <exception cref="std::runtime_error">Thrown when the type has not been added.</exception>
+		static const SignatureList& GetSignaturesForType(RTTI::IdType typeId);
 		/// <summary>
 		/// Adds a type to the TypeManager. 
 		/// Stores an entry into the static hashmap with a typeId key and a signature vector value.
 		/// </summary>
 		/// <param name="typeId">The RTTI typeId for the type you are adding.</param>
 		/// <param name="signatures">The vector of signatures for the type you are adding.</param>
-		static void AddType(RTTI::IdType typeId, Vector<Signature> signatures);
+		/// <exception cref="std::runtime_error">Thrown when the type has already been added.</exception>
+		static void AddType(RTTI::IdType typeId, SignatureList signatures);
 		/// <summary>
 		/// Removes a type from the TypeManager. 
 		/// Removes an entry in the static hashmap with a typeId key.
@@ -70,7 +75,7 @@ namespace FIEAGameEngine
 		/// Returns the static hashmap that contains all RTTI typeId, Signature Vector pairs.
 		/// </summary>
 		/// <returns>The static hashmap that contains all RTTI typeId, Signature Vector pairs.</returns>
-		static const HashMap<RTTI::IdType, Vector<Signature>>& Types();
+		static const ConcurrentHashMap<RTTI::IdType, SignatureList>& Types();
 		/// <summary>
 		/// Clears all types from the TypeManager.
 		/// Removes all RTTI typeId, Signature Vector pairs from the hashmap.
@@ -81,7 +86,7 @@ namespace FIEAGameEngine
 		/// Stores all signatures for each type in the type manager.
 		/// The static hashmap which associate RTTI IdTypes with Signature Vectors. 
 		/// </summary>
-		inline static HashMap<RTTI::IdType, Vector<Signature>> _signatureMap;
+		inline static ConcurrentHashMap<RTTI::IdType, SignatureList> _signatureMap{};
 	};
 
 }
\ No newline at end of file
@@ -4,14 +4,20 @@
 #include "SizeLiteral.h"
 #include "DefaultIncrement.h"
 #include "DefaultEquality.h"
+#include "Relocation.h"
+#include "Allocator.h"
+#include "SimdFind.h"
+#include "ContainerStats.h"
 
 namespace FIEAGameEngine
 {
 	/// <summary>
 	/// A templated class for a vector. Each element in the vector is stored in an array which contains T-type pieces of data.
+	/// Growth and erase move elements with realloc and memmove when T is trivially relocatable (see IsTriviallyRelocatable), and with move construction otherwise.
 	/// </summary>
 	/// <typeparam name="T">The type of element stored in the container.</typeparam>
-	template <typename T>
+	/// <typeparam name="TAllocator">Allocator policy for the element array. See DefaultAllocator.</typeparam>
+	template <typename T, typename TAllocator = DefaultAllocator>
 	class Vector
 	{
 	public:
@@ -269,12 +275,14 @@ namespace FIEAGameEngine
 		/// Creates a new instance of Vector. Sets the capacity to the optional parameters (0 if nothing is provided).
 		/// </summary>
 		/// <param name="capacity">Gives user the option to specify a capacity upfront. Default value is 0.</param>
-		Vector(size_t capacity = 0_z);
+		/// <param name="allocator">The allocator the element array comes from.</param>
+		Vector(size_t capacity = 0_z, TAllocator allocator = TAllocator{});
 		/// <summary>
 		/// Creates a new instance of Vector from an initializer list.
 		/// </summary>
 		/// <param name="vector">Initializer list used to populate the vector.</param>
-		Vector(std::initializer_list<T> list);
+		/// <param name="allocator">The allocator the element array comes from.</param>
+		Vector(std::initializer_list<T> list, TAllocator allocator = TAllocator{});
 		/// <summary>
 		/// Invokes the copy constructor. 
 		/// Creates a new Vector and deep copies each member variable from other Vector into this Vector. 
@@ -291,6 +299,7 @@ namespace FIEAGameEngine
 		/// Invokes the copy assignment. Destructs all elements in the vector and deep copies each element from other Vector into this Vector.
 		/// If the vector that is being copied from is bigger, that amount of memory will be reserved ahead of time.
 		/// If the vector that is being copied from is smaller, the amount of memory reserved will stay the same. You will need to call ShrinkToFit if you want your new size to match your capacity.
+		/// Takes other's allocator, releasing the current array first if the allocators differ.
 		/// </summary>
 		/// <param name="other">The instance of Vector that is being copied from.</param>
 		/// <returns>A Vector reference to this object.</returns>
@@ -352,6 +361,17 @@ namespace FIEAGameEngine
 		/// <returns>The amount of elements that can fit in the allocated space for the vector.</returns>
 		size_t Capacity() const;
 		/// <summary>
+		/// Provides the contiguous array of elements, for code that works on raw ranges such as the parallel algorithms.
+		/// Invalidated by anything that changes the capacity.
+		/// </summary>
+		/// <returns>A pointer to the first element, or nullptr if nothing has been allocated.</returns>
+		T* Data();
+		/// <summary>
+		/// Provides the contiguous array of elements. Invoked against a const vector.
+		/// </summary>
+		/// <returns>A pointer to the first element, or nullptr if nothing has been allocated.</returns>
+		const T* Data() const;
+		/// <summary>
 		/// Provides the front element as a reference.
 		/// </summary>
 		/// <returns>A mutable reference to the element at the front of the vector.</returns>
@@ -392,6 +412,14 @@ namespace FIEAGameEngine
 		template <typename IncrementFunctor = DefaultIncrement>
 		Iterator PushBack(T&& value);
 		/// <summary>
+		/// Constructs a T element in place at the back of the Vector from the arguments provided. Updates the capacity and size.
+		/// Arguments must not refer to elements of this Vector, since growing moves them before the new element is constructed.
+		/// </summary>
+		/// <param name="args">Arguments forwarded to the constructor of T.</param>
+		/// <returns>An iterator pointing to the element that was just constructed at the back of the Vector.</returns>
+		template <typename IncrementFunctor = DefaultIncrement, typename... TArgs>
+		Iterator EmplaceBack(TArgs&&... args);
+		/// <summary>
 		/// Removes a T element onto the back of the list. Updates the size.
 		/// </summary>
 		void PopBack();
@@ -406,6 +434,12 @@ namespace FIEAGameEngine
 		/// <param name="size">The number of elements that will be instantiated in the Vector.</param>
 		void Resize(size_t size);
 		/// <summary>
+		/// Instantiates elements for the vector up to the specified size. Copy constructed from value.
+		/// </summary>
+		/// <param name="size">The number of elements that will be instantiated in the Vector.</param>
+		/// <param name="value">The element new slots are copied from.</param>
+		void Resize(size_t size, const T& value);
+		/// <summary>
 		/// Removes all elements from the Vector. Sets the size and capacity to zero and sets the _data pointer to nullptr.
 		/// </summary>
 		void Clear();
@@ -415,6 +449,17 @@ namespace FIEAGameEngine
 		/// </summary>
 		void ShrinkToFit();
 
+		/// <summary>
+		/// Provides the allocator the element array comes from.
+		/// </summary>
+		/// <returns>A copy of the allocator.</returns>
+		TAllocator GetAllocator() const;
+		/// <summary>
+		/// Reports the elements held and the bytes the buffer takes, including unused capacity.
+		/// </summary>
+		/// <returns>The element count, Capacity and Size in bytes.</returns>
+		ContainerStats Stats() const;
+
 		Iterator begin();
 		/// <summary>
 		/// Returns an Vector ConstIterator that points to the first element in the vector.
@@ -444,6 +489,7 @@ namespace FIEAGameEngine
 
 		/// <summary>
 		/// Searches for the given element and returns a Vector Iterator pointing to that found element.
+		/// With the default equality, int, float, glm::vec4 and pointer elements are compared several at a time by SimdFind.
 		/// </summary>
 		/// <param name="value">The element we are searching for.</param>
 		/// <returns>A Vector Iterator pointing to that found element.</returns>
@@ -481,6 +527,18 @@ namespace FIEAGameEngine
 		void Remove(const Iterator& start, const Iterator& last);
 
 	private:
+		/// <summary>
+		/// Moves the elements of a buffer into one with room for capacity elements and frees the old one.
+		/// Static so growth does not pass this to an out-of-line call, which would make PushBack reload its members every iteration.
+		/// </summary>
+		/// <param name="allocator">The allocator data came from.</param>
+		/// <param name="data">The current buffer, which may be null.</param>
+		/// <param name="size">The number of constructed elements in data.</param>
+		/// <param name="oldCapacity">The capacity data was allocated with.</param>
+		/// <param name="capacity">The new capacity. Must be at least size.</param>
+		/// <returns>The new buffer.</returns>
+		static T* Reallocate(TAllocator allocator, T* data, size_t size, size_t oldCapacity, size_t capacity);
+
 		/// <summary>
 		/// The array where elements will be stored in the vector.
 		/// </summary>
@@ -493,6 +551,10 @@ namespace FIEAGameEngine
 		/// The number of elements that can be currently stored in the vector. Can also be thought of as the amount of space allocated for the vector.
 		/// </summary>
 		size_t _capacity{ 0 };
+		/// <summary>
+		/// The allocator the element array comes from.
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TAllocator _allocator;
 	};
 }
 
@@ -4,26 +4,26 @@ namespace FIEAGameEngine
 {
 
 #pragma region Iterator
-	template<typename T>
-	inline Vector<T>::Iterator::Iterator(Vector& owner, size_t index) :
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>::Iterator::Iterator(Vector& owner, size_t index) :
 		_owner(&owner), _index(index)
 	{
 
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Iterator::operator==(const Iterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool Vector<T, TAllocator>::Iterator::operator==(const Iterator& other) const
 	{
 		return !(operator!=(other));
 	}
-	template<typename T>
-	inline bool Vector<T>::Iterator::operator!=(const Iterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool Vector<T, TAllocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		return _owner != other._owner || _index != other._index;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator& Vector<T>::Iterator::operator++()
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::Iterator& Vector<T, TAllocator>::Iterator::operator++()
 	{
 		if (_owner == nullptr)
 		{
@@ -37,16 +37,16 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator++(int)
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator temp(*this);
 		operator++();
 		return temp;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator& Vector<T>::Iterator::operator--()
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::Iterator& Vector<T, TAllocator>::Iterator::operator--()
 	{
 		if (_owner == nullptr)
 		{
@@ -60,16 +60,16 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator--(int)
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::Iterator::operator--(int)
 	{
 		Iterator temp(*this);
 		operator--();
 		return temp;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator+(size_t increment) const
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::Iterator::operator+(size_t increment) const
 	{
 		if (_owner == nullptr)
 		{
@@ -79,8 +79,8 @@ namespace FIEAGameEngine
 		return Iterator(*_owner, _index + increment);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::Iterator::operator-(size_t decrement) const
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::Iterator::operator-(size_t decrement) const
 	{
 		if (_owner == nullptr)
 		{
@@ -90,8 +90,8 @@ namespace FIEAGameEngine
 		return Iterator (*_owner, _index - decrement);
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Iterator::operator*() const
+	template<typename T, typename TAllocator>
+	inline T& Vector<T, TAllocator>::Iterator::operator*() const
 	{
 		if (_owner == nullptr)
 		{
@@ -105,34 +105,34 @@ namespace FIEAGameEngine
 
 #pragma region ConstIterator
 
-	template<typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Vector& owner, size_t index) :
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>::ConstIterator::ConstIterator(const Vector& owner, size_t index) :
 		_owner(&owner), _index(index)
 	{
 
 	}
 
-	template<typename T>
-	inline Vector<T>::ConstIterator::ConstIterator(const Iterator& other) :
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
 		_owner(other._owner), _index(other._index)
 	{
 
 	}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator==(const ConstIterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool Vector<T, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !(operator!=(other));
 	}
 
-	template<typename T>
-	inline bool Vector<T>::ConstIterator::operator!=(const ConstIterator& other) const
+	template<typename T, typename TAllocator>
+	inline bool Vector<T, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return _owner != other._owner || _index != other._index;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator+(size_t increment) const
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::ConstIterator::operator+(size_t increment) const
 	{
 		if (_owner == nullptr)
 		{
@@ -142,8 +142,8 @@ namespace FIEAGameEngine
 		return ConstIterator(*_owner, _index + increment);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator-(size_t decrement) const
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::ConstIterator::operator-(size_t decrement) const
 	{
 		if (_owner == nullptr)
 		{
@@ -153,8 +153,8 @@ namespace FIEAGameEngine
 		return ConstIterator(*_owner, _index - decrement);
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator++()
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator& Vector<T, TAllocator>::ConstIterator::operator++()
 	{
 		if (_owner == nullptr)
 		{
@@ -167,16 +167,16 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator++(int)
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp(*this);
 		operator++();
 		return temp;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator& Vector<T>::ConstIterator::operator--()
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator& Vector<T, TAllocator>::ConstIterator::operator--()
 	{
 		if (_owner == nullptr)
 		{
@@ -190,16 +190,16 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::ConstIterator::operator--(int)
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::ConstIterator::operator--(int)
 	{
 		ConstIterator temp(*this);
 		operator--();
 		return temp;
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::ConstIterator::operator*() const
+	template<typename T, typename TAllocator>
+	inline const T& Vector<T, TAllocator>::ConstIterator::operator*() const
 	{
 		if (_owner == nullptr)
 		{ 
@@ -212,8 +212,9 @@ namespace FIEAGameEngine
 
 #pragma endregion ConstIterator
 
-	template<typename T>
-	inline Vector<T>::Vector(size_t capacity)
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>::Vector(size_t capacity, TAllocator allocator) :
+		_allocator(allocator)
 	{
 		if(capacity > 0_z)
 		{
@@ -222,57 +223,55 @@ namespace FIEAGameEngine
 		
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(std::initializer_list<T> list)
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>::Vector(std::initializer_list<T> list, TAllocator allocator) :
+		_allocator(allocator)
 	{
 		Reserve(list.size());
-		for (const auto& value : list)
-		{
-			new(_data + _size++)T(value);
-		}
-
+		CopyElements(_data, list.begin(), list.size());
+		_size = list.size();
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(const Vector& other)
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>::Vector(const Vector& other) :
+		_allocator(other._allocator)
 	{
 		Reserve(other._size);
-		for (const auto& value : other)
-		{
-			new(_data + _size++)T(value);
-		}
+		CopyElements(_data, other._data, other._size);
+		_size = other._size;
 	}
 
-	template<typename T>
-	inline Vector<T>::Vector(Vector&& other) noexcept : 
-		_capacity(other._capacity), _size(other._size), _data(other._data)
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>::Vector(Vector&& other) noexcept : 
+		_data(other._data), _size(other._size), _capacity(other._capacity), _allocator(other._allocator)
 	{
 		other._capacity = 0_z;
 		other._size = 0_z;
 		other._data = nullptr;
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::operator=(const Vector& other)
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>& Vector<T, TAllocator>::operator=(const Vector& other)
 	{
 		if (this != &other)
 		{
 			Clear();
-
-			_size = other._size;
-			Reserve(_size);
-
-			for (size_t i = 0_z; i < _size; ++i)
+			if (_allocator != other._allocator)
 			{
-				new(_data + i)T(other[i]);
+				ShrinkToFit();
+				_allocator = other._allocator;
 			}
+
+			Reserve(other._size);
+			CopyElements(_data, other._data, other._size);
+			_size = other._size;
 		}
 
 		return *this;
 	}
 
-	template<typename T>
-	inline Vector<T>& Vector<T>::operator=(Vector&& other) noexcept	
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>& Vector<T, TAllocator>::operator=(Vector&& other) noexcept	
 	{
 		if (this != &other)
 		{
@@ -282,6 +281,7 @@ namespace FIEAGameEngine
 			_capacity = other._capacity;
 			_size = other._size;
 			_data = other._data;
+			_allocator = other._allocator;
 
 			other._capacity = 0_z;
 			other._size = 0_z;
@@ -291,8 +291,8 @@ namespace FIEAGameEngine
 		return *this;
 	}
 
-	template<typename T>
-	inline T& Vector<T>::operator[](size_t index)
+	template<typename T, typename TAllocator>
+	inline T& Vector<T, TAllocator>::operator[](size_t index)
 	{
 		if (index >= _size)
 		{
@@ -301,8 +301,8 @@ namespace FIEAGameEngine
 		return _data[index];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::operator[](size_t index) const
+	template<typename T, typename TAllocator>
+	inline const T& Vector<T, TAllocator>::operator[](size_t index) const
 	{
 		if (index >= _size)
 		{
@@ -311,15 +311,15 @@ namespace FIEAGameEngine
 		return _data[index];
 	}
 
-	template<typename T>
-	inline Vector<T>::~Vector()
+	template<typename T, typename TAllocator>
+	inline Vector<T, TAllocator>::~Vector()
 	{
 		Clear();
 		ShrinkToFit();
 	}
 
-	template<typename T>
-	inline T& Vector<T>::At(size_t index)
+	template<typename T, typename TAllocator>
+	inline T& Vector<T, TAllocator>::At(size_t index)
 	{
 		if (index >= _size)
 		{
@@ -328,8 +328,8 @@ namespace FIEAGameEngine
 		return _data[index];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::At(size_t index) const
+	template<typename T, typename TAllocator>
+	inline const T& Vector<T, TAllocator>::At(size_t index) const
 	{
 		if (index >= _size)
 		{
@@ -338,26 +338,38 @@ namespace FIEAGameEngine
 		return _data[index];
 	}
 
-	template<typename T>
-	inline bool Vector<T>::IsEmpty() const
+	template<typename T, typename TAllocator>
+	inline bool Vector<T, TAllocator>::IsEmpty() const
 	{
 		return _size == 0_z;
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::Size() const
+	template<typename T, typename TAllocator>
+	inline size_t Vector<T, TAllocator>::Size() const
 	{
 		return _size;
 	}
 
-	template<typename T>
-	inline size_t Vector<T>::Capacity() const
+	template<typename T, typename TAllocator>
+	inline size_t Vector<T, TAllocator>::Capacity() const
 	{
 		return _capacity;
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Front()
+	template<typename T, typename TAllocator>
+	inline T* Vector<T, TAllocator>::Data()
+	{
+		return _data;
+	}
+
+	template<typename T, typename TAllocator>
+	inline const T* Vector<T, TAllocator>::Data() const
+	{
+		return _data;
+	}
+
+	template<typename T, typename TAllocator>
+	inline T& Vector<T, TAllocator>::Front()
 	{
 		if (_size == 0_z)
 		{
@@ -366,8 +378,8 @@ namespace FIEAGameEngine
 		return _data[0];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::Front() const
+	template<typename T, typename TAllocator>
+	inline const T& Vector<T, TAllocator>::Front() const
 	{
 		if (_size == 0_z)
 		{
@@ -376,8 +388,8 @@ namespace FIEAGameEngine
 		return _data[0];
 	}
 
-	template<typename T>
-	inline T& Vector<T>::Back()
+	template<typename T, typename TAllocator>
+	inline T& Vector<T, TAllocator>::Back()
 	{
 		if (_size == 0_z)
 		{
@@ -386,8 +398,8 @@ namespace FIEAGameEngine
 		return _data[_size - 1];
 	}
 
-	template<typename T>
-	inline const T& Vector<T>::Back() const
+	template<typename T, typename TAllocator>
+	inline const T& Vector<T, TAllocator>::Back() const
 	{
 		if (_size == 0_z)
 		{
@@ -396,42 +408,37 @@ namespace FIEAGameEngine
 		return _data[_size - 1];
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template<typename IncrementFunctor>
-	typename Vector<T>::Iterator Vector<T>::PushBack(const T& value)
+	typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::PushBack(const T& value)
 	{
-		IncrementFunctor incrementFunc;
-
-		if (_size == _capacity)
-		{
-			size_t capacity = _capacity + std::max(1_z, incrementFunc(_size, _capacity));
-			Reserve(capacity);
-		}
-
-		new(_data + _size)T(value);
-
-		return Iterator(*this, _size++);
+		return EmplaceBack<IncrementFunctor>(value);
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template<typename IncrementFunctor>
-	inline typename Vector<T>::Iterator Vector<T>::PushBack(T&& value)
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::PushBack(T&& value)
 	{
-		IncrementFunctor incrementFunc;
+		return EmplaceBack<IncrementFunctor>(std::move(value));
+	}
 
+	template<typename T, typename TAllocator>
+	template<typename IncrementFunctor, typename... TArgs>
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::EmplaceBack(TArgs&&... args)
+	{
 		if (_size == _capacity)
 		{
-			size_t capacity = _capacity + std::max(1_z, incrementFunc(_size, _capacity));
-			Reserve(capacity);
+			IncrementFunctor incrementFunc;
+			Reserve(_capacity + std::max(1_z, incrementFunc(_size, _capacity)));
 		}
 
-		new(_data + _size)T(std::forward<T>(value));
+		new(_data + _size)T(std::forward<TArgs>(args)...);
 
 		return Iterator(*this, _size++);
 	}
 
-	template<typename T>
-	inline void Vector<T>::PopBack()
+	template<typename T, typename TAllocator>
+	inline void Vector<T, TAllocator>::PopBack()
 	{
 		if (!IsEmpty())
 		{
@@ -439,20 +446,18 @@ namespace FIEAGameEngine
 		}
 	}
 
-	template<typename T>
-	inline void Vector<T>::Reserve(size_t capacity)
+	template<typename T, typename TAllocator>
+	inline void Vector<T, TAllocator>::Reserve(size_t capacity)
 	{
 		if (capacity > _capacity)
 		{
-			T* data = reinterpret_cast<T*>(realloc(_data, sizeof(T) * capacity));
-			assert(data != nullptr);
-			_data = data;
+			_data = Reallocate(_allocator, _data, _size, _capacity, capacity);
 			_capacity = capacity;
 		}
 	}
 
-	template<typename T>
-	inline void Vector<T>::Resize(size_t size)
+	template<typename T, typename TAllocator>
+	inline void Vector<T, TAllocator>::Resize(size_t size)
 	{
 		if (size < _size)
 		{
@@ -473,98 +478,149 @@ namespace FIEAGameEngine
 		_size = size;
 	}
 
-	template<typename T>
-	void Vector<T>::Clear()
+	template<typename T, typename TAllocator>
+	inline void Vector<T, TAllocator>::Resize(size_t size, const T& value)
 	{
-		for (size_t i = 0_z; i < _size; ++i)
+		if (size < _size)
 		{
-			_data[i].~T();
+			DestroyElements(_data + size, _size - size);
 		}
+		else
+		{
+			Reserve(size);
+			for (size_t i = _size; i < size; ++i)
+			{
+				new (_data + i)T(value);
+			}
+		}
+
+		_size = size;
+	}
 
+	template<typename T, typename TAllocator>
+	void Vector<T, TAllocator>::Clear()
+	{
+		DestroyElements(_data, _size);
 		_size = 0;
 	}
 
-	template<typename T>
-	inline void Vector<T>::ShrinkToFit()
+	template<typename T, typename TAllocator>
+	inline void Vector<T, TAllocator>::ShrinkToFit()
 	{
 		if (_size == 0_z)
 		{
-			free(_data);
+			_allocator.Deallocate(_data, sizeof(T) * _capacity, alignof(T));
 			_data = nullptr;
 		}
 		else if (_size < _capacity)
 		{
-			T* data = reinterpret_cast<T*>(realloc(_data, sizeof(T) * _size));
-			assert(data != nullptr);
-			_data = data;
+			_data = Reallocate(_allocator, _data, _size, _capacity, _size);
 		}
 		_capacity = _size;
 	}
 
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::begin()
+	template<typename T, typename TAllocator>
+	inline T* Vector<T, TAllocator>::Reallocate(TAllocator allocator, T* data, size_t size, size_t oldCapacity, size_t capacity)
+	{
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			T* newData = reinterpret_cast<T*>(allocator.Reallocate(data, sizeof(T) * oldCapacity, sizeof(T) * capacity, alignof(T)));
+			assert(newData != nullptr);
+			return newData;
+		}
+		else
+		{
+			T* newData = reinterpret_cast<T*>(allocator.Allocate(sizeof(T) * capacity, alignof(T)));
+			assert(newData != nullptr);
+			RelocateElements(newData, data, size);
+			allocator.Deallocate(data, sizeof(T) * oldCapacity, alignof(T));
+			return newData;
+		}
+	}
+
+	template<typename T, typename TAllocator>
+	inline TAllocator Vector<T, TAllocator>::GetAllocator() const
+	{
+		return _allocator;
+	}
+
+	template <typename T, typename TAllocator>
+	inline ContainerStats Vector<T, TAllocator>::Stats() const
+	{
+		return ContainerStats{ _size, _capacity * sizeof(T), _size * sizeof(T) };
+	}
+
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::begin()
 	{
 		return Iterator(*this, 0_z);
 	}
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::begin() const
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::begin() const
 	{
 		return ConstIterator(*this, 0_z);
 	}
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cbegin() const
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::cbegin() const
 	{
 		return ConstIterator(*this, 0_z);
 	}
-	template<typename T>
-	inline typename Vector<T>::Iterator Vector<T>::end()
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::end()
 	{
 		return Iterator(*this, _size);
 	}
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::end() const
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::end() const
 	{
 		return ConstIterator(*this, _size);
 	}
-	template<typename T>
-	inline typename Vector<T>::ConstIterator Vector<T>::cend() const
+	template<typename T, typename TAllocator>
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::cend() const
 	{
 		return ConstIterator(*this, _size);
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template <typename EqualityFunctor>
-	inline typename Vector<T>::Iterator Vector<T>::Find(const T& value)
+	inline typename Vector<T, TAllocator>::Iterator Vector<T, TAllocator>::Find(const T& value)
 	{
-		EqualityFunctor eq;
-
-		Iterator it = begin();
-		for (; it != end(); it++)
+		if constexpr (std::is_same_v<EqualityFunctor, DefaultEquality<T>> && IsSimdFindable<T>)
 		{
-			if (eq(*it, value))
+			return Iterator(*this, SimdFind(_data, _size, value));
+		}
+		else
+		{
+			EqualityFunctor eq;
+
+			Iterator it = begin();
+			for (; it != end(); it++)
 			{
-				break;
+				if (eq(*it, value))
+				{
+					break;
+				}
 			}
+			return it;
 		}
-		return it;
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template <typename EqualityFunctor>
-	inline typename Vector<T>::ConstIterator Vector<T>::Find(const T& value) const
+	inline typename Vector<T, TAllocator>::ConstIterator Vector<T, TAllocator>::Find(const T& value) const
 	{
 		return const_cast<Vector*>(this)->Find<EqualityFunctor>(value);
 	}
 
-	template<typename T>
+	template<typename T, typename TAllocator>
 	template<typename EqualityFunctor>
-	inline bool Vector<T>::Remove(const T& value)
+	inline bool Vector<T, TAllocator>::Remove(const T& value)
 	{
 		return Remove(Find<EqualityFunctor>(value));
 	}
 
-	template<typename T>
-	inline bool Vector<T>::Remove(const Iterator& it)
+	template<typename T, typename TAllocator>
+	inline bool Vector<T, TAllocator>::Remove(const Iterator& it)
 	{
 		if (it._owner != this)
 		{
@@ -575,15 +631,7 @@ namespace FIEAGameEngine
 		if (it != end())
 		{
 			_data[it._index].~T();
-			size_t size = sizeof(T) * (_size - it._index - 1_z);
-			if (size > 0)
-			{
-#ifdef _WINDOWS
-				memmove_s(_data + it._index, size, _data + it._index + 1_z, size);
-#else
-				memmove(_data + it._index, _data + it._index + 1_z, size);
-#endif 
-			}
+			RelocateElements(_data + it._index, _data + it._index + 1_z, _size - it._index - 1_z);
 			--_size;
 			found = true;
 		}
@@ -591,8 +639,8 @@ namespace FIEAGameEngine
 		return found;
 	}
 
-	template<typename T>
-	inline void Vector<T>::Remove(const Iterator& first, const Iterator& last)
+	template<typename T, typename TAllocator>
+	inline void Vector<T, TAllocator>::Remove(const Iterator& first, const Iterator& last)
 	{
 		if (first._owner != this || last._owner != this)
 		{
@@ -612,25 +660,8 @@ namespace FIEAGameEngine
 		size_t elementsToRemove = (last._index - first._index);
 		if (elementsToRemove > 0)
 		{
-			Iterator it = first, end = last;
-			for (; it != end; ++it)
-			{
-				_data[it._index].~T();
-			}
-
-			size_t elementsToMove = (_size - last._index);
-			if (elementsToMove > 0)
-			{
-				const auto size = elementsToMove * sizeof(T);
-#ifdef _WINDOWS
-				memmove_s(_data + first._index, size, _data + last._index, size);
-#endif
-
-#ifndef _WINDOWS
-				memmove(_data + first._index, _data + last._index, size);
-#endif 
-			}
-
+			DestroyElements(_data + first._index, elementsToRemove);
+			RelocateElements(_data + first._index, _data + last._index, _size - last._index);
 		}
 		_size -= elementsToRemove;
 	}
@@ -33,8 +33,11 @@ namespace FIEAGameEngine
 
 	void WorldState::ProcessCreateQueue()
 	{
-		for (CreateAction createAction : createQueue)
+		while (!createQueue.IsEmpty())
 		{
+			CreateAction createAction = createQueue.Front();
+			createQueue.PopFront();
+
 			Scope* scope = Factory<Scope>::Create(createAction._className);
 			assert(scope != nullptr);
 			assert(scope->Is(Action::TypeIdClass()));
@@ -44,13 +47,15 @@ namespace FIEAGameEngine
 			action.SetTarget(createAction._targetName);
 			createAction._context.Adopt(action, "Actions");
 		}
-		createQueue.Clear();
 	}
 
 	void WorldState::ProcessDestroyQueue()
 	{
-		for (DestroyAction destroyAction : destroyQueue)
+		while (!destroyQueue.IsEmpty())
 		{
+			DestroyAction destroyAction = destroyQueue.Front();
+			destroyQueue.PopFront();
+
 			Datum* actionsDatum = destroyAction._context.Find("Actions");
 			assert(actionsDatum != nullptr);
 
@@ -68,7 +73,6 @@ namespace FIEAGameEngine
 				}
 			}
 		}
-		destroyQueue.Clear();
 	}
 
 	void WorldState::AddCreateAction(CreateAction action)
@@ -77,13 +81,17 @@ namespace FIEAGameEngine
 	}
 	void WorldState::AddDestroyAction(DestroyAction action)
 	{
-		for (auto it = destroyQueue.begin(); it != destroyQueue.end(); ++it)
+		// Remove leaves the iterator on the element after the removed one, so it only advances past elements that stay.
+		for (auto it = destroyQueue.begin(); it != destroyQueue.end();)
 		{
-			DestroyAction destroyAction = *it;
-			if (destroyAction._context.IsDescendantOf(action._context))
+			if ((*it)._context.IsDescendantOf(action._context))
 			{
 				destroyQueue.Remove(it);
 			}
+			else
+			{
+				++it;
+			}
 		}
 		
 		destroyQueue.PushBack(action);
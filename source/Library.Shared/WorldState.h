@@ -1,6 +1,6 @@
 #pragma once
 #include "GameTime.h"
-#include "Vector.h"
+#include "Deque.h"
 #include "Action.h"
 #include "EventQueue.h"
 
@@ -154,11 +154,11 @@ namespace FIEAGameEngine
 		/// </summary>
 		void ProcessQueues();
 		/// <summary>
-		/// Processes each of the CreateAction structs in the createQueue at this moment. Clears the queue afterwards.
+		/// Processes each of the CreateAction structs in the createQueue, oldest first, taking each off the queue as it goes.
 		/// </summary>
 		void ProcessCreateQueue();
 		/// <summary>
-		/// Processes each of the DeleteAction structs in the deleteQueue at this moment. Clears the queue afterwards.
+		/// Processes each of the DeleteAction structs in the deleteQueue, oldest first, taking each off the queue as it goes.
 		/// </summary>
 		void ProcessDestroyQueue();
 		/// <summary>
@@ -176,10 +176,10 @@ namespace FIEAGameEngine
 		/// <summary>
 		/// Queue to hold all the pending CreateAction calls (through the info stored in a CreateAction struct).
 		/// </summary>
-		Vector<CreateAction> createQueue;
+		Deque<CreateAction> createQueue;
 		/// <summary>
 		/// Queue to hold all the pending DeleteAction calls (through the info stored in a DeleteAction struct).
 		/// </summary>
-		Vector<DestroyAction> destroyQueue;
+		Deque<DestroyAction> destroyQueue;
 	};
 }
\ No newline at end of file
@@ -20,5 +20,5 @@
 #include "Scope.h"
 
 #ifndef UNREFERENCED_LOCAL
-#define UNREFERENCED_LOCAL(P) (P)
+#define UNREFERENCED_LOCAL(P) static_cast<void>(P)
 #endif
\ No newline at end of file
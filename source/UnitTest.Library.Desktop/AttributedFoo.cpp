@@ -15,9 +15,9 @@ namespace UnitTests
 
 	}
 
-	const FIEAGameEngine::Vector< FIEAGameEngine::Signature> AttributedFoo::Signatures()
+	const FIEAGameEngine::SignatureList AttributedFoo::Signatures()
 	{
-		return Vector< FIEAGameEngine::Signature>
+		return SignatureList
 		{
 			{"ExternalInteger"s, Datum::DatumTypes::Integer, 1, offsetof(AttributedFoo, ExternalInteger) },
 			{ "ExternalFloat"s, Datum::DatumTypes::Float, 1, offsetof(AttributedFoo, ExternalFloat) },
@@ -29,6 +29,13 @@ namespace UnitTests
 			{ "ExternalStringArray"s, Datum::DatumTypes::String, ArraySize, offsetof(AttributedFoo, ExternalStringArray) },
 			{ "ExternalVectorArray"s, Datum::DatumTypes::Vector, ArraySize, offsetof(AttributedFoo, ExternalVectorArray) },
 			{ "ExternalMatrixArray"s, Datum::DatumTypes::Matrix, ArraySize, offsetof(AttributedFoo, ExternalMatrixArray) },
+			{ "ExternalBoolean"s, Datum::DatumTypes::Boolean, 1, offsetof(AttributedFoo, ExternalBoolean) },
+			{ "ExternalInteger64"s, Datum::DatumTypes::Integer64, 1, offsetof(AttributedFoo, ExternalInteger64) },
+			{ "ExternalDouble"s, Datum::DatumTypes::Double, 1, offsetof(AttributedFoo, ExternalDouble) },
+			{ "ExternalVector2"s, Datum::DatumTypes::Vector2, 1, offsetof(AttributedFoo, ExternalVector2) },
+			{ "ExternalVector3"s, Datum::DatumTypes::Vector3, 1, offsetof(AttributedFoo, ExternalVector3) },
+			{ "ExternalQuaternion"s, Datum::DatumTypes::Quaternion, 1, offsetof(AttributedFoo, ExternalQuaternion) },
+			{ "ExternalMatrix3"s, Datum::DatumTypes::Matrix3, 1, offsetof(AttributedFoo, ExternalMatrix3) },
 			{ "NestedScope"s, Datum::DatumTypes::Table, 1, 0 },
 			{ "NestedScopeArray"s, Datum::DatumTypes::Table, ArraySize, 0 },
 		};
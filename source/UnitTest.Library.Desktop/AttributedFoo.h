@@ -67,20 +67,48 @@ namespace UnitTests
 		/// <summary>
 		/// Example vector used to create a prescribed attribute.
 		/// </summary>
-		glm::vec4 ExternalVector;
+		glm::vec4 ExternalVector{};
 		/// <summary>
 		/// Example matrix used to create a prescribed attribute.
 		/// </summary>
-		glm::mat4 ExternalMatrix;
+		glm::mat4 ExternalMatrix{};
+		/// <summary>
+		/// Example bool used to create a prescribed attribute.
+		/// </summary>
+		bool ExternalBoolean = false;
+		/// <summary>
+		/// Example 64-bit integer used to create a prescribed attribute.
+		/// </summary>
+		std::int64_t ExternalInteger64 = 0;
+		/// <summary>
+		/// Example double used to create a prescribed attribute.
+		/// </summary>
+		double ExternalDouble = 0.0;
+		/// <summary>
+		/// Example 2-vector used to create a prescribed attribute.
+		/// </summary>
+		glm::vec2 ExternalVector2{};
+		/// <summary>
+		/// Example 3-vector used to create a prescribed attribute.
+		/// </summary>
+		glm::vec3 ExternalVector3{};
+		/// <summary>
+		/// Example quaternion used to create a prescribed attribute.
+		/// </summary>
+		glm::quat ExternalQuaternion{};
+		/// <summary>
+		/// Example 3x3 matrix used to create a prescribed attribute.
+		/// </summary>
+		glm::mat3 ExternalMatrix3{};
 
 		/// <summary>
 		/// Example integer array used to create a prescribed attribute.
 		/// </summary>
-		int ExternalIntegerArray[ArraySize];
+		int ExternalIntegerArray[ArraySize]{};
 		/// <summary>
 		/// Example float array used to create a prescribed attribute.
 		/// </summary>
-		float ExternalFloatArray[ArraySize];
+		float ExternalFloatArray[ArraySize]{};
 		/// <summary>
 		/// Example string array used to create a prescribed attribute.
 		/// </summary>
@@ -88,11 +116,11 @@ namespace UnitTests
 		/// <summary>
 		/// Example vector array used to create a prescribed attribute.
 		/// </summary>
-		glm::vec4 ExternalVectorArray[ArraySize];
+		glm::vec4 ExternalVectorArray[ArraySize]{};
 		/// <summary>
 		/// Example matrix array used to create a prescribed attribute.
 		/// </summary>
-		glm::mat4 ExternalMatrixArray[ArraySize];
+		glm::mat4 ExternalMatrixArray[ArraySize]{};
 
 		/// <summary>
 		/// An override on the clone function which provides a heap allocated object of an Attributed Foo.
@@ -115,6 +143,6 @@ namespace UnitTests
 		/// Provides the Signatures Vector for an AttributedFoo with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an AttributedFoo.</returns>
-		static const FIEAGameEngine::Vector<FIEAGameEngine::Signature> Signatures();
+		static const FIEAGameEngine::SignatureList Signatures();
 	};
 }
\ No newline at end of file
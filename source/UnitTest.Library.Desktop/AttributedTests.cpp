@@ -199,6 +199,37 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(b, foo.ExternalFloat);
 		}
 
+		TEST_METHOD(CompactExternalAssignment)
+		{
+			AttributedFoo foo;
+
+			Assert::IsTrue(foo.IsPrescribedAttribute("ExternalBoolean"));
+			Assert::IsTrue(foo["ExternalQuaternion"].IsExternal());
+			Assert::IsTrue(foo["ExternalMatrix3"].Type() == Datum::DatumTypes::Matrix3);
+			Assert::AreSame(foo["ExternalVector3"].GetVector3(), foo.ExternalVector3);
+
+			foo["ExternalBoolean"] = true;
+			foo["ExternalInteger64"] = std::int64_t(1) << 40;
+			foo["ExternalDouble"] = 0.1;
+			foo["ExternalVector2"] = vec2(1.0f, 2.0f);
+			foo["ExternalVector3"].SetFromString("vec3(1, 2, 3)");
+			foo["ExternalQuaternion"].Set(quat(0.0f, 1.0f, 0.0f, 0.0f));
+			foo["ExternalMatrix3"] = mat3(2.0f);
+
+			Assert::IsTrue(foo.ExternalBoolean);
+			Assert::IsTrue(foo.ExternalInteger64 == std::int64_t(1) << 40);
+			Assert::AreEqual(0.1, foo.ExternalDouble);
+			Assert::IsTrue(foo.ExternalVector2 == vec2(1.0f, 2.0f));
+			Assert::IsTrue(foo.ExternalVector3 == vec3(1.0f, 2.0f, 3.0f));
+			Assert::IsTrue(foo.ExternalQuaternion == quat(0.0f, 1.0f, 0.0f, 0.0f));
+			Assert::IsTrue(foo.ExternalMatrix3 == mat3(2.0f));
+
+			AttributedFoo copy(foo);
+			Assert::IsTrue(copy.ExternalMatrix3 == mat3(2.0f));
+			Assert::AreSame(copy["ExternalMatrix3"].GetMatrix3(), copy.ExternalMatrix3);
+			Assert::ExpectException<exception>([&foo] { foo["ExternalDouble"] = 1.0f; }, L"Expected an exception, but none was thrown");
+		}
+
 		TEST_METHOD(CopyConstructor)
 		{
 			AttributedFoo foo;
@@ -20,9 +20,9 @@ namespace UnitTests
 		return new Avatar(*this);
 	}
 
-	const Vector<Signature> Avatar::Signatures()
+	const SignatureList Avatar::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ "Name"s, Datum::DatumTypes::String, 1, offsetof(Avatar, _name) },
 			{ "Children"s, Datum::DatumTypes::Table, 0, 0 },
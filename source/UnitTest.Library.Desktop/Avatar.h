@@ -16,7 +16,7 @@ namespace UnitTests
 		gsl::owner<Avatar*> Clone() const override;
 		int HitPoints = 100;
 
-		static const FIEAGameEngine::Vector<FIEAGameEngine::Signature> Signatures();
+		static const FIEAGameEngine::SignatureList Signatures();
 	};
 
 	ConcreteFactory(Avatar, FIEAGameEngine::Scope)
@@ -0,0 +1,189 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <atomic>
+#include <thread>
+#include "ToStringSpecialization.h"
+#include "ConcurrentHashMap.h"
+#include "Foo.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ConcurrentHashMapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			ConcurrentHashMap<int, Foo> map;
+			Assert::AreEqual(ConcurrentHashMap<int, Foo>::DefaultShardCount, map.ShardCount());
+			Assert::IsTrue(map.IsEmpty());
+
+			ConcurrentHashMap<int, Foo> rounded(5_z);
+			Assert::AreEqual(8_z, rounded.ShardCount());
+			ConcurrentHashMap<int, Foo> single(1_z);
+			Assert::AreEqual(1_z, single.ShardCount());
+
+			Assert::ExpectException<runtime_error>([] { ConcurrentHashMap<int, Foo> invalid(0_z); });
+			Assert::ExpectException<runtime_error>([] { ConcurrentHashMap<int, Foo> invalid(4_z, 0_z); });
+		}
+
+		TEST_METHOD(TestInsertFindRemove)
+		{
+			ConcurrentHashMap<int, Foo> map(4_z, 3_z);
+			Assert::IsNull(map.Find(1));
+
+			Assert::IsTrue(map.Insert(make_pair(1, Foo(10))));
+			Assert::IsFalse(map.Insert(make_pair(1, Foo(20))));
+			const auto entry = make_pair(2, Foo(20));
+			Assert::IsTrue(map.Insert(entry));
+			Assert::IsTrue(map.TryEmplace(3, 30));
+			Assert::IsFalse(map.TryEmplace(3, 40));
+			Assert::AreEqual(3_z, map.Size());
+
+			const Foo* value = map.Find(1);
+			Assert::IsNotNull(value);
+			Assert::AreEqual(Foo(10), *value);
+			Assert::AreEqual(Foo(30), *map.Find(3));
+			Assert::IsTrue(map.ContainsKey(2));
+			Assert::IsFalse(map.ContainsKey(4));
+
+			// Values stay put while every shard grows well past its initial bucket count.
+			for (int i = 100; i < 300; ++i)
+			{
+				map.TryEmplace(i, i);
+			}
+			Assert::AreEqual(203_z, map.Size());
+			Assert::IsTrue(value == map.Find(1));
+
+			size_t visited = 0;
+			int sum = 0;
+			map.ForEach([&visited, &sum](const ConcurrentHashMap<int, Foo>::PairType& pair)
+			{
+				++visited;
+				sum += pair.first;
+			});
+			Assert::AreEqual(map.Size(), visited);
+			Assert::AreEqual(1 + 2 + 3 + (100 + 299) * 100, sum);
+
+			Assert::IsTrue(map.Remove(2));
+			Assert::IsFalse(map.Remove(2));
+			Assert::IsFalse(map.ContainsKey(2));
+			Assert::AreEqual(202_z, map.Size());
+
+			map.Clear();
+			Assert::IsTrue(map.IsEmpty());
+			Assert::IsNull(map.Find(1));
+			Assert::IsTrue(map.TryEmplace(1, 50));
+			Assert::AreEqual(1_z, map.Size());
+		}
+
+		TEST_METHOD(TestStringKeys)
+		{
+			ConcurrentHashMap<string, int> map;
+			string key = "Health";
+			Assert::IsTrue(map.TryEmplace(std::move(key), 100));
+			Assert::IsTrue(key.empty());
+
+			string duplicate = "Health";
+			Assert::IsFalse(map.TryEmplace(std::move(duplicate), 50));
+			Assert::AreEqual("Health"s, duplicate);
+
+			// Both policies are transparent for std::string, so a string_view finds the entry without building a string.
+			const string_view view = "Health";
+			Assert::IsNotNull(map.Find(view));
+			Assert::AreEqual(100, *map.Find(view));
+			Assert::IsFalse(map.ContainsKey("Armor"sv));
+		}
+
+		TEST_METHOD(TestConcurrentAccess)
+		{
+			ConcurrentHashMap<int, int> map;
+			const int threadCount = 4;
+			const int keysPerThread = 500;
+			const int sharedKeyCount = 100;
+
+			for (int i = 0; i < sharedKeyCount; ++i)
+			{
+				map.TryEmplace(-1 - i, i);
+			}
+
+			atomic<int> sharedWins{ 0 };
+			atomic<bool> readFailed{ false };
+			vector<thread> threads;
+			for (int t = 0; t < threadCount; ++t)
+			{
+				threads.emplace_back([&map, &sharedWins, &readFailed, t, keysPerThread, sharedKeyCount]
+				{
+					for (int i = 0; i < keysPerThread; ++i)
+					{
+						const int key = t * keysPerThread + i;
+						map.TryEmplace(key, key);
+
+						// Every thread races for the same keys: exactly one TryEmplace per key may win.
+						if (map.TryEmplace(1000000 + i % sharedKeyCount, t))
+						{
+							++sharedWins;
+						}
+
+						// Keys added before the threads started must stay readable while the shards grow.
+						const int* value = map.Find(-1 - i % sharedKeyCount);
+						if (value == nullptr || *value != i % sharedKeyCount)
+						{
+							readFailed = true;
+						}
+					}
+
+					for (int i = 0; i < keysPerThread; i += 2)
+					{
+						map.Remove(t * keysPerThread + i);
+					}
+				});
+			}
+
+			for (thread& worker : threads)
+			{
+				worker.join();
+			}
+
+			Assert::IsFalse(readFailed.load());
+			Assert::AreEqual(sharedKeyCount, sharedWins.load());
+			Assert::AreEqual(static_cast<size_t>(2 * sharedKeyCount + threadCount * keysPerThread / 2), map.Size());
+			for (int key = 1; key < threadCount * keysPerThread; key += 2)
+			{
+				Assert::AreEqual(key, *map.Find(key));
+			}
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ConcurrentHashMapTests::sStartMemState;
+}
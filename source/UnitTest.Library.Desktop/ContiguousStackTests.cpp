@@ -0,0 +1,134 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include "ToStringSpecialization.h"
+#include "ContiguousStack.h"
+#include "Foo.h"
+#include "CountingResource.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ContiguousStackTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		/// <summary>
+		/// Tests all the functions of the ContiguousStack object.
+		/// </summary>
+		TEST_METHOD(TestStackFunctions)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+
+			ContiguousStack<Foo, 2> stack;
+			Assert::IsTrue(stack.IsEmpty());
+			Assert::AreEqual(2_z, stack.Capacity());
+			Assert::ExpectException<runtime_error>([&stack] { stack.Top(); });
+			stack.Pop();
+
+			stack.Push(a);
+			stack.Push(b);
+			stack.Push(c);
+			Assert::AreEqual(3_z, stack.Size());
+			Assert::AreEqual(c, stack.Top());
+
+			stack.Top() = Foo(40);
+			const ContiguousStack<Foo, 2>& constStack = stack;
+			Assert::AreEqual(Foo(40), constStack.Top());
+
+			stack.Pop();
+			Assert::AreEqual(2_z, stack.Size());
+			Assert::AreEqual(b, stack.Top());
+
+			stack.Pop();
+			Assert::AreEqual(a, stack.Top());
+
+			stack.Pop();
+			Assert::IsTrue(stack.IsEmpty());
+
+			stack.Push(Foo(10));
+			Assert::AreEqual(1_z, stack.Size());
+
+			const size_t capacity = stack.Capacity();
+			stack.Clear();
+			Assert::AreEqual(0_z, stack.Size());
+			Assert::AreEqual(capacity, stack.Capacity());
+		}
+
+		/// <summary>
+		/// Tests that a stack stays inline until it outgrows N, and that Reserve takes the allocation up front.
+		/// </summary>
+		TEST_METHOD(TestReserve)
+		{
+			CountingResource resource;
+			{
+				ContiguousStack<int, 4, ResourceAllocator> stack(0_z, ResourceAllocator(&resource));
+				for (int i = 0; i < 4; ++i)
+				{
+					stack.Push(i);
+				}
+				Assert::AreEqual(0_z, resource.Allocations);
+
+				stack.Reserve(100_z);
+				Assert::AreEqual(1_z, resource.Allocations);
+				Assert::AreEqual(100_z, stack.Capacity());
+				for (int i = 4; i < 100; ++i)
+				{
+					stack.Push(i);
+				}
+				Assert::AreEqual(1_z, resource.Allocations);
+				Assert::AreEqual(99, stack.Top());
+
+				stack.Reserve(10_z);
+				Assert::AreEqual(100_z, stack.Capacity());
+
+				ContiguousStack<int, 4, ResourceAllocator> presized(64_z, ResourceAllocator(&resource));
+				Assert::AreEqual(64_z, presized.Capacity());
+				Assert::AreEqual(2_z, resource.Allocations);
+			}
+			Assert::AreEqual(0_z, resource.OutstandingBytes);
+		}
+
+		TEST_METHOD(TestEmplace)
+		{
+			ContiguousStack<pair<int, string>, 1> stack;
+			stack.Emplace(1, "one");
+			pair<int, string>& top = stack.Emplace(2, "two");
+			Assert::AreEqual("two"s, top.second);
+			Assert::AreEqual(2_z, stack.Size());
+			stack.Pop();
+			Assert::AreEqual(1, stack.Top().first);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ContiguousStackTests::sStartMemState;
+}
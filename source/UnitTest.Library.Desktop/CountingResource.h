@@ -0,0 +1,36 @@
+#pragma once
+#include "MemoryResource.h"
+#include "SizeLiteral.h"
+
+namespace UnitTests
+{
+	/// <summary>
+	/// Forwards to DefaultResource and keeps count of what is outstanding, so a test can see that a container allocated through its resource and gave everything back.
+	/// </summary>
+	class CountingResource final : public FIEAGameEngine::MemoryResource
+	{
+	public:
+		void* Allocate(size_t size, size_t alignment) override
+		{
+			++Allocations;
+			OutstandingBytes += size;
+			return FIEAGameEngine::DefaultResource().Allocate(size, alignment);
+		}
+
+		void Deallocate(void* memory, size_t size, size_t alignment) override
+		{
+			OutstandingBytes -= size;
+			FIEAGameEngine::DefaultResource().Deallocate(memory, size, alignment);
+		}
+
+		void* Reallocate(void* memory, size_t oldSize, size_t newSize, size_t alignment) override
+		{
+			++Allocations;
+			OutstandingBytes += newSize - oldSize;
+			return FIEAGameEngine::DefaultResource().Reallocate(memory, oldSize, newSize, alignment);
+		}
+
+		size_t Allocations{ 0_z };
+		size_t OutstandingBytes{ 0_z };
+	};
+}
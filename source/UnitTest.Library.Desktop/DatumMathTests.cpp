@@ -0,0 +1,235 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include "ToStringSpecialization.h"
+#include "DatumMath.h"
+#include "SizeLiteral.h"
+#include <glm/gtx/string_cast.hpp>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<glm::vec4>(const glm::vec4& t)
+	{
+		try
+		{
+			return ToString(glm::to_string(t));
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<glm::mat4>(const glm::mat4& t)
+	{
+		try
+		{
+			return ToString(glm::to_string(t));
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+}
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(DatumMathTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestElementWise)
+		{
+			{
+				Datum floats{ 1.0f, 2.0f, 3.0f, 4.0f, 5.0f };
+				DatumMath::Scale(floats, 2.0f);
+				Assert::AreEqual(10.0f, floats.GetFloat(4_z));
+
+				const Datum offsets{ 1.0f, 1.0f, 1.0f, 1.0f, 1.0f };
+				DatumMath::Add(floats, offsets);
+				Assert::AreEqual(3.0f, floats.GetFloat(0_z));
+
+				DatumMath::MultiplyAdd(floats, offsets, -3.0f);
+				Assert::AreEqual(0.0f, floats.GetFloat(0_z));
+				Assert::AreEqual(8.0f, floats.GetFloat(4_z));
+
+				DatumMath::Lerp(floats, offsets, 0.5f);
+				Assert::AreEqual(0.5f, floats.GetFloat(0_z));
+				Assert::AreEqual(4.5f, floats.GetFloat(4_z));
+
+				DatumMath::Clamp(floats, 1.0f, 3.0f);
+				Assert::AreEqual(1.0f, floats.GetFloat(0_z));
+				Assert::AreEqual(2.5f, floats.GetFloat(2_z));
+				Assert::AreEqual(3.0f, floats.GetFloat(4_z));
+				Assert::ExpectException<exception>([&floats] { DatumMath::Clamp(floats, 3.0f, 1.0f); }, L"Expected an exception, but none was thrown");
+			}
+
+			{
+				// Positions move by velocity over a frame, every component at once.
+				Datum positions{ glm::vec4(0.0f), glm::vec4(1.0f), glm::vec4(2.0f) };
+				const Datum velocities{ glm::vec4(2.0f), glm::vec4(4.0f, 0.0f, -4.0f, 0.0f), glm::vec4(0.0f) };
+				DatumMath::MultiplyAdd(positions, velocities, 0.5f);
+				Assert::AreEqual(glm::vec4(1.0f), positions.GetVector(0_z));
+				Assert::AreEqual(glm::vec4(3.0f, 1.0f, -1.0f, 1.0f), positions.GetVector(1_z));
+				Assert::AreEqual(glm::vec4(2.0f), positions.GetVector(2_z));
+
+				Datum matrices{ glm::mat4(1.0f), glm::mat4(2.0f) };
+				DatumMath::Scale(matrices, 3.0f);
+				Assert::AreEqual(glm::mat4(3.0f), matrices.GetMatrix(0_z));
+				Assert::AreEqual(glm::mat4(6.0f), matrices.GetMatrix(1_z));
+			}
+
+			{
+				float values[] = { -2.0f, 0.0f, 2.0f };
+				Datum external;
+				external.SetStorage(values, 3_z);
+				DatumMath::Clamp(external, -1.0f, 1.0f);
+				Assert::AreEqual(-1.0f, values[0]);
+				Assert::AreEqual(1.0f, values[2]);
+			}
+
+			{
+				Datum floats{ 1.0f, 2.0f };
+				Datum shorter{ 1.0f };
+				Datum vectors{ glm::vec4(1.0f), glm::vec4(2.0f) };
+				Datum ints{ 1, 2 };
+				Datum empty;
+				Assert::ExpectException<exception>([&floats, &shorter] { DatumMath::Add(floats, shorter); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&floats, &vectors] { DatumMath::Lerp(floats, vectors, 0.5f); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&ints] { DatumMath::Scale(ints, 2.0f); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&empty] { DatumMath::Scale(empty, 2.0f); }, L"Expected an exception, but none was thrown");
+
+				Datum emptyFloats;
+				emptyFloats.SetType(Datum::DatumTypes::Float);
+				DatumMath::Scale(emptyFloats, 2.0f);
+				Assert::AreEqual(0_z, emptyFloats.Size());
+			}
+		}
+
+		TEST_METHOD(TestTransform)
+		{
+			const glm::mat4 translation(glm::vec4(1.0f, 0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 1.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 1.0f, 0.0f), glm::vec4(5.0f, 6.0f, 7.0f, 1.0f));
+
+			Datum points{ glm::vec4(0.0f, 0.0f, 0.0f, 1.0f), glm::vec4(1.0f, 2.0f, 3.0f, 1.0f), glm::vec4(1.0f, 2.0f, 3.0f, 0.0f) };
+			DatumMath::Transform(points, translation);
+			Assert::AreEqual(glm::vec4(5.0f, 6.0f, 7.0f, 1.0f), points.GetVector(0_z));
+			Assert::AreEqual(glm::vec4(6.0f, 8.0f, 10.0f, 1.0f), points.GetVector(1_z));
+			Assert::AreEqual(glm::vec4(1.0f, 2.0f, 3.0f, 0.0f), points.GetVector(2_z));
+
+			const glm::mat4 scale(2.0f);
+			Datum matrices{ translation, glm::mat4(1.0f) };
+			DatumMath::Transform(matrices, scale);
+			Assert::AreEqual(scale * translation, matrices.GetMatrix(0_z));
+			Assert::AreEqual(scale, matrices.GetMatrix(1_z));
+
+			Datum floats{ 1.0f };
+			Assert::ExpectException<exception>([&floats, &scale] { DatumMath::Transform(floats, scale); }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestCopiesAreUnchanged)
+		{
+			// Matrix Datums share their buffer with copies, so writing one must leave the others alone.
+			Datum matrices{ glm::mat4(1.0f), glm::mat4(2.0f) };
+			const Datum copy(matrices);
+			Assert::IsTrue(copy.IsShared());
+
+			DatumMath::Scale(matrices, 5.0f);
+			Assert::AreEqual(glm::mat4(5.0f), matrices.GetMatrix(0_z));
+			Assert::AreEqual(glm::mat4(1.0f), copy.GetMatrix(0_z));
+			Assert::AreEqual(glm::mat4(2.0f), copy.GetMatrix(1_z));
+
+			const Datum other(copy);
+			Datum sum(copy);
+			DatumMath::Add(sum, other);
+			DatumMath::Clamp(sum, 0.0f, 3.0f);
+			Assert::AreEqual(glm::mat4(2.0f), sum.GetMatrix(0_z));
+			Assert::AreEqual(glm::mat4(1.0f), copy.GetMatrix(0_z));
+			Assert::AreEqual(glm::mat4(1.0f), other.GetMatrix(0_z));
+		}
+
+		TEST_METHOD(TestReductions)
+		{
+			const Datum floats{ 3.0f, -1.0f, 4.0f, 1.0f, -5.0f, 9.0f, 2.0f, 6.0f, 5.0f };
+			Assert::AreEqual(24.0f, DatumMath::Sum(floats));
+			Assert::AreEqual(-5.0f, DatumMath::Min(floats));
+			Assert::AreEqual(9.0f, DatumMath::Max(floats));
+
+			const Datum vectors{ glm::vec4(1.0f), glm::vec4(1.0f, 2.0f, 3.0f, 4.0f), glm::vec4(-2.0f) };
+			Assert::AreEqual(glm::vec4(0.0f, 1.0f, 2.0f, 3.0f), DatumMath::SumVectors(vectors));
+
+			Datum empty;
+			empty.SetType(Datum::DatumTypes::Float);
+			Assert::AreEqual(0.0f, DatumMath::Sum(empty));
+			Assert::ExpectException<exception>([&empty] { DatumMath::Min(empty); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&empty] { DatumMath::Max(empty); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&vectors] { DatumMath::Sum(vectors); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&floats] { DatumMath::SumVectors(floats); }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestConvert)
+		{
+			const Datum ints{ -3, 0, 7, 100000 };
+			Datum floats;
+			DatumMath::Convert(ints, floats);
+			Assert::IsTrue(floats.Type() == Datum::DatumTypes::Float);
+			Assert::AreEqual(4_z, floats.Size());
+			Assert::AreEqual(-3.0f, floats.GetFloat(0_z));
+			Assert::AreEqual(100000.0f, floats.GetFloat(3_z));
+
+			floats.GetFloat(0_z) = -2.75f;
+			floats.GetFloat(1_z) = 0.5f;
+			Datum roundTrip{ 1 };
+			DatumMath::Convert(floats, roundTrip);
+			Assert::AreEqual(4_z, roundTrip.Size());
+			Assert::AreEqual(-2, roundTrip.GetInteger(0_z));
+			Assert::AreEqual(0, roundTrip.GetInteger(1_z));
+			Assert::AreEqual(7, roundTrip.GetInteger(2_z));
+
+			int storage[4];
+			Datum external;
+			external.SetStorage(storage, 4_z);
+			DatumMath::Convert(floats, external);
+			Assert::AreEqual(100000, storage[3]);
+
+			int small[2];
+			Datum smallExternal;
+			smallExternal.SetStorage(small, 2_z);
+			Datum strings{ "Hello"s };
+			Assert::ExpectException<exception>([&floats, &smallExternal] { DatumMath::Convert(floats, smallExternal); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&ints, &roundTrip] { DatumMath::Convert(ints, roundTrip); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&strings, &floats] { DatumMath::Convert(strings, floats); }, L"Expected an exception, but none was thrown");
+		}
+
+	private:
+		inline static _CrtMemState sStartMemState;
+	};
+}
@@ -6,6 +6,10 @@
 #include "Datum.h"
 #include "Scope.h"
 #include <glm/gtx/string_cast.hpp>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace UnitTests;
@@ -624,9 +628,10 @@ namespace UnitTestLibraryDesktop
 				f.SetFromString(str_f20, 0_z);
 				f.SetFromString(str_f10, 1_z);
 				f.SetFromString(str_f5, 2_z);
-				Assert::AreEqual(f.ToString(0_z), to_string(20.f));
-				Assert::AreEqual(f.ToString(1_z), to_string(10.f));
-				Assert::AreEqual(f.ToString(2_z), to_string(5.f));
+				Assert::AreEqual(f.ToString(0_z), "20"s);
+				Assert::AreEqual(f.ToString(1_z), "10"s);
+				Assert::AreEqual(f.ToString(2_z), "5"s);
+				Assert::ExpectException<exception>([&f] { f.SetFromString("ten"s, 0_z); }, L"Expected an exception, but none was thrown");
 
 
 				std::string str_hello = "Hello";
@@ -647,9 +652,9 @@ namespace UnitTestLibraryDesktop
 				v.SetFromString(str_vec2, 0_z);
 				v.SetFromString(str_vec1, 1_z);
 				v.SetFromString(str_vec0, 2_z);
-				Assert::AreEqual(v.ToString(0_z), glm::to_string(glm::vec4(2)));
-				Assert::AreEqual(v.ToString(1_z), glm::to_string(glm::vec4(1)));
-				Assert::AreEqual(v.ToString(2_z), glm::to_string(glm::vec4(0)));
+				Assert::AreEqual(v.ToString(0_z), "vec4(2, 2, 2, 2)"s);
+				Assert::AreEqual(v.ToString(1_z), "vec4(1, 1, 1, 1)"s);
+				Assert::AreEqual(v.ToString(2_z), "vec4(0, 0, 0, 0)"s);
 
 				std::string str_mat0 = glm::to_string(glm::mat4(0));
 				std::string str_mat1 = glm::to_string(glm::mat4(1));
@@ -658,9 +663,9 @@ namespace UnitTestLibraryDesktop
 				m.SetFromString(str_mat2, 0_z);
 				m.SetFromString(str_mat1, 1_z);
 				m.SetFromString(str_mat0, 2_z);
-				Assert::AreEqual(m.ToString(0_z), glm::to_string(glm::mat4(2)));
-				Assert::AreEqual(m.ToString(1_z), glm::to_string(glm::mat4(1)));
-				Assert::AreEqual(m.ToString(2_z), glm::to_string(glm::mat4(0)));
+				Assert::AreEqual(m.ToString(0_z), "mat4x4((2, 0, 0, 0), (0, 2, 0, 0), (0, 0, 2, 0), (0, 0, 0, 2))"s);
+				Assert::AreEqual(m.ToString(1_z), "mat4x4((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (0, 0, 0, 1))"s);
+				Assert::AreEqual(m.ToString(2_z), "mat4x4((0, 0, 0, 0), (0, 0, 0, 0), (0, 0, 0, 0), (0, 0, 0, 0))"s);
 
 				Foo a(10), b(20), c(30);
 				RTTI* a_rtti = &a;
@@ -675,6 +680,25 @@ namespace UnitTestLibraryDesktop
 				Assert::AreEqual(p.ToString(1_z), b_rtti->ToString());
 				Assert::AreEqual(p.ToString(2_z), c_rtti->ToString());
 			}
+
+			// Into a caller's buffer
+			{
+				char buffer[TextConversion::MaxMatrixLength];
+				Datum f{ 0.1f, -2.5f };
+				Assert::AreEqual("0.1"s, string(buffer, f.ToString(buffer, 0_z)));
+				f.SetFromString(string_view(buffer, f.ToString(buffer, 0_z)), 1_z);
+				Assert::AreEqual(0.1f, f.GetFloat(1_z));
+
+				Datum v{ glm::vec4(1.0f, 2.0f, 3.0f, 4.0f) };
+				Assert::AreEqual("vec4(1, 2, 3, 4)"s, string(buffer, v.ToString(buffer)));
+
+				Datum s{ "Hello"s };
+				Assert::AreEqual("Hello"s, string(buffer, s.ToString(buffer)));
+				Assert::ExpectException<exception>([&s, &buffer] { s.ToString(span<char>(buffer, 4_z)); }, L"Expected an exception, but none was thrown");
+
+				Datum m{ glm::mat4(1.0f) };
+				Assert::ExpectException<exception>([&m, &buffer] { m.ToString(span<char>(buffer, 16_z)); }, L"Expected an exception, but none was thrown");
+			}
 		}
 
 		TEST_METHOD(TestPushBackPopBackFrontBack)
@@ -1382,9 +1406,9 @@ namespace UnitTestLibraryDesktop
 
 				Datum s{ "Hello"s, "Hi"s, "Henlo"s };
 				const Datum constS{ "Hello"s, "Hi"s, "Henlo"s };
-				index = f.IndexOf("Hello"s);
+				index = s.IndexOf("Hello"s);
 				Assert::AreEqual(index, 0_z);
-				index = constF.IndexOf("Hello"s);
+				index = constS.IndexOf("Hello"s);
 				Assert::AreEqual(index, 0_z);
 
 				Datum v{ glm::vec4(0), glm::vec4(1), glm::vec4(2) };
@@ -1545,7 +1569,578 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestInlineStorage)
+		{
+			{
+				Datum d;
+				d.SetType(Datum::DatumTypes::Integer);
+				d.PushBack(10);
+				Assert::AreEqual(sizeof(void*) / sizeof(int), d.Capacity());
+				Assert::AreEqual(0_z, d.Stats()._bytesAllocated);
+				Assert::AreEqual(sizeof(int), d.Stats()._bytesInUse);
+
+				d.PushBack(20);
+				Assert::AreEqual(0_z, d.Stats()._bytesAllocated);
+				d.PushBack(30);
+				Assert::AreEqual(3_z, d.Size());
+				Assert::AreNotEqual(0_z, d.Stats()._bytesAllocated);
+				Assert::AreEqual(10, d.GetInteger(0_z));
+				Assert::AreEqual(20, d.GetInteger(1_z));
+				Assert::AreEqual(30, d.GetInteger(2_z));
+
+				Datum inlineDatum{ 10, 20 };
+				Datum heapDatum{ 10, 20, 30 };
+				heapDatum.PopBack();
+				Assert::AreEqual(inlineDatum, heapDatum);
+				Assert::AreEqual(0_z, inlineDatum.Stats()._bytesAllocated);
+				Assert::AreNotEqual(0_z, heapDatum.Stats()._bytesAllocated);
+			}
+
+			{
+				Datum d{ 1.f, 2.f };
+				Datum copy(d);
+				Assert::AreEqual(d, copy);
+				copy.Set(5.f, 1_z);
+				Assert::AreEqual(2.f, d.GetFloat(1_z));
+				Assert::AreEqual(5.f, copy.GetFloat(1_z));
+
+				Datum moved(std::move(copy));
+				Assert::AreEqual(0_z, copy.Size());
+				Assert::AreEqual(0_z, copy.Capacity());
+				Assert::AreEqual(5.f, moved.GetFloat(1_z));
+
+				Datum assigned{ 1.f, 2.f, 3.f };
+				assigned = std::move(moved);
+				Assert::AreEqual(2_z, assigned.Size());
+				Assert::AreEqual(0_z, assigned.Stats()._bytesAllocated);
+				Assert::AreEqual(1.f, assigned.GetFloat(0_z));
+
+				assigned = d;
+				Assert::AreEqual(d, assigned);
+			}
+
+			{
+				Foo a;
+				RTTI* p = &a;
+				Datum d{ p };
+				Assert::AreEqual(1_z, d.Capacity());
+				Assert::AreEqual(0_z, d.Stats()._bytesAllocated);
+				Assert::IsTrue(d.GetPointer() == &a);
+
+				Datum s{ "Hello"s };
+				Assert::AreEqual(1_z, s.Capacity());
+				Assert::AreEqual(sizeof(std::string), s.Stats()._bytesAllocated);
+			}
+
+			{
+				int i[] = { 10, 20, 30 };
+				Datum d;
+				d.SetType(Datum::DatumTypes::Integer);
+				d.Reserve(1_z);
+				d.SetStorage(i, 3_z);
+				Assert::IsTrue(d.IsExternal());
+				Assert::AreEqual(30, d.GetInteger(2_z));
+			}
+		}
+
+
+
+		TEST_METHOD(TestAsSpan)
+		{
+			{
+				Datum d{ 1.f, 2.f, 3.f };
+				std::span<float> values = d.AsSpan<float>();
+				Assert::AreEqual(3_z, values.size());
+				for (float& value : values)
+				{
+					value *= 2.f;
+				}
+				Assert::AreEqual(2.f, d.GetFloat(0_z));
+				Assert::AreEqual(6.f, d.GetFloat(2_z));
+
+				const Datum& constDatum = d;
+				std::span<const float> constValues = constDatum.AsSpan<float>();
+				Assert::AreEqual(4.f, constValues[1]);
+
+				Assert::ExpectException<exception>([&d] { d.AsSpan<int>(); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&constDatum] { constDatum.AsSpan<glm::vec4>(); }, L"Expected an exception, but none was thrown");
+			}
+
+			{
+				Datum d{ glm::vec4(0), glm::vec4(1), glm::vec4(2) };
+				std::span<glm::vec4> values = d.AsSpan<glm::vec4>();
+				Assert::AreEqual(glm::vec4(2), values[2]);
+				Assert::IsTrue(&d.GetVector(1_z) == &values[1]);
+
+				d.Clear();
+				Assert::IsTrue(d.AsSpan<glm::vec4>().empty());
+			}
+
+			{
+				int i[] = { 10, 20, 30 };
+				Datum d;
+				d.SetStorage(i, 3_z);
+				std::span<int> values = d.AsSpan<int>();
+				Assert::IsTrue(values.data() == i);
+				values[1] = 25;
+				Assert::AreEqual(25, i[1]);
+			}
+
+			{
+				Foo a;
+				RTTI* p = &a;
+				Datum pointers{ p, p };
+				Assert::IsTrue(pointers.AsSpan<RTTI*>()[1] == &a);
+
+				Scope scope;
+				Scope& child = scope.AppendScope("child"s);
+				Datum& table = scope["child"s];
+				Assert::AreEqual(1_z, table.AsSpan<Scope*>().size());
+				Assert::IsTrue(table.AsSpan<Scope*>()[0] == &child);
+				Assert::ExpectException<exception>([&table] { table.AsSpan<RTTI*>(); }, L"Expected an exception, but none was thrown");
+			}
+
+			{
+				Datum d;
+				Assert::ExpectException<exception>([&d] { d.AsSpan<int>(); }, L"Expected an exception, but none was thrown");
+			}
+		}
+
+		TEST_METHOD(TestBulk)
+		{
+			// Append
+			{
+				const int ints[] = { 1, 2, 3, 4, 5 };
+				Datum d{ 0 };
+				d.Append(span<const int>(ints));
+				Assert::AreEqual(6_z, d.Size());
+				Assert::AreEqual(0, d.GetInteger(0_z));
+				Assert::AreEqual(5, d.GetInteger(5_z));
+
+				d.Append(span<const int>());
+				Assert::AreEqual(6_z, d.Size());
+
+				const vector<glm::mat4> matrices{ glm::mat4(1.0f), glm::mat4(2.0f), glm::mat4(3.0f) };
+				Datum m(Datum::DatumTypes::Matrix);
+				m.Append(matrices.begin(), matrices.end());
+				Assert::AreEqual(3_z, m.Size());
+				Assert::AreEqual(3_z, m.Capacity());
+				Assert::AreEqual(glm::mat4(3.0f), m.GetMatrix(2_z));
+
+				// Moved strings are left empty; copied ones are untouched.
+				vector<string> names{ "A name too long for the small string buffer"s, "Another name too long for the small string buffer"s };
+				Datum s{ "The first name, also too long for the small string buffer"s };
+				s.Append(span<const string>(names));
+				Assert::AreEqual(names[1], s.GetString(2_z));
+				s.Append(make_move_iterator(names.begin()), make_move_iterator(names.end()));
+				Assert::AreEqual(5_z, s.Size());
+				Assert::AreEqual("Another name too long for the small string buffer"s, s.GetString(4_z));
+				Assert::IsTrue(names[0].empty());
+
+				// Input iterators that can only be read once grow the Datum as they go.
+				istringstream stream("7 8 9");
+				Datum read(Datum::DatumTypes::Integer);
+				read.Append(istream_iterator<int>(stream), istream_iterator<int>());
+				Assert::AreEqual(3_z, read.Size());
+				Assert::AreEqual(9, read.GetInteger(2_z));
+
+				Assert::ExpectException<exception>([&s, &ints] { s.Append(span<const int>(ints)); }, L"Expected an exception, but none was thrown");
+				int storage[2];
+				Datum external;
+				external.SetStorage(storage, 2_z);
+				Assert::ExpectException<exception>([&external, &ints] { external.Append(span<const int>(ints)); }, L"Expected an exception, but none was thrown");
+			}
+
+			// Assign
+			{
+				const float floats[] = { 1.0f, 2.0f, 3.0f };
+				Datum d{ 9.0f, 8.0f, 7.0f, 6.0f };
+				const size_t capacity = d.Capacity();
+				d.Assign(span<const float>(floats));
+				Assert::AreEqual(3_z, d.Size());
+				Assert::AreEqual(capacity, d.Capacity());
+				Assert::AreEqual(1.0f, d.GetFloat(0_z));
+
+				const string strings[] = { "a"s, "b"s, "c"s, "d"s, "e"s };
+				Datum s{ "x"s };
+				s.Assign(span<const string>(strings));
+				Assert::AreEqual(5_z, s.Size());
+				Assert::AreEqual("e"s, s.GetString(4_z));
+				s.Assign(span<const string>(strings, 1_z));
+				Assert::AreEqual(1_z, s.Size());
+				Assert::AreEqual("a"s, s.GetString(0_z));
+
+				// External storage keeps its size.
+				float storage[3] = { 0.0f, 0.0f, 0.0f };
+				Datum external;
+				external.SetStorage(storage, 3_z);
+				external.Assign(span<const float>(floats));
+				Assert::AreEqual(3.0f, storage[2]);
+				Assert::ExpectException<exception>([&external, &floats] { external.Assign(span<const float>(floats, 2_z)); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&s, &floats] { s.Assign(span<const float>(floats)); }, L"Expected an exception, but none was thrown");
+			}
+
+			// Resize with a value
+			{
+				Datum v{ glm::vec4(1.0f) };
+				v.Resize(4_z, glm::vec4(2.0f));
+				Assert::AreEqual(4_z, v.Size());
+				Assert::AreEqual(glm::vec4(1.0f), v.GetVector(0_z));
+				Assert::AreEqual(glm::vec4(2.0f), v.GetVector(3_z));
+				v.Resize(2_z, glm::vec4(3.0f));
+				Assert::AreEqual(2_z, v.Size());
+				Assert::AreEqual(glm::vec4(2.0f), v.GetVector(1_z));
+
+				Datum s(Datum::DatumTypes::String);
+				s.Resize(3_z, "Name"s);
+				Assert::AreEqual("Name"s, s.GetString(2_z));
+				s.Resize(1_z, "Other"s);
+				Assert::AreEqual(1_z, s.Size());
+
+				Assert::ExpectException<exception>([&s] { s.Resize(4_z, 1); }, L"Expected an exception, but none was thrown");
+			}
+
+			// A Datum's own elements as the source, which growing would otherwise free before they are read
+			{
+				Datum i{ 1, 2 };
+				i.Append(i.AsSpan<int>());
+				Assert::AreEqual(4_z, i.Size());
+				Assert::AreEqual(1, i.GetInteger(2_z));
+				Assert::AreEqual(2, i.GetInteger(3_z));
+
+				const string first = "The first name, too long for the small string buffer";
+				const string second = "The second name, too long for the small string buffer";
+				Datum s{ first, second };
+				const Datum& constS = s;
+				s.Append(constS.AsSpan<string>().subspan(1_z));
+				Assert::AreEqual(3_z, s.Size());
+				Assert::AreEqual(second, s.GetString(2_z));
+
+				s.Resize(20_z, constS.GetString(0_z));
+				Assert::AreEqual(20_z, s.Size());
+				Assert::AreEqual(first, s.GetString(19_z));
+
+				s.Assign(constS.AsSpan<string>().subspan(18_z));
+				Assert::AreEqual(2_z, s.Size());
+				Assert::AreEqual(first, s.GetString(1_z));
+				s.Assign(constS.AsSpan<string>());
+				Assert::AreEqual(2_z, s.Size());
+
+				Datum m{ glm::mat4(2.0f) };
+				m.Resize(10_z, m.GetMatrix(0_z));
+				Assert::AreEqual(glm::mat4(2.0f), m.GetMatrix(9_z));
+			}
+
+			// PushBack vectors and matrices by rvalue
+			{
+				Datum v(Datum::DatumTypes::Vector);
+				v.PushBack(glm::vec4(1.0f));
+				Datum m(Datum::DatumTypes::Matrix);
+				m.PushBack(glm::mat4(2.0f));
+				Assert::AreEqual(glm::vec4(1.0f), v.GetVector(0_z));
+				Assert::AreEqual(glm::mat4(2.0f), m.GetMatrix(0_z));
+				Assert::ExpectException<exception>([&v] { v.PushBack(glm::mat4(1.0f)); }, L"Expected an exception, but none was thrown");
+			}
+		}
+
+		TEST_METHOD(TestShortStringGrowth)
+		{
+			// Short strings keep their characters inside themselves, so growing and removing must move them rather than copy their bytes
+			Datum strings;
+			strings.SetType(Datum::DatumTypes::String);
+			for (size_t i = 0_z; i < 100_z; ++i)
+			{
+				strings.PushBack(to_string(i));
+			}
+			Assert::AreEqual(100_z, strings.Size());
+			for (size_t i = 0_z; i < 100_z; ++i)
+			{
+				Assert::AreEqual(to_string(i), strings.GetString(i));
+			}
+
+			strings.Reserve(strings.Capacity() * 4_z);
+			Assert::AreEqual("99"s, strings.BackString());
+
+			Assert::IsTrue(strings.RemoveAt(0_z));
+			Assert::IsTrue(strings.Remove("50"s));
+			Assert::AreEqual(98_z, strings.Size());
+			Assert::AreEqual("1"s, strings.FrontString());
+			Assert::AreEqual("49"s, strings.GetString(48_z));
+			Assert::AreEqual("51"s, strings.GetString(49_z));
+
+			Datum copy(strings);
+			strings.Resize(500_z);
+			Assert::AreEqual(98_z, copy.Size());
+			Assert::AreEqual("99"s, copy.GetString(97_z));
+			Assert::AreEqual("99"s, strings.GetString(97_z));
+			Assert::IsTrue(strings.GetString(499_z).empty());
+		}
+
+		TEST_METHOD(TestCopyOnWrite)
+		{
+			const string first = "A string too long to be stored inside itself";
+			const string second = "Another string that needs its own allocation";
+
+			// Copies share the elements until one of them changes
+			{
+				Datum strings{ first, second };
+				Datum copy(strings);
+				const Datum& constStrings = strings;
+				const Datum& constCopy = copy;
+				Assert::IsTrue(strings.IsShared());
+				Assert::IsTrue(copy.IsShared());
+				Assert::IsTrue(constStrings.AsSpan<string>().data() == constCopy.AsSpan<string>().data());
+				Assert::IsTrue(strings == copy);
+				Assert::AreEqual(constStrings.Stats()._bytesAllocated, strings.Capacity() * sizeof(string) / 2);
+
+				copy.GetString(1_z) += " changed";
+				Assert::IsFalse(strings.IsShared());
+				Assert::IsFalse(copy.IsShared());
+				Assert::AreEqual(second, constStrings.GetString(1_z));
+				Assert::AreEqual(second + " changed", constCopy.GetString(1_z));
+				Assert::AreEqual(first, constCopy.GetString(0_z));
+				Assert::IsTrue(strings != copy);
+			}
 
+			// Copy assignment shares too, and every kind of change unshares
+			{
+				Datum strings{ first, second };
+				const Datum& constStrings = strings;
+				Datum assigned{ first };
+				assigned = strings;
+				Assert::IsTrue(assigned.IsShared());
+				Assert::AreEqual(strings.Capacity(), assigned.Capacity());
+
+				assigned.PushBack(first);
+				Assert::AreEqual(2_z, strings.Size());
+				Assert::AreEqual(3_z, assigned.Size());
+
+				Datum a(strings);
+				Datum b(strings);
+				a.Clear();
+				Assert::AreEqual(0_z, a.Size());
+				Assert::AreEqual(0_z, a.Capacity());
+				Assert::IsTrue(strings.IsShared());
+
+				b.RemoveAt(0_z);
+				Assert::AreEqual(1_z, b.Size());
+				Assert::AreEqual(second, b.GetString(0_z));
+				Assert::AreEqual(first, constStrings.GetString(0_z));
+				Assert::IsFalse(strings.IsShared());
+
+				Datum c(strings);
+				c.PopBack();
+				Datum d(strings);
+				d.Set(second, 0_z);
+				Datum e(strings);
+				e.Resize(1_z);
+				Datum f(strings);
+				f.AsSpan<string>()[0] = second;
+				Datum g(strings);
+				g.SetFromString(second);
+				Datum h(strings);
+				h = second;
+				Assert::AreEqual(2_z, strings.Size());
+				Assert::AreEqual(first, constStrings.GetString(0_z));
+				Assert::AreEqual(second, d.GetString(0_z));
+				Assert::AreEqual(second, f.GetString(0_z));
+				Assert::AreEqual(second, g.GetString(0_z));
+				Assert::AreEqual(1_z, h.Size());
+				Assert::IsFalse(strings.IsShared());
+
+				Datum moved(strings);
+				Datum target(std::move(moved));
+				Assert::IsTrue(target.IsShared());
+				strings = Datum{ first };
+				Assert::IsFalse(target.IsShared());
+				Assert::AreEqual(second, target.GetString(1_z));
+			}
+
+			// A mutable reference or span handed out before a copy must not write into the copy
+			{
+				Datum strings{ first, second };
+				string& reference = strings.GetString(0_z);
+				Datum copy(strings);
+				Assert::IsFalse(copy.IsShared());
+				reference = second;
+				Assert::AreEqual(first, as_const(copy).GetString(0_z));
+				Assert::AreEqual(second, as_const(strings).GetString(0_z));
+
+				Datum assigned;
+				assigned = strings;
+				Assert::IsFalse(assigned.IsShared());
+
+				Datum matrices{ glm::mat4(1.0f), glm::mat4(2.0f) };
+				const span<glm::mat4> elements = matrices.AsSpan<glm::mat4>();
+				const Datum matrixCopy(matrices);
+				elements[1] = glm::mat4(5.0f);
+				Assert::AreEqual(glm::mat4(2.0f), matrixCopy.GetMatrix(1_z));
+				Assert::AreEqual(glm::mat4(5.0f), as_const(matrices).GetMatrix(1_z));
+
+				// Reallocating invalidates what was handed out, so the new buffer can be shared again.
+				matrices.Reserve(10_z);
+				const Datum shared(matrices);
+				Assert::IsTrue(shared.IsShared());
+			}
+
+			// Matrices
+			{
+				Datum matrices{ glm::mat4(1.0f), glm::mat4(2.0f) };
+				Datum copy(matrices);
+				Assert::IsTrue(copy.IsShared());
+				copy.Set(glm::mat4(3.0f), 0_z);
+				Assert::AreEqual(glm::mat4(1.0f), matrices.GetMatrix(0_z));
+				Assert::AreEqual(glm::mat4(3.0f), copy.GetMatrix(0_z));
+
+				Datum grown(matrices);
+				grown.Reserve(10_z);
+				grown.FrontMatrix() = glm::mat4(4.0f);
+				Assert::AreEqual(glm::mat4(1.0f), matrices.FrontMatrix());
+				Assert::AreEqual(10_z, grown.Capacity());
+			}
+
+			// Other types and external storage copy as before
+			{
+				Datum ints{ 1, 2, 3 };
+				Datum intCopy(ints);
+				Assert::IsFalse(ints.IsShared());
+				Assert::IsFalse(intCopy.IsShared());
+
+				string storage[] = { first, second };
+				Datum external;
+				external.SetStorage(storage, 2_z);
+				Datum externalCopy(external);
+				Assert::IsFalse(externalCopy.IsShared());
+				externalCopy.Set(second, 0_z);
+				Assert::AreEqual(second, storage[0]);
+			}
+		}
+
+		TEST_METHOD(TestCompactTypes)
+		{
+			// Scalars, lists and the type map
+			{
+				Datum flags{ true, false, true };
+				Assert::AreEqual(Datum::DatumTypes::Boolean, flags.Type());
+				Assert::AreEqual(3_z, flags.Size());
+				Assert::IsFalse(flags.GetBoolean(1_z));
+				flags.Set(true, 1_z);
+				Assert::IsTrue(flags.GetBoolean(1_z));
+
+				Datum big = std::int64_t(1) << 40;
+				Datum precise = 0.1;
+				Datum position = vec2(1.0f, 2.0f);
+				Datum point = vec3(1.0f, 2.0f, 3.0f);
+				Datum rotation = quat(1.0f, 0.0f, 0.0f, 0.0f);
+				Datum basis = mat3(1.0f);
+				Assert::AreEqual(Datum::DatumTypes::Integer64, big.Type());
+				Assert::AreEqual(Datum::DatumTypes::Double, precise.Type());
+				Assert::AreEqual(Datum::DatumTypes::Vector2, position.Type());
+				Assert::AreEqual(Datum::DatumTypes::Vector3, point.Type());
+				Assert::AreEqual(Datum::DatumTypes::Quaternion, rotation.Type());
+				Assert::AreEqual(Datum::DatumTypes::Matrix3, basis.Type());
+				Assert::IsTrue(big.GetInteger64() == std::int64_t(1) << 40);
+				Assert::AreEqual(0.1, precise.GetDouble());
+				Assert::IsTrue(point.GetVector3() == vec3(1.0f, 2.0f, 3.0f));
+				Assert::IsTrue(rotation.GetQuaternion() == quat(1.0f, 0.0f, 0.0f, 0.0f));
+
+				// String literals and pointers are not taken for bools.
+				Datum name;
+				name = "Hello";
+				Assert::AreEqual(Datum::DatumTypes::String, name.Type());
+				Datum names;
+				names.SetType(Datum::DatumTypes::String);
+				names.PushBack("Hello");
+				Assert::AreEqual(1_z, names.Size());
+
+				Assert::AreEqual(Datum::DatumTypes::Boolean, Datum::_typeMap.At("boolean"s));
+				Assert::AreEqual(Datum::DatumTypes::Integer64, Datum::_typeMap.At("integer64"s));
+				Assert::AreEqual(Datum::DatumTypes::Double, Datum::_typeMap.At("double"s));
+				Assert::AreEqual(Datum::DatumTypes::Vector2, Datum::_typeMap.At("vector2"s));
+				Assert::AreEqual(Datum::DatumTypes::Vector3, Datum::_typeMap.At("vector3"s));
+				Assert::AreEqual(Datum::DatumTypes::Quaternion, Datum::_typeMap.At("quaternion"s));
+				Assert::AreEqual(Datum::DatumTypes::Matrix3, Datum::_typeMap.At("matrix3"s));
+
+				Assert::ExpectException<exception>([&flags] { flags.GetBoolean(3_z); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&flags] { flags.GetDouble(); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&precise] { precise = 1; }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&big] { big.PushBack(1.0); }, L"Expected an exception, but none was thrown");
+			}
+
+			// Growth, removal, copies and comparison
+			{
+				Datum positions(Datum::DatumTypes::Vector2);
+				positions.PushBack(vec2(1.0f));
+				Assert::AreEqual(1_z, positions.Capacity());
+				Assert::AreEqual(0_z, positions.Stats()._bytesAllocated);
+				for (int i = 2; i <= 5; ++i)
+				{
+					positions.PushBack(vec2(static_cast<float>(i)));
+				}
+				Assert::AreEqual(5_z, positions.Size());
+				Assert::IsTrue(positions.RemoveAt(1_z));
+				Assert::IsTrue(positions.GetVector2(1_z) == vec2(3.0f));
+
+				Datum copy(positions);
+				Assert::AreEqual(positions, copy);
+				copy.GetVector2(3_z) = vec2(-1.0f);
+				Assert::AreNotEqual(positions, copy);
+				Assert::IsTrue(positions.GetVector2(3_z) == vec2(5.0f));
+
+				Datum rotations(Datum::DatumTypes::Quaternion);
+				rotations.Resize(3_z, quat(0.0f, 0.0f, 1.0f, 0.0f));
+				rotations.PopBack();
+				const Datum& constRotations = rotations;
+				Assert::AreEqual(2_z, constRotations.AsSpan<quat>().size());
+				Assert::IsTrue(constRotations.GetQuaternion(1_z) == quat(0.0f, 0.0f, 1.0f, 0.0f));
+
+				Datum flags(Datum::DatumTypes::Boolean);
+				for (int i = 0; i < 20; ++i)
+				{
+					flags.PushBack(i % 3 == 0);
+				}
+				Assert::AreEqual(20_z, flags.Size());
+				Assert::IsTrue(flags.GetBoolean(18_z));
+				Assert::AreEqual(20_z * sizeof(bool), flags.Stats()._bytesInUse);
+			}
+
+			// Text round trips and external storage
+			{
+				Datum values(Datum::DatumTypes::Double);
+				values.PushBackFromString("0.1");
+				values.PushBackFromString("-2.5e-300");
+				Assert::AreEqual("0.1"s, values.ToString(0_z));
+				Assert::AreEqual(-2.5e-300, values.GetDouble(1_z));
+
+				Datum basis = mat3(1.0f);
+				const string text = basis.ToString();
+				Assert::AreEqual("mat3x3((1, 0, 0), (0, 1, 0), (0, 0, 1))"s, text);
+				basis.PushBackFromString("mat3x3((2, 0, 0), (0, 2, 0), (0, 0, 2))");
+				Assert::IsTrue(basis.GetMatrix3(1_z) == mat3(2.0f));
+
+				char buffer[TextConversion::MaxQuaternionLength];
+				Datum rotation = quat(1.0f, 0.0f, 0.5f, 0.0f);
+				Assert::AreEqual("quat(1, {0, 0.5, 0})"s, string(buffer, rotation.ToString(buffer)));
+				rotation.SetFromString("quat(0, {1, 0, 0})");
+				Assert::IsTrue(rotation.GetQuaternion() == quat(0.0f, 1.0f, 0.0f, 0.0f));
+
+				Datum flag = false;
+				flag.SetFromString("true");
+				Assert::AreEqual("true"s, flag.ToString());
+				Assert::ExpectException<exception>([&flag] { flag.SetFromString("1"); }, L"Expected an exception, but none was thrown");
+
+				std::int64_t storage[] = { 1, 2, 3 };
+				Datum external;
+				external.SetStorage(storage, 3_z);
+				external.SetFromString("-9223372036854775808", 2_z);
+				Assert::IsTrue(storage[2] == std::numeric_limits<std::int64_t>::min());
+				Assert::ExpectException<exception>([&external] { external.PushBack(std::int64_t(4)); }, L"Expected an exception, but none was thrown");
+
+				vec3 points[2];
+				Datum wrongType(Datum::DatumTypes::Vector2);
+				Assert::ExpectException<exception>([&wrongType, &points] { wrongType.SetStorage(points, 2_z); }, L"Expected an exception, but none was thrown");
+			}
+		}
 
 	private:
 		static _CrtMemState sStartMemState;
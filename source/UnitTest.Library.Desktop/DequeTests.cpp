@@ -0,0 +1,320 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include "ToStringSpecialization.h"
+#include "Deque.h"
+#include "Foo.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<Deque<Foo>::Iterator>(const Deque<Foo>::Iterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<Deque<Foo>::ConstIterator>(const Deque<Foo>::ConstIterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+}
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(DequeTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			Deque<Foo> deque;
+			Assert::IsTrue(deque.IsEmpty());
+			Assert::AreEqual(0_z, deque.Size());
+			Assert::AreEqual(0_z, deque.Capacity());
+			Assert::AreEqual(deque.begin(), deque.end());
+			Assert::ExpectException<exception>([&deque] { deque.Front(); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&deque] { deque.Back(); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&deque] { deque.At(0); }, L"Expected an exception, but none was thrown");
+			deque.PopFront();
+			deque.PopBack();
+
+			// Capacity is rounded up to a power of two.
+			Deque<Foo> reserved(5);
+			Assert::AreEqual(8_z, reserved.Capacity());
+			reserved.Reserve(3);
+			Assert::AreEqual(8_z, reserved.Capacity());
+
+			const Deque<Foo> list{ Foo(1), Foo(2), Foo(3) };
+			Assert::AreEqual(3_z, list.Size());
+			Assert::AreEqual(Foo(1), list.Front());
+			Assert::AreEqual(Foo(3), list.Back());
+			Assert::AreEqual(Foo(2), list[1]);
+			Assert::ExpectException<exception>([&list] { list[3]; }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestPushPopBothEnds)
+		{
+			Deque<Foo> deque;
+			deque.PushBack(Foo(2));
+			deque.PushFront(Foo(1));
+			const Foo three(3);
+			deque.PushBack(three);
+			const Foo zero(0);
+			Assert::AreEqual(Foo(0), *deque.PushFront(zero));
+			Assert::AreEqual(Foo(4), *deque.EmplaceBack(4));
+			Assert::AreEqual(Foo(-1), *deque.EmplaceFront(-1));
+
+			Assert::AreEqual(6_z, deque.Size());
+			for (int i = 0; i < 6; ++i)
+			{
+				Assert::AreEqual(Foo(i - 1), deque[i]);
+			}
+
+			deque.PopFront();
+			deque.PopBack();
+			Assert::AreEqual(Foo(0), deque.Front());
+			Assert::AreEqual(Foo(3), deque.Back());
+			Assert::AreEqual(4_z, deque.Size());
+
+			deque.Clear();
+			Assert::IsTrue(deque.IsEmpty());
+			Assert::AreNotEqual(0_z, deque.Capacity());
+		}
+
+		TEST_METHOD(TestWrapAndGrow)
+		{
+			// Used as a FIFO the elements wander around the ring; growing while wrapped must keep them in order.
+			Deque<int> deque(8);
+			int nextPushed = 0;
+			int nextPopped = 0;
+			for (int round = 0; round < 100; ++round)
+			{
+				for (int i = 0; i < 5; ++i)
+				{
+					deque.PushBack(nextPushed++);
+				}
+				for (int i = 0; i < 4; ++i)
+				{
+					Assert::AreEqual(nextPopped++, deque.Front());
+					deque.PopFront();
+				}
+
+				Assert::AreEqual(static_cast<size_t>(nextPushed - nextPopped), deque.Size());
+				for (size_t i = 0; i < deque.Size(); ++i)
+				{
+					Assert::AreEqual(nextPopped + static_cast<int>(i), deque[i]);
+				}
+			}
+			Assert::AreEqual(128_z, deque.Capacity());
+
+			// The same from the front.
+			Deque<string> strings(4);
+			strings.PushBack("c"s);
+			strings.PushBack("d"s);
+			strings.PopFront();
+			strings.PushFront("b"s);
+			strings.PushFront("a"s);
+			strings.PushBack("e"s);
+			strings.PushFront("z"s);
+			Assert::AreEqual(8_z, strings.Capacity());
+			Assert::AreEqual("z"s, strings[0]);
+			Assert::AreEqual("a"s, strings[1]);
+			Assert::AreEqual("b"s, strings[2]);
+			Assert::AreEqual("d"s, strings[3]);
+			Assert::AreEqual("e"s, strings[4]);
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			Deque<Foo> deque{ Foo(2), Foo(3), Foo(4) };
+			deque.PushFront(Foo(1));
+			deque.PushBack(Foo(5));
+
+			int expected = 1;
+			for (const Foo& foo : deque)
+			{
+				Assert::AreEqual(Foo(expected++), foo);
+			}
+			Assert::AreEqual(6, expected);
+
+			auto it = deque.begin();
+			Assert::AreEqual(Foo(2), *(++it));
+			Assert::AreEqual(Foo(2), *(it++));
+			Assert::AreEqual(Foo(3), *(it--));
+			Assert::AreEqual(Foo(1), *(--it));
+			Assert::AreEqual(Foo(4), *(it + 3));
+			Assert::AreEqual(Foo(3), *((it + 3) - 1));
+			Assert::AreEqual(1, it->Data());
+			Assert::AreEqual(deque.end(), deque.begin() + 5);
+			Assert::AreEqual(deque.end(), ++(deque.begin() + 5));
+
+			const Deque<Foo>& constDeque = deque;
+			auto constIt = constDeque.begin();
+			Assert::AreEqual(Foo(2), *(++constIt));
+			Assert::AreEqual(Foo(2), *(constIt++));
+			Assert::AreEqual(Foo(3), *(constIt--));
+			Assert::AreEqual(Foo(1), *(--constIt));
+			Assert::AreEqual(Foo(5), *(constIt + 4));
+			Assert::AreEqual(Foo(4), *((constIt + 4) - 1));
+			Assert::AreEqual(1, constIt->Data());
+			Assert::AreEqual(constDeque.cend(), Deque<Foo>::ConstIterator(deque.end()));
+			Assert::AreEqual(deque.cbegin(), constDeque.begin());
+
+			auto found = std::find_if(deque.begin(), deque.end(), [](const Foo& foo) { return foo.Data() == 4; });
+			Assert::AreEqual(Foo(4), *found);
+
+			Deque<Foo>::Iterator unassociated;
+			Deque<Foo>::ConstIterator constUnassociated;
+			Assert::ExpectException<exception>([&unassociated] { ++unassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&unassociated] { --unassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&unassociated] { *unassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&unassociated] { unassociated + 1; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&unassociated] { unassociated - 1; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { ++constUnassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { --constUnassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { *constUnassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { constUnassociated + 1; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { constUnassociated - 1; }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestFindRemove)
+		{
+			Deque<Foo> deque{ Foo(3), Foo(4), Foo(5), Foo(6) };
+			deque.PushFront(Foo(2));
+			deque.PushFront(Foo(1));
+
+			Assert::AreEqual(Foo(5), *deque.Find(Foo(5)));
+			Assert::AreEqual(deque.end(), deque.Find(Foo(7)));
+			const Deque<Foo>& constDeque = deque;
+			Assert::AreEqual(Foo(1), *constDeque.Find(Foo(1)));
+
+			// Near the front the earlier elements shift back; near the back the later ones shift forward.
+			Assert::IsTrue(deque.Remove(deque.Find(Foo(2))));
+			Assert::IsTrue(deque.Remove(deque.Find(Foo(5))));
+			Assert::IsFalse(deque.Remove(deque.end()));
+			Assert::AreEqual(4_z, deque.Size());
+			Assert::AreEqual(Foo(1), deque[0]);
+			Assert::AreEqual(Foo(3), deque[1]);
+			Assert::AreEqual(Foo(4), deque[2]);
+			Assert::AreEqual(Foo(6), deque[3]);
+
+			Deque<Foo> other;
+			Assert::ExpectException<exception>([&deque, &other] { deque.Remove(other.begin()); }, L"Expected an exception, but none was thrown");
+
+			// Removing while iterating: the iterator is left on the next element.
+			for (auto it = deque.begin(); it != deque.end();)
+			{
+				if ((*it).Data() % 2 == 1)
+				{
+					deque.Remove(it);
+				}
+				else
+				{
+					++it;
+				}
+			}
+			Assert::AreEqual(2_z, deque.Size());
+			Assert::AreEqual(Foo(4), deque.Front());
+			Assert::AreEqual(Foo(6), deque.Back());
+
+			// The SIMD search covers both runs of a wrapped ring.
+			Deque<int> ints(16);
+			for (int i = 0; i < 12; ++i)
+			{
+				ints.PushBack(i);
+			}
+			for (int i = 0; i < 10; ++i)
+			{
+				ints.PopFront();
+				ints.PushBack(12 + i);
+			}
+			for (int i = 10; i < 22; ++i)
+			{
+				Assert::AreEqual(i, *ints.Find(i));
+			}
+			Assert::AreEqual(ints.end(), ints.Find(9));
+			Assert::AreEqual(ints.end(), ints.Find(22));
+		}
+
+		TEST_METHOD(TestSpecialMembers)
+		{
+			Deque<Foo> deque(4);
+			deque.PushBack(Foo(2));
+			deque.PushBack(Foo(3));
+			deque.PushFront(Foo(1));
+
+			Deque<Foo> copy(deque);
+			Assert::AreEqual(3_z, copy.Size());
+			for (int i = 0; i < 3; ++i)
+			{
+				Assert::AreEqual(Foo(i + 1), copy[i]);
+			}
+
+			Deque<Foo> assigned{ Foo(9) };
+			assigned = deque;
+			Assert::AreEqual(3_z, assigned.Size());
+			Assert::AreEqual(Foo(1), assigned.Front());
+
+			Deque<Foo> moved(std::move(copy));
+			Assert::AreEqual(3_z, moved.Size());
+			Assert::IsTrue(copy.IsEmpty());
+
+			assigned = std::move(moved);
+			Assert::AreEqual(Foo(3), assigned.Back());
+			Assert::IsTrue(moved.IsEmpty());
+
+			// Move-only elements.
+			Deque<unique_ptr<int>> pointers;
+			pointers.PushBack(make_unique<int>(1));
+			pointers.EmplaceFront(make_unique<int>(0));
+			Assert::AreEqual(0, *pointers.Front());
+			Assert::AreEqual(1, *pointers.Back());
+		}
+
+	private:
+		inline static _CrtMemState sStartMemState;
+	};
+}
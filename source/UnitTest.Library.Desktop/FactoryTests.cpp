@@ -76,6 +76,11 @@ namespace UnitTestLibraryDesktop
                 Assert::AreEqual(2_z, Factory<RTTI>::Size());
                 foundFactory = Factory<RTTI>::Find("Bar"s);
                 Assert::AreEqual(&barFactory, static_cast<const BarFactory*>(foundFactory));
+
+                foundFactory = Factory<RTTI>::Find("Foo"sv);
+                Assert::AreEqual(&fooFactory, static_cast<const FooFactory*>(foundFactory));
+                foundFactory = Factory<RTTI>::Find("Bar");
+                Assert::AreEqual(&barFactory, static_cast<const BarFactory*>(foundFactory));
             }
 
             Assert::AreEqual(0_z, Factory<RTTI>::Size());
@@ -0,0 +1,595 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <memory>
+#include "ToStringSpecialization.h"
+#include "FlatHashMap.h"
+#include "Foo.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace FIEAGameEngine
+{
+	template<>
+	struct DefaultHash<Foo> final
+	{
+		size_t operator()(const Foo& key) const
+		{
+			return key.Data();
+		}
+	};
+}
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<FlatHashMap<Foo, int>::PairType>(const FlatHashMap<Foo, int>::PairType& t)
+	{
+		try
+		{
+			std::wstringstream s;
+			s << L"("s << ToString(t.first) << L", "s << t.second << L")"s;
+			return s.str();
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<Foo, int>::Iterator>(const FlatHashMap<Foo, int>::Iterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<FlatHashMap<Foo, int>::ConstIterator>(const FlatHashMap<Foo, int>::ConstIterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+}
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(FlatHashMapTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+#pragma region IteratorTests
+		TEST_METHOD(IteratorConstructorAndOperators)
+		{
+			// Iterator
+			{
+				FlatHashMap<Foo, int> hashMap;
+				FlatHashMap<Foo, int>::Iterator itConstructor = hashMap.begin();
+
+				// Equality
+				Assert::AreEqual(itConstructor, hashMap.end());
+				hashMap.Insert(make_pair(Foo(10), 10));
+				Assert::AreNotEqual(itConstructor, hashMap.begin());
+
+				// ++ operator
+				FlatHashMap<Foo, int>::Iterator itPlusPlus;
+				Assert::ExpectException<exception>([&itPlusPlus] { itPlusPlus++; }, L"Expected an exception, but none was thrown");
+
+				hashMap.Insert(make_pair(Foo(20), 20));
+				hashMap.Insert(make_pair(Foo(21), 21));
+				hashMap.Insert(make_pair(Foo(30), 30));
+				hashMap.Insert(make_pair(Foo(50), 50));
+
+				size_t count = 0;
+				for (itPlusPlus = hashMap.begin(); itPlusPlus != hashMap.end(); ++itPlusPlus)
+				{
+					++count;
+				}
+				Assert::AreEqual(5_z, count);
+
+				count = 0;
+				for (itPlusPlus = hashMap.begin(); itPlusPlus != hashMap.end(); itPlusPlus++)
+				{
+					++count;
+				}
+				Assert::AreEqual(5_z, count);
+				itPlusPlus++;
+				Assert::AreEqual(hashMap.end(), itPlusPlus);
+
+				// * operator
+				FlatHashMap<Foo, int>::Iterator itStar;
+				Assert::ExpectException<exception>([&itStar] { *itStar; }, L"Expected an exception, but none was thrown");
+				for (itStar = hashMap.begin(); itStar != hashMap.end(); ++itStar)
+				{
+					Assert::AreEqual((*itStar).first.Data(), (*itStar).second);
+				}
+				Assert::ExpectException<exception>([&itStar] { *itStar; }, L"Expected an exception, but none was thrown");
+
+				// -> operator
+				FlatHashMap<Foo, int>::Iterator itArrow;
+				Assert::ExpectException<exception>([&itArrow] { itArrow->first; }, L"Expected an exception, but none was thrown");
+				for (itArrow = hashMap.begin(); itArrow != hashMap.end(); ++itArrow)
+				{
+					itArrow->second += 1;
+				}
+				Assert::AreEqual(11, hashMap.At(Foo(10)));
+				Assert::ExpectException<exception>([&itArrow] { itArrow->first; }, L"Expected an exception, but none was thrown");
+			}
+
+			// ConstIterator
+			{
+				FlatHashMap<Foo, int> hashMap;
+				hashMap.Insert(make_pair(Foo(10), 10));
+				hashMap.Insert(make_pair(Foo(20), 20));
+				hashMap.Insert(make_pair(Foo(21), 21));
+				const FlatHashMap<Foo, int> constHashMap(hashMap);
+				FlatHashMap<Foo, int>::ConstIterator itPromote = hashMap.begin();
+				Assert::AreEqual(FlatHashMap<Foo, int>::ConstIterator(hashMap.begin()), itPromote);
+
+				FlatHashMap<Foo, int>::ConstIterator constItConstructor = constHashMap.begin();
+				Assert::AreEqual(constItConstructor, constHashMap.begin());
+				Assert::AreNotEqual(constItConstructor, constHashMap.end());
+
+				FlatHashMap<Foo, int>::ConstIterator constItPlusPlus;
+				Assert::ExpectException<exception>([&constItPlusPlus] { constItPlusPlus++; }, L"Expected an exception, but none was thrown");
+
+				size_t count = 0;
+				for (constItPlusPlus = constHashMap.begin(); constItPlusPlus != constHashMap.end(); ++constItPlusPlus)
+				{
+					Assert::AreEqual(constItPlusPlus->first.Data(), (*constItPlusPlus).second);
+					++count;
+				}
+				Assert::AreEqual(3_z, count);
+
+				FlatHashMap<Foo, int>::ConstIterator constItStar;
+				Assert::ExpectException<exception>([&constItStar] { *constItStar; }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&constHashMap] { *constHashMap.end(); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&constHashMap] { constHashMap.cend()->first; }, L"Expected an exception, but none was thrown");
+			}
+		}
+#pragma endregion
+
+#pragma region FlatHashMapTests
+		TEST_METHOD(TestConstructor)
+		{
+			// Default constructor rounds the requested 11 slots up to one full probe group.
+			{
+				FlatHashMap<Foo, int> hashMap;
+				Assert::AreEqual(0_z, hashMap.Size());
+				Assert::AreEqual(16_z, hashMap.BucketSize());
+				Assert::AreEqual(hashMap.begin(), hashMap.end());
+			}
+
+			// Custom sizes round up to a power of two.
+			{
+				FlatHashMap<Foo, int> hashMap(100_z);
+				Assert::AreEqual(128_z, hashMap.BucketSize());
+			}
+
+			// Custom functors
+			{
+				function<bool(const Foo& lhs, const Foo& rhs)> eq = [](const Foo& lhs, const Foo& rhs) { return lhs.Data() == rhs.Data(); };
+				function<size_t(const Foo& key)> hf = [](const Foo& key) { return static_cast<size_t>(key.Data()) * 0x9E3779B97F4A7C15ull; };
+
+				DynamicFlatHashMap<Foo, int> hashMap(5_z, hf, eq);
+				const Foo a(10);
+				const Foo b(20);
+
+				auto [it, valueInserted] = hashMap.Insert(make_pair(a, a.Data()));
+				Assert::IsTrue(valueInserted);
+				Assert::AreEqual(a, it->first);
+
+				tie(it, valueInserted) = hashMap.Insert(make_pair(b, b.Data()));
+				Assert::IsTrue(valueInserted);
+				Assert::AreEqual(2_z, hashMap.Size());
+				Assert::AreEqual(b, it->first);
+			}
+
+			Assert::ExpectException<exception>([] { FlatHashMap<Foo, int> hashMap(0_z); }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestSpecialMembers)
+		{
+			FlatHashMap<Foo, int> hashMap;
+			for (int i = 0; i < 20; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+			}
+			hashMap.Remove(Foo(3));
+
+			// Copy Constructor
+			{
+				FlatHashMap<Foo, int> copy(hashMap);
+				Assert::AreEqual(hashMap.Size(), copy.Size());
+				Assert::AreEqual(hashMap.BucketSize(), copy.BucketSize());
+				for (int i = 0; i < 20; ++i)
+				{
+					Assert::AreEqual(i != 3, copy.ContainsKey(Foo(i)));
+				}
+			}
+
+			// Copy Assignment
+			{
+				FlatHashMap<Foo, int> copy{ make_pair(Foo(100), 100) };
+				copy = hashMap;
+				Assert::AreEqual(19_z, copy.Size());
+				Assert::IsFalse(copy.ContainsKey(Foo(100)));
+				Assert::AreEqual(7, copy.At(Foo(7)));
+			}
+
+			// Move Constructor and Move Assignment
+			{
+				FlatHashMap<Foo, int> copy(hashMap);
+				FlatHashMap<Foo, int> moved(std::move(copy));
+				Assert::AreEqual(19_z, moved.Size());
+				Assert::AreEqual(0_z, copy.Size());
+				Assert::AreEqual(copy.begin(), copy.end());
+
+				// A moved-from map is still usable.
+				copy.Insert(make_pair(Foo(1), 1));
+				Assert::AreEqual(1_z, copy.Size());
+
+				copy = std::move(moved);
+				Assert::AreEqual(19_z, copy.Size());
+				Assert::IsFalse(moved.ContainsKey(Foo(1)));
+			}
+		}
+
+		TEST_METHOD(InitializerListConstructor)
+		{
+			auto a = make_pair(Foo(10), 10);
+			auto b = make_pair(Foo(20), 20);
+			auto c = make_pair(Foo(30), 30);
+
+			FlatHashMap<Foo, int> hashMap{ a, b, c };
+			Assert::AreEqual(3_z, hashMap.Size());
+			Assert::AreNotEqual(hashMap.end(), hashMap.Find(a.first));
+			Assert::AreNotEqual(hashMap.end(), hashMap.Find(b.first));
+			Assert::AreNotEqual(hashMap.end(), hashMap.Find(c.first));
+
+			// Brace initialization default constructs the map's own policies.
+			struct DataHash final
+			{
+				size_t operator()(const Foo& key) const
+				{
+					return static_cast<size_t>(key.Data()) * 31_z;
+				}
+			};
+
+			const FlatHashMap<Foo, int, DataHash> customMap{ a, b };
+			Assert::AreEqual(2_z, customMap.Size());
+			Assert::AreEqual(20, customMap.At(b.first));
+		}
+
+		TEST_METHOD(TestBracketOperators)
+		{
+			const Foo a(10);
+			FlatHashMap<Foo, int> hashMap;
+			hashMap.Insert(make_pair(a, 10));
+
+			Assert::AreEqual(a.Data(), hashMap[a]);
+			hashMap[a] = 15;
+			Assert::AreEqual(15, hashMap.At(a));
+			Assert::AreEqual(1_z, hashMap.Size());
+
+			int noData = hashMap[Foo(100)];
+			Assert::IsTrue(hashMap.ContainsKey(Foo(100)));
+			Assert::AreEqual(int(), noData);
+			Assert::AreEqual(2_z, hashMap.Size());
+		}
+
+		TEST_METHOD(TestFind)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+
+			FlatHashMap<Foo, int> hashMap;
+			hashMap.Insert(make_pair(a, 10));
+			hashMap.Insert(make_pair(b, 20));
+			hashMap.Insert(make_pair(c, 30));
+
+			FlatHashMap<Foo, int>::Iterator it = hashMap.Find(a);
+			Assert::AreEqual(a, it->first);
+			Assert::AreEqual(a.Data(), it->second);
+			Assert::AreEqual(hashMap.end(), hashMap.Find(Foo(100)));
+
+			const FlatHashMap<Foo, int> constHashMap(hashMap);
+			FlatHashMap<Foo, int>::ConstIterator constIt = constHashMap.Find(b);
+			Assert::AreEqual(b, constIt->first);
+			Assert::AreEqual(b.Data(), constIt->second);
+			Assert::AreEqual(constHashMap.end(), constHashMap.Find(Foo(100)));
+		}
+
+		TEST_METHOD(TestHeterogeneousFind)
+		{
+			FlatHashMap<string, int> hashMap;
+			hashMap.Insert(make_pair("Health"s, 100));
+			hashMap.Insert(make_pair("Mana"s, 50));
+
+			Assert::AreEqual(hashMap.Hash("Health"s), hashMap.Hash("Health"sv));
+			Assert::AreEqual(100, hashMap.Find("Health"sv)->second);
+			Assert::AreEqual(50, hashMap.Find("Mana")->second);
+			Assert::IsTrue(hashMap.Find("Stamina"sv) == hashMap.end());
+
+			const size_t hash = hashMap.Hash("Mana");
+			Assert::AreEqual(50, hashMap.Find("Mana"sv, hash)->second);
+			Assert::AreEqual(50, hashMap.Find("Mana"s, hash)->second);
+
+			const FlatHashMap<string, int> constHashMap(hashMap);
+			Assert::AreEqual(100, constHashMap.Find("Health"sv)->second);
+			Assert::AreEqual(50, constHashMap.Find("Mana"sv, hash)->second);
+			Assert::IsTrue(constHashMap.Find("Stamina") == constHashMap.end());
+		}
+
+		TEST_METHOD(TestInsert)
+		{
+			const Foo a(10);
+			const Foo b(20);
+
+			FlatHashMap<Foo, int> hashMap;
+			auto [it, valueInserted] = hashMap.Insert(make_pair(a, a.Data()));
+			Assert::IsTrue(valueInserted);
+			Assert::AreEqual(1_z, hashMap.Size());
+			Assert::AreEqual(a, it->first);
+
+			tie(it, valueInserted) = hashMap.Insert(make_pair(b, b.Data()));
+			Assert::IsTrue(valueInserted);
+			Assert::AreEqual(2_z, hashMap.Size());
+			Assert::AreEqual(b, it->first);
+
+			tie(it, valueInserted) = hashMap.Insert(make_pair(a, 99));
+			Assert::IsFalse(valueInserted);
+			Assert::AreEqual(2_z, hashMap.Size());
+			Assert::AreEqual(a.Data(), it->second);
+		}
+
+		TEST_METHOD(TestGrowth)
+		{
+			// Every key lands in the same group, so this exercises probing into later groups as well as growth.
+			function<size_t(const Foo& key)> collidingHash = [](const Foo& key) { return static_cast<size_t>(key.Data() & 0x7F); };
+			DynamicFlatHashMap<Foo, int> collidingMap(16_z, collidingHash);
+
+			FlatHashMap<Foo, int> hashMap;
+			const int count = 1000;
+			for (int i = 0; i < count; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+				collidingMap.Insert(make_pair(Foo(i), i));
+			}
+
+			Assert::AreEqual(static_cast<size_t>(count), hashMap.Size());
+			Assert::AreEqual(static_cast<size_t>(count), collidingMap.Size());
+			Assert::IsTrue(hashMap.BucketSize() * 7 / 8 >= hashMap.Size());
+
+			for (int i = 0; i < count; ++i)
+			{
+				Assert::AreEqual(i, hashMap.At(Foo(i)));
+				Assert::AreEqual(i, collidingMap.At(Foo(i)));
+			}
+
+			size_t iterated = 0;
+			for (const auto& pair : hashMap)
+			{
+				Assert::AreEqual(pair.first.Data(), pair.second);
+				++iterated;
+			}
+			Assert::AreEqual(static_cast<size_t>(count), iterated);
+		}
+
+		TEST_METHOD(TestRemove)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+			const Foo z(100);
+
+			FlatHashMap<Foo, int> hashMap;
+			hashMap.Insert(make_pair(a, 10));
+			hashMap.Insert(make_pair(b, 20));
+			hashMap.Insert(make_pair(c, 30));
+			Assert::AreEqual(3_z, hashMap.Size());
+
+			hashMap.Remove(a);
+			Assert::AreEqual(2_z, hashMap.Size());
+			Assert::IsFalse(hashMap.ContainsKey(a));
+
+			hashMap.Remove(z);
+			Assert::AreEqual(2_z, hashMap.Size());
+
+			hashMap.Remove(b);
+			hashMap.Remove(c);
+			Assert::AreEqual(0_z, hashMap.Size());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+		}
+
+		TEST_METHOD(TestRemoveAndReinsertChurn)
+		{
+			// Fill whole groups so removals leave deleted markers, then make sure lookups still probe past them.
+			function<size_t(const Foo& key)> collidingHash = [](const Foo& key) { return static_cast<size_t>(key.Data() & 0x7F); };
+			DynamicFlatHashMap<Foo, int> hashMap(64_z, collidingHash);
+			for (int i = 0; i < 40; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+			}
+
+			const size_t bucketSize = hashMap.BucketSize();
+			for (int round = 0; round < 50; ++round)
+			{
+				for (int i = 0; i < 40; i += 2)
+				{
+					hashMap.Remove(Foo(i));
+				}
+				for (int i = 1; i < 40; i += 2)
+				{
+					Assert::AreEqual(i, hashMap.At(Foo(i)));
+				}
+				for (int i = 0; i < 40; i += 2)
+				{
+					hashMap.Insert(make_pair(Foo(i), i));
+				}
+			}
+
+			Assert::AreEqual(40_z, hashMap.Size());
+			Assert::AreEqual(bucketSize, hashMap.BucketSize());
+		}
+
+		TEST_METHOD(TestClear)
+		{
+			FlatHashMap<Foo, int> hashMap;
+			hashMap.Insert(make_pair(Foo(10), 10));
+			hashMap.Insert(make_pair(Foo(20), 20));
+			Assert::AreEqual(2_z, hashMap.Size());
+
+			const size_t bucketSize = hashMap.BucketSize();
+			hashMap.Clear();
+			Assert::AreEqual(0_z, hashMap.Size());
+			Assert::IsTrue(hashMap.IsEmpty());
+			Assert::AreEqual(bucketSize, hashMap.BucketSize());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+
+			hashMap.Insert(make_pair(Foo(10), 10));
+			Assert::AreEqual(1_z, hashMap.Size());
+		}
+
+		TEST_METHOD(TestContainsKeyAndAt)
+		{
+			const Foo a(10);
+			const Foo b(20);
+
+			FlatHashMap<Foo, int> hashMap;
+			hashMap.Insert(make_pair(a, 10));
+			hashMap.Insert(make_pair(b, 20));
+			Assert::IsTrue(hashMap.ContainsKey(a));
+			Assert::IsFalse(hashMap.ContainsKey(Foo(100)));
+
+			Assert::AreEqual(20, hashMap.At(b));
+			Assert::ExpectException<exception>([&hashMap] { hashMap.At(Foo(100)); }, L"Expected an exception, but none was thrown");
+
+			const FlatHashMap<Foo, int> constHashMap(hashMap);
+			Assert::AreEqual(10, constHashMap.At(a));
+			Assert::ExpectException<exception>([&constHashMap] { constHashMap.At(Foo(100)); }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestBeginEnd)
+		{
+			FlatHashMap<Foo, int> hashMap;
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+			hashMap.Insert(make_pair(Foo(10), 10));
+			Assert::AreEqual(Foo(10), hashMap.begin()->first);
+
+			const FlatHashMap<Foo, int> emptyConstHashMap;
+			Assert::AreEqual(emptyConstHashMap.begin(), emptyConstHashMap.end());
+			Assert::AreEqual(emptyConstHashMap.cbegin(), emptyConstHashMap.cend());
+
+			const FlatHashMap<Foo, int> constHashMap(hashMap);
+			Assert::AreNotEqual(constHashMap.cbegin(), constHashMap.cend());
+			Assert::AreEqual(Foo(10), constHashMap.cbegin()->first);
+		}
+
+		TEST_METHOD(TestResize)
+		{
+			FlatHashMap<Foo, int> hashMap;
+			for (int i = 0; i < 10; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+			}
+
+			hashMap.Resize(200_z);
+			Assert::AreEqual(10_z, hashMap.Size());
+			Assert::AreEqual(256_z, hashMap.BucketSize());
+
+			// Resize never shrinks below what the current elements need.
+			hashMap.Resize(1_z);
+			Assert::AreEqual(16_z, hashMap.BucketSize());
+			for (int i = 0; i < 10; ++i)
+			{
+				Assert::AreEqual(i, hashMap.At(Foo(i)));
+			}
+		}
+#pragma endregion
+
+		TEST_METHOD(TestEmplace)
+		{
+			FlatHashMap<string, unique_ptr<Foo>> hashMap;
+
+			auto value = make_unique<Foo>(1);
+			auto [it, wasInserted] = hashMap.TryEmplace("a", std::move(value));
+			Assert::IsTrue(wasInserted);
+			Assert::IsNull(value.get());
+			Assert::AreEqual(Foo(1), *it->second);
+
+			auto duplicate = make_unique<Foo>(2);
+			tie(it, wasInserted) = hashMap.TryEmplace("a", std::move(duplicate));
+			Assert::IsFalse(wasInserted);
+			Assert::IsNotNull(duplicate.get());
+
+			const string key = "b";
+			tie(it, wasInserted) = hashMap.TryEmplace(key, make_unique<Foo>(3));
+			Assert::IsTrue(wasInserted);
+
+			tie(it, wasInserted) = hashMap.Emplace("c", make_unique<Foo>(4));
+			Assert::IsTrue(wasInserted);
+			tie(it, wasInserted) = hashMap.Emplace("c", make_unique<Foo>(5));
+			Assert::IsFalse(wasInserted);
+			Assert::AreEqual(Foo(4), *it->second);
+
+			tie(it, wasInserted) = hashMap.Insert(make_pair("d"s, make_unique<Foo>(6)));
+			Assert::IsTrue(wasInserted);
+
+			Assert::IsNull(hashMap["e"].get());
+			Assert::AreEqual(Foo(1), *hashMap["a"]);
+			Assert::AreEqual(5_z, hashMap.Size());
+
+			for (int i = 0; i < 100; ++i)
+			{
+				hashMap.TryEmplace(to_string(i), make_unique<Foo>(i));
+			}
+			Assert::AreEqual(105_z, hashMap.Size());
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(Foo(i), *hashMap.At(to_string(i)));
+			}
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState FlatHashMapTests::sStartMemState;
+}
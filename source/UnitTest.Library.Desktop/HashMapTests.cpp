@@ -1,6 +1,7 @@
 #include "pch.h"
 #include <crtdbg.h>
 #include <CppUnitTest.h>
+#include <memory>
 #include "ToStringSpecialization.h"
 #include "HashMap.h"
 #include "Vector.h"
@@ -34,6 +35,25 @@ namespace FIEAGameEngine
 	};
 }
 
+namespace UnitTests
+{
+	struct FooDataHash final
+	{
+		size_t operator()(const Foo& key) const
+		{
+			return static_cast<size_t>(key.Data()) * 31_z;
+		}
+	};
+
+	struct FooDataEquality final
+	{
+		bool operator()(const Foo& lhs, const Foo& rhs) const
+		{
+			return lhs.Data() == rhs.Data();
+		}
+	};
+}
+
 namespace Microsoft::VisualStudio::CppUnitTestFramework
 {
 	template<>
@@ -107,6 +127,19 @@ namespace Microsoft::VisualStudio::CppUnitTestFramework
 		}
 	}
 
+	template<>
+	inline std::wstring ToString<DynamicHashMap<Foo, int>::Iterator>(const DynamicHashMap<Foo, int>::Iterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+
 	template<>
 	inline std::wstring ToString<HashMap<Bar, int>::Iterator>(const HashMap<Bar, int>::Iterator& t)
 	{
@@ -171,6 +204,17 @@ namespace UnitTestLibraryDesktop
 		}
 	};
 
+	struct CountingHash final
+	{
+		size_t operator()(int key) const
+		{
+			++*_calls;
+			return static_cast<size_t>(key);
+		}
+
+		size_t* _calls{ nullptr };
+	};
+
 	TEST_CLASS(HashMapTests)
 	{
 	public:
@@ -368,6 +412,90 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(hashFunc(a), hashFunc(c));
 		}
 
+		TEST_METHOD(HashIsOrderSensitive)
+		{
+			DefaultHash<string> hashFunc;
+			Assert::AreNotEqual(hashFunc("ab"s), hashFunc("ba"s));
+			Assert::AreNotEqual(hashFunc("Actions"s), hashFunc("snoitcA"s));
+			Assert::AreNotEqual(hashFunc(""s), hashFunc("\0"s));
+
+			// Character strings hash by contents no matter how they are held.
+			const char* cString = "Children";
+			Assert::AreEqual(hashFunc("Children"s), DefaultHash<const char*>{}(cString));
+			Assert::AreEqual(hashFunc("Children"s), DefaultHash<const string>{}("Children"s));
+		}
+
+		TEST_METHOD(LongStringHash)
+		{
+			DefaultHash<string> hashFunc;
+			for (size_t length : { 255_z, 256_z, 257_z, 1024_z, 1025_z, 5000_z })
+			{
+				string a(length, 'x');
+				string b(a);
+				Assert::AreEqual(hashFunc(a), hashFunc(b));
+
+				b.front() = 'y';
+				Assert::AreNotEqual(hashFunc(a), hashFunc(b));
+				b = a;
+				b.back() = 'y';
+				Assert::AreNotEqual(hashFunc(a), hashFunc(b));
+				b = a;
+				b[length / 2] = 'y';
+				Assert::AreNotEqual(hashFunc(a), hashFunc(b));
+			}
+		}
+
+		TEST_METHOD(SeededHashTest)
+		{
+			FIEAGameEngine::SeededHash<string> defaultSeed;
+			FIEAGameEngine::SeededHash<string> otherSeed(42);
+			Assert::AreEqual(DefaultHashSeed, defaultSeed.Seed());
+			Assert::AreEqual(42ull, static_cast<unsigned long long>(otherSeed.Seed()));
+
+			Assert::AreEqual(DefaultHash<string>{}("Hello"s), defaultSeed("Hello"s));
+			Assert::AreNotEqual(defaultSeed("Hello"s), otherSeed("Hello"s));
+			Assert::AreEqual(otherSeed("Hello"s), otherSeed("Hello"s));
+
+			HashMap<string, int, SeededHash<string>> hashMap(11_z, otherSeed);
+			hashMap.Insert(make_pair("Hello"s, 1));
+			Assert::AreEqual(1, hashMap.At("Hello"s));
+		}
+
+		TEST_METHOD(HashPolicies)
+		{
+			// Stateless policies take no space, while the type-erased adapters carry their std::function objects.
+			Assert::AreEqual(sizeof(HashMap<Foo, int>), sizeof(HashMap<Foo, int, FooDataHash, FooDataEquality>));
+			Assert::IsTrue(sizeof(HashMap<Foo, int>) < sizeof(DynamicHashMap<Foo, int>));
+
+			HashMap<Foo, int, FooDataHash, FooDataEquality> hashMap(5_z);
+			for (int i = 0; i < 20; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+			}
+			Assert::AreEqual(20_z, hashMap.Size());
+			for (int i = 0; i < 20; ++i)
+			{
+				Assert::AreEqual(i, hashMap.At(Foo(i)));
+			}
+			Assert::IsFalse(hashMap.ContainsKey(Foo(20)));
+
+			// Brace initialization default constructs the map's own policies.
+			const HashMap<Foo, int, FooDataHash, FooDataEquality> listMap{ make_pair(Foo(1), 1), make_pair(Foo(2), 2) };
+			Assert::AreEqual(2_z, listMap.Size());
+			Assert::AreEqual(2, listMap.At(Foo(2)));
+
+			// Default constructed adapters fall back to DefaultHash and DefaultEquality.
+			DynamicHash<Foo> dynamicHash;
+			DynamicEquality<Foo> dynamicEquality;
+			Assert::AreEqual(DefaultHash<Foo>{}(Foo(10)), dynamicHash(Foo(10)));
+			Assert::IsTrue(dynamicEquality(Foo(10), Foo(10)));
+			Assert::IsFalse(dynamicEquality(Foo(10), Foo(20)));
+
+			DynamicHashMap<Foo, int> dynamicMap;
+			dynamicMap.Insert(make_pair(Foo(10), 10));
+			Assert::AreEqual(10, dynamicMap.At(Foo(10)));
+		}
+
 		TEST_METHOD(FooHash)
 		{
 			Foo a(10);
@@ -415,7 +543,7 @@ namespace UnitTestLibraryDesktop
 				const Foo c(30);
 
 				const size_t bucketSize = 5;
-				HashMap<Foo, int> hashMap(bucketSize, hf, eq);
+				DynamicHashMap<Foo, int> hashMap(bucketSize, hf, eq);
 				Assert::AreEqual(0_z, hashMap.Size());
 				Assert::AreEqual(bucketSize, hashMap.BucketSize());
 				Assert::AreEqual(hashMap.begin(), hashMap.end());
@@ -444,7 +572,7 @@ namespace UnitTestLibraryDesktop
 				function<bool(const Foo& lhs, const Foo& rhs)> eq = [](const Foo& lhs, const Foo& rhs) { return lhs.Data() == rhs.Data();  };
 				function<size_t(const Foo& key)> hf = [](const Foo& key) { return key.Data(); };
 				const size_t bucketSize = 0_z;
-				Assert::ExpectException<exception>([&bucketSize, &hf, &eq] { HashMap<Foo, int> hashMap(bucketSize, hf, eq); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&bucketSize, &hf, &eq] { DynamicHashMap<Foo, int> hashMap(bucketSize, hf, eq); }, L"Expected an exception, but none was thrown");
 				
 			}
 
@@ -554,6 +682,45 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(constIt, constHashMap.end());
 		}
 
+		TEST_METHOD(TestHeterogeneousFind)
+		{
+			HashMap<string, int> hashMap(5_z);
+			hashMap.Insert(make_pair("Health"s, 100));
+			hashMap.Insert(make_pair("Mana"s, 50));
+
+			// string_view and const char* lookups hash exactly like the key type.
+			Assert::AreEqual(hashMap.Hash("Health"s), hashMap.Hash("Health"sv));
+			Assert::AreEqual(hashMap.Hash("Health"s), hashMap.Hash("Health"));
+
+			Assert::AreEqual(100, hashMap.Find("Health"sv)->second);
+			Assert::AreEqual(50, hashMap.Find("Mana")->second);
+			Assert::IsTrue(hashMap.Find("Stamina"sv) == hashMap.end());
+
+			// Precomputed hashes
+			const size_t hash = hashMap.Hash("Mana"sv);
+			Assert::AreEqual(50, hashMap.Find("Mana"sv, hash)->second);
+			Assert::AreEqual(50, hashMap.Find("Mana"s, hash)->second);
+
+			const HashMap<string, int> constHashMap(hashMap);
+			Assert::AreEqual(100, constHashMap.Find("Health"sv)->second);
+			Assert::AreEqual(50, constHashMap.Find("Mana"sv, hash)->second);
+			Assert::AreEqual(50, constHashMap.Find("Mana"s, hash)->second);
+			Assert::IsTrue(constHashMap.Find("Stamina") == constHashMap.end());
+
+			// A precomputed hash still finds keys that live in the old buckets during an incremental resize.
+			HashMap<string, int> growingMap(3_z);
+			for (int i = 0; i < 4; ++i)
+			{
+				growingMap.Insert(make_pair(to_string(i), i));
+			}
+			Assert::IsTrue(growingMap.IsResizing());
+			for (int i = 0; i < 4; ++i)
+			{
+				const string key = to_string(i);
+				Assert::AreEqual(i, growingMap.Find(string_view(key), growingMap.Hash(key))->second);
+			}
+		}
+
 		TEST_METHOD(TestInsert)
 		{
 			const Foo a(10);
@@ -745,8 +912,407 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(hashMap.Size(), 3_z);
 			Assert::AreEqual(hashMap.BucketSize(), 15_z);
 		}
+
+		TEST_METHOD(TestAutomaticGrowth)
+		{
+			HashMap<Foo, int> hashMap(5_z);
+			Assert::AreEqual(1.0f, hashMap.MaxLoadFactor());
+
+			const int count = 1000;
+			Vector<int*> addresses(count);
+			for (int i = 0; i < count; ++i)
+			{
+				auto [it, wasInserted] = hashMap.Insert(make_pair(Foo(i), i));
+				Assert::IsTrue(wasInserted);
+				addresses.PushBack(&it->second);
+				Assert::IsTrue(hashMap.LoadFactor() <= hashMap.MaxLoadFactor());
+			}
+
+			Assert::AreEqual(static_cast<size_t>(count), hashMap.Size());
+			Assert::IsTrue(hashMap.BucketSize() >= static_cast<size_t>(count));
+
+			// Every key stays reachable and stays at the same address while buckets are being moved, and finding it moves nothing.
+			const bool wasResizing = hashMap.IsResizing();
+			for (int i = 0; i < count; ++i)
+			{
+				auto it = hashMap.Find(Foo(i));
+				Assert::AreNotEqual(hashMap.end(), it);
+				Assert::IsTrue(addresses[i] == &it->second);
+			}
+			Assert::AreEqual(wasResizing, hashMap.IsResizing());
+
+			size_t iterated = 0;
+			for (const auto& pair : hashMap)
+			{
+				Assert::AreEqual(pair.first.Data(), pair.second);
+				++iterated;
+			}
+			Assert::AreEqual(static_cast<size_t>(count), iterated);
+		}
+
+		TEST_METHOD(TestOperationsWhileResizing)
+		{
+			HashMap<Foo, int> hashMap(16_z);
+			for (int i = 0; i < 16; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+			}
+			Assert::IsFalse(hashMap.IsResizing());
+
+			hashMap.Insert(make_pair(Foo(16), 16));
+			Assert::IsTrue(hashMap.IsResizing());
+			Assert::AreEqual(33_z, hashMap.BucketSize());
+
+			// Iteration, const lookups, and removal all have to see keys in both the old and new buckets.
+			size_t iterated = 0;
+			for (auto it = hashMap.begin(); it != hashMap.end(); ++it)
+			{
+				++iterated;
+			}
+			Assert::AreEqual(17_z, iterated);
+
+			const HashMap<Foo, int>& constHashMap = hashMap;
+			for (int i = 0; i <= 16; ++i)
+			{
+				Assert::IsTrue(constHashMap.ContainsKey(Foo(i)));
+			}
+
+			hashMap.Remove(Foo(15));
+			hashMap.Remove(Foo(16));
+			Assert::AreEqual(15_z, hashMap.Size());
+			Assert::IsFalse(hashMap.ContainsKey(Foo(15)));
+
+			const HashMap<Foo, int> copy(hashMap);
+			Assert::AreEqual(15_z, copy.Size());
+			Assert::AreEqual(3, copy.At(Foo(3)));
+
+			hashMap.Clear();
+			Assert::IsFalse(hashMap.IsResizing());
+			Assert::AreEqual(hashMap.begin(), hashMap.end());
+		}
+
+		TEST_METHOD(TestFindWhileIterating)
+		{
+			HashMap<Foo, int> hashMap(16_z);
+			for (int i = 0; i <= 16; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+			}
+			Assert::IsTrue(hashMap.IsResizing());
+
+			// Lookups inside the loop, including inserts of keys already present, must not move buckets out from under the iterator.
+			Vector<int> visited;
+			for (auto it = hashMap.begin(); it != hashMap.end(); ++it)
+			{
+				visited.PushBack(it->second);
+				for (int i = 0; i <= 16; ++i)
+				{
+					Assert::AreNotEqual(hashMap.end(), hashMap.Find(Foo(i)));
+					Assert::AreEqual(i, hashMap.At(Foo(i)));
+
+					auto [existing, wasInserted] = hashMap.TryEmplace(Foo(i), -1);
+					Assert::IsFalse(wasInserted);
+					Assert::AreEqual(i, existing->second);
+				}
+				Assert::IsTrue(hashMap.IsResizing());
+			}
+
+			Assert::AreEqual(17_z, visited.Size());
+			for (int i = 0; i <= 16; ++i)
+			{
+				Assert::IsTrue(visited.Find(i) != visited.end());
+			}
+
+			// Insert and Remove still finish the resize.
+			for (int i = 0; i < 16 && hashMap.IsResizing(); ++i)
+			{
+				hashMap.Remove(Foo(100 + i));
+			}
+			Assert::IsFalse(hashMap.IsResizing());
+			Assert::AreEqual(17_z, hashMap.Size());
+		}
+
+		TEST_METHOD(TestMaxLoadFactor)
+		{
+			HashMap<Foo, int> hashMap(5_z);
+			Assert::ExpectException<exception>([&hashMap] { hashMap.SetMaxLoadFactor(0.0f); }, L"Expected an exception, but none was thrown");
+
+			hashMap.SetMaxLoadFactor(4.0f);
+			for (int i = 0; i < 20; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+			}
+			Assert::AreEqual(5_z, hashMap.BucketSize());
+			Assert::AreEqual(4.0f, hashMap.LoadFactor());
+
+			hashMap.Insert(make_pair(Foo(20), 20));
+			Assert::AreEqual(11_z, hashMap.BucketSize());
+		}
+
+		TEST_METHOD(TestReserve)
+		{
+			HashMap<Foo, int> hashMap(5_z);
+			hashMap.Insert(make_pair(Foo(1), 1));
+			const int* address = &hashMap.At(Foo(1));
+
+			hashMap.Reserve(100_z);
+			Assert::AreEqual(100_z, hashMap.BucketSize());
+			Assert::IsTrue(address == &hashMap.At(Foo(1)));
+
+			for (int i = 0; i < 100; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+				Assert::IsFalse(hashMap.IsResizing());
+			}
+			Assert::AreEqual(100_z, hashMap.BucketSize());
+
+			hashMap.Reserve(10_z);
+			Assert::AreEqual(100_z, hashMap.BucketSize());
+
+			hashMap.SetMaxLoadFactor(0.5f);
+			hashMap.Reserve(100_z);
+			Assert::AreEqual(200_z, hashMap.BucketSize());
+
+			Assert::ExpectException<exception>([&hashMap] { hashMap.Resize(0_z); }, L"Expected an exception, but none was thrown");
+		}
 #pragma endregion
 
+		TEST_METHOD(TestEmplace)
+		{
+			HashMap<string, unique_ptr<Foo>> hashMap;
+
+			// TryEmplace constructs the value in place, and leaves its arguments alone when the key is already present.
+			auto value = make_unique<Foo>(1);
+			auto [it, wasInserted] = hashMap.TryEmplace("a", std::move(value));
+			Assert::IsTrue(wasInserted);
+			Assert::IsNull(value.get());
+			Assert::AreEqual(Foo(1), *it->second);
+
+			auto duplicate = make_unique<Foo>(2);
+			tie(it, wasInserted) = hashMap.TryEmplace("a", std::move(duplicate));
+			Assert::IsFalse(wasInserted);
+			Assert::IsNotNull(duplicate.get());
+			Assert::AreEqual(Foo(1), *it->second);
+
+			const string key = "b";
+			tie(it, wasInserted) = hashMap.TryEmplace(key);
+			Assert::IsTrue(wasInserted);
+			Assert::IsNull(it->second.get());
+
+			string movedKey = "c";
+			tie(it, wasInserted) = hashMap.TryEmplace(std::move(movedKey), make_unique<Foo>(3));
+			Assert::IsTrue(wasInserted);
+			Assert::AreEqual("c"s, it->first);
+
+			// Emplace builds the whole pair in a node, and throws it away if the key is taken.
+			tie(it, wasInserted) = hashMap.Emplace("d", make_unique<Foo>(4));
+			Assert::IsTrue(wasInserted);
+			Assert::AreEqual(Foo(4), *it->second);
+			tie(it, wasInserted) = hashMap.Emplace("d", make_unique<Foo>(5));
+			Assert::IsFalse(wasInserted);
+			Assert::AreEqual(Foo(4), *it->second);
+
+			tie(it, wasInserted) = hashMap.Insert(make_pair("e"s, make_unique<Foo>(6)));
+			Assert::IsTrue(wasInserted);
+			Assert::AreEqual(Foo(6), *hashMap.At("e"));
+
+			Assert::IsNull(hashMap["f"].get());
+			Assert::AreEqual(Foo(1), *hashMap["a"]);
+			Assert::AreEqual(6_z, hashMap.Size());
+
+			// Inserting past the load factor migrates the chains without touching the stored values.
+			const Foo* first = hashMap.At("a").get();
+			for (int i = 0; i < 100; ++i)
+			{
+				hashMap.TryEmplace(to_string(i), make_unique<Foo>(i));
+			}
+			Assert::AreEqual(106_z, hashMap.Size());
+			Assert::IsTrue(first == hashMap.At("a").get());
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(Foo(i), *hashMap.At(to_string(i)));
+			}
+		}
+
+		TEST_METHOD(TestNodeHandles)
+		{
+			HashMap<string, unique_ptr<Foo>> hashMap;
+			hashMap.TryEmplace("a", make_unique<Foo>(1));
+			hashMap.TryEmplace("b", make_unique<Foo>(2));
+			hashMap.TryEmplace("c", make_unique<Foo>(3));
+			const Foo* address = hashMap.At("b").get();
+
+			using NodeHandle = HashMap<string, unique_ptr<Foo>>::NodeHandle;
+			NodeHandle empty;
+			Assert::IsTrue(empty.IsEmpty());
+			Assert::ExpectException<exception>([&empty] { empty.Key(); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&empty] { empty.Value(); }, L"Expected an exception, but none was thrown");
+			const NodeHandle& constEmpty = empty;
+			Assert::ExpectException<exception>([&constEmpty] { constEmpty.Value(); }, L"Expected an exception, but none was thrown");
+			Assert::IsTrue(hashMap.Extract("z").IsEmpty());
+			Assert::IsTrue(hashMap.Extract(hashMap.end()).IsEmpty());
+			Assert::IsFalse(hashMap.Insert(std::move(empty)).second);
+
+			NodeHandle node = hashMap.Extract("b");
+			Assert::IsFalse(node.IsEmpty());
+			Assert::AreEqual("b"s, node.Key());
+			Assert::IsTrue(address == node.Value().get());
+			Assert::AreEqual(2_z, hashMap.Size());
+			Assert::IsFalse(hashMap.ContainsKey("b"));
+
+			// Reinserting into another HashMap relinks the same node.
+			HashMap<string, unique_ptr<Foo>> other;
+			auto [it, wasInserted] = other.Insert(std::move(node));
+			Assert::IsTrue(wasInserted);
+			Assert::IsTrue(node.IsEmpty());
+			Assert::IsTrue(address == it->second.get());
+			Assert::IsTrue(address == other.At("b").get());
+
+			// A taken key leaves the node in its handle.
+			other.TryEmplace("a", make_unique<Foo>(10));
+			NodeHandle duplicate = hashMap.Extract(hashMap.Find("a"));
+			tie(it, wasInserted) = other.Insert(std::move(duplicate));
+			Assert::IsFalse(wasInserted);
+			Assert::IsFalse(duplicate.IsEmpty());
+			Assert::AreEqual(Foo(10), *it->second);
+			Assert::AreEqual(Foo(1), *duplicate.Value());
+
+			Assert::ExpectException<exception>([&hashMap, &other] { hashMap.Extract(other.begin()); }, L"Expected an exception, but none was thrown");
+
+			// Extracting every node while a resize is in progress, from both the old and the new buckets.
+			HashMap<int, int> growing(4_z);
+			for (int i = 0; i < 5; ++i)
+			{
+				growing.Insert(make_pair(i, i));
+			}
+			Assert::IsTrue(growing.IsResizing());
+			for (int i = 0; i < 5; ++i)
+			{
+				auto extracted = growing.Extract(i);
+				Assert::AreEqual(i, extracted.Key());
+			}
+			Assert::IsTrue(growing.IsEmpty());
+			Assert::AreEqual(growing.begin(), growing.end());
+		}
+
+		TEST_METHOD(TestMerge)
+		{
+			HashMap<Foo, int> hashMap;
+			HashMap<Foo, int> other;
+			for (int i = 0; i < 20; ++i)
+			{
+				hashMap.Insert(make_pair(Foo(i), i));
+			}
+			for (int i = 10; i < 40; ++i)
+			{
+				other.Insert(make_pair(Foo(i), -i));
+			}
+			const int* address = &other.At(Foo(30));
+
+			hashMap.Merge(other);
+			hashMap.Merge(hashMap);
+			Assert::AreEqual(40_z, hashMap.Size());
+			for (int i = 0; i < 20; ++i)
+			{
+				Assert::AreEqual(i, hashMap.At(Foo(i)));
+			}
+			for (int i = 20; i < 40; ++i)
+			{
+				Assert::AreEqual(-i, hashMap.At(Foo(i)));
+			}
+			Assert::IsTrue(address == &hashMap.At(Foo(30)));
+
+			// Keys that were already present stay behind.
+			Assert::AreEqual(10_z, other.Size());
+			size_t iterated = 0;
+			for (const auto& pair : other)
+			{
+				Assert::AreEqual(-pair.first.Data(), pair.second);
+				Assert::IsTrue(pair.first.Data() >= 10 && pair.first.Data() < 20);
+				++iterated;
+			}
+			Assert::AreEqual(10_z, iterated);
+		}
+
+		TEST_METHOD(TestHashIsCached)
+		{
+			// Growth, Resize, Merge and node handles reuse the hash stored with each key.
+			size_t calls = 0;
+			HashMap<int, int, CountingHash> hashMap(2_z, CountingHash{ &calls });
+			for (int i = 0; i < 100; ++i)
+			{
+				hashMap.TryEmplace(i, i);
+			}
+			Assert::AreEqual(100_z, calls);
+
+			hashMap.Resize(7_z);
+			hashMap.Reserve(1000_z);
+			Assert::AreEqual(100_z, calls);
+
+			HashMap<int, int, CountingHash> other(3_z, CountingHash{ &calls });
+			other.Merge(hashMap);
+			other.Insert(other.Extract(other.Find(5, 5_z)));
+			Assert::AreEqual(100_z, calls);
+			Assert::AreEqual(100_z, other.Size());
+			Assert::IsTrue(hashMap.IsEmpty());
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(i, other.At(i));
+			}
+		}
+
+
+		TEST_METHOD(TestStats)
+		{
+			// CountingHash is the identity, so bucket placement is predictable.
+			size_t calls = 0;
+			using Map = HashMap<int, int, CountingHash>;
+			Map hashMap(10_z, CountingHash{ &calls });
+			HashMapStats stats = hashMap.Stats();
+			Assert::AreEqual(0_z, stats._memory._elementCount);
+			Assert::AreEqual(10_z, stats._bucketCount);
+			Assert::AreEqual(10_z, stats._emptyBucketCount);
+			Assert::AreEqual(10_z, stats._chainLengths[0]);
+			Assert::AreEqual(1.0f, stats.EmptyBucketRatio());
+			Assert::AreEqual(0.0f, stats.LoadFactor());
+
+			// Keys 0, 10, 20, ... all land in bucket 0; the rest are one per bucket.
+			hashMap.SetMaxLoadFactor(100.0f);
+			for (int i = 0; i < 10; ++i)
+			{
+				hashMap.Insert(make_pair(i * 10, i));
+			}
+			for (int i = 1; i < 5; ++i)
+			{
+				hashMap.Insert(make_pair(i, i));
+			}
+
+			stats = hashMap.Stats();
+			Assert::AreEqual(14_z, stats._memory._elementCount);
+			Assert::AreEqual(14 * sizeof(Map::PairType), stats._memory._bytesInUse);
+			Assert::IsTrue(stats._memory._bytesAllocated >= 14 * Map::NodeSize + 10 * sizeof(void*));
+			Assert::AreEqual(10_z, stats._longestChain);
+			Assert::AreEqual(5_z, stats._emptyBucketCount);
+			Assert::AreEqual(5_z, stats._chainLengths[0]);
+			Assert::AreEqual(4_z, stats._chainLengths[1]);
+			Assert::AreEqual(1_z, stats._chainLengths[HashMapStats::HistogramSize - 1]);
+			Assert::AreEqual(1.4f, stats.LoadFactor());
+
+			// The old buckets of an incremental resize are counted too.
+			hashMap.SetMaxLoadFactor(1.0f);
+			hashMap.Insert(make_pair(100, 100));
+			Assert::IsTrue(hashMap.IsResizing());
+			stats = hashMap.Stats();
+			Assert::AreEqual(15_z, stats._memory._elementCount);
+			Assert::AreEqual(10_z + hashMap.BucketSize(), stats._bucketCount);
+
+			HashMapStats total = stats;
+			total += Map(3_z, CountingHash{ &calls }).Stats();
+			Assert::AreEqual(stats._bucketCount + 3_z, total._bucketCount);
+			Assert::AreEqual(stats._emptyBucketCount + 3_z, total._emptyBucketCount);
+			Assert::AreEqual(stats._longestChain, total._longestChain);
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -308,6 +308,77 @@ namespace UnitTestLibraryDesktop
             Assert::AreEqual("Test Name 2"s, sharedData.Root->At("Name").GetString(2));
         }
 
+        TEST_METHOD(ParseArrays)
+        {
+            string inputString = R"json({
+            "Health": { "type": "integer", "value": [ 100, -5, 0 ] },
+            "Speed": { "type": "float", "value": [ 1.5, 0.25 ] },
+            "Positions": { "type": "vector", "value": [ "vec4(1, 0, 0, 1)", "vec4(0.5, -2, 3, 1)" ] },
+            "Transforms": { "type": "matrix", "value": [ "mat4x4((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (0, 0, 0, 1))", "mat4x4((2, 0, 0, 0), (0, 2, 0, 0), (0, 0, 2, 0), (0, 0, 0, 2))" ] },
+            "Empty": { "type": "integer", "value": [] }
+            })json";
+
+            Scope scope;
+            JsonTableParseHelper::SharedData sharedData(scope);
+            JsonTableParseHelper tableParseHelper;
+            JsonParseCoordinator parseCoordinator(sharedData);
+            parseCoordinator.AddHelper(tableParseHelper);
+
+            parseCoordinator.Parse(inputString);
+            Assert::AreEqual(5_z, scope.Size());
+            Assert::AreEqual(3_z, scope.At("Health").Size());
+            Assert::AreEqual(-5, scope.At("Health").GetInteger(1));
+            Assert::AreEqual(0.25f, scope.At("Speed").GetFloat(1));
+            Assert::IsTrue(glm::vec4(0.5f, -2.0f, 3.0f, 1.0f) == scope.At("Positions").GetVector(1));
+            Assert::IsTrue(glm::mat4(2.0f) == scope.At("Transforms").GetMatrix(1));
+            Assert::AreEqual(2_z, scope.At("Transforms").Capacity());
+            Assert::AreEqual(0_z, scope.At("Empty").Size());
+
+            string malformed = R"json({ "Positions": { "type": "vector", "value": [ "vec4(1, 0, 0, 1)", "vec4(1, 0)" ] } })json";
+            Scope other;
+            JsonTableParseHelper::SharedData otherData(other);
+            JsonTableParseHelper otherParseHelper;
+            JsonParseCoordinator otherCoordinator(otherData);
+            otherCoordinator.AddHelper(otherParseHelper);
+            Assert::ExpectException<exception>([&otherCoordinator, &malformed] { otherCoordinator.Parse(malformed); }, L"Expected an exception, but none was thrown");
+        }
+
+        TEST_METHOD(ParseCompactTypes)
+        {
+            string inputString = R"json({
+            "Visible": { "type": "boolean", "value": true },
+            "Flags": { "type": "boolean", "value": [ true, false, true ] },
+            "Id": { "type": "integer64", "value": 1099511627776 },
+            "Ids": { "type": "integer64", "value": [ -9223372036854775807, 7 ] },
+            "Time": { "type": "double", "value": 0.1 },
+            "Times": { "type": "double", "value": [ 1e300, -2.5 ] },
+            "Offset": { "type": "vector2", "value": "vec2(1, 2)" },
+            "Position": { "type": "vector3", "value": [ "vec3(1, 2, 3)", "vec3(-1, 0, 0.5)" ] },
+            "Rotation": { "type": "quaternion", "value": "quat(1, {0, 0, 0})" },
+            "Basis": { "type": "matrix3", "value": [ "mat3x3((2, 0, 0), (0, 2, 0), (0, 0, 2))" ] }
+            })json";
+
+            Scope scope;
+            JsonTableParseHelper::SharedData sharedData(scope);
+            JsonTableParseHelper tableParseHelper;
+            JsonParseCoordinator parseCoordinator(sharedData);
+            parseCoordinator.AddHelper(tableParseHelper);
+
+            parseCoordinator.Parse(inputString);
+            Assert::AreEqual(10_z, scope.Size());
+            Assert::IsTrue(scope.At("Visible").GetBoolean());
+            Assert::AreEqual(3_z, scope.At("Flags").Size());
+            Assert::IsFalse(scope.At("Flags").GetBoolean(1));
+            Assert::IsTrue(scope.At("Id").GetInteger64() == std::int64_t(1) << 40);
+            Assert::IsTrue(scope.At("Ids").GetInteger64(0) == -9223372036854775807);
+            Assert::AreEqual(0.1, scope.At("Time").GetDouble());
+            Assert::AreEqual(1e300, scope.At("Times").GetDouble(0));
+            Assert::IsTrue(glm::vec2(1.0f, 2.0f) == scope.At("Offset").GetVector2());
+            Assert::IsTrue(glm::vec3(-1.0f, 0.0f, 0.5f) == scope.At("Position").GetVector3(1));
+            Assert::IsTrue(glm::quat(1.0f, 0.0f, 0.0f, 0.0f) == scope.At("Rotation").GetQuaternion());
+            Assert::IsTrue(glm::mat3(2.0f) == scope.At("Basis").GetMatrix3());
+        }
+
         TEST_METHOD(FileParsing)
         {
             ScopeFactory scopeFactory;
@@ -0,0 +1,276 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include "ToStringSpecialization.h"
+#include "MemoryResource.h"
+#include "Allocator.h"
+#include "Vector.h"
+#include "SmallVector.h"
+#include "SList.h"
+#include "Stack.h"
+#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "Scope.h"
+#include "Foo.h"
+#include "CountingResource.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(MemoryResourceTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestMonotonicResource)
+		{
+			CountingResource upstream;
+			{
+				MonotonicResource resource(64_z, &upstream);
+				Assert::AreEqual(0_z, upstream.Allocations);
+
+				void* first = resource.Allocate(8_z, 8_z);
+				void* second = resource.Allocate(8_z, 32_z);
+				Assert::AreEqual(1_z, upstream.Allocations);
+				Assert::AreEqual(0_z, reinterpret_cast<uintptr_t>(second) % 32_z);
+				Assert::IsTrue(static_cast<std::byte*>(second) > static_cast<std::byte*>(first));
+
+				// The most recent allocation grows in place while the block has room.
+				void* grown = resource.Reallocate(second, 8_z, 16_z, 32_z);
+				Assert::IsTrue(grown == second);
+
+				// Anything that does not fit comes from a new, larger block.
+				void* large = resource.Allocate(1000_z, 8_z);
+				Assert::AreEqual(2_z, upstream.Allocations);
+				std::memset(large, 0xFF, 1000_z);
+
+				resource.Deallocate(first, 8_z, 8_z);
+				Assert::AreEqual(2_z, upstream.Allocations);
+
+				resource.Release();
+				Assert::AreEqual(0_z, upstream.OutstandingBytes);
+
+				resource.Allocate(8_z, 8_z);
+				Assert::AreEqual(3_z, upstream.Allocations);
+			}
+			Assert::AreEqual(0_z, upstream.OutstandingBytes);
+
+			{
+				alignas(std::max_align_t) std::byte buffer[128];
+				MonotonicResource resource(buffer, sizeof(buffer), &upstream);
+
+				void* memory = resource.Allocate(64_z, 8_z);
+				Assert::IsTrue(memory == buffer);
+				Assert::AreEqual(3_z, upstream.Allocations);
+
+				resource.Allocate(128_z, 8_z);
+				Assert::AreEqual(4_z, upstream.Allocations);
+
+				resource.Release();
+				Assert::IsTrue(resource.Allocate(64_z, 8_z) == buffer);
+			}
+			Assert::AreEqual(0_z, upstream.OutstandingBytes);
+		}
+
+		TEST_METHOD(TestPoolResource)
+		{
+			CountingResource upstream;
+			{
+				PoolResource resource(1024_z, &upstream);
+
+				void* first = resource.Allocate(24_z, 8_z);
+				Assert::AreEqual(1_z, upstream.Allocations);
+				Assert::AreEqual(0_z, reinterpret_cast<uintptr_t>(first) % PoolResource::MinimumBlockSize);
+
+				// Blocks of the same size class are recycled instead of going back to upstream.
+				resource.Deallocate(first, 24_z, 8_z);
+				void* second = resource.Allocate(32_z, 8_z);
+				Assert::IsTrue(first == second);
+
+				// Growing within a size class keeps the block; leaving it moves the contents.
+				Assert::IsTrue(resource.Reallocate(second, 32_z, 20_z, 8_z) == second);
+				static_cast<int*>(second)[0] = 42;
+				void* moved = resource.Reallocate(second, 20_z, 100_z, 8_z);
+				Assert::IsFalse(moved == second);
+				Assert::AreEqual(42, static_cast<int*>(moved)[0]);
+				Assert::AreEqual(2_z, upstream.Allocations);
+
+				// Oversized and overaligned requests go straight to upstream.
+				void* large = resource.Allocate(PoolResource::MaximumBlockSize + 1_z, 8_z);
+				Assert::AreEqual(3_z, upstream.Allocations);
+				resource.Deallocate(large, PoolResource::MaximumBlockSize + 1_z, 8_z);
+
+				resource.Deallocate(resource.Allocate(64_z, 8_z), 64_z, 8_z);
+				const size_t before = upstream.OutstandingBytes;
+				for (size_t i = 0_z; i < 10_z; ++i)
+				{
+					resource.Deallocate(resource.Allocate(64_z, 8_z), 64_z, 8_z);
+				}
+				Assert::AreEqual(before, upstream.OutstandingBytes);
+			}
+			Assert::AreEqual(0_z, upstream.OutstandingBytes);
+		}
+
+		TEST_METHOD(TestContainersUseAllocator)
+		{
+			CountingResource resource;
+			const ResourceAllocator allocator(&resource);
+			{
+				Vector<Foo, ResourceAllocator> vector(0_z, allocator);
+				for (int i = 0; i < 20; ++i)
+				{
+					vector.PushBack(Foo(i));
+				}
+				Assert::IsTrue(resource.Allocations > 0_z);
+				Assert::IsTrue(vector.GetAllocator() == allocator);
+
+				Vector<Foo, ResourceAllocator> copy(vector);
+				Assert::IsTrue(copy.GetAllocator() == allocator);
+				Vector<Foo, ResourceAllocator> other;
+				Assert::IsTrue(other.GetAllocator().Resource() == &DefaultResource());
+				other = copy;
+				Assert::IsTrue(other.GetAllocator() == allocator);
+				Assert::AreEqual(Foo(19), other.Back());
+
+				Vector<Foo, ResourceAllocator> moved(std::move(copy));
+				Assert::IsTrue(moved.GetAllocator() == allocator);
+				moved.ShrinkToFit();
+			}
+			Assert::AreEqual(0_z, resource.OutstandingBytes);
+
+			{
+				resource.Allocations = 0_z;
+				SmallVector<Foo, 2, ResourceAllocator> vector(0_z, allocator);
+				vector.PushBack(Foo(1));
+				vector.PushBack(Foo(2));
+				Assert::AreEqual(0_z, resource.Allocations);
+				vector.PushBack(Foo(3));
+				Assert::AreEqual(1_z, resource.Allocations);
+
+				SmallVector<Foo, 2, ResourceAllocator> moved(std::move(vector));
+				Assert::IsTrue(moved.GetAllocator() == allocator);
+				moved.PopBack();
+				moved.ShrinkToFit();
+				Assert::IsTrue(moved.IsInline());
+				Assert::AreEqual(0_z, resource.OutstandingBytes);
+			}
+
+			{
+				resource.Allocations = 0_z;
+				SList<Foo, ResourceAllocator> list(allocator);
+				list.PushBack(Foo(1));
+				list.PushFront(Foo(0));
+				list.InsertAfter(Foo(2), list.begin());
+				Assert::AreEqual(3_z, resource.Allocations);
+
+				SList<Foo, ResourceAllocator> copy(list);
+				Assert::IsTrue(copy.GetAllocator() == allocator);
+				copy.Remove(Foo(2));
+				copy.PopBack();
+
+				Stack<Foo, ResourceAllocator> stack(allocator);
+				stack.Push(Foo(1));
+				stack.Push(Foo(2));
+				Assert::AreEqual(Foo(2), stack.Top());
+			}
+			Assert::AreEqual(0_z, resource.OutstandingBytes);
+
+			{
+				HashMap<int, Foo, DefaultHash<int>, DefaultEquality<int>, ResourceAllocator> map(3_z, {}, {}, allocator);
+				for (int i = 0; i < 50; ++i)
+				{
+					map.Insert(make_pair(i, Foo(i)));
+				}
+				Assert::IsTrue(map.GetAllocator() == allocator);
+				Assert::AreEqual(Foo(42), map.At(42));
+
+				auto copy = map;
+				Assert::IsTrue(copy.GetAllocator() == allocator);
+				copy.Remove(7);
+				copy.Resize(101_z);
+				Assert::AreEqual(49_z, copy.Size());
+
+				FlatHashMap<int, Foo, DefaultHash<int>, DefaultEquality<int>, ResourceAllocator> flatMap(16_z, {}, {}, allocator);
+				const size_t before = resource.OutstandingBytes;
+				for (int i = 0; i < 50; ++i)
+				{
+					flatMap.Insert(make_pair(i, Foo(i)));
+				}
+				Assert::IsTrue(resource.OutstandingBytes > before);
+				Assert::AreEqual(Foo(42), flatMap.At(42));
+			}
+			Assert::AreEqual(0_z, resource.OutstandingBytes);
+		}
+
+		TEST_METHOD(TestScopeWithResource)
+		{
+			CountingResource upstream;
+			{
+				MonotonicResource resource(1024_z, &upstream);
+				Scope root(11_z, &resource);
+				Assert::IsTrue(root.Resource() == &resource);
+				const size_t blocks = upstream.Allocations;
+				Assert::AreEqual(1_z, blocks);
+
+				Scope& child = root.AppendScope("Child");
+				Assert::IsTrue(child.Resource() == &resource);
+				child.Append("Health") = 100;
+				root.Append("Name") = "Root";
+
+				Scope copy(root);
+				Assert::IsTrue(copy.Resource() == &resource);
+				Assert::IsTrue(copy == root);
+
+				Scope defaultScope;
+				Assert::IsTrue(defaultScope.Resource() == &DefaultResource());
+				Assert::IsTrue(defaultScope.AppendScope("Child").Resource() == &DefaultResource());
+			}
+			Assert::AreEqual(0_z, upstream.OutstandingBytes);
+
+			{
+				PoolResource resource(4096_z, &upstream);
+				Scope root(11_z, &resource);
+				for (int i = 0; i < 20; ++i)
+				{
+					root.AppendScope("Child" + to_string(i)).Append("Value") = i;
+				}
+				root.Clear();
+				const size_t outstanding = upstream.OutstandingBytes;
+				for (int i = 0; i < 20; ++i)
+				{
+					root.AppendScope("Child" + to_string(i)).Append("Value") = i;
+				}
+				Assert::AreEqual(outstanding, upstream.OutstandingBytes);
+			}
+			Assert::AreEqual(0_z, upstream.OutstandingBytes);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState MemoryResourceTests::sStartMemState;
+}
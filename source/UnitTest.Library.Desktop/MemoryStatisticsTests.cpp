@@ -0,0 +1,245 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ToStringSpecialization.h"
+#include "MemoryStatistics.h"
+#include "Scope.h"
+#include "SizeLiteral.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+using namespace FIEAGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(MemoryStatisticsTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestDatumStats)
+		{
+			{
+				Datum datum;
+				ContainerStats stats = datum.Stats();
+				Assert::AreEqual(0_z, stats._elementCount);
+				Assert::AreEqual(0_z, stats._bytesAllocated);
+				Assert::AreEqual(0_z, stats._bytesInUse);
+			}
+
+			{
+				Datum datum{ 1, 2, 3 };
+				datum.Reserve(10);
+				ContainerStats stats = datum.Stats();
+				Assert::AreEqual(3_z, stats._elementCount);
+				Assert::AreEqual(10 * sizeof(int), stats._bytesAllocated);
+				Assert::AreEqual(3 * sizeof(int), stats._bytesInUse);
+				Assert::AreEqual(7 * sizeof(int), stats.BytesOverhead());
+
+				datum.Resize(1);
+				stats = datum.Stats();
+				Assert::AreEqual(1_z, stats._elementCount);
+				Assert::AreEqual(10 * sizeof(int), stats._bytesAllocated);
+			}
+
+			{
+				float floats[] = { 1.0f, 2.0f };
+				Datum datum;
+				datum.SetStorage(floats, 2);
+				ContainerStats stats = datum.Stats();
+				Assert::AreEqual(2_z, stats._elementCount);
+				Assert::AreEqual(0_z, stats._bytesAllocated);
+				Assert::AreEqual(2 * sizeof(float), stats._bytesInUse);
+			}
+		}
+
+		TEST_METHOD(TestDatumBuffers)
+		{
+			const MemoryReport before = MemoryStatistics::Report();
+
+			{
+				Datum datum;
+				datum.SetType(Datum::DatumTypes::Integer);
+				Assert::AreEqual(before._datumBufferCount, MemoryStatistics::Report()._datumBufferCount);
+
+				datum.Reserve(10);
+				MemoryReport report = MemoryStatistics::Report();
+				Assert::AreEqual(before._datumBufferCount + 1, report._datumBufferCount);
+				Assert::AreEqual(before._datumBufferBytes + 10 * sizeof(int), report._datumBufferBytes);
+
+				datum.Reserve(20);
+				report = MemoryStatistics::Report();
+				Assert::AreEqual(before._datumBufferCount + 1, report._datumBufferCount);
+				Assert::AreEqual(before._datumBufferBytes + 20 * sizeof(int), report._datumBufferBytes);
+
+				datum.PushBack(1);
+				datum.PushBack(2);
+				datum.PushBack(3);
+				Datum copy(datum);
+				report = MemoryStatistics::Report();
+				Assert::AreEqual(before._datumBufferCount + 2, report._datumBufferCount);
+				Assert::AreEqual(before._datumBufferBytes + 23 * sizeof(int), report._datumBufferBytes);
+
+				Datum moved(std::move(copy));
+				report = MemoryStatistics::Report();
+				Assert::AreEqual(before._datumBufferCount + 2, report._datumBufferCount);
+				Assert::AreEqual(before._datumBufferBytes + 23 * sizeof(int), report._datumBufferBytes);
+
+				Datum floats{ 1.0f, 2.0f, 3.0f };
+				moved = floats;
+				report = MemoryStatistics::Report();
+				Assert::AreEqual(before._datumBufferCount + 3, report._datumBufferCount);
+				Assert::AreEqual(before._datumBufferBytes + 20 * sizeof(int) + 6 * sizeof(float), report._datumBufferBytes);
+
+				moved = std::move(datum);
+				report = MemoryStatistics::Report();
+				Assert::AreEqual(before._datumBufferCount + 2, report._datumBufferCount);
+				Assert::AreEqual(before._datumBufferBytes + 20 * sizeof(int) + 3 * sizeof(float), report._datumBufferBytes);
+
+				int ints[] = { 1, 2, 3 };
+				moved.Clear();
+				moved.SetStorage(ints, 3);
+				report = MemoryStatistics::Report();
+				Assert::AreEqual(before._datumBufferCount + 1, report._datumBufferCount);
+				Assert::AreEqual(before._datumBufferBytes + 3 * sizeof(float), report._datumBufferBytes);
+
+				Datum single{ 1 };
+				report = MemoryStatistics::Report();
+				Assert::AreEqual(before._datumBufferCount + 1, report._datumBufferCount);
+				Assert::AreEqual(before._datumBufferBytes + 3 * sizeof(float), report._datumBufferBytes);
+			}
+
+			const MemoryReport after = MemoryStatistics::Report();
+			Assert::AreEqual(before._datumBufferCount, after._datumBufferCount);
+			Assert::AreEqual(before._datumBufferBytes, after._datumBufferBytes);
+		}
+
+		TEST_METHOD(TestScopeRegistration)
+		{
+			const MemoryReport before = MemoryStatistics::Report();
+
+			{
+				Scope scope;
+				Assert::AreEqual(before._scopeCount + 1, MemoryStatistics::Report()._scopeCount);
+
+				{
+					Scope copy(scope);
+					Assert::AreEqual(before._scopeCount + 2, MemoryStatistics::Report()._scopeCount);
+
+					Scope moved(std::move(copy));
+					Assert::AreEqual(before._scopeCount + 3, MemoryStatistics::Report()._scopeCount);
+				}
+				Assert::AreEqual(before._scopeCount + 1, MemoryStatistics::Report()._scopeCount);
+
+				Scope& child = scope.AppendScope("child"s);
+				child.AppendScope("grandchild"s);
+				Assert::AreEqual(before._scopeCount + 3, MemoryStatistics::Report()._scopeCount);
+
+				Scope copy(scope);
+				Assert::AreEqual(before._scopeCount + 6, MemoryStatistics::Report()._scopeCount);
+			}
+
+			Assert::AreEqual(before._scopeCount, MemoryStatistics::Report()._scopeCount);
+		}
+
+		TEST_METHOD(TestScopeTotals)
+		{
+			const MemoryReport before = MemoryStatistics::Report();
+
+			{
+				Scope scope(4);
+				Datum& numbers = scope.Append("numbers"s);
+				numbers.SetType(Datum::DatumTypes::Integer);
+				numbers.Reserve(8);
+				numbers.PushBack(1);
+				numbers.PushBack(2);
+				scope.Append("empty"s);
+				scope.AppendScope("child"s);
+
+				const MemoryReport report = MemoryStatistics::Report();
+				Assert::AreEqual(before._scopeCount + 2, report._scopeCount);
+				Assert::AreEqual(before._dictionaries._memory._elementCount + 3, report._dictionaries._memory._elementCount);
+				Assert::AreEqual(before._orders._elementCount + 3, report._orders._elementCount);
+				Assert::AreEqual(before._scopeDatums._elementCount + 3, report._scopeDatums._elementCount);
+				Assert::AreEqual(before._scopeDatums._bytesAllocated + 8 * sizeof(int), report._scopeDatums._bytesAllocated);
+				Assert::AreEqual(before._scopeDatums._bytesInUse + 2 * sizeof(int) + sizeof(Scope*), report._scopeDatums._bytesInUse);
+				Assert::IsTrue(report._dictionaries._bucketCount >= before._dictionaries._bucketCount + 4);
+				Assert::IsTrue(report.TotalBytes() > before.TotalBytes());
+			}
+
+			const MemoryReport after = MemoryStatistics::Report();
+			Assert::AreEqual(before._scopeCount, after._scopeCount);
+			Assert::AreEqual(before._dictionaries._memory._elementCount, after._dictionaries._memory._elementCount);
+			Assert::AreEqual(before._scopeDatums._bytesAllocated, after._scopeDatums._bytesAllocated);
+			Assert::AreEqual(before.TotalBytes(), after.TotalBytes());
+		}
+
+		TEST_METHOD(TestConcurrentScopes)
+		{
+			const MemoryReport before = MemoryStatistics::Report();
+
+			{
+				vector<thread> threads;
+				for (size_t i = 0; i < 4; ++i)
+				{
+					threads.emplace_back([]
+					{
+						for (size_t j = 0; j < 250; ++j)
+						{
+							Scope scope;
+							Scope copy(scope);
+							MemoryStatistics::Report();
+						}
+					});
+				}
+
+				for (thread& thread : threads)
+				{
+					thread.join();
+				}
+			}
+
+			Assert::AreEqual(before._scopeCount, MemoryStatistics::Report()._scopeCount);
+		}
+
+		TEST_METHOD(TestWriteReport)
+		{
+			Scope scope;
+			scope.Append("value"s) = 5;
+
+			ostringstream stream;
+			MemoryStatistics::WriteReport(stream);
+			const string text = stream.str();
+			Assert::AreNotEqual(string::npos, text.find("Scopes:"));
+			Assert::AreNotEqual(string::npos, text.find("Total:"));
+		}
+
+	private:
+		inline static _CrtMemState sStartMemState;
+	};
+}
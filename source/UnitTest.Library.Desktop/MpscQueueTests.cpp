@@ -0,0 +1,131 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <string>
+#include <thread>
+#include "ToStringSpecialization.h"
+#include "MpscQueue.h"
+#include "Vector.h"
+#include "Foo.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(MpscQueueTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestPushPop)
+		{
+			MpscQueue<Foo> queue(1);
+			Assert::AreEqual(2_z, queue.Capacity());
+			Assert::IsTrue(queue.IsEmpty());
+
+			Foo popped;
+			Assert::IsFalse(queue.TryPop(popped));
+
+			const Foo one(1);
+			Assert::IsTrue(queue.TryPush(one));
+			Assert::IsTrue(queue.TryPush(Foo(2)));
+			Assert::IsFalse(queue.TryEmplace(3));
+			Assert::AreEqual(2_z, queue.Size());
+
+			for (int i = 1; i <= 20; ++i)
+			{
+				Assert::IsTrue(queue.TryPop(popped));
+				Assert::AreEqual(Foo(i), popped);
+				Assert::IsTrue(queue.TryEmplace(i + 2));
+			}
+			Assert::AreEqual(2_z, queue.Size());
+
+			MpscQueue<string> strings(4);
+			strings.TryPush("a string long enough to live on the heap"s);
+			strings.TryPush("another string long enough to live on the heap"s);
+			string poppedString;
+			Assert::IsTrue(strings.TryPop(poppedString));
+			Assert::AreEqual("a string long enough to live on the heap"s, poppedString);
+		}
+
+		TEST_METHOD(TestManyProducers)
+		{
+			const int producerCount = 4;
+			const int countPerProducer = 25000;
+			MpscQueue<int> queue(64);
+
+			Vector<thread> producers;
+			for (int producer = 0; producer < producerCount; ++producer)
+			{
+				producers.EmplaceBack([&queue, producer] {
+					for (int i = 0; i < countPerProducer; ++i)
+					{
+						while (!queue.TryPush(producer * countPerProducer + i))
+						{
+							this_thread::yield();
+						}
+					}
+				});
+			}
+
+			// Elements from one producer arrive in the order that producer pushed them.
+			Vector<int> nextExpected(producerCount);
+			for (int producer = 0; producer < producerCount; ++producer)
+			{
+				nextExpected.PushBack(0);
+			}
+			bool inOrder = true;
+			for (int received = 0; received < producerCount * countPerProducer;)
+			{
+				int value;
+				if (queue.TryPop(value))
+				{
+					const int producer = value / countPerProducer;
+					inOrder &= (value % countPerProducer == nextExpected[producer]);
+					++nextExpected[producer];
+					++received;
+				}
+				else
+				{
+					this_thread::yield();
+				}
+			}
+			for (thread& producer : producers)
+			{
+				producer.join();
+			}
+
+			Assert::IsTrue(inOrder);
+			Assert::IsTrue(queue.IsEmpty());
+			for (int producer = 0; producer < producerCount; ++producer)
+			{
+				Assert::AreEqual(countPerProducer, nextExpected[producer]);
+			}
+		}
+
+	private:
+		inline static _CrtMemState sStartMemState;
+	};
+}
@@ -0,0 +1,226 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include "ToStringSpecialization.h"
+#include "NodePool.h"
+#include "SList.h"
+#include "Stack.h"
+#include "HashMap.h"
+#include "Foo.h"
+#include "CountingResource.h"
+#include "SizeLiteral.h"
+#include <thread>
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(NodePoolTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestNodePool)
+		{
+			CountingResource upstream;
+			{
+				NodePool pool(24_z, 8_z, 4_z, &upstream);
+				Assert::AreEqual(24_z, pool.BlockSize());
+				Assert::IsTrue(pool.Fits(24_z, 8_z));
+				Assert::IsFalse(pool.Fits(25_z, 8_z));
+				Assert::IsFalse(pool.Fits(8_z, 16_z));
+				Assert::AreEqual(0_z, upstream.Allocations);
+
+				// One chunk serves blocksPerChunk blocks before the pool goes back to upstream.
+				void* blocks[5];
+				for (void*& block : blocks)
+				{
+					block = pool.Allocate(24_z, 8_z);
+					Assert::AreEqual(0_z, reinterpret_cast<uintptr_t>(block) % 8_z);
+				}
+				Assert::AreEqual(2_z, upstream.Allocations);
+
+				// Freed blocks are recycled most recent first.
+				pool.Deallocate(blocks[2], 24_z, 8_z);
+				Assert::IsTrue(pool.Allocate(16_z, 8_z) == blocks[2]);
+				Assert::AreEqual(2_z, upstream.Allocations);
+
+				// Requests that do not fit go straight to upstream.
+				void* large = pool.Allocate(100_z, 8_z);
+				Assert::AreEqual(3_z, upstream.Allocations);
+				static_cast<int*>(large)[0] = 42;
+				void* moved = pool.Reallocate(large, 100_z, 16_z, 8_z);
+				Assert::AreEqual(42, static_cast<int*>(moved)[0]);
+				Assert::IsTrue(pool.Reallocate(moved, 16_z, 24_z, 8_z) == moved);
+				pool.Deallocate(moved, 24_z, 8_z);
+
+				pool.Release();
+				Assert::AreEqual(0_z, upstream.OutstandingBytes);
+				pool.Allocate(24_z, 8_z);
+			}
+			Assert::AreEqual(0_z, upstream.OutstandingBytes);
+		}
+
+		TEST_METHOD(TestPerListPool)
+		{
+			using ListType = SList<Foo, NodePoolAllocator>;
+
+			CountingResource upstream;
+			{
+				NodePool pool(ListType::NodeSize, ListType::NodeAlignment, 16_z, &upstream);
+				ListType list{ NodePoolAllocator(pool) };
+				for (int i = 0; i < 16; ++i)
+				{
+					list.PushBack(Foo(i));
+				}
+				Assert::AreEqual(1_z, upstream.Allocations);
+
+				// Nodes popped off one list are reused by another list on the same pool.
+				ListType other(list.GetAllocator());
+				list.Clear();
+				for (int i = 0; i < 16; ++i)
+				{
+					other.PushFront(Foo(i));
+				}
+				Assert::AreEqual(1_z, upstream.Allocations);
+				Assert::AreEqual(Foo(15), other.Front());
+
+				ListType copy(other);
+				Assert::IsTrue(copy.GetAllocator() == other.GetAllocator());
+				Assert::AreEqual(2_z, upstream.Allocations);
+
+				Stack<Foo, NodePoolAllocator> stack{ NodePoolAllocator(pool) };
+				stack.Push(Foo(1));
+				stack.Push(Foo(2));
+				Assert::AreEqual(Foo(2), stack.Top());
+				stack.Pop();
+				Assert::AreEqual(Foo(1), stack.Top());
+			}
+			Assert::AreEqual(0_z, upstream.OutstandingBytes);
+
+			{
+				using MapType = HashMap<int, Foo, DefaultHash<int>, DefaultEquality<int>, NodePoolAllocator>;
+				NodePool pool(MapType::NodeSize, MapType::NodeAlignment, 64_z, &upstream);
+				MapType map(11_z, {}, {}, NodePoolAllocator(pool));
+				for (int i = 0; i < 100; ++i)
+				{
+					map.Insert(make_pair(i, Foo(i)));
+				}
+				for (int i = 0; i < 100; i += 2)
+				{
+					map.Remove(i);
+				}
+				Assert::AreEqual(50_z, map.Size());
+				Assert::AreEqual(Foo(41), map.At(41));
+				Assert::IsTrue(map.GetAllocator().Pool() == &pool);
+			}
+			Assert::AreEqual(0_z, upstream.OutstandingBytes);
+		}
+
+		TEST_METHOD(TestSharedPools)
+		{
+			using ListType = SList<Foo, NodePoolAllocator>;
+
+			NodePool* shared = NodePool::Shared(ListType::NodeSize, ListType::NodeAlignment);
+			Assert::IsNotNull(shared);
+			Assert::IsTrue(shared == NodePool::Shared(ListType::NodeSize, ListType::NodeAlignment));
+			Assert::IsTrue(shared->Fits(ListType::NodeSize, ListType::NodeAlignment));
+			Assert::IsNull(NodePool::Shared(NodePool::MaximumSharedBlockSize + 1_z, 8_z));
+
+			{
+				// Default constructed allocators share one pool per node size.
+				ListType first;
+				ListType second;
+				Assert::IsTrue(first.GetAllocator() == second.GetAllocator());
+				Assert::IsNull(first.GetAllocator().Pool());
+
+				first.PushBack(Foo(1));
+				ListType::Iterator it = first.begin();
+				const Foo* node = &*it;
+				first.PopFront();
+				second.PushBack(Foo(2));
+				Assert::IsTrue(&second.Front() == node);
+
+				// Allocations too large to share, such as a HashMap's bucket vector, go to DefaultResource.
+				HashMap<int, Foo, DefaultHash<int>, DefaultEquality<int>, NodePoolAllocator> map(101_z);
+				for (int i = 0; i < 20; ++i)
+				{
+					map.Insert(make_pair(i, Foo(i)));
+				}
+				Assert::AreEqual(Foo(7), map.At(7));
+			}
+
+			NodePool::ReleaseShared();
+		}
+
+		TEST_METHOD(TestSharedPoolsAcrossThreads)
+		{
+			using ListType = SList<Foo, NodePoolAllocator>;
+			using MapType = HashMap<int, Foo, DefaultHash<int>, DefaultEquality<int>, NodePoolAllocator>;
+
+			// Each thread owns its containers, but their nodes all come from the same shared pools.
+			const auto churn = [](int seed, size_t& mismatches)
+			{
+				ListType list;
+				MapType map(31_z);
+				for (int round = 0; round < 200; ++round)
+				{
+					for (int i = 0; i < 50; ++i)
+					{
+						list.PushBack(Foo(seed + i));
+						map.Insert(make_pair(i, Foo(seed + i)));
+					}
+
+					for (int i = 0; i < 50; ++i)
+					{
+						if (list.Front() != Foo(seed + i) || map.At(i) != Foo(seed + i))
+						{
+							++mismatches;
+						}
+						list.PopFront();
+						map.Remove(i);
+					}
+				}
+			};
+
+			size_t firstMismatches = 0_z;
+			size_t secondMismatches = 0_z;
+			{
+				thread first(churn, 1000, ref(firstMismatches));
+				thread second(churn, 2000, ref(secondMismatches));
+				first.join();
+				second.join();
+			}
+
+			Assert::AreEqual(0_z, firstMismatches);
+			Assert::AreEqual(0_z, secondMismatches);
+			NodePool::ReleaseShared();
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState NodePoolTests::sStartMemState;
+}
@@ -0,0 +1,185 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <numeric>
+#include <random>
+#include "ToStringSpecialization.h"
+#include "ParallelAlgorithms.h"
+#include "Foo.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ParallelAlgorithmsTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestChunking)
+		{
+			ThreadPool serialPool(0_z);
+			ThreadPool pool(3_z);
+			Assert::AreEqual(1_z, ParallelChunkCount(1000000_z, serialPool));
+			Assert::AreEqual(1_z, ParallelChunkCount(ParallelSerialThreshold - 1_z, pool));
+			Assert::AreEqual(ParallelSerialThreshold / ParallelMinimumChunkSize, ParallelChunkCount(ParallelSerialThreshold, pool));
+			Assert::AreEqual(4_z * ParallelChunksPerThread, ParallelChunkCount(1000000_z, pool));
+
+			// Chunks cover the range exactly and differ in length by at most one.
+			const size_t count = 10007;
+			const size_t chunkCount = 16;
+			Assert::AreEqual(0_z, ParallelChunkBegin(count, chunkCount, 0_z));
+			Assert::AreEqual(count, ParallelChunkBegin(count, chunkCount, chunkCount));
+			for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+			{
+				const size_t length = ParallelChunkBegin(count, chunkCount, chunk + 1_z) - ParallelChunkBegin(count, chunkCount, chunk);
+				Assert::IsTrue(length == count / chunkCount || length == count / chunkCount + 1_z);
+			}
+		}
+
+		TEST_METHOD(TestForEachTransform)
+		{
+			ThreadPool pool(3_z);
+			for (const size_t count : { 0_z, 10_z, 100000_z })
+			{
+				Vector<int> vector;
+				for (size_t i = 0; i < count; ++i)
+				{
+					vector.PushBack(static_cast<int>(i));
+				}
+
+				ParallelForEach(vector, [](int& value) { value *= 2; }, pool);
+				atomic<long long> sum{ 0 };
+				ParallelForEach(static_cast<const Vector<int>&>(vector), [&sum](const int& value) { sum += value; }, pool);
+				Assert::AreEqual(static_cast<long long>(count) * (static_cast<long long>(count) - 1), sum.load());
+
+				Vector<string> strings;
+				ParallelTransform(vector, strings, [](int value) { return to_string(value); }, pool);
+				Assert::AreEqual(count, strings.Size());
+				for (size_t i = 0; i < count; i += 997)
+				{
+					Assert::AreEqual(to_string(2 * i), strings[i]);
+				}
+
+				// In place, through the pointer overload.
+				int* end = ParallelTransform(vector.Data(), vector.Data() + vector.Size(), vector.Data(), [](int value) { return value / 2; }, pool);
+				Assert::IsTrue(end == vector.Data() + vector.Size());
+				for (size_t i = 0; i < count; ++i)
+				{
+					Assert::AreEqual(static_cast<int>(i), vector[i]);
+				}
+			}
+		}
+
+		TEST_METHOD(TestReduce)
+		{
+			ThreadPool pool(3_z);
+			Vector<int> vector;
+			Assert::AreEqual(7LL, ParallelReduce(vector, 7LL, plus<>{}, pool));
+
+			for (int i = 1; i <= 100000; ++i)
+			{
+				vector.PushBack(i);
+			}
+			Assert::AreEqual(5000050000LL + 7LL, ParallelReduce(vector, 7LL, plus<>{}, pool));
+			Assert::AreEqual(100000, ParallelReduce(vector, 0, [](int a, int b) { return max(a, b); }, pool));
+			Assert::AreEqual(55LL, ParallelReduce(vector.Data(), vector.Data() + 10, 0LL, plus<>{}, pool));
+
+			// Non-trivial results are folded chunk by chunk and then in chunk order, so concatenation keeps the element order.
+			Vector<string> letters;
+			for (int i = 0; i < 20000; ++i)
+			{
+				letters.PushBack(string(1, static_cast<char>('a' + i % 26)));
+			}
+			const string joined = ParallelReduce(letters, string(">"), plus<>{}, pool);
+			Assert::AreEqual(20001_z, joined.size());
+			Assert::AreEqual(">abc"s, joined.substr(0, 4));
+			Assert::AreEqual('a' + 19999 % 26, static_cast<int>(joined.back()));
+		}
+
+		TEST_METHOD(TestSort)
+		{
+			ThreadPool pool(3_z);
+			mt19937 random(12345);
+			for (const size_t count : { 0_z, 1_z, 1000_z, 100000_z, 100003_z })
+			{
+				Vector<int> vector;
+				for (size_t i = 0; i < count; ++i)
+				{
+					vector.PushBack(static_cast<int>(random() % 1000));
+				}
+
+				ParallelSort(vector, less<>{}, pool);
+				Assert::IsTrue(is_sorted(vector.Data(), vector.Data() + vector.Size()));
+
+				ParallelSort(vector, greater<>{}, pool);
+				Assert::IsTrue(is_sorted(vector.Data(), vector.Data() + vector.Size(), greater<>{}));
+			}
+
+			// Move-only elements are moved, never copied.
+			Vector<unique_ptr<Foo>> foos;
+			for (int i = 0; i < 20000; ++i)
+			{
+				foos.PushBack(make_unique<Foo>(static_cast<int>(random() % 5000)));
+			}
+			ParallelSort(foos, [](const unique_ptr<Foo>& lhs, const unique_ptr<Foo>& rhs) { return lhs->Data() < rhs->Data(); }, pool);
+			for (size_t i = 1; i < foos.Size(); ++i)
+			{
+				Assert::IsTrue(foos[i - 1]->Data() <= foos[i]->Data());
+			}
+		}
+
+		TEST_METHOD(TestPartition)
+		{
+			ThreadPool pool(3_z);
+			mt19937 random(54321);
+			for (const size_t count : { 0_z, 5_z, 100000_z, 100003_z })
+			{
+				Vector<int> vector;
+				long long sum = 0;
+				for (size_t i = 0; i < count; ++i)
+				{
+					vector.PushBack(static_cast<int>(random() % 1000));
+					sum += vector.Back();
+				}
+
+				const auto isEven = [](int value) { return value % 2 == 0; };
+				auto partitionPoint = ParallelPartition(vector, isEven, pool);
+				const size_t evenCount = static_cast<size_t>(count_if(vector.Data(), vector.Data() + vector.Size(), isEven));
+				Assert::IsTrue(partitionPoint == vector.begin() + evenCount);
+				Assert::IsTrue(is_partitioned(vector.Data(), vector.Data() + vector.Size(), isEven));
+				Assert::AreEqual(sum, accumulate(vector.Data(), vector.Data() + vector.Size(), 0LL));
+			}
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ParallelAlgorithmsTests::sStartMemState;
+}
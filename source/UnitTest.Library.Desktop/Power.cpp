@@ -11,9 +11,9 @@ namespace UnitTests
 
 	}
 
-	const FIEAGameEngine::Vector<FIEAGameEngine::Signature> Power::Signatures()
+	const FIEAGameEngine::SignatureList Power::Signatures()
 	{
-		return FIEAGameEngine::Vector<FIEAGameEngine::Signature>
+		return FIEAGameEngine::SignatureList
 		{
 			{"Name"s, FIEAGameEngine::Datum::DatumTypes::String, 1, offsetof(Power, Name) },
 			{ "Dps"s, FIEAGameEngine::Datum::DatumTypes::Float, 1, offsetof(Power, Dps) }
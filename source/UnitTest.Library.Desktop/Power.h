@@ -68,7 +68,7 @@ namespace UnitTests
 		/// Provides the Signatures Vector for an Power with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an Power.</returns>
-		static const FIEAGameEngine::Vector<FIEAGameEngine::Signature> Signatures();
+		static const FIEAGameEngine::SignatureList Signatures();
 	};
 
 	ConcreteFactory(Power, FIEAGameEngine::Scope)
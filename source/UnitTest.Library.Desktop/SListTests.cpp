@@ -1,6 +1,7 @@
 #include "pch.h"
 #include <crtdbg.h>
 #include <CppUnitTest.h>
+#include <memory>
 #include "ToStringSpecialization.h"
 #include "SList.h"
 #include "Foo.h"
@@ -792,6 +793,79 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		/// <summary>
+		/// Tests SpliceFront()
+		/// Moves nodes between two lists and checks that sizes, front/back, and element addresses are preserved.
+		/// </summary>
+		TEST_METHOD(TestSpliceFront)
+		{
+			{
+				const Foo a(10);
+				const Foo b(20);
+
+				SList<Foo> source;
+				SList<Foo> destination;
+				Assert::ExpectException<exception>([&destination, &source] { destination.SpliceFront(source); }, L"Expected an exception, but none was thrown");
+
+				source.PushBack(a);
+				source.PushBack(b);
+				const Foo* address = &source.Front();
+
+				SList<Foo>::Iterator it = destination.SpliceFront(source);
+				Assert::AreEqual(1_z, source.Size());
+				Assert::AreEqual(1_z, destination.Size());
+				Assert::AreEqual(a, *it);
+				Assert::AreEqual(a, destination.Back());
+				Assert::IsTrue(address == &destination.Front());
+				Assert::AreEqual(b, source.Front());
+
+				destination.SpliceFront(source);
+				Assert::IsTrue(source.IsEmpty());
+				Assert::AreEqual(2_z, destination.Size());
+				Assert::AreEqual(b, destination.Front());
+				Assert::AreEqual(a, destination.Back());
+
+				// The emptied list is still usable.
+				source.PushBack(a);
+				Assert::AreEqual(a, source.Back());
+			}
+
+			{
+				const Foo a(10);
+				const Foo b(20);
+				const Foo c(30);
+
+				SList<Foo> source;
+				source.PushBack(a);
+				source.PushBack(b);
+				source.PushBack(c);
+				SList<Foo> destination;
+				Assert::ExpectException<exception>([&destination, &source] { destination.SpliceFront(source, destination.begin()); }, L"Expected an exception, but none was thrown");
+				Assert::ExpectException<exception>([&destination, &source] { destination.SpliceFront(source, source.end()); }, L"Expected an exception, but none was thrown");
+
+				// Any node can be spliced; the back of the source is kept up to date.
+				const Foo* address = &source.Back();
+				SList<Foo>::Iterator it = destination.SpliceFront(source, source.Find(c));
+				Assert::IsTrue(address == &*it);
+				Assert::AreEqual(2_z, source.Size());
+				Assert::AreEqual(b, source.Back());
+
+				destination.SpliceFront(source, source.Find(a));
+				Assert::AreEqual(1_z, source.Size());
+				Assert::AreEqual(b, source.Front());
+				Assert::AreEqual(b, source.Back());
+				Assert::AreEqual(a, destination.Front());
+				Assert::AreEqual(c, destination.Back());
+
+				destination.SpliceFront(source, source.begin());
+				Assert::IsTrue(source.IsEmpty());
+				Assert::AreEqual(3_z, destination.Size());
+				Assert::AreEqual(b, destination.Front());
+				source.PushBack(a);
+				Assert::AreEqual(a, source.Front());
+			}
+		}
+
 		/// <summary>
 		/// Tests Front() and PushFront()
 		/// Creates a list and pushes 3 elements onto the front, checking that the size increments and that Front() gives the newly pushed element.
@@ -988,6 +1062,40 @@ namespace UnitTestLibraryDesktop
 #pragma endregion 
 
 
+		TEST_METHOD(TestEmplace)
+		{
+			SList<pair<int, string>> list;
+			auto it = list.EmplaceFront(2, "two");
+			Assert::AreEqual("two"s, it->second);
+			list.EmplaceFront(1, "one");
+			it = list.EmplaceBack(3, "three");
+			Assert::AreEqual(3, it->first);
+			Assert::AreEqual(3_z, list.Size());
+			Assert::AreEqual(1, list.Front().first);
+			Assert::AreEqual(3, list.Back().first);
+
+			SList<unique_ptr<Foo>> pointers;
+			pointers.EmplaceBack(make_unique<Foo>(1));
+			pointers.EmplaceFront(new Foo(0));
+			Assert::AreEqual(Foo(0), *pointers.Front());
+			Assert::AreEqual(Foo(1), *pointers.Back());
+		}
+
+
+		TEST_METHOD(TestStats)
+		{
+			SList<Foo> list;
+			Assert::AreEqual(0_z, list.Stats()._bytesAllocated);
+
+			list.PushBack(Foo(1));
+			list.PushFront(Foo(2));
+			const ContainerStats stats = list.Stats();
+			Assert::AreEqual(2_z, stats._elementCount);
+			Assert::AreEqual(2 * SList<Foo>::NodeSize, stats._bytesAllocated);
+			Assert::AreEqual(2 * sizeof(Foo), stats._bytesInUse);
+			Assert::IsTrue(stats.BytesOverhead() >= 2 * sizeof(void*));
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -350,6 +350,17 @@ namespace UnitTestLibraryDesktop
 			foundDatum = bScope.Search(c, foundScope);
 			Assert::IsNull(foundDatum);
 
+			// Searches with names that are not std::strings, through two levels of parents
+			Scope& dScope = bScope.AppendScope("D");
+			const Scope& constDScope = dScope;
+			const Scope* constFoundScope = nullptr;
+			Assert::AreEqual(&aDatum, dScope.Search("A"sv));
+			Assert::IsTrue(&aDatum == constDScope.Search("A", constFoundScope));
+			Assert::IsTrue(&scope == constFoundScope);
+			Assert::IsNull(dScope.Search("C"sv));
+			Assert::AreEqual(&aDatum, scope.Find("A"sv));
+			Assert::AreEqual(&aDatum, &scope["A"sv]);
+
 			Scope newScope;
 			newScope.Append("D") = "New Scope";
 			auto result = scope.FindContainedScope(newScope);
@@ -572,6 +583,29 @@ namespace UnitTestLibraryDesktop
 		}
 
 
+		TEST_METHOD(TestAppendRvalue)
+		{
+			Scope scope;
+			string name = "Health";
+			Datum& datum = scope.Append(std::move(name));
+			datum = 100;
+			Assert::IsTrue(&datum == scope.Find("Health"));
+			Assert::AreEqual(1_z, scope.Size());
+
+			// An existing name is neither moved from nor inserted again.
+			string again = "Health";
+			Assert::IsTrue(&datum == &scope.Append(std::move(again)));
+			Assert::AreEqual("Health"s, again);
+			Assert::AreEqual(1_z, scope.Size());
+
+			Assert::IsTrue(&scope["Health"] == &datum);
+			scope["Armor"] = 5;
+			Assert::AreEqual(2_z, scope.Size());
+			Assert::IsTrue(scope[1] == scope["Armor"]);
+
+			Assert::ExpectException<invalid_argument>([&scope] { scope.Append(string()); });
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
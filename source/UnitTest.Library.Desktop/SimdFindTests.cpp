@@ -0,0 +1,214 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <limits>
+#include "ToStringSpecialization.h"
+#include "SimdFind.h"
+#include "Vector.h"
+#include "SmallVector.h"
+#include "Datum.h"
+#include "Foo.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SimdFindTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestSupportedSimdLevel)
+		{
+			const SimdLevel level = SupportedSimdLevel();
+			Assert::IsTrue(level == SupportedSimdLevel());
+#if defined(_M_X64) || defined(__x86_64__)
+			Assert::IsTrue(level >= SimdLevel::SSE2);
+#endif
+		}
+
+		TEST_METHOD(TestFindInt)
+		{
+			// Every length up to a few full blocks, with the match in every position, exercises both the blocks and the leftover elements.
+			int data[40];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 40_z; ++count)
+				{
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						data[i] = static_cast<int>(i) * 3;
+					}
+					Assert::AreEqual(count, SimdFind(data, count, -1, level));
+
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						Assert::AreEqual(i, SimdFind(data, count, static_cast<int>(i) * 3, level));
+					}
+
+					// The first of several matches is found.
+					if (count >= 2_z)
+					{
+						data[count - 1_z] = data[count / 2_z];
+						Assert::AreEqual(count / 2_z, SimdFind(data, count, data[count / 2_z], level));
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestFindFloat)
+		{
+			float data[40];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 40_z; ++count)
+				{
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						data[i] = static_cast<float>(i) + 0.5f;
+					}
+					Assert::AreEqual(count, SimdFind(data, count, -1.0f, level));
+
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						Assert::AreEqual(i, SimdFind(data, count, static_cast<float>(i) + 0.5f, level));
+					}
+				}
+
+				// Matches as operator== does: NaN never matches, and -0 matches +0.
+				const float nan = numeric_limits<float>::quiet_NaN();
+				for (size_t i = 0_z; i < 40_z; ++i)
+				{
+					data[i] = nan;
+				}
+				Assert::AreEqual(40_z, SimdFind(data, 40_z, nan, level));
+				data[17] = -0.0f;
+				Assert::AreEqual(17_z, SimdFind(data, 40_z, 0.0f, level));
+			}
+		}
+
+		TEST_METHOD(TestFindVec4)
+		{
+			glm::vec4 data[20];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 20_z; ++count)
+				{
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						const float component = static_cast<float>(i);
+						data[i] = glm::vec4(component, component + 1.0f, component + 2.0f, component + 3.0f);
+					}
+					Assert::AreEqual(count, SimdFind(data, count, glm::vec4(-1.0f), level));
+
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						Assert::AreEqual(i, SimdFind(data, count, data[i], level));
+
+						// Three of four components matching is not a match.
+						glm::vec4 partial = data[i];
+						partial.w = -1.0f;
+						Assert::AreEqual(count, SimdFind(data, count, partial, level));
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestFindPointer)
+		{
+			Foo foos[20];
+			const Foo* data[20];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 20_z; ++count)
+				{
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						data[i] = &foos[i];
+					}
+					Assert::AreEqual(count, SimdFind(data, count, static_cast<const Foo*>(nullptr), level));
+
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						Assert::AreEqual(i, SimdFind(data, count, static_cast<const Foo*>(&foos[i]), level));
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestContainers)
+		{
+			static_assert(IsSimdFindable<int> && IsSimdFindable<float> && IsSimdFindable<glm::vec4> && IsSimdFindable<Foo*>);
+			static_assert(!IsSimdFindable<RTTI*> && !IsSimdFindable<const char*> && !IsSimdFindable<Foo> && !IsSimdFindable<double>);
+
+			{
+				Vector<int> vector;
+				for (int i = 0; i < 100; ++i)
+				{
+					vector.PushBack(i);
+				}
+				Assert::AreEqual(37, *vector.Find(37));
+				Assert::IsTrue(vector.Find(100) == vector.end());
+
+				const Vector<int>& constVector = vector;
+				Assert::IsTrue(constVector.Find(99) == --constVector.end());
+				Assert::IsTrue(vector.Remove(50));
+				Assert::IsTrue(vector.Find(50) == vector.end());
+				Assert::AreEqual(51, *vector.Find(51));
+			}
+
+			{
+				Foo foos[3];
+				Vector<Foo*> vector{ &foos[0], &foos[1], &foos[2] };
+				Assert::IsTrue(vector.Find(&foos[1]) == ++vector.begin());
+
+				SmallVector<Foo*, 4> smallVector{ &foos[0], &foos[1], &foos[2] };
+				Assert::IsTrue(smallVector.Find(&foos[2]) == --smallVector.end());
+				Assert::IsTrue(smallVector.Find(nullptr) == smallVector.end());
+			}
+
+			{
+				Datum datum;
+				datum.SetType(Datum::DatumTypes::Vector);
+				for (int i = 0; i < 20; ++i)
+				{
+					datum.PushBack(glm::vec4(static_cast<float>(i)));
+				}
+				Assert::AreEqual(13_z, datum.IndexOf(glm::vec4(13.0f)));
+
+				Datum floats;
+				floats.SetType(Datum::DatumTypes::Float);
+				for (int i = 0; i < 20; ++i)
+				{
+					floats.PushBack(static_cast<float>(i));
+				}
+				Assert::AreEqual(19_z, floats.IndexOf(19.0f));
+			}
+		}
+
+	private:
+		inline static _CrtMemState sStartMemState;
+	};
+}
@@ -0,0 +1,274 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include "ToStringSpecialization.h"
+#include "SimdMath.h"
+#include "SizeLiteral.h"
+#include <glm/gtx/string_cast.hpp>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<glm::vec4>(const glm::vec4& t)
+	{
+		try
+		{
+			return ToString(glm::to_string(t));
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+}
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SimdMathTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		// Every length up to a few full registers exercises both the vector loops and the leftover elements.
+		// The values are small integers and halves, so every kernel's result is exact and can be compared with ==.
+
+		TEST_METHOD(TestScale)
+		{
+			float data[40];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 40_z; ++count)
+				{
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						data[i] = static_cast<float>(i);
+					}
+
+					SimdScale(data, count, 0.5f, level);
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						Assert::AreEqual(i < count ? static_cast<float>(i) * 0.5f : static_cast<float>(i), data[i]);
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestAddAndMultiplyAdd)
+		{
+			float destination[40];
+			float source[40];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 40_z; ++count)
+				{
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						destination[i] = static_cast<float>(i);
+						source[i] = 100.0f - static_cast<float>(i);
+					}
+
+					SimdAdd(destination, source, count, level);
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						Assert::AreEqual(i < count ? 100.0f : static_cast<float>(i), destination[i]);
+					}
+
+					SimdMultiplyAdd(destination, source, -2.0f, count, level);
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						Assert::AreEqual(i < count ? 2.0f * static_cast<float>(i) - 100.0f : static_cast<float>(i), destination[i]);
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestLerp)
+		{
+			float destination[40];
+			float target[40];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 40_z; ++count)
+				{
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						destination[i] = static_cast<float>(i);
+						target[i] = static_cast<float>(i) + 8.0f;
+					}
+
+					SimdLerp(destination, target, 0.25f, count, level);
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						Assert::AreEqual(i < count ? static_cast<float>(i) + 2.0f : static_cast<float>(i), destination[i]);
+					}
+
+					SimdLerp(destination, target, 1.0f, count, level);
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						Assert::AreEqual(target[i], destination[i]);
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestClamp)
+		{
+			float data[40];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 40_z; ++count)
+				{
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						data[i] = static_cast<float>(i) - 20.0f;
+					}
+
+					SimdClamp(data, count, -5.0f, 5.5f, level);
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						const float original = static_cast<float>(i) - 20.0f;
+						Assert::AreEqual(i < count ? std::min(std::max(original, -5.0f), 5.5f) : original, data[i]);
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestTransform)
+		{
+			const glm::mat4 matrix(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+			glm::vec4 data[9];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 9_z; ++count)
+				{
+					for (size_t i = 0_z; i < 9_z; ++i)
+					{
+						const float value = static_cast<float>(i);
+						data[i] = glm::vec4(value, -value, 2.0f, 1.0f);
+					}
+
+					SimdTransform(data, count, matrix, level);
+					for (size_t i = 0_z; i < 9_z; ++i)
+					{
+						const float value = static_cast<float>(i);
+						const glm::vec4 original(value, -value, 2.0f, 1.0f);
+						Assert::AreEqual(i < count ? matrix * original : original, data[i]);
+					}
+				}
+			}
+
+			// Transforming the columns of a matrix is the matrix product.
+			glm::mat4 product = matrix;
+			SimdTransform(&product[0], 4_z, matrix);
+			Assert::IsTrue(product == matrix * matrix);
+		}
+
+		TEST_METHOD(TestReductions)
+		{
+			float data[40];
+			glm::vec4 vectors[9];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				Assert::AreEqual(0.0f, SimdSum(data, 0_z, level));
+				Assert::AreEqual(glm::vec4(0.0f), SimdSum(vectors, 0_z, level));
+
+				for (size_t count = 1_z; count <= 40_z; ++count)
+				{
+					float total = 0.0f;
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						data[i] = static_cast<float>(i % 2 == 0 ? i : count - i);
+						total += data[i];
+					}
+					Assert::AreEqual(total, SimdSum(data, count, level));
+
+					// The least and greatest elements, in every position.
+					for (size_t position = 0_z; position < count; ++position)
+					{
+						const float saved = data[position];
+						data[position] = -1000.0f;
+						Assert::AreEqual(-1000.0f, SimdMin(data, count, level));
+						data[position] = 1000.0f;
+						Assert::AreEqual(1000.0f, SimdMax(data, count, level));
+						data[position] = saved;
+					}
+				}
+
+				for (size_t count = 1_z; count <= 9_z; ++count)
+				{
+					glm::vec4 total(0.0f);
+					for (size_t i = 0_z; i < count; ++i)
+					{
+						const float value = static_cast<float>(i);
+						vectors[i] = glm::vec4(value, 1.0f, -value, 0.5f);
+						total += vectors[i];
+					}
+					Assert::AreEqual(total, SimdSum(vectors, count, level));
+				}
+			}
+		}
+
+		TEST_METHOD(TestConvert)
+		{
+			int ints[40];
+			float floats[40];
+			for (const SimdLevel level : { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (size_t count = 0_z; count <= 40_z; ++count)
+				{
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						ints[i] = static_cast<int>(i) - 20;
+						floats[i] = -1.0f;
+					}
+
+					SimdConvert(ints, floats, count, level);
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						Assert::AreEqual(i < count ? static_cast<float>(ints[i]) : -1.0f, floats[i]);
+					}
+
+					// Fractions round towards zero, as static_cast does.
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						floats[i] = static_cast<float>(i) * 0.75f - 15.0f;
+						ints[i] = -1;
+					}
+
+					SimdConvert(floats, ints, count, level);
+					for (size_t i = 0_z; i < 40_z; ++i)
+					{
+						Assert::AreEqual(i < count ? static_cast<int>(floats[i]) : -1, ints[i]);
+					}
+				}
+			}
+		}
+
+	private:
+		inline static _CrtMemState sStartMemState;
+	};
+}
@@ -0,0 +1,343 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <memory>
+#include "ToStringSpecialization.h"
+#include "SmallVector.h"
+#include "Foo.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<SmallVector<Foo, 4>::Iterator>(const SmallVector<Foo, 4>::Iterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<SmallVector<Foo, 4>::ConstIterator>(const SmallVector<Foo, 4>::ConstIterator& t)
+	{
+		try
+		{
+			return ToString(*t);
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+}
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SmallVectorTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestSpecialMembers)
+		{
+			const Foo a(10);
+			const Foo b(20);
+			const Foo c(30);
+
+			{
+				SmallVector<Foo, 4> vector1;
+				Assert::AreEqual(4_z, vector1.Capacity());
+				Assert::IsTrue(vector1.IsInline());
+				Assert::IsTrue(vector1.IsEmpty());
+
+				SmallVector<Foo, 4> vector2(10_z);
+				Assert::AreEqual(10_z, vector2.Capacity());
+				Assert::IsFalse(vector2.IsInline());
+			}
+
+			{
+				SmallVector<Foo, 4> inlineVector{ a, b, c };
+				Assert::IsTrue(inlineVector.IsInline());
+				SmallVector<Foo, 4> heapVector{ a, b, c, a, b, c };
+				Assert::IsFalse(heapVector.IsInline());
+
+				// Copy constructor
+				SmallVector<Foo, 4> copy1(inlineVector);
+				Assert::IsTrue(copy1.IsInline());
+				Assert::AreEqual(3_z, copy1.Size());
+				Assert::AreEqual(c, copy1[2]);
+				SmallVector<Foo, 4> copy2(heapVector);
+				Assert::IsFalse(copy2.IsInline());
+				Assert::AreEqual(6_z, copy2.Size());
+				Assert::AreEqual(c, copy2[5]);
+
+				// Copy assignment
+				copy1 = heapVector;
+				Assert::AreEqual(6_z, copy1.Size());
+				Assert::AreEqual(a, copy1[3]);
+				copy2 = inlineVector;
+				Assert::AreEqual(3_z, copy2.Size());
+				Assert::AreEqual(b, copy2[1]);
+				copy2 = copy2;
+				Assert::AreEqual(3_z, copy2.Size());
+			}
+
+			{
+				// Move constructor from inline storage moves the elements one by one
+				SmallVector<Foo, 4> inlineVector{ a, b, c };
+				SmallVector<Foo, 4> moved1(std::move(inlineVector));
+				Assert::IsTrue(moved1.IsInline());
+				Assert::AreEqual(3_z, moved1.Size());
+				Assert::AreEqual(a, moved1[0]);
+				Assert::AreEqual(0_z, inlineVector.Size());
+				Assert::ExpectException<exception>([&inlineVector] { inlineVector.At(0); }, L"Expected an exception, but none was thrown");
+
+				// Move constructor from the heap steals the buffer
+				SmallVector<Foo, 4> heapVector{ a, b, c, a, b };
+				const Foo* heapData = &heapVector[0];
+				SmallVector<Foo, 4> moved2(std::move(heapVector));
+				Assert::IsTrue(heapData == &moved2[0]);
+				Assert::AreEqual(5_z, moved2.Size());
+				Assert::IsTrue(heapVector.IsInline());
+				Assert::AreEqual(4_z, heapVector.Capacity());
+				Assert::IsTrue(heapVector.IsEmpty());
+
+				// Move assignment in both directions
+				moved2 = std::move(moved1);
+				Assert::IsTrue(moved2.IsInline());
+				Assert::AreEqual(3_z, moved2.Size());
+				Assert::AreEqual(c, moved2[2]);
+
+				SmallVector<Foo, 4> heapVector2{ c, b, a, c, b, a };
+				moved1 = std::move(heapVector2);
+				Assert::IsFalse(moved1.IsInline());
+				Assert::AreEqual(6_z, moved1.Size());
+				Assert::AreEqual(c, moved1[0]);
+				Assert::IsTrue(heapVector2.IsEmpty());
+			}
+		}
+
+		TEST_METHOD(TestPushBackSpillsToHeap)
+		{
+			SmallVector<Foo, 4> vector;
+			for (int i = 0; i < 4; ++i)
+			{
+				vector.PushBack(Foo(i));
+			}
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(4_z, vector.Capacity());
+
+			auto first = vector.begin();
+			const Foo fifth(4);
+			auto it = vector.PushBack(fifth);
+			Assert::IsFalse(vector.IsInline());
+			Assert::AreEqual(8_z, vector.Capacity());
+			Assert::AreEqual(5_z, vector.Size());
+			Assert::AreEqual(fifth, *it);
+			// Iterators hold an index, so they survive the move to the heap
+			Assert::AreEqual(Foo(0), *first);
+
+			for (int i = 0; i < 5; ++i)
+			{
+				Assert::AreEqual(Foo(i), vector[i]);
+			}
+
+			vector.PopBack();
+			Assert::AreEqual(Foo(3), vector.Back());
+			Assert::AreEqual(Foo(0), vector.Front());
+			vector.Clear();
+			Assert::IsTrue(vector.IsEmpty());
+			Assert::ExpectException<exception>([&vector] { vector.Front(); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&vector] { vector.Back(); }, L"Expected an exception, but none was thrown");
+
+			const SmallVector<Foo, 4>& constVector = vector;
+			Assert::ExpectException<exception>([&constVector] { constVector.Front(); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constVector] { constVector.Back(); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constVector] { constVector[0]; }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestReserveResizeShrinkToFit)
+		{
+			SmallVector<Foo, 4> vector;
+			vector.Reserve(2_z);
+			Assert::AreEqual(4_z, vector.Capacity());
+			Assert::IsTrue(vector.IsInline());
+
+			vector.Resize(3_z);
+			Assert::AreEqual(3_z, vector.Size());
+			Assert::IsTrue(vector.IsInline());
+			vector.Resize(10_z);
+			Assert::AreEqual(10_z, vector.Size());
+			Assert::IsFalse(vector.IsInline());
+
+			vector.Reserve(20_z);
+			vector.ShrinkToFit();
+			Assert::AreEqual(10_z, vector.Capacity());
+			Assert::IsFalse(vector.IsInline());
+
+			vector[0] = Foo(42);
+			vector.Resize(2_z);
+			vector.ShrinkToFit();
+			Assert::IsTrue(vector.IsInline());
+			Assert::AreEqual(4_z, vector.Capacity());
+			Assert::AreEqual(Foo(42), vector[0]);
+
+			vector.ShrinkToFit();
+			Assert::IsTrue(vector.IsInline());
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			SmallVector<Foo, 4> vector{ Foo(1), Foo(2), Foo(3), Foo(4), Foo(5) };
+
+			int expected = 1;
+			for (const Foo& foo : vector)
+			{
+				Assert::AreEqual(Foo(expected++), foo);
+			}
+			Assert::AreEqual(6, expected);
+
+			auto it = vector.begin();
+			Assert::AreEqual(Foo(2), *(++it));
+			Assert::AreEqual(Foo(2), *(it++));
+			Assert::AreEqual(Foo(3), *it);
+			Assert::AreEqual(Foo(3), *(it--));
+			Assert::AreEqual(Foo(1), *(--it));
+			Assert::AreEqual(Foo(4), *(it + 3));
+			Assert::AreEqual(Foo(3), *((it + 3) - 1));
+			Assert::AreEqual(1, it->Data());
+			Assert::AreEqual(vector.end(), vector.begin() + 5);
+
+			const SmallVector<Foo, 4>& constVector = vector;
+			auto constIt = constVector.begin();
+			Assert::AreEqual(Foo(2), *(++constIt));
+			Assert::AreEqual(Foo(2), *(constIt++));
+			Assert::AreEqual(Foo(3), *(constIt--));
+			Assert::AreEqual(Foo(1), *(--constIt));
+			Assert::AreEqual(Foo(5), *(constIt + 4));
+			Assert::AreEqual(Foo(4), *((constIt + 4) - 1));
+			Assert::AreEqual(1, constIt->Data());
+			Assert::AreEqual(constVector.cend(), SmallVector<Foo, 4>::ConstIterator(vector.end()));
+			Assert::AreEqual(vector.cbegin(), constVector.begin());
+
+			auto found = std::find_if(vector.begin(), vector.end(), [](const Foo& foo) { return foo.Data() == 4; });
+			Assert::AreEqual(Foo(4), *found);
+
+			SmallVector<Foo, 4>::Iterator unassociated;
+			SmallVector<Foo, 4>::ConstIterator constUnassociated;
+			Assert::ExpectException<exception>([&unassociated] { ++unassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&unassociated] { --unassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&unassociated] { *unassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&unassociated] { unassociated + 1; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&unassociated] { unassociated - 1; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { ++constUnassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { --constUnassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { *constUnassociated; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { constUnassociated + 1; }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&constUnassociated] { constUnassociated - 1; }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestFindAndRemove)
+		{
+			SmallVector<Foo, 4> vector{ Foo(1), Foo(2), Foo(3), Foo(4), Foo(5), Foo(6) };
+
+			Assert::AreEqual(Foo(3), *vector.Find(Foo(3)));
+			Assert::AreEqual(vector.end(), vector.Find(Foo(7)));
+			const SmallVector<Foo, 4>& constVector = vector;
+			Assert::AreEqual(Foo(3), *constVector.Find(Foo(3)));
+			Assert::AreEqual(constVector.end(), constVector.Find(Foo(7)));
+
+			Assert::IsTrue(vector.Remove(Foo(2)));
+			Assert::IsFalse(vector.Remove(Foo(2)));
+			Assert::AreEqual(5_z, vector.Size());
+			Assert::AreEqual(Foo(3), vector[1]);
+
+			Assert::IsTrue(vector.Remove(vector.begin()));
+			Assert::AreEqual(Foo(3), vector.Front());
+
+			// Removes [4, 5], leaving 3 and 6
+			vector.Remove(vector.begin() + 1, vector.begin() + 3);
+			Assert::AreEqual(2_z, vector.Size());
+			Assert::AreEqual(Foo(3), vector[0]);
+			Assert::AreEqual(Foo(6), vector[1]);
+
+			vector.Remove(vector.begin(), vector.begin());
+			Assert::AreEqual(2_z, vector.Size());
+
+			SmallVector<Foo, 4> other{ Foo(1) };
+			Assert::ExpectException<exception>([&vector, &other] { vector.Remove(other.begin()); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&vector, &other] { vector.Remove(vector.begin(), other.end()); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&vector] { vector.Remove(vector.end(), vector.begin()); }, L"Expected an exception, but none was thrown");
+
+			vector.Remove(vector.begin(), vector.end());
+			Assert::IsTrue(vector.IsEmpty());
+		}
+
+		TEST_METHOD(TestEmplaceBack)
+		{
+			SmallVector<pair<int, string>, 2> vector;
+			vector.EmplaceBack(1, "one");
+			vector.EmplaceBack(2, "two");
+			Assert::IsTrue(vector.IsInline());
+			auto it = vector.EmplaceBack(3, "three");
+			Assert::IsFalse(vector.IsInline());
+			Assert::AreEqual("three"s, it->second);
+			Assert::AreEqual("one"s, vector.Front().second);
+
+			SmallVector<unique_ptr<Foo>, 1> pointers;
+			pointers.EmplaceBack(make_unique<Foo>(1));
+			pointers.EmplaceBack(new Foo(2));
+			Assert::AreEqual(Foo(1), *pointers[0]);
+			Assert::AreEqual(Foo(2), *pointers[1]);
+		}
+
+
+		TEST_METHOD(TestStats)
+		{
+			// Inline elements take nothing from the allocator.
+			SmallVector<int, 4> vector{ 1, 2, 3 };
+			ContainerStats stats = vector.Stats();
+			Assert::AreEqual(3_z, stats._elementCount);
+			Assert::AreEqual(0_z, stats._bytesAllocated);
+			Assert::AreEqual(3 * sizeof(int), stats._bytesInUse);
+
+			vector.Reserve(16);
+			stats = vector.Stats();
+			Assert::AreEqual(16 * sizeof(int), stats._bytesAllocated);
+			Assert::AreEqual(3 * sizeof(int), stats._bytesInUse);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState SmallVectorTests::sStartMemState;
+}
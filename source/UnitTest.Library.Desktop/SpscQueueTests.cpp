@@ -0,0 +1,124 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <string>
+#include <thread>
+#include "ToStringSpecialization.h"
+#include "SpscQueue.h"
+#include "Foo.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SpscQueueTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestPushPop)
+		{
+			SpscQueue<Foo> queue(3);
+			Assert::AreEqual(4_z, queue.Capacity());
+			Assert::IsTrue(queue.IsEmpty());
+
+			Foo popped;
+			Assert::IsFalse(queue.TryPop(popped));
+
+			const Foo one(1);
+			Assert::IsTrue(queue.TryPush(one));
+			Assert::IsTrue(queue.TryPush(Foo(2)));
+			Assert::IsTrue(queue.TryEmplace(3));
+			Assert::IsTrue(queue.TryEmplace(4));
+			Assert::AreEqual(4_z, queue.Size());
+
+			Foo rejected(5);
+			Assert::IsFalse(queue.TryPush(std::move(rejected)));
+			Assert::AreEqual(5, rejected.Data());
+
+			// Keep the positions cycling around the ring.
+			for (int i = 1; i <= 20; ++i)
+			{
+				Assert::IsTrue(queue.TryPop(popped));
+				Assert::AreEqual(Foo(i), popped);
+				Assert::IsTrue(queue.TryEmplace(i + 4));
+			}
+			Assert::AreEqual(4_z, queue.Size());
+
+			SpscQueue<int> single(0);
+			Assert::AreEqual(1_z, single.Capacity());
+			Assert::IsTrue(single.TryPush(1));
+			Assert::IsFalse(single.TryPush(2));
+		}
+
+		TEST_METHOD(TestDestructorReleasesElements)
+		{
+			SpscQueue<string> queue(8);
+			queue.TryPush("a string long enough to live on the heap"s);
+			queue.TryPush("another string long enough to live on the heap"s);
+			string popped;
+			Assert::IsTrue(queue.TryPop(popped));
+			Assert::AreEqual("a string long enough to live on the heap"s, popped);
+		}
+
+		TEST_METHOD(TestTwoThreads)
+		{
+			const int count = 100000;
+			SpscQueue<int> queue(64);
+
+			thread producer([&queue] {
+				for (int i = 0; i < count; ++i)
+				{
+					while (!queue.TryPush(i))
+					{
+						this_thread::yield();
+					}
+				}
+			});
+
+			bool inOrder = true;
+			for (int expected = 0; expected < count;)
+			{
+				int value;
+				if (queue.TryPop(value))
+				{
+					inOrder &= (value == expected);
+					++expected;
+				}
+				else
+				{
+					this_thread::yield();
+				}
+			}
+			producer.join();
+
+			Assert::IsTrue(inOrder);
+			Assert::IsTrue(queue.IsEmpty());
+		}
+
+	private:
+		inline static _CrtMemState sStartMemState;
+	};
+}
@@ -195,6 +195,22 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		/// <summary>
+		/// Tests that Emplace constructs the new top element from its arguments.
+		/// </summary>
+		TEST_METHOD(TestEmplace)
+		{
+			{
+				Stack<pair<int, string>> stack;
+				stack.Emplace(1, "one");
+				pair<int, string>& top = stack.Emplace(2, "two");
+				Assert::AreEqual("two"s, top.second);
+				Assert::AreEqual(2_z, stack.Size());
+				stack.Pop();
+				Assert::AreEqual(1, stack.Top().first);
+			}
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};
@@ -15,9 +15,9 @@ namespace UnitTests
 		Event<FooSubscriber>::Subscribe(*this);
 	}
 
-	const Vector<Signature> TestReaction::Signatures()
+	const SignatureList TestReaction::Signatures()
 	{
-		return Vector<Signature>
+		return SignatureList
 		{
 			{ "Name"s, Datum::DatumTypes::String, 1, offsetof(TestReaction, _name) },
 			{ "Count"s, Datum::DatumTypes::Integer, 1, offsetof(TestReaction, Count) }
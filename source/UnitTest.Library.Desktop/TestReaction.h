@@ -59,12 +59,12 @@ namespace UnitTests
 		/// <summary>
 		/// Test variable to check if notify occured.
 		/// </summary>
-		std::int32_t Count;
+		std::int32_t Count{ 0 };
 		/// <summary>
 		/// Provides the Signatures Vector for an TestReaction with all the prescribed Attributes.
 		/// </summary>
 		/// <returns>The Signatures Vector for an TestReaction.</returns>
-		static const FIEAGameEngine::Vector<FIEAGameEngine::Signature> Signatures();
+		static const FIEAGameEngine::SignatureList Signatures();
 	};
 
 	ConcreteFactory(TestReaction, FIEAGameEngine::Scope)
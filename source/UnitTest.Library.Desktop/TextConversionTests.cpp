@@ -0,0 +1,202 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include "ToStringSpecialization.h"
+#include "TextConversion.h"
+#include "SizeLiteral.h"
+#include <cstring>
+#include <limits>
+#include <glm/gtx/string_cast.hpp>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+using namespace std::string_literals;
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template<>
+	inline std::wstring ToString<glm::vec4>(const glm::vec4& t)
+	{
+		try
+		{
+			return ToString(glm::to_string(t));
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+
+	template<>
+	inline std::wstring ToString<glm::mat4>(const glm::mat4& t)
+	{
+		try
+		{
+			return ToString(glm::to_string(t));
+		}
+		catch (...)
+		{
+			return L"end()";
+		}
+	}
+}
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(TextConversionTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestFormat)
+		{
+			char buffer[TextConversion::MaxMatrixLength];
+
+			Assert::AreEqual("-2147483648"s, string(buffer, TextConversion::Format(numeric_limits<int>::min(), buffer)));
+			Assert::AreEqual("20"s, string(buffer, TextConversion::Format(20, buffer)));
+			Assert::AreEqual("20"s, string(buffer, TextConversion::Format(20.0f, buffer)));
+			Assert::AreEqual("0.1"s, string(buffer, TextConversion::Format(0.1f, buffer)));
+			Assert::AreEqual("-1.5"s, string(buffer, TextConversion::Format(-1.5f, buffer)));
+			Assert::AreEqual("vec4(1, -0.5, 0, 3.25)"s, string(buffer, TextConversion::Format(glm::vec4(1.0f, -0.5f, 0.0f, 3.25f), buffer)));
+			Assert::AreEqual("mat4x4((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (5, 6, 7, 1))"s,
+				string(buffer, TextConversion::Format(glm::mat4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 5, 6, 7, 1), buffer)));
+
+			// The longest values fit the advertised lengths exactly, and a byte less is refused rather than overrun.
+			const float longest = -1.00053455e-36f;
+			Assert::AreEqual(TextConversion::MaxFloatLength, TextConversion::Format(longest, buffer));
+			Assert::AreEqual(TextConversion::MaxVectorLength, TextConversion::Format(glm::vec4(longest), buffer));
+			Assert::AreEqual(TextConversion::MaxMatrixLength, TextConversion::Format(glm::mat4(glm::vec4(longest), glm::vec4(longest), glm::vec4(longest), glm::vec4(longest)), buffer));
+			Assert::ExpectException<exception>([&buffer, longest] { TextConversion::Format(longest, span<char>(buffer, TextConversion::MaxFloatLength - 1)); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&buffer] { TextConversion::Format(glm::vec4(1.0f), span<char>(buffer, 8_z)); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([&buffer] { TextConversion::Format(glm::mat4(1.0f), span<char>(buffer, 40_z)); }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestParse)
+		{
+			Assert::AreEqual(-42, TextConversion::ParseInteger("-42"));
+			Assert::AreEqual(42, TextConversion::ParseInteger(" +42 "));
+			Assert::AreEqual(2.5f, TextConversion::ParseFloat("2.5"));
+			Assert::AreEqual(20.0f, TextConversion::ParseFloat("20.000000"));
+			Assert::AreEqual(1500.0f, TextConversion::ParseFloat("1.5e3"));
+			Assert::AreEqual(-0.25f, TextConversion::ParseFloat("\t-0.25\n"));
+
+			// The format content files use, the one glm::to_string writes, and spacing that differs from both.
+			Assert::AreEqual(glm::vec4(1.0f, 0.0f, 0.0f, 1.0f), TextConversion::ParseVector("vec4(1, 0, 0, 1)"));
+			Assert::AreEqual(glm::vec4(2.0f), TextConversion::ParseVector("vec4(2.000000, 2.000000, 2.000000, 2.000000)"));
+			Assert::AreEqual(glm::vec4(1.0f, -2.0f, 3.5f, 4.0f), TextConversion::ParseVector("  vec4(1,-2 ,  3.5,4 ) "));
+			Assert::AreEqual(glm::mat4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 5, 6, 7, 1), TextConversion::ParseMatrix("mat4x4((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0), (5, 6, 7, 1))"));
+			Assert::AreEqual(glm::mat4(2.0f), TextConversion::ParseMatrix("mat4x4((2.000000, 0.000000, 0.000000, 0.000000), (0.000000, 2.000000, 0.000000, 0.000000), (0.000000, 0.000000, 2.000000, 0.000000), (0.000000, 0.000000, 0.000000, 2.000000))"));
+
+			Assert::ExpectException<exception>([] { TextConversion::ParseInteger(""); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseInteger("12abc"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseInteger("+-12"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseInteger("99999999999"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseFloat("one"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseFloat("1e60"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseVector("vec4(1, 2, 3)"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseVector("vec3(1, 2, 3, 4)"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseVector("vec4(1, 2, 3, 4) extra"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseMatrix("mat4x4((1, 0, 0, 0), (0, 1, 0, 0), (0, 0, 1, 0))"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseMatrix("vec4(1, 0, 0, 1)"); }, L"Expected an exception, but none was thrown");
+		}
+
+		TEST_METHOD(TestRoundTrip)
+		{
+			char buffer[TextConversion::MaxMatrixLength];
+
+			// Values that six fixed decimals, as std::to_string writes, would lose or change.
+			const float values[] = { 0.1f, 1.0f / 3.0f, -2.0f / 7.0f, 1.0e-7f, 3.0e-30f, 1.17549435e-38f, 16777216.0f, numeric_limits<float>::max(), -numeric_limits<float>::max(), 0.0f, -0.0f };
+			for (const float value : values)
+			{
+				const float parsed = TextConversion::ParseFloat(string_view(buffer, TextConversion::Format(value, buffer)));
+				Assert::AreEqual(0, memcmp(&value, &parsed, sizeof(float)));
+			}
+
+			for (int value : { 0, 1, -1, numeric_limits<int>::max(), numeric_limits<int>::min() })
+			{
+				Assert::AreEqual(value, TextConversion::ParseInteger(string_view(buffer, TextConversion::Format(value, buffer))));
+			}
+
+			const glm::vec4 vector(values[0], values[1], values[2], values[3]);
+			Assert::AreEqual(vector, TextConversion::ParseVector(string_view(buffer, TextConversion::Format(vector, buffer))));
+
+			const glm::mat4 matrix(glm::vec4(values[0], values[1], values[2], values[3]), glm::vec4(values[4], values[5], values[6], values[7]), glm::vec4(values[8], values[9], 0.0f, 1.0f), vector);
+			Assert::AreEqual(matrix, TextConversion::ParseMatrix(string_view(buffer, TextConversion::Format(matrix, buffer))));
+		}
+
+		TEST_METHOD(TestCompactTypes)
+		{
+			char buffer[TextConversion::MaxMatrix3Length];
+
+			Assert::AreEqual("true"s, string(buffer, TextConversion::Format(true, buffer)));
+			Assert::AreEqual("false"s, string(buffer, TextConversion::Format(false, buffer)));
+			Assert::AreEqual("vec2(1, -0.5)"s, string(buffer, TextConversion::Format(glm::vec2(1.0f, -0.5f), buffer)));
+			Assert::AreEqual("vec3(1, -0.5, 3.25)"s, string(buffer, TextConversion::Format(glm::vec3(1.0f, -0.5f, 3.25f), buffer)));
+			Assert::AreEqual("quat(1, {0, 0.5, 0})"s, string(buffer, TextConversion::Format(glm::quat(1.0f, 0.0f, 0.5f, 0.0f), buffer)));
+			Assert::AreEqual("mat3x3((1, 0, 0), (0, 1, 0), (5, 6, 1))"s, string(buffer, TextConversion::Format(glm::mat3(1, 0, 0, 0, 1, 0, 5, 6, 1), buffer)));
+
+			// The longest values fit the advertised lengths exactly.
+			const float longest = -1.00053455e-36f;
+			Assert::AreEqual(TextConversion::MaxBooleanLength, TextConversion::Format(false, buffer));
+			Assert::AreEqual(TextConversion::MaxInteger64Length, TextConversion::Format(numeric_limits<std::int64_t>::min(), buffer));
+			Assert::AreEqual(TextConversion::MaxDoubleLength, TextConversion::Format(-2.2250738585072014e-308, buffer));
+			Assert::AreEqual(TextConversion::MaxVector2Length, TextConversion::Format(glm::vec2(longest), buffer));
+			Assert::AreEqual(TextConversion::MaxVector3Length, TextConversion::Format(glm::vec3(longest), buffer));
+			Assert::AreEqual(TextConversion::MaxQuaternionLength, TextConversion::Format(glm::quat(longest, longest, longest, longest), buffer));
+			Assert::AreEqual(TextConversion::MaxMatrix3Length, TextConversion::Format(glm::mat3(glm::vec3(longest), glm::vec3(longest), glm::vec3(longest)), buffer));
+			Assert::ExpectException<exception>([&buffer] { TextConversion::Format(false, span<char>(buffer, 4_z)); }, L"Expected an exception, but none was thrown");
+
+			// Parsing, including the glm::to_string format, and round trips.
+			Assert::IsTrue(TextConversion::ParseBoolean(" true "));
+			Assert::IsFalse(TextConversion::ParseBoolean("false"));
+			Assert::IsTrue(TextConversion::ParseInteger64("-9223372036854775808") == numeric_limits<std::int64_t>::min());
+			Assert::AreEqual(1e300, TextConversion::ParseDouble("1e300"));
+			Assert::IsTrue(TextConversion::ParseVector2("vec2(2.000000, -1.000000)") == glm::vec2(2.0f, -1.0f));
+			Assert::IsTrue(TextConversion::ParseVector3(" vec3(1,2 , 3) ") == glm::vec3(1.0f, 2.0f, 3.0f));
+			Assert::IsTrue(TextConversion::ParseQuaternion("quat(1.000000, {0.000000, 0.000000, 0.000000})") == glm::quat(1.0f, 0.0f, 0.0f, 0.0f));
+			Assert::IsTrue(TextConversion::ParseMatrix3("mat3x3((2, 0, 0), (0, 2, 0), (0, 0, 2))") == glm::mat3(2.0f));
+
+			for (const double value : { 0.1, 1.0 / 3.0, -2.2250738585072014e-308, numeric_limits<double>::max(), 5e-324 })
+			{
+				const double parsed = TextConversion::ParseDouble(string_view(buffer, TextConversion::Format(value, buffer)));
+				Assert::AreEqual(0, memcmp(&value, &parsed, sizeof(double)));
+			}
+
+			const glm::quat rotation(1.0f / 3.0f, 0.1f, -0.2f, 0.7f);
+			Assert::IsTrue(rotation == TextConversion::ParseQuaternion(string_view(buffer, TextConversion::Format(rotation, buffer))));
+
+			Assert::ExpectException<exception>([] { TextConversion::ParseBoolean("True"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseBoolean("truest"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseInteger64("9223372036854775808"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseDouble("1e400"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseVector2("vec3(1, 2, 3)"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseVector3("vec3(1, 2)"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseQuaternion("quat(1, 0, 0, 0)"); }, L"Expected an exception, but none was thrown");
+			Assert::ExpectException<exception>([] { TextConversion::ParseMatrix3("mat4x4((1, 0, 0), (0, 1, 0), (0, 0, 1))"); }, L"Expected an exception, but none was thrown");
+		}
+
+	private:
+		inline static _CrtMemState sStartMemState;
+	};
+}
@@ -0,0 +1,133 @@
+#include "pch.h"
+#include <crtdbg.h>
+#include <CppUnitTest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "ToStringSpecialization.h"
+#include "ThreadPool.h"
+#include "SizeLiteral.h"
+
+using namespace FIEAGameEngine;
+using namespace UnitTests;
+using namespace std;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(ThreadPoolTests)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#ifdef _DEBUG
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#ifdef _DEBUG
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+		}
+
+		TEST_METHOD(TestRun)
+		{
+			for (const size_t workerCount : { 0_z, 1_z, 3_z })
+			{
+				ThreadPool pool(workerCount);
+				Assert::AreEqual(workerCount + 1_z, pool.Concurrency());
+
+				const size_t taskCount = 1000;
+				vector<atomic<int>> hits(taskCount);
+				pool.Run(taskCount, [&hits](size_t task) { ++hits[task]; });
+				for (const atomic<int>& hit : hits)
+				{
+					Assert::AreEqual(1, hit.load());
+				}
+
+				// The pool is reused for job after job.
+				atomic<size_t> sum{ 0 };
+				for (size_t job = 0; job < 50; ++job)
+				{
+					pool.Run(job, [&sum](size_t task) { sum += task; });
+				}
+				Assert::AreEqual(static_cast<size_t>(49 * 50 * 48 / 6), sum.load());
+			}
+		}
+
+		TEST_METHOD(TestNestedRun)
+		{
+			ThreadPool pool(3_z);
+			atomic<size_t> count{ 0 };
+			pool.Run(8_z, [&pool, &count](size_t)
+			{
+				// A task that calls Run again runs the inner job on its own thread instead of waiting on the busy pool.
+				const thread::id outer = this_thread::get_id();
+				pool.Run(8_z, [&count, outer](size_t)
+				{
+					Assert::IsTrue(this_thread::get_id() == outer);
+					++count;
+				});
+			});
+			Assert::AreEqual(64_z, count.load());
+		}
+
+		TEST_METHOD(TestExceptions)
+		{
+			ThreadPool pool(3_z);
+			atomic<size_t> count{ 0 };
+			Assert::ExpectException<runtime_error>([&pool, &count]
+			{
+				pool.Run(100_z, [&count](size_t task)
+				{
+					++count;
+					if (task % 10 == 0)
+					{
+						throw runtime_error("Task failed.");
+					}
+				});
+			});
+			Assert::AreEqual(100_z, count.load());
+
+			// A failed job leaves the pool usable.
+			count = 0;
+			pool.Run(10_z, [&count](size_t) { ++count; });
+			Assert::AreEqual(10_z, count.load());
+		}
+
+		TEST_METHOD(TestConcurrentCallers)
+		{
+			ThreadPool pool(2_z);
+			atomic<size_t> count{ 0 };
+			vector<thread> callers;
+			for (int i = 0; i < 4; ++i)
+			{
+				callers.emplace_back([&pool, &count]
+				{
+					for (int job = 0; job < 20; ++job)
+					{
+						pool.Run(16_z, [&count](size_t) { ++count; });
+					}
+				});
+			}
+			for (thread& caller : callers)
+			{
+				caller.join();
+			}
+			Assert::AreEqual(static_cast<size_t>(4 * 20 * 16), count.load());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+	};
+
+	_CrtMemState ThreadPoolTests::sStartMemState;
+}
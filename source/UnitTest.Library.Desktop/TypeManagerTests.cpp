@@ -22,9 +22,9 @@ namespace UnitTestLibraryDesktop
 		int HitPoints;
 		float Dps;
 
-		static const FIEAGameEngine::Vector<FIEAGameEngine::Signature> Signatures()
+		static const FIEAGameEngine::SignatureList Signatures()
 		{
-			return Vector<Signature>
+			return SignatureList
 			{
 				{"Name"s, Datum::DatumTypes::String, 1, offsetof(Monster, Name) },
 				{ "HitPoints"s, Datum::DatumTypes::Integer, 1, offsetof(Monster, HitPoints) },
@@ -42,9 +42,9 @@ namespace UnitTestLibraryDesktop
 	public:
 		int Grumpiness;
 
-		static const FIEAGameEngine::Vector<FIEAGameEngine::Signature> Signatures()
+		static const FIEAGameEngine::SignatureList Signatures()
 		{
-			return Vector<Signature>
+			return SignatureList
 			{
 				{ "Name"s, Datum::DatumTypes::String, 1, offsetof(Monster, Name) },
 				{ "HitPoints"s, Datum::DatumTypes::Integer, 1, offsetof(Monster, HitPoints) },
@@ -100,7 +100,7 @@ namespace UnitTestLibraryDesktop
 			}
 
 			{
-				Vector<Signature> signatures
+				SignatureList signatures
 				{
 					{"Name"s, Datum::DatumTypes::String, 1, offsetof(Monster, Name) },
 					{"HitPoints"s, Datum::DatumTypes::Integer, 1, offsetof(Monster, HitPoints) },
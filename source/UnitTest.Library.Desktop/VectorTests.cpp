@@ -1,6 +1,7 @@
 #include "pch.h"
 #include <crtdbg.h>
 #include <CppUnitTest.h>
+#include <memory>
 #include "ToStringSpecialization.h"
 #include "Vector.h"
 #include "Foo.h"
@@ -119,6 +120,24 @@ namespace FIEAGameEngine
 
 namespace UnitTestLibraryDesktop
 {
+	/// <summary>
+	/// Points at itself, so it is only valid if the Vector moves it with its move constructor rather than by copying bytes.
+	/// </summary>
+	struct SelfReference final
+	{
+		explicit SelfReference(int value = 0) : Value(value) {}
+		SelfReference(const SelfReference& other) : Value(other.Value) {}
+		SelfReference(SelfReference&& other) noexcept : Value(other.Value) {}
+		SelfReference& operator=(const SelfReference& other) { Value = other.Value; return *this; }
+		SelfReference& operator=(SelfReference&& other) noexcept { Value = other.Value; return *this; }
+		~SelfReference() = default;
+
+		bool IsValid() const { return Self == this; }
+
+		int Value;
+		const SelfReference* Self{ this };
+	};
+
 	struct CustomIncrementStrategy final
 	{
 		size_t operator()(size_t /*size*/, size_t capacity) const
@@ -881,8 +900,106 @@ namespace UnitTestLibraryDesktop
 			vector.ShrinkToFit();
 			Assert::AreEqual(3_z, vector.Capacity());
 		}
+
+		TEST_METHOD(TestRelocation)
+		{
+			static_assert(IsTriviallyRelocatableV<int>);
+			static_assert(IsTriviallyRelocatableV<Foo*>);
+			static_assert(!IsTriviallyRelocatableV<std::string>);
+			static_assert(!IsTriviallyRelocatableV<SelfReference>);
+
+			{
+				Vector<SelfReference> vector;
+				for (int i = 0; i < 100; ++i)
+				{
+					vector.PushBack(SelfReference(i));
+				}
+
+				vector.Remove(vector.begin() + 10);
+				vector.Remove(vector.begin() + 20, vector.begin() + 30);
+				Assert::AreEqual(89_z, vector.Size());
+				vector.ShrinkToFit();
+
+				Vector<SelfReference> copy(vector);
+				copy = vector;
+				for (size_t i = 0; i < vector.Size(); ++i)
+				{
+					const int expected = static_cast<int>(i < 10 ? i : (i < 20 ? i + 1 : i + 11));
+					Assert::AreEqual(expected, vector[i].Value);
+					Assert::IsTrue(vector[i].IsValid());
+					Assert::IsTrue(copy[i].IsValid());
+				}
+			}
+
+			{
+				Vector<std::string> vector;
+				for (int i = 0; i < 100; ++i)
+				{
+					vector.PushBack(std::to_string(i) + " is long enough to need a heap allocation");
+				}
+
+				vector.Remove(vector.begin());
+				vector.Remove(vector.begin(), vector.begin() + 9);
+				vector.ShrinkToFit();
+				Assert::AreEqual(90_z, vector.Capacity());
+				Assert::AreEqual("10 is long enough to need a heap allocation"s, vector.Front());
+				Assert::AreEqual("99 is long enough to need a heap allocation"s, vector.Back());
+
+				Vector<int> integers{ 1, 2, 3, 4, 5 };
+				integers.Remove(integers.begin() + 1, integers.begin() + 3);
+				Vector<int> copy(integers);
+				Assert::AreEqual(3_z, copy.Size());
+				Assert::AreEqual(1, copy[0]);
+				Assert::AreEqual(4, copy[1]);
+				Assert::AreEqual(5, copy[2]);
+			}
+		}
 #pragma endregion
 
+		TEST_METHOD(TestEmplaceBack)
+		{
+			Vector<pair<int, string>> vector;
+			for (int i = 0; i < 20; ++i)
+			{
+				auto it = vector.EmplaceBack(i, to_string(i));
+				Assert::AreEqual(to_string(i), (*it).second);
+			}
+			Assert::AreEqual(20_z, vector.Size());
+			Assert::AreEqual(7, vector[7].first);
+
+			Vector<unique_ptr<Foo>> pointers;
+			pointers.EmplaceBack(make_unique<Foo>(1));
+			pointers.EmplaceBack(new Foo(2));
+			pointers.EmplaceBack();
+			Assert::AreEqual(3_z, pointers.Size());
+			Assert::AreEqual(Foo(2), *pointers[1]);
+			Assert::IsNull(pointers.Back().get());
+		}
+
+
+		TEST_METHOD(TestStats)
+		{
+			Vector<Foo> vector(10);
+			ContainerStats stats = vector.Stats();
+			Assert::AreEqual(0_z, stats._elementCount);
+			Assert::AreEqual(10 * sizeof(Foo), stats._bytesAllocated);
+			Assert::AreEqual(0_z, stats._bytesInUse);
+
+			vector.PushBack(Foo(1));
+			vector.PushBack(Foo(2));
+			stats = vector.Stats();
+			Assert::AreEqual(2_z, stats._elementCount);
+			Assert::AreEqual(2 * sizeof(Foo), stats._bytesInUse);
+			Assert::AreEqual(8 * sizeof(Foo), stats.BytesOverhead());
+
+			vector.ShrinkToFit();
+			Assert::AreEqual(0_z, vector.Stats().BytesOverhead());
+
+			stats += vector.Stats();
+			Assert::AreEqual(4_z, stats._elementCount);
+			Assert::AreEqual(12 * sizeof(Foo), stats._bytesAllocated);
+		}
+
 	private:
 		static _CrtMemState sStartMemState;
 	};